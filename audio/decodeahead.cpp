@@ -0,0 +1,322 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/decodeahead.h"
+#include "audio/audiostream.h"
+
+#include "common/array.h"
+#include "common/atomic.h"
+#include "common/mutex.h"
+#include "common/singleton.h"
+#include "common/system.h"
+#include "common/util.h"
+
+namespace Audio {
+
+enum {
+	// Samples decoded at once by the decode thread
+	kDecodeChunkSize = 4096,
+	// Time the decode thread sleeps when all the rings are full, in milliseconds
+	kDecodeIdleDelay = 5
+};
+
+class DecodeAheadAudioStream : public SeekableAudioStream {
+public:
+	DecodeAheadAudioStream(SeekableAudioStream *parent, DisposeAfterUse::Flag disposeAfterUse, uint bufferMillis);
+	~DecodeAheadAudioStream();
+
+	int readBuffer(int16 *buffer, const int numSamples);
+	bool isStereo() const { return _stereo; }
+	int getRate() const { return _rate; }
+	bool endOfData() const;
+
+	bool seek(const Timestamp &where);
+	Timestamp getLength() const { return _length; }
+
+	/**
+	 * Decode the next chunk of samples into the ring, if it has room for it.
+	 * Called by the decode thread.
+	 *
+	 * @return true if samples were decoded
+	 */
+	bool decodeAhead();
+
+private:
+	void updateParentEnded();
+
+	Common::DisposablePtr<SeekableAudioStream> _parent;
+	// Protects _parent, which both the decode thread and the reader use
+	Common::Mutex _mutex;
+
+	const bool _stereo;
+	const int _rate;
+	const Timestamp _length;
+
+	// The decode thread writes to the ring, the reader reads from it
+	DecodeAheadRing _ring;
+	// Whether the parent stream has no samples left to decode
+	volatile int32 _parentEnded;
+};
+
+/**
+ * Owner of the thread decoding ahead the samples of all the decode-ahead streams.
+ * The thread runs as long as there is at least one such stream.
+ */
+class DecodeAheadManager : public Common::Singleton<DecodeAheadManager> {
+public:
+	void addStream(DecodeAheadAudioStream *stream);
+	void removeStream(DecodeAheadAudioStream *stream);
+
+private:
+	friend class Common::Singleton<SingletonBaseType>;
+	DecodeAheadManager() : _thread(0), _quit(false) {}
+
+	static int threadEntry(void *param);
+	void run();
+
+	// Serializes addStream() and removeStream(), so that the thread is never
+	// started while it is being stopped
+	Common::Mutex _threadMutex;
+	OSystem::ThreadRef _thread;
+
+	// Protects _streams and _quit, and is held while the thread decodes
+	Common::Mutex _streamsMutex;
+	Common::Array<DecodeAheadAudioStream *> _streams;
+	bool _quit;
+};
+
+void DecodeAheadManager::addStream(DecodeAheadAudioStream *stream) {
+	Common::StackLock threadLock(_threadMutex);
+	Common::StackLock streamsLock(_streamsMutex);
+
+	_streams.push_back(stream);
+	if (!_thread) {
+		_quit = false;
+		_thread = g_system->createThread(threadEntry, this);
+	}
+}
+
+void DecodeAheadManager::removeStream(DecodeAheadAudioStream *stream) {
+	Common::StackLock threadLock(_threadMutex);
+
+	bool stopThread = false;
+	{
+		Common::StackLock streamsLock(_streamsMutex);
+		for (uint i = 0; i < _streams.size(); i++) {
+			if (_streams[i] == stream) {
+				_streams.remove_at(i);
+				break;
+			}
+		}
+		if (_streams.empty() && _thread) {
+			_quit = true;
+			stopThread = true;
+		}
+	}
+
+	if (stopThread) {
+		g_system->waitThread(_thread);
+		_thread = 0;
+	}
+}
+
+int DecodeAheadManager::threadEntry(void *param) {
+	((DecodeAheadManager *)param)->run();
+	return 0;
+}
+
+void DecodeAheadManager::run() {
+	while (true) {
+		bool decoded = false;
+		{
+			Common::StackLock lock(_streamsMutex);
+			if (_quit)
+				return;
+
+			// Decode one chunk per stream at a time, so that a stream which
+			// just started or seeked doesn't wait for the rings of the others
+			for (uint i = 0; i < _streams.size(); i++)
+				decoded |= _streams[i]->decodeAhead();
+		}
+
+		if (!decoded)
+			g_system->delayMillis(kDecodeIdleDelay);
+	}
+}
+
+DecodeAheadRing::DecodeAheadRing(uint32 minSize) :
+		_readPos(0),
+		_writePos(0),
+		_dropRequested(0) {
+
+	// The size is a power of two, so that the positions can wrap around the
+	// uint32 range
+	uint32 size = 1;
+	while (size < minSize)
+		size <<= 1;
+	_buffer = new int16[size];
+	_mask = size - 1;
+}
+
+DecodeAheadRing::~DecodeAheadRing() {
+	delete[] _buffer;
+}
+
+int DecodeAheadRing::read(int16 *buffer, int numSamples) {
+	uint32 readPos, writePos;
+	if (Common::atomicLoad(&_dropRequested)) {
+		// Nothing is written until the request is cleared, so the write
+		// position read after it is where the samples to keep will start
+		writePos = Common::atomicLoad(&_writePos);
+		readPos = writePos;
+		Common::atomicStore(&_readPos, readPos);
+		Common::atomicStore(&_dropRequested, 0);
+	} else {
+		readPos = Common::atomicLoad(&_readPos);
+		writePos = Common::atomicLoad(&_writePos);
+	}
+
+	uint32 count = MIN<uint32>(writePos - readPos, numSamples);
+
+	uint32 offset = readPos & _mask;
+	uint32 firstPart = MIN<uint32>(count, _mask + 1 - offset);
+	memcpy(buffer, _buffer + offset, firstPart * sizeof(int16));
+	memcpy(buffer + firstPart, _buffer, (count - firstPart) * sizeof(int16));
+
+	Common::atomicStore(&_readPos, readPos + count);
+	return count;
+}
+
+bool DecodeAheadRing::isEmpty() const {
+	return Common::atomicLoad(&_dropRequested) || Common::atomicLoad(&_readPos) == Common::atomicLoad(&_writePos);
+}
+
+uint32 DecodeAheadRing::getFreeSpace() const {
+	if (Common::atomicLoad(&_dropRequested))
+		return 0;
+
+	uint32 used = (uint32)Common::atomicLoad(&_writePos) - (uint32)Common::atomicLoad(&_readPos);
+	return _mask + 1 - used;
+}
+
+int16 *DecodeAheadRing::getWriteBuffer(uint32 &count) {
+	// Stop at the end of the ring, the next samples start at its beginning
+	uint32 offset = (uint32)Common::atomicLoad(&_writePos) & _mask;
+	count = MIN<uint32>(count, MIN<uint32>(getFreeSpace(), _mask + 1 - offset));
+	return _buffer + offset;
+}
+
+void DecodeAheadRing::commitWrite(uint32 count) {
+	Common::atomicStore(&_writePos, (uint32)Common::atomicLoad(&_writePos) + count);
+}
+
+void DecodeAheadRing::drop() {
+	Common::atomicStore(&_dropRequested, 1);
+}
+
+DecodeAheadAudioStream::DecodeAheadAudioStream(SeekableAudioStream *parent, DisposeAfterUse::Flag disposeAfterUse, uint bufferMillis) :
+		_parent(parent, disposeAfterUse),
+		_stereo(parent->isStereo()),
+		_rate(parent->getRate()),
+		_length(parent->getLength()),
+		// The ring holds at least a few chunks, so that the decode thread has
+		// room to work with
+		_ring(MAX<uint32>(kDecodeChunkSize * 4, (uint32)parent->getRate() * (parent->isStereo() ? 2 : 1) * bufferMillis / 1000)),
+		_parentEnded(parent->endOfData()) {
+
+	DecodeAheadManager::instance().addStream(this);
+}
+
+DecodeAheadAudioStream::~DecodeAheadAudioStream() {
+	// The decode thread is done with the stream once it is removed
+	DecodeAheadManager::instance().removeStream(this);
+}
+
+void DecodeAheadAudioStream::updateParentEnded() {
+	Common::atomicStore(&_parentEnded, _parent->endOfData() ? 1 : 0);
+}
+
+int DecodeAheadAudioStream::readBuffer(int16 *buffer, const int numSamples) {
+	int samples = _ring.read(buffer, numSamples);
+	if (samples == numSamples)
+		return samples;
+
+	// The decode thread did not keep up, or there is none. It can't add
+	// samples to the ring while the lock is held, so once what it decoded in
+	// the meantime is read, the next samples come from the parent.
+	Common::StackLock lock(_mutex);
+	samples += _ring.read(buffer + samples, numSamples - samples);
+	if (samples < numSamples && !_parent->endOfData()) {
+		int decoded = _parent->readBuffer(buffer + samples, numSamples - samples);
+		if (decoded > 0)
+			samples += decoded;
+		updateParentEnded();
+	}
+
+	return samples;
+}
+
+bool DecodeAheadAudioStream::endOfData() const {
+	// _parentEnded is checked first, the ring can't get new samples after it is set
+	return Common::atomicLoad(&_parentEnded) && _ring.isEmpty();
+}
+
+bool DecodeAheadAudioStream::seek(const Timestamp &where) {
+	Common::StackLock lock(_mutex);
+
+	// Drop the samples decoded from the previous position. The reader may
+	// be reading the ring right now, so it drops them itself.
+	_ring.drop();
+
+	bool result = _parent->seek(where);
+	updateParentEnded();
+	return result;
+}
+
+bool DecodeAheadAudioStream::decodeAhead() {
+	Common::StackLock lock(_mutex);
+
+	if (Common::atomicLoad(&_parentEnded) || _ring.getFreeSpace() < kDecodeChunkSize)
+		return false;
+
+	uint32 count = kDecodeChunkSize;
+	int16 *buffer = _ring.getWriteBuffer(count);
+	int decoded = _parent->readBuffer(buffer, count);
+	if (decoded > 0)
+		_ring.commitWrite(decoded);
+	updateParentEnded();
+
+	return decoded > 0;
+}
+
+SeekableAudioStream *makeDecodeAheadStream(SeekableAudioStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint bufferMillis) {
+	if (!stream)
+		return 0;
+
+	return new DecodeAheadAudioStream(stream, disposeAfterUse, bufferMillis);
+}
+
+} // End of namespace Audio
+
+namespace Common {
+DECLARE_SINGLETON(Audio::DecodeAheadManager);
+}
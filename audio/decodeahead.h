@@ -0,0 +1,110 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef AUDIO_DECODEAHEAD_H
+#define AUDIO_DECODEAHEAD_H
+
+#include "common/types.h"
+
+namespace Audio {
+
+class SeekableAudioStream;
+
+/**
+ * Wrap a stream, so that its samples are decoded ahead of time by a
+ * background thread instead of by the mixer.
+ *
+ * This is meant for compressed streams (Vorbis, MP3, FLAC...), whose
+ * readBuffer() can take long enough to make the mixer miss its deadline.
+ * The wrapper keeps a ring of decoded samples, which a thread shared by all
+ * the decode-ahead streams refills. When the ring runs dry, the wrapper
+ * decodes the missing samples itself, and seeking drops the samples decoded
+ * ahead, so the first samples after a seek are still decoded by the caller.
+ *
+ * When the backend does not support threads, the wrapper decodes everything
+ * itself, like the stream it wraps.
+ *
+ * @param stream           Stream to decode ahead of time
+ * @param disposeAfterUse  Whether to delete the stream along with the wrapper
+ * @param bufferMillis     How much audio to keep decoded, in milliseconds
+ * @return A new SeekableAudioStream, or 0 if stream is 0
+ */
+SeekableAudioStream *makeDecodeAheadStream(SeekableAudioStream *stream, DisposeAfterUse::Flag disposeAfterUse, uint bufferMillis = 500);
+
+/**
+ * Ring of decoded samples of a decode-ahead stream, shared without a lock
+ * by one writer, the decode thread, and one reader.
+ *
+ * Each side is the only one to move its position. To drop the samples,
+ * e.g. after a seek, the writer side requests it, and the reader skips
+ * them on its next read. Nothing can be written in the meantime, so the samples
+ * written after the request are never dropped.
+ */
+class DecodeAheadRing {
+public:
+	/** Create a ring holding at least minSize samples */
+	DecodeAheadRing(uint32 minSize);
+	~DecodeAheadRing();
+
+	/**
+	 * Read up to numSamples samples, after dropping the samples if requested.
+	 * Called by the reader.
+	 *
+	 * @return the number of samples read
+	 */
+	int read(int16 *buffer, int numSamples);
+
+	/** Whether there are no samples left to read */
+	bool isEmpty() const;
+
+	/**
+	 * Number of samples that can be written, 0 until requested drops are done.
+	 * Called by the writer.
+	 */
+	uint32 getFreeSpace() const;
+
+	/**
+	 * Get where to write the next samples. count is reduced to the samples
+	 * which can be written contiguously. Called by the writer.
+	 */
+	int16 *getWriteBuffer(uint32 &count);
+
+	/** Make the count samples written to the write buffer readable */
+	void commitWrite(uint32 count);
+
+	/**
+	 * Request to drop all the samples written so far. Called on the writer
+	 * side, never while samples are being written.
+	 */
+	void drop();
+
+private:
+	int16 *_buffer;
+	uint32 _mask;
+	volatile int32 _readPos;
+	volatile int32 _writePos;
+	volatile int32 _dropRequested;
+};
+
+} // End of namespace Audio
+
+#endif
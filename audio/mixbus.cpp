@@ -0,0 +1,104 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/mixbus.h"
+#include "audio/mixer.h"
+#include "audio/rate.h"
+#include "common/system.h"
+#include "common/util.h"
+
+namespace Audio {
+
+static void mixMono(int32 *bus, const int16 *samples, uint count, uint16 volL, uint16 volR) {
+	for (uint i = 0; i < count; i++) {
+		bus[0] += samples[i] * volL;
+		bus[1] += samples[i] * volR;
+		bus += 2;
+	}
+}
+
+static void mixStereo(int32 *bus, const int16 *frames, uint count, uint16 volL, uint16 volR, bool reverseStereo) {
+	for (uint i = 0; i < count; i++) {
+		bus[reverseStereo    ] += frames[0] * volL;
+		bus[reverseStereo ^ 1] += frames[1] * volR;
+		bus += 2;
+		frames += 2;
+	}
+}
+
+static void resolve(int16 *dst, const int32 *bus, uint count) {
+	for (uint i = 0; i < count; i++) {
+		int32 sample = (bus[i] + Mixer::kMaxMixerVolume / 2) >> 8;
+		sample = CLIP<int32>(sample, ST_SAMPLE_MIN, ST_SAMPLE_MAX);
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		sample ^= 0x8000;
+#endif
+		dst[i] = sample;
+	}
+}
+
+const MixBusFuncs *selectMixBusFuncs() {
+	// SSE2 and NEON are part of the base instruction sets of x86-64 and AArch64,
+	// the CPU only needs to be asked about them in 32 bit builds.
+#ifdef SCUMMVM_NEON
+#if defined(__aarch64__) || defined(_M_ARM64)
+	return getMixBusFuncsNEON();
+#else
+	if (g_system && g_system->hasFeature(OSystem::kFeatureCpuNEON))
+		return getMixBusFuncsNEON();
+#endif
+#endif
+
+#ifdef SCUMMVM_SSE2
+#if defined(__x86_64__) || defined(_M_X64)
+	return getMixBusFuncsSSE2();
+#else
+	if (g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+		return getMixBusFuncsSSE2();
+#endif
+#endif
+
+	static const MixBusFuncs funcs = { mixMono, mixStereo, resolve };
+	return &funcs;
+}
+
+int RateConverter::flow(AudioStream &input, int32 *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+	// Converters which only write to int16 samples, like the ARM assembly ones,
+	// convert blocks of frames at full volume, which are then added to the bus.
+	enum { kBlockFrames = 256 };
+	st_sample_t block[kBlockFrames * 2];
+	const MixBusFuncs *funcs = selectMixBusFuncs();
+
+	st_size_t done = 0;
+	while (done < osamp) {
+		st_size_t count = MIN<st_size_t>(osamp - done, kBlockFrames);
+		memset(block, 0, sizeof(block));
+		int written = flow(input, block, count, Mixer::kMaxMixerVolume, Mixer::kMaxMixerVolume);
+		funcs->mixStereo(obuf + done * 2, block, written, vol_l, vol_r, false);
+		done += written;
+		if ((st_size_t)written < count)
+			break;
+	}
+	return done;
+}
+
+} // End of namespace Audio
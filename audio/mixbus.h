@@ -0,0 +1,68 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef AUDIO_MIXBUS_H
+#define AUDIO_MIXBUS_H
+
+#include "common/scummsys.h"
+
+namespace Audio {
+
+// The mixer adds its channels together in a bus of interleaved stereo int32
+// samples, which hold the samples of the channels multiplied by their volume,
+// out of Mixer::kMaxMixerVolume. The bus is only rounded and clamped to the
+// int16 output once all the channels are in it, so that loud channels don't
+// clip the ones mixed after them, and so that the volume doesn't truncate the
+// samples of each channel.
+//
+// The kernels process several samples at a time with SIMD instructions when
+// the CPU has them. All the kernels give the same results.
+
+struct MixBusFuncs {
+	// Adds count mono samples to count frames of the bus.
+	void (*mixMono)(int32 *bus, const int16 *samples, uint count, uint16 volL, uint16 volR);
+	// Adds count stereo frames to the bus. With reverseStereo, the left samples go
+	// to the right channel with volL, and the right samples to the left one with volR.
+	void (*mixStereo)(int32 *bus, const int16 *frames, uint count, uint16 volL, uint16 volR, bool reverseStereo);
+	// Rounds and clamps count samples of the bus to int16 samples.
+	void (*resolve)(int16 *dst, const int32 *bus, uint count);
+};
+
+#ifdef SCUMMVM_SSE2
+const MixBusFuncs *getMixBusFuncsSSE2();
+#endif
+
+#ifdef SCUMMVM_NEON
+const MixBusFuncs *getMixBusFuncsNEON();
+#endif
+
+/**
+ * Select the best mixing kernels supported by the CPU.
+ *
+ * @return the kernels, which are plain C++ ones when the CPU has no SIMD
+ *         instructions they can use.
+ */
+const MixBusFuncs *selectMixBusFuncs();
+
+} // End of namespace Audio
+
+#endif
@@ -0,0 +1,106 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/mixbus.h"
+
+#ifdef SCUMMVM_NEON
+
+#include <arm_neon.h>
+
+namespace Audio {
+
+// Adds the products of 8 samples and their volumes to 8 samples of the bus
+static inline void mixBlock(int32 *bus, int16x8_t samples, int16x4_t volumes) {
+	vst1q_s32(bus, vmlal_s16(vld1q_s32(bus), vget_low_s16(samples), volumes));
+	vst1q_s32(bus + 4, vmlal_s16(vld1q_s32(bus + 4), vget_high_s16(samples), volumes));
+}
+
+static inline int16x4_t makeVolumes(uint16 first, uint16 second) {
+	const int16 values[4] = { (int16)first, (int16)second, (int16)first, (int16)second };
+	return vld1_s16(values);
+}
+
+static void mixMono(int32 *bus, const int16 *samples, uint count, uint16 volL, uint16 volR) {
+	const int16x4_t volumes = makeVolumes(volL, volR);
+
+	uint i = 0;
+	for (; i + 8 <= count; i += 8) {
+		int16x8_t s = vld1q_s16(samples + i);
+		int16x8x2_t pairs = vzipq_s16(s, s);
+		mixBlock(bus + i * 2, pairs.val[0], volumes);
+		mixBlock(bus + i * 2 + 8, pairs.val[1], volumes);
+	}
+
+	for (; i < count; i++) {
+		bus[i * 2] += samples[i] * volL;
+		bus[i * 2 + 1] += samples[i] * volR;
+	}
+}
+
+static void mixStereo(int32 *bus, const int16 *frames, uint count, uint16 volL, uint16 volR, bool reverseStereo) {
+	// Reversed frames are swapped before being mixed, the right samples then
+	// come first, and get volR.
+	const int16x4_t volumes = reverseStereo ? makeVolumes(volR, volL) : makeVolumes(volL, volR);
+
+	uint i = 0;
+	for (; i + 4 <= count; i += 4) {
+		int16x8_t s = vld1q_s16(frames + i * 2);
+		if (reverseStereo)
+			s = vrev32q_s16(s);
+		mixBlock(bus + i * 2, s, volumes);
+	}
+
+	for (; i < count; i++) {
+		bus[i * 2 + reverseStereo    ] += frames[i * 2] * volL;
+		bus[i * 2 + (reverseStereo ^ 1)] += frames[i * 2 + 1] * volR;
+	}
+}
+
+static void resolve(int16 *dst, const int32 *bus, uint count) {
+	uint i = 0;
+	for (; i + 8 <= count; i += 8) {
+		// Rounding shifts, with saturation to 16 bits
+		int16x8_t samples = vcombine_s16(vqrshrn_n_s32(vld1q_s32(bus + i), 8), vqrshrn_n_s32(vld1q_s32(bus + i + 4), 8));
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		samples = veorq_s16(samples, vdupq_n_s16((int16)0x8000));
+#endif
+		vst1q_s16(dst + i, samples);
+	}
+
+	for (; i < count; i++) {
+		int32 sample = (bus[i] + 128) >> 8;
+		sample = sample > 32767 ? 32767 : (sample < -32768 ? -32768 : sample);
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		sample ^= 0x8000;
+#endif
+		dst[i] = sample;
+	}
+}
+
+const MixBusFuncs *getMixBusFuncsNEON() {
+	static const MixBusFuncs funcs = { mixMono, mixStereo, resolve };
+	return &funcs;
+}
+
+} // End of namespace Audio
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,113 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// This file is compiled with SSE2 enabled, it must only be called after checking the CPU supports it.
+
+#include "audio/mixbus.h"
+
+#ifdef SCUMMVM_SSE2
+
+#include <emmintrin.h>
+
+namespace Audio {
+
+// Adds the products of 8 samples and their volumes to 8 samples of the bus
+static inline void mixBlock(int32 *bus, __m128i samples, __m128i volumes) {
+	// The volumes fit in 9 bits, the products in 25
+	__m128i low = _mm_mullo_epi16(samples, volumes);
+	__m128i high = _mm_mulhi_epi16(samples, volumes);
+	__m128i *dst = (__m128i *)bus;
+	_mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), _mm_unpacklo_epi16(low, high)));
+	_mm_storeu_si128(dst + 1, _mm_add_epi32(_mm_loadu_si128(dst + 1), _mm_unpackhi_epi16(low, high)));
+}
+
+static void mixMono(int32 *bus, const int16 *samples, uint count, uint16 volL, uint16 volR) {
+	const __m128i volumes = _mm_set1_epi32(volL | (volR << 16));
+
+	uint i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m128i s = _mm_loadu_si128((const __m128i *)(samples + i));
+		mixBlock(bus + i * 2, _mm_unpacklo_epi16(s, s), volumes);
+		mixBlock(bus + i * 2 + 8, _mm_unpackhi_epi16(s, s), volumes);
+	}
+
+	for (; i < count; i++) {
+		bus[i * 2] += samples[i] * volL;
+		bus[i * 2 + 1] += samples[i] * volR;
+	}
+}
+
+static void mixStereo(int32 *bus, const int16 *frames, uint count, uint16 volL, uint16 volR, bool reverseStereo) {
+	// Reversed frames are swapped before being mixed, the right samples then
+	// come first, and get volR.
+	const __m128i volumes = reverseStereo ? _mm_set1_epi32(volR | (volL << 16)) : _mm_set1_epi32(volL | (volR << 16));
+
+	uint i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i s = _mm_loadu_si128((const __m128i *)(frames + i * 2));
+		if (reverseStereo)
+			s = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+		mixBlock(bus + i * 2, s, volumes);
+	}
+
+	for (; i < count; i++) {
+		bus[i * 2 + reverseStereo    ] += frames[i * 2] * volL;
+		bus[i * 2 + (reverseStereo ^ 1)] += frames[i * 2 + 1] * volR;
+	}
+}
+
+static void resolve(int16 *dst, const int32 *bus, uint count) {
+	const __m128i round = _mm_set1_epi32(128);
+#ifdef OUTPUT_UNSIGNED_AUDIO
+	const __m128i sign = _mm_set1_epi16((int16)0x8000);
+#endif
+
+	uint i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m128i low = _mm_srai_epi32(_mm_add_epi32(_mm_loadu_si128((const __m128i *)(bus + i)), round), 8);
+		__m128i high = _mm_srai_epi32(_mm_add_epi32(_mm_loadu_si128((const __m128i *)(bus + i + 4)), round), 8);
+		// The packing saturates the samples
+		__m128i samples = _mm_packs_epi32(low, high);
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		samples = _mm_xor_si128(samples, sign);
+#endif
+		_mm_storeu_si128((__m128i *)(dst + i), samples);
+	}
+
+	for (; i < count; i++) {
+		int32 sample = (bus[i] + 128) >> 8;
+		sample = sample > 32767 ? 32767 : (sample < -32768 ? -32768 : sample);
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		sample ^= 0x8000;
+#endif
+		dst[i] = sample;
+	}
+}
+
+const MixBusFuncs *getMixBusFuncsSSE2() {
+	static const MixBusFuncs funcs = { mixMono, mixStereo, resolve };
+	return &funcs;
+}
+
+} // End of namespace Audio
+
+#endif // SCUMMVM_SSE2
@@ -22,6 +22,7 @@
 
 #include "gui/EventRecorder.h"
 
+#include "common/atomic.h"
 #include "common/util.h"
 #include "common/textconsole.h"
 
@@ -40,6 +41,10 @@ namespace Audio {
 
 /**
  * Channel used by the default Mixer implementation.
+ *
+ * The engine side settings are only accessed with the mutex of the mixer
+ * locked. The audio thread only calls mix() and isFinished(), which write
+ * the timing getElapsedTime() reads atomically.
  */
 class Channel {
 public:
@@ -47,15 +52,16 @@ public:
 	~Channel();
 
 	/**
-	 * Mixes the channel's samples into the given buffer.
+	 * Mixes the channel's samples into the given mixing bus.
 	 *
-	 * @param data buffer where to mix the data
+	 * @param data bus where to mix the data, see audio/mixbus.h
 	 * @param len  number of sample *pairs*. So a value of
-	 *             10 means that the buffer contains twice 10 sample, each
-	 *             16 bits, for a total of 40 bytes.
+	 *             10 means that the bus contains twice 10 samples.
+	 * @param volL volume of the left channel, as computed by updateChannelVolumes()
+	 * @param volR volume of the right channel
 	 * @return number of sample pairs processed (which can still be silence!)
 	 */
-	int mix(int16 *data, uint len);
+	int mix(int32 *data, uint len, st_volume_t volL, st_volume_t volR);
 
 	/**
 	 * Queries whether the channel is still playing or not.
@@ -121,6 +127,13 @@ public:
 	 */
 	void notifyGlobalVolChange() { updateChannelVolumes(); }
 
+	/**
+	 * Gets the volumes the channel is mixed with, from its own and
+	 * the global settings.
+	 */
+	st_volume_t getLeftVolume() const { return _volL; }
+	st_volume_t getRightVolume() const { return _volR; }
+
 	/**
 	 * Queries how long the channel has been playing.
 	 */
@@ -158,10 +171,14 @@ private:
 
 	Mixer *_mixer;
 
-	uint32 _samplesConsumed;
+	// Written by mix(), the version is odd while they are being updated
+	volatile int32 _timingVersion;
+	volatile int32 _samplesConsumed;
 	uint32 _samplesDecoded;
-	uint32 _mixerTimeStamp;
+	volatile int32 _mixerTimeStamp;
+
 	uint32 _pauseStartTime;
+	uint32 _pauseEndTime;
 	uint32 _pauseTime;
 
 	RateConverter *_converter;
@@ -173,7 +190,8 @@ private:
 #pragma mark -
 
 MixerImpl::MixerImpl(uint sampleRate)
-	: _mutex(), _sampleRate(sampleRate), _mixerReady(false), _handleSeed(0), _soundTypeSettings() {
+	: _mutex(), _sampleRate(sampleRate), _mixerReady(false), _handleSeed(0), _soundTypeSettings(), _mixOwner(kMixOwnerNone),
+	  _bus(0), _busSize(0), _busFuncs(selectMixBusFuncs()) {
 
 	assert(sampleRate > 0);
 
@@ -182,20 +200,129 @@ MixerImpl::MixerImpl(uint sampleRate)
 }
 
 MixerImpl::~MixerImpl() {
+	// The backend does not call mixCallback() anymore
+	applyCommands();
+	deleteRetiredChannels();
+
 	for (int i = 0; i != NUM_CHANNELS; i++)
-		delete _channels[i];
+		delete _mixSlots[i].channel;
+
+	delete[] _bus;
 }
 
 void MixerImpl::setReady(bool ready) {
 	Common::StackLock lock(_mutex);
 
-	_mixerReady = ready;
+	Common::atomicStore(&_mixerReady, ready);
 }
 
 uint MixerImpl::getOutputRate() const {
 	return _sampleRate;
 }
 
+MixerImpl::Command MixerImpl::makeCommand(CommandType type, int index) const {
+	Command command;
+	command.type = type;
+	command.index = index;
+	command.channel = _channels[index];
+	command.volL = _channels[index]->getLeftVolume();
+	command.volR = _channels[index]->getRightVolume();
+	command.paused = _channels[index]->isPaused();
+	return command;
+}
+
+void MixerImpl::pushCommand(const Command &command) {
+	while (!_commands.push(command)) {
+		// The audio thread is not applying the commands, most likely because the
+		// backend paused it. Apply them in its place if it is not mixing.
+		if (Common::atomicCompareExchange(&_mixOwner, kMixOwnerNone, kMixOwnerEngine)) {
+			applyCommands();
+			Common::atomicStore(&_mixOwner, kMixOwnerNone);
+			deleteRetiredChannels();
+		} else {
+			g_system->delayMillis(1);
+		}
+	}
+}
+
+void MixerImpl::removeChannel(int index) {
+	pushCommand(makeCommand(kCommandRemoveChannel, index));
+	_channels[index] = 0;
+}
+
+void MixerImpl::updateChannelVolume(int index) {
+	pushCommand(makeCommand(kCommandSetVolume, index));
+}
+
+void MixerImpl::updateChannelPause(int index) {
+	pushCommand(makeCommand(kCommandPause, index));
+}
+
+void MixerImpl::waitForCommands() {
+	// The engines may delete the streams of the channels they stopped once they get
+	// control back. The audio thread applies the commands before mixing, it only
+	// needs to be waited for when it is already mixing.
+	uint32 writePos = _commands.getWritePos();
+	while (!_commands.hasPopped(writePos) && Common::atomicLoad(&_mixOwner) == kMixOwnerAudio)
+		g_system->delayMillis(1);
+
+	deleteRetiredChannels();
+}
+
+void MixerImpl::applyCommands() {
+	Command *command;
+	while ((command = _commands.front()) != nullptr) {
+		MixSlot &slot = _mixSlots[command->index];
+
+		// The channel of the slot changes when it finished, in which case the commands
+		// queued for it meanwhile are ignored
+		if (command->type == kCommandAddChannel) {
+			slot.channel = command->channel;
+			slot.volL = command->volL;
+			slot.volR = command->volR;
+			slot.paused = command->paused;
+		} else if (slot.channel == command->channel) {
+			switch (command->type) {
+			case kCommandRemoveChannel:
+				retireChannel(slot);
+				break;
+			case kCommandSetVolume:
+				slot.volL = command->volL;
+				slot.volR = command->volR;
+				break;
+			case kCommandPause:
+				slot.paused = command->paused;
+				break;
+			default:
+				break;
+			}
+		}
+
+		_commands.pop();
+	}
+}
+
+void MixerImpl::retireChannel(MixSlot &slot) {
+	// Can't fail, see NUM_RETIRED_CHANNELS
+	bool retired = _retiredChannels.push(slot.channel);
+	assert(retired);
+	(void)retired;
+
+	slot.channel = 0;
+}
+
+void MixerImpl::deleteRetiredChannels() {
+	Channel *chan;
+	while (_retiredChannels.pop(chan)) {
+		// Finished channels are still in _channels
+		const int index = chan->getHandle()._val % NUM_CHANNELS;
+		if (_channels[index] == chan)
+			_channels[index] = 0;
+
+		delete chan;
+	}
+}
+
 void MixerImpl::insertChannel(SoundHandle *handle, Channel *chan) {
 	int index = -1;
 	for (int i = 0; i != NUM_CHANNELS; i++) {
@@ -219,6 +346,8 @@ void MixerImpl::insertChannel(SoundHandle *handle, Channel *chan) {
 	_handleSeed++;
 	if (handle)
 		*handle = chanHandle;
+
+	pushCommand(makeCommand(kCommandAddChannel, index));
 }
 
 void MixerImpl::playStream(
@@ -237,7 +366,9 @@ void MixerImpl::playStream(
 	}
 
 
-	assert(_mixerReady);
+	assert(isReady());
+
+	deleteRetiredChannels();
 
 	// Prevent duplicate sounds
 	if (id != -1) {
@@ -269,76 +400,101 @@ void MixerImpl::playStream(
 int MixerImpl::mixCallback(byte *samples, uint len) {
 	assert(samples);
 
-	Common::StackLock lock(_mutex);
-
 	int16 *buf = (int16 *)samples;
 	// we store stereo, 16-bit samples
 	assert(len % 4 == 0);
 	len >>= 2;
 
+	// An engine thread only applies the commands itself when they piled up,
+	// while this callback was not called. Don't wait for it.
+	if (!Common::atomicCompareExchange(&_mixOwner, kMixOwnerNone, kMixOwnerAudio)) {
+		memset(buf, 0, 2 * len * sizeof(int16));
+		return 0;
+	}
+
 	// Since the mixer callback has been called, the mixer must be ready...
-	_mixerReady = true;
+	Common::atomicStore(&_mixerReady, true);
 
-	//  zero the buf
-	memset(buf, 0, 2 * len * sizeof(int16));
+	applyCommands();
+
+	// The backends normally always ask for the same amount of samples
+	if (2 * len > _busSize) {
+		delete[] _bus;
+		_busSize = 2 * len;
+		_bus = new int32[_busSize];
+	}
+
+	//  zero the bus
+	memset(_bus, 0, 2 * len * sizeof(int32));
 
 	// mix all channels
 	int res = 0, tmp;
-	for (int i = 0; i != NUM_CHANNELS; i++)
-		if (_channels[i]) {
-			if (_channels[i]->isFinished()) {
-				delete _channels[i];
-				_channels[i] = 0;
-			} else if (!_channels[i]->isPaused()) {
-				tmp = _channels[i]->mix(buf, len);
+	for (int i = 0; i != NUM_CHANNELS; i++) {
+		MixSlot &slot = _mixSlots[i];
+		if (slot.channel) {
+			if (slot.channel->isFinished()) {
+				retireChannel(slot);
+			} else if (!slot.paused) {
+				tmp = slot.channel->mix(_bus, len, slot.volL, slot.volR);
 
 				if (tmp > res)
 					res = tmp;
 			}
 		}
+	}
+
+	Common::atomicStore(&_mixOwner, kMixOwnerNone);
+
+	// Clamp the sum of the channels once, instead of after each of them
+	_busFuncs->resolve(buf, _bus, 2 * len);
 
 	return res;
 }
 
 void MixerImpl::stopAll() {
 	Common::StackLock lock(_mutex);
+	deleteRetiredChannels();
 	for (int i = 0; i != NUM_CHANNELS; i++) {
-		if (_channels[i] != 0 && !_channels[i]->isPermanent()) {
-			delete _channels[i];
-			_channels[i] = 0;
-		}
+		if (_channels[i] != 0 && !_channels[i]->isPermanent())
+			removeChannel(i);
 	}
+	waitForCommands();
 }
 
 void MixerImpl::stopID(int id) {
 	Common::StackLock lock(_mutex);
+	deleteRetiredChannels();
 	for (int i = 0; i != NUM_CHANNELS; i++) {
-		if (_channels[i] != 0 && _channels[i]->getId() == id) {
-			delete _channels[i];
-			_channels[i] = 0;
-		}
+		if (_channels[i] != 0 && _channels[i]->getId() == id)
+			removeChannel(i);
 	}
+	waitForCommands();
 }
 
 void MixerImpl::stopHandle(SoundHandle handle) {
 	Common::StackLock lock(_mutex);
+	deleteRetiredChannels();
 
 	// Simply ignore stop requests for handles of sounds that already terminated
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
 		return;
 
-	delete _channels[index];
-	_channels[index] = 0;
+	removeChannel(index);
+	waitForCommands();
 }
 
 void MixerImpl::muteSoundType(SoundType type, bool mute) {
 	assert(0 <= (int)type && (int)type < ARRAYSIZE(_soundTypeSettings));
+
+	Common::StackLock lock(_mutex);
 	_soundTypeSettings[type].mute = mute;
 
 	for (int i = 0; i != NUM_CHANNELS; ++i) {
-		if (_channels[i] && _channels[i]->getType() == type)
+		if (_channels[i] && _channels[i]->getType() == type) {
 			_channels[i]->notifyGlobalVolChange();
+			updateChannelVolume(i);
+		}
 	}
 }
 
@@ -355,9 +511,12 @@ void MixerImpl::setChannelVolume(SoundHandle handle, byte volume) {
 		return;
 
 	_channels[index]->setVolume(volume);
+	updateChannelVolume(index);
 }
 
 byte MixerImpl::getChannelVolume(SoundHandle handle) {
+	Common::StackLock lock(_mutex);
+
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
 		return 0;
@@ -373,9 +532,12 @@ void MixerImpl::setChannelBalance(SoundHandle handle, int8 balance) {
 		return;
 
 	_channels[index]->setBalance(balance);
+	updateChannelVolume(index);
 }
 
 int8 MixerImpl::getChannelBalance(SoundHandle handle) {
+	Common::StackLock lock(_mutex);
+
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
 		return 0;
@@ -389,6 +551,7 @@ uint32 MixerImpl::getSoundElapsedTime(SoundHandle handle) {
 
 Timestamp MixerImpl::getElapsedTime(SoundHandle handle) {
 	Common::StackLock lock(_mutex);
+	deleteRetiredChannels();
 
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
@@ -402,6 +565,7 @@ void MixerImpl::pauseAll(bool paused) {
 	for (int i = 0; i != NUM_CHANNELS; i++) {
 		if (_channels[i] != 0) {
 			_channels[i]->pause(paused);
+			updateChannelPause(i);
 		}
 	}
 }
@@ -411,6 +575,7 @@ void MixerImpl::pauseID(int id, bool paused) {
 	for (int i = 0; i != NUM_CHANNELS; i++) {
 		if (_channels[i] != 0 && _channels[i]->getId() == id) {
 			_channels[i]->pause(paused);
+			updateChannelPause(i);
 			return;
 		}
 	}
@@ -425,6 +590,7 @@ void MixerImpl::pauseHandle(SoundHandle handle, bool paused) {
 		return;
 
 	_channels[index]->pause(paused);
+	updateChannelPause(index);
 }
 
 bool MixerImpl::isSoundIDActive(int id) {
@@ -434,6 +600,8 @@ bool MixerImpl::isSoundIDActive(int id) {
 	g_eventRec.updateSubsystems();
 #endif
 
+	deleteRetiredChannels();
+
 	for (int i = 0; i != NUM_CHANNELS; i++)
 		if (_channels[i] && _channels[i]->getId() == id)
 			return true;
@@ -442,6 +610,7 @@ bool MixerImpl::isSoundIDActive(int id) {
 
 int MixerImpl::getSoundID(SoundHandle handle) {
 	Common::StackLock lock(_mutex);
+	deleteRetiredChannels();
 	const int index = handle._val % NUM_CHANNELS;
 	if (_channels[index] && _channels[index]->getHandle()._val == handle._val)
 		return _channels[index]->getId();
@@ -455,12 +624,15 @@ bool MixerImpl::isSoundHandleActive(SoundHandle handle) {
 	g_eventRec.updateSubsystems();
 #endif
 
+	deleteRetiredChannels();
+
 	const int index = handle._val % NUM_CHANNELS;
 	return _channels[index] && _channels[index]->getHandle()._val == handle._val;
 }
 
 bool MixerImpl::hasActiveChannelOfType(SoundType type) {
 	Common::StackLock lock(_mutex);
+	deleteRetiredChannels();
 	for (int i = 0; i != NUM_CHANNELS; i++)
 		if (_channels[i] && _channels[i]->getType() == type)
 			return true;
@@ -480,8 +652,10 @@ void MixerImpl::setVolumeForSoundType(SoundType type, int volume) {
 	_soundTypeSettings[type].volume = volume;
 
 	for (int i = 0; i != NUM_CHANNELS; ++i) {
-		if (_channels[i] && _channels[i]->getType() == type)
+		if (_channels[i] && _channels[i]->getType() == type) {
 			_channels[i]->notifyGlobalVolChange();
+			updateChannelVolume(i);
+		}
 	}
 }
 
@@ -499,8 +673,8 @@ int MixerImpl::getVolumeForSoundType(SoundType type) const {
 Channel::Channel(Mixer *mixer, Mixer::SoundType type, AudioStream *stream,
                  DisposeAfterUse::Flag autofreeStream, bool reverseStereo, int id, bool permanent)
     : _type(type), _mixer(mixer), _id(id), _permanent(permanent), _volume(Mixer::kMaxChannelVolume),
-      _balance(0), _pauseLevel(0), _samplesConsumed(0), _samplesDecoded(0), _mixerTimeStamp(0),
-      _pauseStartTime(0), _pauseTime(0), _converter(0), _volL(0), _volR(0),
+      _balance(0), _pauseLevel(0), _timingVersion(0), _samplesConsumed(0), _samplesDecoded(0), _mixerTimeStamp(0),
+      _pauseStartTime(0), _pauseEndTime(0), _pauseTime(0), _converter(0), _volL(0), _volR(0),
       _stream(stream, autofreeStream) {
 	assert(mixer);
 	assert(stream);
@@ -570,7 +744,8 @@ void Channel::pause(bool paused) {
 		_pauseLevel--;
 
 		if (!_pauseLevel) {
-			_pauseTime = (g_system->getMillis(true) - _pauseStartTime);
+			_pauseEndTime = g_system->getMillis(true);
+			_pauseTime = (_pauseEndTime - _pauseStartTime);
 			_pauseStartTime = 0;
 		}
 	}
@@ -582,17 +757,31 @@ Timestamp Channel::getElapsedTime() {
 
 	Audio::Timestamp ts(0, rate);
 
-	if (_mixerTimeStamp == 0)
+	// mix() may be running on the audio thread
+	int32 version;
+	uint32 mixerTimeStamp, samplesConsumed;
+	do {
+		version = Common::atomicLoad(&_timingVersion);
+		mixerTimeStamp = Common::atomicLoad(&_mixerTimeStamp);
+		samplesConsumed = Common::atomicLoad(&_samplesConsumed);
+	} while ((version & 1) || version != Common::atomicLoad(&_timingVersion));
+
+	if (mixerTimeStamp == 0)
 		return ts;
 
-	if (isPaused())
-		delta = _pauseStartTime - _mixerTimeStamp;
-	else
-		delta = g_system->getMillis(true) - _mixerTimeStamp - _pauseTime;
+	if (isPaused()) {
+		delta = _pauseStartTime - mixerTimeStamp;
+	} else {
+		delta = g_system->getMillis(true) - mixerTimeStamp;
+
+		// The last pause only counts until the channel is mixed again
+		if ((int32)(_pauseEndTime - mixerTimeStamp) > 0)
+			delta -= _pauseTime;
+	}
 
 	// Convert the number of samples into a time duration.
 
-	ts = ts.addFrames(_samplesConsumed);
+	ts = ts.addFrames(samplesConsumed);
 	ts = ts.addMsecs(delta);
 
 	// In theory it would seem like a good idea to limit the approximation
@@ -604,7 +793,7 @@ Timestamp Channel::getElapsedTime() {
 	return ts;
 }
 
-int Channel::mix(int16 *data, uint len) {
+int Channel::mix(int32 *data, uint len, st_volume_t volL, st_volume_t volR) {
 	assert(_stream);
 
 	int res = 0;
@@ -612,10 +801,12 @@ int Channel::mix(int16 *data, uint len) {
 		// TODO: call drain method
 	} else {
 		assert(_converter);
-		_samplesConsumed = _samplesDecoded;
-		_mixerTimeStamp = g_system->getMillis(true);
-		_pauseTime = 0;
-		res = _converter->flow(*_stream, data, len, _volL, _volR);
+		const int32 version = Common::atomicLoad(&_timingVersion);
+		Common::atomicStore(&_timingVersion, (int32)((uint32)version + 1));
+		Common::atomicStore(&_samplesConsumed, _samplesDecoded);
+		Common::atomicStore(&_mixerTimeStamp, g_system->getMillis(true));
+		Common::atomicStore(&_timingVersion, (int32)((uint32)version + 2));
+		res = _converter->flow(*_stream, data, len, volL, volR);
 		_samplesDecoded += res;
 	}
 
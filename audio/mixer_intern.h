@@ -25,7 +25,11 @@
 
 #include "common/scummsys.h"
 #include "common/mutex.h"
+#include "common/atomic.h"
+#include "common/spsc-queue.h"
+#include "audio/mixbus.h"
 #include "audio/mixer.h"
+#include "audio/rate.h"
 
 namespace Audio {
 
@@ -42,6 +46,11 @@ namespace Audio {
  * 4) Change the mixer into ready mode via setReady(true).
  * 5) Start audio processing (e.g. by resuming the audio thread, if applicable).
  *
+ * The channels are shared with the audio thread without locking it: the
+ * engines queue their changes to them in a command ring, which mixCallback()
+ * applies before mixing. Channels leave the audio thread through another
+ * ring, and are deleted by the next call from the engines.
+ *
  * In the future, we might make it possible for backends to provide
  * (partial) alternative implementations of the mixer, e.g. to make
  * better use of native sound mixing support on low-end devices.
@@ -51,13 +60,19 @@ namespace Audio {
 class MixerImpl : public Mixer {
 private:
 	enum {
-		NUM_CHANNELS = 32
+		NUM_CHANNELS = 32,
+		NUM_COMMANDS = 256,
+		// Channels are retired once, either when the audio thread finds them finished, or when
+		// applying their removal. Those not retired yet are either in _channels, or have their
+		// removal among the queued commands.
+		NUM_RETIRED_CHANNELS = 512
 	};
 
+	// Serializes the calls from the engines, the audio thread never locks it
 	Common::Mutex _mutex;
 
 	const uint _sampleRate;
-	bool _mixerReady;
+	volatile int32 _mixerReady; // Also set by mixCallback()
 	uint32 _handleSeed;
 
 	struct SoundTypeSettings {
@@ -68,15 +83,56 @@ private:
 	};
 
 	SoundTypeSettings _soundTypeSettings[4];
+	// The channels as seen by the engines
 	Channel *_channels[NUM_CHANNELS];
 
+	enum CommandType {
+		kCommandAddChannel,
+		kCommandRemoveChannel,
+		kCommandSetVolume,
+		kCommandPause
+	};
+
+	struct Command {
+		CommandType type;
+		int index;
+		Channel *channel;
+		st_volume_t volL, volR;
+		bool paused;
+	};
+
+	// The channels as seen by the audio thread
+	struct MixSlot {
+		MixSlot() : channel(0), volL(0), volR(0), paused(false) {}
+
+		Channel *channel;
+		st_volume_t volL, volR;
+		bool paused;
+	};
+
+	enum MixOwner {
+		kMixOwnerNone,
+		kMixOwnerAudio,  // mixCallback() is running
+		kMixOwnerEngine  // The commands did not fit, an engine thread is applying them
+	};
+
+	MixSlot _mixSlots[NUM_CHANNELS];
+	volatile int32 _mixOwner;
+	Common::SPSCQueue<Command, NUM_COMMANDS> _commands;
+	Common::SPSCQueue<Channel *, NUM_RETIRED_CHANNELS> _retiredChannels;
+
+	// Where mixCallback() adds the channels together, see audio/mixbus.h
+	int32 *_bus;
+	uint _busSize;
+	const MixBusFuncs *_busFuncs;
+
 
 public:
 
 	MixerImpl(uint sampleRate);
 	~MixerImpl();
 
-	virtual bool isReady() const { Common::StackLock lock(_mutex); return _mixerReady; }
+	virtual bool isReady() const { return Common::atomicLoad(&_mixerReady) != 0; }
 
 	virtual void playStream(
 		SoundType type,
@@ -121,6 +177,20 @@ public:
 protected:
 	void insertChannel(SoundHandle *handle, Channel *chan);
 
+private:
+	Command makeCommand(CommandType type, int index) const;
+	void pushCommand(const Command &command);
+	void removeChannel(int index);
+	void updateChannelVolume(int index);
+	void updateChannelPause(int index);
+	void waitForCommands();
+
+	// Called by the thread owning the mix slots
+	void applyCommands();
+	void retireChannel(MixSlot &slot);
+
+	void deleteRetiredChannels();
+
 public:
 	/**
 	 * The mixer callback function, to be called at regular intervals by
@@ -2,7 +2,9 @@ MODULE := audio
 
 MODULE_OBJS := \
 	audiostream.o \
+	decodeahead.o \
 	mididrv.o \
+	mixbus.o \
 	mixer.o \
 	musicplugin.o \
 	timestamp.o \
@@ -38,5 +40,17 @@ MODULE_OBJS += \
 	rate_arm_asm.o
 endif
 
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	mixbus_sse2.o
+
+$(MODULE)/mixbus_sse2.o: CXXFLAGS += -msse2
+endif
+
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	mixbus_neon.o
+endif
+
 # Include common rules
 include $(srcdir)/rules.mk
@@ -29,6 +29,7 @@
  */
 
 #include "audio/audiostream.h"
+#include "audio/mixbus.h"
 #include "audio/rate.h"
 #include "audio/mixer.h"
 #include "common/frac.h"
@@ -57,6 +58,93 @@ enum {
 	FRAC_HALF_LOW = (1L << (FRAC_BITS_LOW-1))
 };
 
+/**
+ * Base of the rate converters, which convert the input into blocks of frames,
+ * then apply the volume to them while adding them to the output.
+ */
+template<bool stereo, bool reverseStereo>
+class BlockRateConverter : public RateConverter {
+protected:
+	enum {
+		kBlockFrames = INTERMEDIATE_BUFFER_SIZE / (stereo ? 2 : 1)
+	};
+
+	/** Converted frames, with the channels of the input */
+	st_sample_t _block[INTERMEDIATE_BUFFER_SIZE];
+
+	const MixBusFuncs *_busFuncs;
+
+	/**
+	 * Convert up to count frames of the input.
+	 *
+	 * @return Number of frames written, which is lower than count only
+	 *         at the end of the input.
+	 */
+	virtual int convert(AudioStream &input, st_sample_t *frames, st_size_t count) = 0;
+
+public:
+	BlockRateConverter() : _busFuncs(selectMixBusFuncs()) {}
+
+	int flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r);
+	int flow(AudioStream &input, int32 *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r);
+	int drain(st_sample_t *obuf, st_size_t osamp, st_volume_t vol) {
+		return ST_SUCCESS;
+	}
+};
+
+template<bool stereo, bool reverseStereo>
+int BlockRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+	st_sample_t *ostart, *oend;
+
+	ostart = obuf;
+	oend = obuf + osamp * 2;
+
+	while (obuf < oend) {
+		st_size_t count = MIN<st_size_t>((oend - obuf) / 2, kBlockFrames);
+		st_size_t len = convert(input, _block, count);
+
+		// Mix the data into the output buffer
+		const st_sample_t *ptr = _block;
+		for (st_size_t i = 0; i < len; i++) {
+			st_sample_t out0, out1;
+			out0 = *ptr++;
+			out1 = (stereo ? *ptr++ : out0);
+
+			// output left channel
+			clampedAdd(obuf[reverseStereo    ], (out0 * (int)vol_l) / Audio::Mixer::kMaxMixerVolume);
+
+			// output right channel
+			clampedAdd(obuf[reverseStereo ^ 1], (out1 * (int)vol_r) / Audio::Mixer::kMaxMixerVolume);
+
+			obuf += 2;
+		}
+
+		if (len < count)
+			break;
+	}
+	return (obuf - ostart) / 2;
+}
+
+template<bool stereo, bool reverseStereo>
+int BlockRateConverter<stereo, reverseStereo>::flow(AudioStream &input, int32 *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+	st_size_t done = 0;
+
+	while (done < osamp) {
+		st_size_t count = MIN<st_size_t>(osamp - done, kBlockFrames);
+		st_size_t len = convert(input, _block, count);
+
+		if (stereo)
+			_busFuncs->mixStereo(obuf + done * 2, _block, len, vol_l, vol_r, reverseStereo);
+		else
+			_busFuncs->mixMono(obuf + done * 2, _block, len, vol_l, vol_r);
+		done += len;
+
+		if (len < count)
+			break;
+	}
+	return done;
+}
+
 /**
  * Audio rate converter based on simple resampling. Used when no
  * interpolation is required.
@@ -64,7 +152,7 @@ enum {
  * Limited to sampling frequency <= 65535 Hz.
  */
 template<bool stereo, bool reverseStereo>
-class SimpleRateConverter : public RateConverter {
+class SimpleRateConverter : public BlockRateConverter<stereo, reverseStereo> {
 protected:
 	st_sample_t inBuf[INTERMEDIATE_BUFFER_SIZE];
 	const st_sample_t *inPtr;
@@ -77,12 +165,10 @@ protected:
 	/** fractional position increment in the output stream */
 	long opos_inc;
 
+	int convert(AudioStream &input, st_sample_t *frames, st_size_t count);
+
 public:
 	SimpleRateConverter(st_rate_t inrate, st_rate_t outrate);
-	int flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r);
-	int drain(st_sample_t *obuf, st_size_t osamp, st_volume_t vol) {
-		return ST_SUCCESS;
-	}
 };
 
 
@@ -108,17 +194,17 @@ SimpleRateConverter<stereo, reverseStereo>::SimpleRateConverter(st_rate_t inrate
 }
 
 /*
- * Processed signed long samples from ibuf to obuf.
- * Return number of sample pairs processed.
+ * Processed signed long samples from ibuf to frames.
+ * Return number of frames processed.
  */
 template<bool stereo, bool reverseStereo>
-int SimpleRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+int SimpleRateConverter<stereo, reverseStereo>::convert(AudioStream &input, st_sample_t *frames, st_size_t count) {
 	st_sample_t *ostart, *oend;
 
-	ostart = obuf;
-	oend = obuf + osamp * 2;
+	ostart = frames;
+	oend = frames + count * (stereo ? 2 : 1);
 
-	while (obuf < oend) {
+	while (frames < oend) {
 
 		// read enough input samples so that opos >= 0
 		do {
@@ -127,7 +213,7 @@ int SimpleRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_samp
 				inPtr = inBuf;
 				inLen = input.readBuffer(inBuf, ARRAYSIZE(inBuf));
 				if (inLen <= 0)
-					return (obuf - ostart) / 2;
+					return (frames - ostart) / (stereo ? 2 : 1);
 			}
 			inLen -= (stereo ? 2 : 1);
 			opos--;
@@ -136,22 +222,14 @@ int SimpleRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_samp
 			}
 		} while (opos >= 0);
 
-		st_sample_t out0, out1;
-		out0 = *inPtr++;
-		out1 = (stereo ? *inPtr++ : out0);
+		*frames++ = *inPtr++;
+		if (stereo)
+			*frames++ = *inPtr++;
 
 		// Increment output position
 		opos += opos_inc;
-
-		// output left channel
-		clampedAdd(obuf[reverseStereo    ], (out0 * (int)vol_l) / Audio::Mixer::kMaxMixerVolume);
-
-		// output right channel
-		clampedAdd(obuf[reverseStereo ^ 1], (out1 * (int)vol_r) / Audio::Mixer::kMaxMixerVolume);
-
-		obuf += 2;
 	}
-	return (obuf - ostart) / 2;
+	return (frames - ostart) / (stereo ? 2 : 1);
 }
 
 /**
@@ -166,7 +244,7 @@ int SimpleRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_samp
  */
 
 template<bool stereo, bool reverseStereo>
-class LinearRateConverter : public RateConverter {
+class LinearRateConverter : public BlockRateConverter<stereo, reverseStereo> {
 protected:
 	st_sample_t inBuf[INTERMEDIATE_BUFFER_SIZE];
 	const st_sample_t *inPtr;
@@ -183,12 +261,10 @@ protected:
 	/** current sample(s) in the input stream (left/right channel) */
 	st_sample_t icur0, icur1;
 
+	int convert(AudioStream &input, st_sample_t *frames, st_size_t count);
+
 public:
 	LinearRateConverter(st_rate_t inrate, st_rate_t outrate);
-	int flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r);
-	int drain(st_sample_t *obuf, st_size_t osamp, st_volume_t vol) {
-		return ST_SUCCESS;
-	}
 };
 
 
@@ -217,17 +293,17 @@ LinearRateConverter<stereo, reverseStereo>::LinearRateConverter(st_rate_t inrate
 }
 
 /*
- * Processed signed long samples from ibuf to obuf.
- * Return number of sample pairs processed.
+ * Processed signed long samples from ibuf to frames.
+ * Return number of frames processed.
  */
 template<bool stereo, bool reverseStereo>
-int LinearRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+int LinearRateConverter<stereo, reverseStereo>::convert(AudioStream &input, st_sample_t *frames, st_size_t count) {
 	st_sample_t *ostart, *oend;
 
-	ostart = obuf;
-	oend = obuf + osamp * 2;
+	ostart = frames;
+	oend = frames + count * (stereo ? 2 : 1);
 
-	while (obuf < oend) {
+	while (frames < oend) {
 
 		// read enough input samples so that opos < 0
 		while ((frac_t)FRAC_ONE_LOW <= opos) {
@@ -236,7 +312,7 @@ int LinearRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_samp
 				inPtr = inBuf;
 				inLen = input.readBuffer(inBuf, ARRAYSIZE(inBuf));
 				if (inLen <= 0)
-					return (obuf - ostart) / 2;
+					return (frames - ostart) / (stereo ? 2 : 1);
 			}
 			inLen -= (stereo ? 2 : 1);
 			ilast0 = icur0;
@@ -250,27 +326,17 @@ int LinearRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_samp
 
 		// Loop as long as the outpos trails behind, and as long as there is
 		// still space in the output buffer.
-		while (opos < (frac_t)FRAC_ONE_LOW && obuf < oend) {
+		while (opos < (frac_t)FRAC_ONE_LOW && frames < oend) {
 			// interpolate
-			st_sample_t out0, out1;
-			out0 = (st_sample_t)(ilast0 + (((icur0 - ilast0) * opos + FRAC_HALF_LOW) >> FRAC_BITS_LOW));
-			out1 = (stereo ?
-						  (st_sample_t)(ilast1 + (((icur1 - ilast1) * opos + FRAC_HALF_LOW) >> FRAC_BITS_LOW)) :
-						  out0);
-
-			// output left channel
-			clampedAdd(obuf[reverseStereo    ], (out0 * (int)vol_l) / Audio::Mixer::kMaxMixerVolume);
-
-			// output right channel
-			clampedAdd(obuf[reverseStereo ^ 1], (out1 * (int)vol_r) / Audio::Mixer::kMaxMixerVolume);
-
-			obuf += 2;
+			*frames++ = (st_sample_t)(ilast0 + (((icur0 - ilast0) * opos + FRAC_HALF_LOW) >> FRAC_BITS_LOW));
+			if (stereo)
+				*frames++ = (st_sample_t)(ilast1 + (((icur1 - ilast1) * opos + FRAC_HALF_LOW) >> FRAC_BITS_LOW));
 
 			// Increment output position
 			opos += opos_inc;
 		}
 	}
-	return (obuf - ostart) / 2;
+	return (frames - ostart) / (stereo ? 2 : 1);
 }
 
 
@@ -281,59 +347,16 @@ int LinearRateConverter<stereo, reverseStereo>::flow(AudioStream &input, st_samp
  * Simple audio rate converter for the case that the inrate equals the outrate.
  */
 template<bool stereo, bool reverseStereo>
-class CopyRateConverter : public RateConverter {
-	st_sample_t *_buffer;
-	st_size_t _bufferSize;
-public:
-	CopyRateConverter() : _buffer(0), _bufferSize(0) {}
-	~CopyRateConverter() {
-		free(_buffer);
-	}
-
-	virtual int flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) {
+class CopyRateConverter : public BlockRateConverter<stereo, reverseStereo> {
+protected:
+	int convert(AudioStream &input, st_sample_t *frames, st_size_t count) {
 		assert(input.isStereo() == stereo);
 
-		st_sample_t *ptr;
-		st_size_t len;
-
-		st_sample_t *ostart = obuf;
-
-		if (stereo)
-			osamp *= 2;
-
-		// Reallocate temp buffer, if necessary
-		if (osamp > _bufferSize) {
-			free(_buffer);
-			_buffer = (st_sample_t *)malloc(osamp * 2);
-			_bufferSize = osamp;
-		}
-
-		if (!_buffer)
-			error("[CopyRateConverter::flow] Cannot allocate memory for temp buffer");
-
-		// Read up to 'osamp' samples into our temporary buffer
-		len = input.readBuffer(_buffer, osamp);
-
-		// Mix the data into the output buffer
-		ptr = _buffer;
-		for (; len > 0; len -= (stereo ? 2 : 1)) {
-			st_sample_t out0, out1;
-			out0 = *ptr++;
-			out1 = (stereo ? *ptr++ : out0);
-
-			// output left channel
-			clampedAdd(obuf[reverseStereo    ], (out0 * (int)vol_l) / Audio::Mixer::kMaxMixerVolume);
-
-			// output right channel
-			clampedAdd(obuf[reverseStereo ^ 1], (out1 * (int)vol_r) / Audio::Mixer::kMaxMixerVolume);
-
-			obuf += 2;
-		}
-		return (obuf - ostart) / 2;
-	}
-
-	virtual int drain(st_sample_t *obuf, st_size_t osamp, st_volume_t vol) {
-		return ST_SUCCESS;
+		// Read up to 'count' frames straight into the block
+		int len = input.readBuffer(frames, count * (stereo ? 2 : 1));
+		if (len <= 0)
+			return 0;
+		return len / (stereo ? 2 : 1);
 	}
 };
 
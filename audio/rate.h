@@ -75,6 +75,14 @@ public:
 	 */
 	virtual int flow(AudioStream &input, st_sample_t *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r) = 0;
 
+	/**
+	 * Add the converted samples, multiplied by their volume, to a mixing bus.
+	 * See audio/mixbus.h.
+	 *
+	 * @return Number of sample pairs written into the bus.
+	 */
+	virtual int flow(AudioStream &input, int32 *obuf, st_size_t osamp, st_volume_t vol_l, st_volume_t vol_r);
+
 	virtual int drain(st_sample_t *obuf, st_size_t osamp, st_volume_t vol) = 0;
 };
 
@@ -34,6 +34,7 @@
 
 #include "backends/fs/posix/posix-fs.h"
 #include "backends/fs/posix/posix-iostream.h"
+#include "backends/fs/posix/posix-mmapstream.h"
 #include "common/algorithm.h"
 
 #include <sys/param.h>
@@ -287,6 +288,11 @@ AbstractFSNode *POSIXFilesystemNode::getParent() const {
 }
 
 Common::SeekableReadStream *POSIXFilesystemNode::createReadStream() {
+	// The archives read their members as views into the mapping of the file
+	Common::SeekableReadStream *stream = PosixMappedStream::makeFromPath(getPath());
+	if (stream)
+		return stream;
+
 	return PosixIoStream::makeFromPath(getPath(), false);
 }
 
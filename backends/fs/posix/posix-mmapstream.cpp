@@ -0,0 +1,84 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include "backends/fs/posix/posix-mmapstream.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#include <sys/mman.h>
+#define HAVE_POSIX_MMAP
+#endif
+
+#ifdef HAVE_POSIX_MMAP
+
+namespace {
+
+class PosixMapping : public Common::SharedMemoryReadStream::Owner {
+public:
+	PosixMapping(void *data, size_t size) : _data(data), _size(size) {}
+	~PosixMapping() override { munmap(_data, _size); }
+
+private:
+	void *_data;
+	size_t _size;
+};
+
+} // End of anonymous namespace
+
+PosixMappedStream *PosixMappedStream::makeFromPath(const Common::String &path) {
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd == -1)
+		return nullptr;
+
+	struct stat st;
+	if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode) || st.st_size < kMinMappedSize || st.st_size > 0x7FFFFFFF) {
+		close(fd);
+		return nullptr;
+	}
+
+	// The mapping stays valid once the file is closed
+	size_t size = st.st_size;
+	void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if (data == MAP_FAILED)
+		return nullptr;
+
+	return new PosixMappedStream(new PosixMapping(data, size), (const byte *)data, size);
+}
+
+#else
+
+PosixMappedStream *PosixMappedStream::makeFromPath(const Common::String &path) {
+	return nullptr;
+}
+
+#endif
+
+PosixMappedStream::PosixMappedStream(Owner *mapping, const byte *data, uint32 size) :
+		SharedMemoryReadStream(mapping, data, size) {
+}
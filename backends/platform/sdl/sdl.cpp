@@ -188,6 +188,13 @@ bool OSystem_SDL::hasFeature(Feature f) {
 	if (f == kFeatureJoystickDeadzone || f == kFeatureKbdMouseSpeed) {
 		return _eventSource->isJoystickConnected();
 	}
+	if (f == kFeatureCpuSSE2) return SDL_HasSSE2();
+#if SDL_VERSION_ATLEAST(2, 0, 4)
+	if (f == kFeatureCpuAVX2) return SDL_HasAVX2();
+#endif
+#if SDL_VERSION_ATLEAST(2, 0, 6)
+	if (f == kFeatureCpuNEON) return SDL_HasNEON();
+#endif
 	return ModularGraphicsBackend::hasFeature(f);
 }
 
@@ -660,6 +667,74 @@ void OSystem_SDL::delayMillis(uint msecs) {
 		SDL_Delay(msecs);
 }
 
+namespace {
+
+struct SdlThreadStart {
+	OSystem::ThreadProc proc;
+	void *param;
+};
+
+int SDLCALL sdlThreadEntry(void *data) {
+	SdlThreadStart start = *(SdlThreadStart *)data;
+	delete (SdlThreadStart *)data;
+	return start.proc(start.param);
+}
+
+} // End of anonymous namespace
+
+OSystem::ThreadRef OSystem_SDL::createThread(ThreadProc proc, void *param) {
+	SdlThreadStart *start = new SdlThreadStart();
+	start->proc = proc;
+	start->param = param;
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	SDL_Thread *thread = SDL_CreateThread(sdlThreadEntry, "worker", start);
+#else
+	SDL_Thread *thread = SDL_CreateThread(sdlThreadEntry, start);
+#endif
+	if (!thread) {
+		warning("Could not create thread: %s", SDL_GetError());
+		delete start;
+		return 0;
+	}
+
+	return (ThreadRef)thread;
+}
+
+int OSystem_SDL::waitThread(ThreadRef thread) {
+	int status = 0;
+	SDL_WaitThread((SDL_Thread *)thread, &status);
+	return status;
+}
+
+OSystem::SemaphoreRef OSystem_SDL::createSemaphore(uint value) {
+	SDL_sem *semaphore = SDL_CreateSemaphore(value);
+	if (!semaphore)
+		warning("Could not create semaphore: %s", SDL_GetError());
+	return (SemaphoreRef)semaphore;
+}
+
+void OSystem_SDL::waitSemaphore(SemaphoreRef semaphore) {
+	SDL_SemWait((SDL_sem *)semaphore);
+}
+
+void OSystem_SDL::signalSemaphore(SemaphoreRef semaphore) {
+	SDL_SemPost((SDL_sem *)semaphore);
+}
+
+void OSystem_SDL::deleteSemaphore(SemaphoreRef semaphore) {
+	SDL_DestroySemaphore((SDL_sem *)semaphore);
+}
+
+uint OSystem_SDL::getCPUCount() {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	int count = SDL_GetCPUCount();
+	return count > 1 ? count : 1;
+#else
+	return 1;
+#endif
+}
+
 void OSystem_SDL::getTimeAndDate(TimeDate &td) const {
 	time_t curTime = time(0);
 	struct tm t = *localtime(&curTime);
@@ -84,6 +84,13 @@ public:
 	virtual void addSysArchivesToSearchSet(Common::SearchSet &s, int priority = 0) override;
 	virtual uint32 getMillis(bool skipRecord = false) override;
 	virtual void delayMillis(uint msecs) override;
+	virtual ThreadRef createThread(ThreadProc proc, void *param) override;
+	virtual int waitThread(ThreadRef thread) override;
+	virtual SemaphoreRef createSemaphore(uint value) override;
+	virtual void waitSemaphore(SemaphoreRef semaphore) override;
+	virtual void signalSemaphore(SemaphoreRef semaphore) override;
+	virtual void deleteSemaphore(SemaphoreRef semaphore) override;
+	virtual uint getCPUCount() override;
 	virtual void getTimeAndDate(TimeDate &td) const override;
 	virtual MixerManager *getMixerManager() override;
 	virtual Common::TimerManager *getTimerManager() override;
@@ -31,90 +31,124 @@ struct TimerSlot {
 	Common::String id;
 	uint32 interval;	// in microseconds
 
-	uint32 nextFireTime;	// in milliseconds
-	uint32 nextFireTimeMicro;	// microseconds part of nextFire
+	uint32 nextFireTime;	// in microseconds, wraps around
+	uint32 order;	// Orders the slots firing at the same time by insertion
 
-	TimerSlot *next;
+	// Owned by the timer manager, kept when the timer is removed
+	Common::TimerManager::TimerStats *stats;
 
-	TimerSlot() : callback(nullptr), refCon(nullptr), interval(0), nextFireTime(0), nextFireTimeMicro(0), next(nullptr) {}
+	TimerSlot() : callback(nullptr), refCon(nullptr), interval(0), nextFireTime(0), order(0), stats(nullptr) {}
 };
 
-void insertPrioQueue(TimerSlot *head, TimerSlot *newSlot) {
-	// The head points to a fake anchor TimerSlot; this common
-	// trick allows us to get rid of many special cases.
+// The times wrap around, they are compared through their difference
+static inline bool firesBefore(const TimerSlot *a, const TimerSlot *b) {
+	int32 diff = (int32)(a->nextFireTime - b->nextFireTime);
+	if (diff != 0)
+		return diff < 0;
+	return (int32)(a->order - b->order) < 0;
+}
 
-	const uint32 nextFireTime = newSlot->nextFireTime;
-	TimerSlot *slot = head;
-	newSlot->next = 0;
+static void siftUp(Common::Array<TimerSlot *> &heap, uint index) {
+	TimerSlot *slot = heap[index];
+	while (index > 0) {
+		uint parent = (index - 1) / 2;
+		if (!firesBefore(slot, heap[parent]))
+			break;
+		heap[index] = heap[parent];
+		index = parent;
+	}
+	heap[index] = slot;
+}
 
-	// Insert the new slot into the sorted list of already scheduled
-	// timers in such a way that the list stays sorted...
+static void siftDown(Common::Array<TimerSlot *> &heap, uint index) {
+	TimerSlot *slot = heap[index];
+	const uint size = heap.size();
 	while (true) {
-		assert(slot);
-		if (slot->next == 0 || nextFireTime < slot->next->nextFireTime) {
-			newSlot->next = slot->next;
-			slot->next = newSlot;
-			return;
-		}
-		slot = slot->next;
+		uint child = index * 2 + 1;
+		if (child >= size)
+			break;
+		if (child + 1 < size && firesBefore(heap[child + 1], heap[child]))
+			child++;
+		if (!firesBefore(heap[child], slot))
+			break;
+		heap[index] = heap[child];
+		index = child;
 	}
+	heap[index] = slot;
 }
 
 
 DefaultTimerManager::DefaultTimerManager() :
-	_timerCallbackNext(0),
-	_head(0) {
-
-	_head = new TimerSlot();
+	_insertions(0),
+	_timerCallbackNext(0) {
 }
 
 DefaultTimerManager::~DefaultTimerManager() {
 	Common::StackLock lock(_mutex);
 
-	TimerSlot *slot = _head;
-	while (slot) {
-		TimerSlot *next = slot->next;
-		delete slot;
-		slot = next;
-	}
-	_head = 0;
+	for (uint i = 0; i < _queue.size(); i++)
+		delete _queue[i];
+	_queue.clear();
+
+	for (TimerStatsMap::iterator i = _stats.begin(); i != _stats.end(); ++i)
+		delete i->_value;
+	_stats.clear();
+}
+
+uint32 DefaultTimerManager::getMicroseconds() {
+	// The product wraps around along with the milliseconds
+	return g_system->getMillis(true) * 1000;
+}
+
+void DefaultTimerManager::pushSlot(TimerSlot *slot) {
+	slot->order = _insertions++;
+	_queue.push_back(slot);
+	siftUp(_queue, _queue.size() - 1);
 }
 
 void DefaultTimerManager::handler() {
 	Common::StackLock lock(_mutex);
 
-	uint32 curTime = g_system->getMillis(true);
-
-	// On slow systems this could still be run after destructor
-	if (!_head)
-		return;
+	uint32 curTime = getMicroseconds();
 
 	// Repeat as long as there is a TimerSlot that is scheduled to fire.
-	TimerSlot *slot = _head->next;
-	while (slot && slot->nextFireTime < curTime) {
-		// Remove the slot from the priority queue
-		_head->next = slot->next;
-
-		// Update the fire time and reinsert the TimerSlot into the priority
-		// queue.
+	// On slow systems this could still be run after destructor, the queue is empty then.
+	while (!_queue.empty() && (int32)(curTime - _queue[0]->nextFireTime) >= 0) {
+		TimerSlot *slot = _queue[0];
+		uint32 fireTime = slot->nextFireTime;
+
+		// Update the fire time and move the TimerSlot to its new place in the
+		// priority queue. The fire time only depends on the interval, so the
+		// calls don't drift when the handler is late.
 		assert(slot->interval > 0);
-		slot->nextFireTime += (slot->interval / 1000);
-		slot->nextFireTimeMicro += (slot->interval % 1000);
-		if (slot->nextFireTimeMicro > 1000) {
-			slot->nextFireTime += slot->nextFireTimeMicro / 1000;
-			slot->nextFireTimeMicro %= 1000;
-		}
-		insertPrioQueue(_head, slot);
+		slot->nextFireTime += slot->interval;
+		slot->order = _insertions++;
+		siftDown(_queue, 0);
 
-		// Invoke the timer callback
+		// Invoke the timer callback, which may remove the timer
 		assert(slot->callback);
+		Common::TimerManager::TimerStats *stats = slot->stats;
+		uint32 startTime = getMicroseconds();
 		slot->callback(slot->refCon);
+		uint32 endTime = getMicroseconds();
 
-		// Look at the next scheduled timer
-		slot = _head->next;
+		int32 lateness = (int32)(startTime - fireTime);
+		stats->addCall(MAX<int32>(lateness, 0), endTime - startTime);
 	}
 }
 
+uint32 DefaultTimerManager::getTimeToNextTimer(uint32 maximum) {
+	Common::StackLock lock(_mutex);
+
+	if (_queue.empty())
+		return maximum;
+
+	int32 delay = (int32)(_queue[0]->nextFireTime - getMicroseconds());
+	if (delay <= 0)
+		return 0;
+	return MIN<uint32>(delay, maximum);
+}
+
 void DefaultTimerManager::checkTimers(uint32 interval) {
 	uint32 curTime = g_system->getMillis();
 
@@ -143,16 +177,22 @@ bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, v
 	}
 	_callbacks[id] = callback;
 
+	// Timers reinstalled with the same id keep adding to the same statistics
+	TimerStats *&stats = _stats[id];
+	if (!stats) {
+		stats = new TimerStats();
+		stats->id = id;
+	}
+
 	TimerSlot *slot = new TimerSlot;
 	slot->callback = callback;
 	slot->refCon = refCon;
 	slot->id = id;
 	slot->interval = interval;
-	slot->nextFireTime = g_system->getMillis() + interval / 1000;
-	slot->nextFireTimeMicro = interval % 1000;
-	slot->next = 0;
+	slot->nextFireTime = getMicroseconds() + interval;
+	slot->stats = stats;
 
-	insertPrioQueue(_head, slot);
+	pushSlot(slot);
 
 	return true;
 }
@@ -160,17 +200,17 @@ bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, v
 void DefaultTimerManager::removeTimerProc(TimerProc callback) {
 	Common::StackLock lock(_mutex);
 
-	TimerSlot *slot = _head;
-
-	while (slot->next) {
-		if (slot->next->callback == callback) {
-			TimerSlot *next = slot->next->next;
-			delete slot->next;
-			slot->next = next;
-		} else {
-			slot = slot->next;
-		}
+	// Keep the other slots in their order, then restore the heap property
+	uint kept = 0;
+	for (uint i = 0; i < _queue.size(); i++) {
+		if (_queue[i]->callback == callback)
+			delete _queue[i];
+		else
+			_queue[kept++] = _queue[i];
 	}
+	_queue.resize(kept);
+	for (uint i = kept / 2; i-- > 0; )
+		siftDown(_queue, i);
 
 	// We need to remove all names referencing the timer proc here.
 	//
@@ -189,3 +229,18 @@ void DefaultTimerManager::removeTimerProc(TimerProc callback) {
 			_callbacks.erase(i);
 	}
 }
+
+void DefaultTimerManager::getTimerStats(Common::Array<TimerStats> &stats) {
+	Common::StackLock lock(_mutex);
+
+	stats.clear();
+	for (TimerStatsMap::const_iterator i = _stats.begin(); i != _stats.end(); ++i)
+		stats.push_back(*i->_value);
+}
+
+void DefaultTimerManager::resetTimerStats() {
+	Common::StackLock lock(_mutex);
+
+	for (TimerStatsMap::iterator i = _stats.begin(); i != _stats.end(); ++i)
+		i->_value->reset();
+}
@@ -23,6 +23,7 @@
 #ifndef BACKENDS_TIMER_DEFAULT_H
 #define BACKENDS_TIMER_DEFAULT_H
 
+#include "common/array.h"
 #include "common/str.h"
 #include "common/hash-str.h"
 #include "common/timer.h"
@@ -33,24 +34,48 @@ struct TimerSlot;
 class DefaultTimerManager : public Common::TimerManager {
 private:
 	typedef Common::HashMap<Common::String, TimerProc, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> TimerSlotMap;
+	typedef Common::HashMap<Common::String, TimerStats *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> TimerStatsMap;
 
 	Common::Mutex _mutex;
-	TimerSlot *_head;
+	// Binary heap of the installed timers, the next one to fire first
+	Common::Array<TimerSlot *> _queue;
+	uint32 _insertions;
 	TimerSlotMap _callbacks;
+	TimerStatsMap _stats;
 
 	uint32 _timerCallbackNext;
 
+	void pushSlot(TimerSlot *slot);
+
+protected:
+	/**
+	 * Current time of the timers, in microseconds. It can wrap around.
+	 * The default implementation only has a millisecond resolution.
+	 */
+	virtual uint32 getMicroseconds();
+
 public:
 	DefaultTimerManager();
 	virtual ~DefaultTimerManager();
 	virtual bool installTimerProc(TimerProc proc, int32 interval, void *refCon, const Common::String &id);
 	virtual void removeTimerProc(TimerProc proc);
+	virtual void getTimerStats(Common::Array<TimerStats> &stats);
+	virtual void resetTimerStats();
 
 	/**
 	 * Timer callback, to be invoked at regular time intervals by the backend.
 	 */
 	void handler();
 
+	/**
+	 * Get the time until the next timer fires, to know how long the backend
+	 * can wait before calling handler().
+	 *
+	 * @param maximum	the value to return when no timer fires sooner
+	 * @return the time in microseconds, 0 if a timer is due
+	 */
+	uint32 getTimeToNextTimer(uint32 maximum);
+
 	/*
 	 * Ensure that the callback is called at regular time intervals.
 	 * Should be called from pollEvents() on backends without threads.
@@ -27,34 +27,69 @@
 
 #include "backends/timer/sdl/sdl-timer.h"
 
+#include "common/atomic.h"
 #include "common/textconsole.h"
+#include "common/util.h"
 
-OSystem::MutexRef timerMutex;
+enum {
+	// Longest time the thread sleeps, so that it notices the new timers
+	kMaxTimerSleep = 10000
+};
 
-static Uint32 timer_handler(Uint32 interval, void *param) {
-	Common::StackLock lock(timerMutex);
-
-	((DefaultTimerManager *)param)->handler();
-	return interval;
+static int timerThread(void *param) {
+	((SdlTimerManager *)param)->run();
+	return 0;
 }
 
-SdlTimerManager::SdlTimerManager() {
+SdlTimerManager::SdlTimerManager() : _stopThread(0) {
 	// Initializes the SDL timer subsystem
 	if (SDL_InitSubSystem(SDL_INIT_TIMER) == -1) {
 		error("Could not initialize SDL: %s", SDL_GetError());
 	}
 
-	// Creates the timer callback
-	_timerID = SDL_AddTimer(10, &timer_handler, this);
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	_counterFrequency = SDL_GetPerformanceFrequency();
+#endif
+
+	// Creates the timer thread
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	_thread = SDL_CreateThread(timerThread, "timer", this);
+#else
+	_thread = SDL_CreateThread(timerThread, this);
+#endif
+	if (!_thread) {
+		error("Could not create the timer thread: %s", SDL_GetError());
+	}
 }
 
 SdlTimerManager::~SdlTimerManager() {
-	Common::StackLock lock(timerMutex);
-
-	// Removes the timer callback
-	SDL_RemoveTimer(_timerID);
+	// Stops the timer thread
+	Common::atomicStore(&_stopThread, 1);
+	SDL_WaitThread(_thread, nullptr);
 
 	SDL_QuitSubSystem(SDL_INIT_TIMER);
 }
 
+uint32 SdlTimerManager::getMicroseconds() {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	// Split the conversion, so that the product doesn't overflow
+	uint64 counter = SDL_GetPerformanceCounter();
+	return (uint32)((counter / _counterFrequency) * 1000000 + (counter % _counterFrequency) * 1000000 / _counterFrequency);
+#else
+	return SDL_GetTicks() * 1000;
+#endif
+}
+
+void SdlTimerManager::run() {
+	while (!Common::atomicLoad(&_stopThread)) {
+		handler();
+
+		// SDL can only sleep whole milliseconds, the timers can be up to
+		// a millisecond late.
+		uint32 delay = getTimeToNextTimer(kMaxTimerSleep);
+		if (delay > 0)
+			SDL_Delay(MAX<uint32>(delay / 1000, 1));
+	}
+}
+
 #endif
@@ -28,16 +28,27 @@
 #include "backends/platform/sdl/sdl-sys.h"
 
 /**
- * SDL timer manager. Setups the timer callback for
- * DefaultTimerManager.
+ * SDL timer manager. Calls the DefaultTimerManager handler from a
+ * thread of its own, which sleeps until the next timer is due.
  */
 class SdlTimerManager : public DefaultTimerManager {
 public:
 	SdlTimerManager();
 	virtual ~SdlTimerManager();
 
+	/**
+	 * Body of the timer thread.
+	 */
+	void run();
+
 protected:
-	SDL_TimerID _timerID;
+	virtual uint32 getMicroseconds();
+
+	SDL_Thread *_thread;
+	volatile int32 _stopThread;
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	uint64 _counterFrequency;
+#endif
 };
 
 
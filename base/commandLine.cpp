@@ -161,6 +161,8 @@ static const char HELP_STRING[] =
 	"  --aspect-ratio           Enable aspect ratio correction\n"
 	"  --[no-]dirtyrects        Enable dirty rectangles optimisation in software renderer\n"
 	"                           (default: enabled)\n"
+	"  --[no-]tiledrendering    Enable multi-threaded tiled rendering in software renderer\n"
+	"                           (default: disabled)\n"
 #endif
 #if 0 // ResidulVM - not used
 	"  --render-mode=MODE       Enable additional render modes (hercGreen, hercAmber,\n"
@@ -258,6 +260,7 @@ void registerDefaults() {
 // ResidualVM specific start
 	ConfMan.registerDefault("show_fps", false);
 	ConfMan.registerDefault("dirtyrects", true);
+	ConfMan.registerDefault("tiledrendering", false);
 	ConfMan.registerDefault("vsync", true);
 // ResidualVM specific end
 
@@ -729,6 +732,9 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_LONG_OPTION_BOOL("dirtyrects")
 			END_OPTION
 
+			DO_LONG_OPTION_BOOL("tiledrendering")
+			END_OPTION
+
 			DO_LONG_OPTION("gamma")
 			END_OPTION
 
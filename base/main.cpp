@@ -44,6 +44,7 @@
 #include "common/events.h"
 #include "gui/EventRecorder.h"
 #include "common/fs.h"
+#include "common/jobs.h"
 #ifdef ENABLE_EVENTRECORDER
 #include "common/recorderfile.h"
 #endif
@@ -710,6 +711,7 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 #endif
 	EngineManager::destroy();
 	Graphics::YUVToRGBManager::destroy();
+	Common::JobManager::destroy();
 
 	return 0;
 }
@@ -94,10 +94,11 @@ void SearchSet::insert(const Node &node) {
 	_list.insert(it, node);
 }
 
-void SearchSet::add(const String &name, Archive *archive, int priority, bool autoFree) {
+void SearchSet::add(const String &name, Archive *archive, int priority, bool autoFree, bool indexMembers) {
 	if (find(name) == _list.end()) {
-		Node node(priority, name, archive, autoFree);
+		Node node(priority, name, archive, autoFree, indexMembers);
 		insert(node);
+		invalidateMemberIndex();
 	} else {
 		if (autoFree)
 			delete archive;
@@ -173,6 +174,7 @@ void SearchSet::remove(const String &name) {
 		if (it->_autoFree)
 			delete it->_arc;
 		_list.erase(it);
+		invalidateMemberIndex();
 	}
 }
 
@@ -187,6 +189,7 @@ void SearchSet::clear() {
 	}
 
 	_list.clear();
+	invalidateMemberIndex();
 }
 
 void SearchSet::setPriority(const String &name, int priority) {
@@ -203,19 +206,57 @@ void SearchSet::setPriority(const String &name, int priority) {
 	_list.erase(it);
 	node._priority = priority;
 	insert(node);
+	invalidateMemberIndex();
+}
+
+void SearchSet::invalidateMemberIndex() {
+	_memberIndex.clear(true);
+	_memberIndexValid = false;
+}
+
+Archive *SearchSet::findIndexedArchive(const String &name) const {
+	if (!_memberIndexValid) {
+		// The list is sorted by descending priority, the first archive listing a member wins
+		for (ArchiveNodeList::const_iterator it = _list.begin(); it != _list.end(); ++it) {
+			if (!it->_indexed)
+				continue;
+
+			ArchiveMemberList members;
+			it->_arc->listMembers(members);
+			for (ArchiveMemberList::const_iterator member = members.begin(); member != members.end(); ++member) {
+				String memberName = (*member)->getName();
+				if (!_memberIndex.contains(memberName))
+					_memberIndex[memberName] = it->_arc;
+			}
+		}
+
+		_memberIndexValid = true;
+	}
+
+	return _memberIndex.getVal(name, nullptr);
+}
+
+Archive *SearchSet::findArchive(const String &name) const {
+	Archive *indexed = findIndexedArchive(name);
+
+	// Only the archives which aren't indexed need to be asked
+	for (ArchiveNodeList::const_iterator it = _list.begin(); it != _list.end(); ++it) {
+		if (it->_indexed) {
+			if (it->_arc == indexed)
+				return indexed;
+		} else if (it->_arc->hasFile(name)) {
+			return it->_arc;
+		}
+	}
+
+	return nullptr;
 }
 
 bool SearchSet::hasFile(const String &name) const {
 	if (name.empty())
 		return false;
 
-	ArchiveNodeList::const_iterator it = _list.begin();
-	for (; it != _list.end(); ++it) {
-		if (it->_arc->hasFile(name))
-			return true;
-	}
-
-	return false;
+	return findArchive(name) != nullptr;
 }
 
 int SearchSet::listMatchingMembers(ArchiveMemberList &list, const String &pattern) const {
@@ -242,11 +283,9 @@ const ArchiveMemberPtr SearchSet::getMember(const String &name) const {
 	if (name.empty())
 		return ArchiveMemberPtr();
 
-	ArchiveNodeList::const_iterator it = _list.begin();
-	for (; it != _list.end(); ++it) {
-		if (it->_arc->hasFile(name))
-			return it->_arc->getMember(name);
-	}
+	Archive *archive = findArchive(name);
+	if (archive)
+		return archive->getMember(name);
 
 	return ArchiveMemberPtr();
 }
@@ -255,8 +294,13 @@ SeekableReadStream *SearchSet::createReadStreamForMember(const String &name) con
 	if (name.empty())
 		return nullptr;
 
+	Archive *indexed = findIndexedArchive(name);
+
 	ArchiveNodeList::const_iterator it = _list.begin();
 	for (; it != _list.end(); ++it) {
+		if (it->_indexed && it->_arc != indexed)
+			continue;
+
 		SeekableReadStream *stream = it->_arc->createReadStreamForMember(name);
 		if (stream)
 			return stream;
@@ -24,6 +24,8 @@
 #define COMMON_ARCHIVE_H
 
 #include "common/str.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
 #include "common/list.h"
 #include "common/ptr.h"
 #include "common/singleton.h"
@@ -144,6 +146,11 @@ public:
  * contained Archives, hence the simplistic policy of always looking for the first
  * match. SearchSet does guarantee that searches are performed in DESCENDING
  * priority order. In case of conflicting priorities, insertion order prevails.
+ *
+ * The members of the archives added with indexMembers set are looked up in a
+ * combined index, which maps their names to the archive with the highest
+ * priority containing them. It is built the first time a file is looked up,
+ * and rebuilt after the set of archives has changed.
  */
 class SearchSet : public Archive {
 	struct Node {
@@ -151,8 +158,9 @@ class SearchSet : public Archive {
 		String	_name;
 		Archive	*_arc;
 		bool	_autoFree;
-		Node(int priority, const String &name, Archive *arc, bool autoFree)
-			: _priority(priority), _name(name), _arc(arc), _autoFree(autoFree) {
+		bool	_indexed;
+		Node(int priority, const String &name, Archive *arc, bool autoFree, bool indexed)
+			: _priority(priority), _name(name), _arc(arc), _autoFree(autoFree), _indexed(indexed) {
 		}
 	};
 	typedef List<Node> ArchiveNodeList;
@@ -163,16 +171,29 @@ class SearchSet : public Archive {
 
 	void insert(const Node& node); //!< Add an archive keeping the list sorted by descending priority.
 
+	typedef HashMap<String, Archive *, IgnoreCase_Hash, IgnoreCase_EqualTo> MemberIndex;
+	mutable MemberIndex _memberIndex;
+	mutable bool _memberIndexValid;
+
+	void invalidateMemberIndex();
+	Archive *findIndexedArchive(const String &name) const; //!< The indexed archive with the highest priority containing the member.
+	Archive *findArchive(const String &name) const; //!< The archive with the highest priority containing the member.
+
 	bool _ignoreClashes;
 
 public:
-	SearchSet() : _ignoreClashes(false) { }
+	SearchSet() : _memberIndexValid(false), _ignoreClashes(false) { }
 	virtual ~SearchSet() { clear(); }
 
 	/**
 	 * Add a new archive to the searchable set.
+	 *
+	 * @param indexMembers Look up the members of the archive in the combined
+	 *                     index instead of asking the archive. Only suitable for
+	 *                     archives whose members don't change, and which list
+	 *                     all the names hasFile() accepts in listMembers().
 	 */
-	void add(const String& name, Archive *arch, int priority = 0, bool autoFree = true);
+	void add(const String& name, Archive *arch, int priority = 0, bool autoFree = true, bool indexMembers = false);
 
 	/**
 	 * Create and add a FSDirectory by name.
@@ -0,0 +1,105 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_ATOMIC_H
+#define COMMON_ATOMIC_H
+
+#include "common/scummsys.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Common {
+
+/**
+ * @defgroup common_atomic Atomic operations
+ * @ingroup common
+ *
+ * @brief Atomic operations on 32 bit integers, for the few structures shared
+ * between threads without a mutex.
+ *
+ * All the operations are sequentially consistent: they are seen in the same
+ * order by every thread, and no memory access is moved across them.
+ *
+ * @{
+ */
+
+/** Read the value. */
+inline int32 atomicLoad(const volatile int32 *ptr) {
+#if defined(__ATOMIC_SEQ_CST)
+	return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+#elif defined(_MSC_VER)
+	return _InterlockedCompareExchange((volatile long *)ptr, 0, 0);
+#else
+	return __sync_fetch_and_add((volatile int32 *)ptr, 0);
+#endif
+}
+
+/** Write the value. */
+inline void atomicStore(volatile int32 *ptr, int32 value) {
+#if defined(__ATOMIC_SEQ_CST)
+	__atomic_store_n(ptr, value, __ATOMIC_SEQ_CST);
+#elif defined(_MSC_VER)
+	_InterlockedExchange((volatile long *)ptr, value);
+#else
+	__sync_synchronize();
+	*ptr = value;
+	__sync_synchronize();
+#endif
+}
+
+/**
+ * Add delta to the value.
+ *
+ * @return the new value.
+ */
+inline int32 atomicAdd(volatile int32 *ptr, int32 delta) {
+#if defined(__ATOMIC_SEQ_CST)
+	return __atomic_add_fetch(ptr, delta, __ATOMIC_SEQ_CST);
+#elif defined(_MSC_VER)
+	return _InterlockedExchangeAdd((volatile long *)ptr, delta) + delta;
+#else
+	return __sync_add_and_fetch(ptr, delta);
+#endif
+}
+
+/**
+ * Replace the value with newValue if it is equal to expected.
+ *
+ * @return true if the value was replaced.
+ */
+inline bool atomicCompareExchange(volatile int32 *ptr, int32 expected, int32 newValue) {
+#if defined(__ATOMIC_SEQ_CST)
+	return __atomic_compare_exchange_n(ptr, &expected, newValue, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#elif defined(_MSC_VER)
+	return _InterlockedCompareExchange((volatile long *)ptr, newValue, expected) == expected;
+#else
+	return __sync_bool_compare_and_swap(ptr, expected, newValue);
+#endif
+}
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
@@ -24,6 +24,7 @@
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/memstream.h"
 #include "common/textconsole.h"
 #include "common/system.h"
 #include "backends/fs/fs-factory.h"
@@ -128,6 +129,10 @@ int32 File::pos() const {
 	return _handle->pos();
 }
 
+SharedMemoryReadStream *File::getMappedStream() const {
+	return dynamic_cast<SharedMemoryReadStream *>(_handle);
+}
+
 int32 File::size() const {
 	assert(_handle);
 	return _handle->size();
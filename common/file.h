@@ -41,6 +41,7 @@ namespace Common {
  */
 
 class Archive;
+class SharedMemoryReadStream;
 
 /**
  * TODO: vital to document this core class properly!!! For both users and implementors
@@ -126,6 +127,17 @@ public:
 	 */
 	const char *getName() const { return _name.c_str(); }
 
+	/**
+	 * Returns the contents of the file as a stream over memory shared with
+	 * the backend, when the backend mapped the file into memory.
+	 *
+	 * Streams over ranges of the file created from it don't copy the data,
+	 * and stay valid after the file is closed.
+	 *
+	 * @return: the mapped contents, or 0 if the file isn't mapped
+	 */
+	SharedMemoryReadStream *getMappedStream() const;
+
 	bool err() const override;	// implement abstract Stream method
 	void clearErr() override;	// implement abstract Stream method
 	bool eos() const override;	// implement abstract SeekableReadStream method
@@ -0,0 +1,136 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/jobs.h"
+#include "common/atomic.h"
+#include "common/util.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(JobManager);
+
+enum {
+	kMaxJobThreads = 16
+};
+
+JobPool::JobPool() : _started(false), _quit(false), _busy(0), _done(0),
+	_proc(nullptr), _params(nullptr), _count(0), _stride(1) {
+}
+
+JobPool::~JobPool() {
+	_quit = true;
+	for (uint i = 0; i < _workers.size(); i++)
+		g_system->signalSemaphore(_workers[i]->start);
+
+	for (uint i = 0; i < _workers.size(); i++) {
+		g_system->waitThread(_workers[i]->thread);
+		g_system->deleteSemaphore(_workers[i]->start);
+		delete _workers[i];
+	}
+
+	if (_done)
+		g_system->deleteSemaphore(_done);
+}
+
+void JobPool::startWorkers() {
+	_started = true;
+	if (!g_system)
+		return;
+
+	uint threadCount = MIN<uint>(g_system->getCPUCount(), kMaxJobThreads);
+	if (threadCount <= 1)
+		return;
+
+	_done = g_system->createSemaphore(0);
+	if (!_done)
+		return;
+
+	// The calling thread runs the first slice of the jobs
+	for (uint i = 1; i < threadCount; i++) {
+		Worker *worker = new Worker();
+		worker->pool = this;
+		worker->first = i;
+		worker->start = g_system->createSemaphore(0);
+		worker->thread = worker->start ? g_system->createThread(workerEntry, worker) : 0;
+		if (!worker->thread) {
+			if (worker->start)
+				g_system->deleteSemaphore(worker->start);
+			delete worker;
+			break;
+		}
+		_workers.push_back(worker);
+	}
+}
+
+void JobPool::runSlice(uint first) {
+	for (uint i = first; i < _count; i += _stride)
+		_proc(_params[i]);
+}
+
+int JobPool::workerEntry(void *param) {
+	Worker *worker = (Worker *)param;
+	JobPool *pool = worker->pool;
+
+	while (true) {
+		g_system->waitSemaphore(worker->start);
+		if (pool->_quit)
+			break;
+
+		pool->runSlice(worker->first);
+		g_system->signalSemaphore(pool->_done);
+	}
+	return 0;
+}
+
+void JobPool::run(JobProc proc, void *const *params, uint count) {
+	// Nothing to share, or another thread is using the workers
+	if (count <= 1 || !atomicCompareExchange(&_busy, 0, 1)) {
+		for (uint i = 0; i < count; i++)
+			proc(params[i]);
+		return;
+	}
+
+	if (!_started)
+		startWorkers();
+
+	uint threadCount = MIN<uint>(count, _workers.size() + 1);
+	_proc = proc;
+	_params = params;
+	_count = count;
+	_stride = threadCount;
+
+	for (uint i = 1; i < threadCount; i++)
+		g_system->signalSemaphore(_workers[i - 1]->start);
+
+	runSlice(0);
+
+	for (uint i = 1; i < threadCount; i++)
+		g_system->waitSemaphore(_done);
+
+	atomicStore(&_busy, 0);
+}
+
+void runJobs(JobProc proc, void *const *params, uint count) {
+	JobManager::instance().run(proc, params, count);
+}
+
+} // End of namespace Common
@@ -0,0 +1,115 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_JOBS_H
+#define COMMON_JOBS_H
+
+#include "common/scummsys.h"
+#include "common/array.h"
+#include "common/noncopyable.h"
+#include "common/singleton.h"
+#include "common/system.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_jobs Parallel jobs
+ * @ingroup common
+ *
+ * @brief Helpers for running independent CPU bound jobs on worker threads.
+ * @{
+ */
+
+typedef void (*JobProc)(void *param);
+
+/**
+ * A set of worker threads, started on the first run and kept waiting for
+ * the next one, so that running jobs often only costs waking them up.
+ *
+ * When the backend supports worker threads and semaphores, the pool has
+ * OSystem::getCPUCount() - 1 workers, the calling thread running jobs as
+ * well. Otherwise the jobs are simply run one after another on the calling
+ * thread.
+ */
+class JobPool : NonCopyable {
+public:
+	JobPool();
+	~JobPool();
+
+	/**
+	 * Call proc once for each of the given parameters, and return once all
+	 * the calls have completed.
+	 *
+	 * The jobs must not depend on each other, and must not use any engine or
+	 * OSystem functionality which is not thread safe. While the pool runs
+	 * jobs, the jobs run by other threads are made on those threads.
+	 *
+	 * @param proc   the function to call.
+	 * @param params the parameters to pass to each call.
+	 * @param count  the number of parameters.
+	 */
+	void run(JobProc proc, void *const *params, uint count);
+
+private:
+	struct Worker {
+		JobPool *pool;
+		uint first;
+		OSystem::SemaphoreRef start;
+		OSystem::ThreadRef thread;
+	};
+
+	void startWorkers();
+	void runSlice(uint first);
+	static int workerEntry(void *param);
+
+	Array<Worker *> _workers;
+	bool _started;
+	bool _quit;
+	volatile int32 _busy;
+	OSystem::SemaphoreRef _done;
+
+	// The current batch
+	JobProc _proc;
+	void *const *_params;
+	uint _count;
+	uint _stride;
+};
+
+/** The pool used by runJobs(). */
+class JobManager : public JobPool, public Singleton<JobManager> {
+private:
+	friend class Singleton<SingletonBaseType>;
+	JobManager() {}
+};
+
+/**
+ * Run the jobs on the worker threads shared by all callers.
+ *
+ * @see JobPool::run
+ */
+void runJobs(JobProc proc, void *const *params, uint count);
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
@@ -23,6 +23,7 @@
 #ifndef COMMON_MEMSTREAM_H
 #define COMMON_MEMSTREAM_H
 
+#include "common/atomic.h"
 #include "common/stream.h"
 #include "common/types.h"
 #include "common/util.h"
@@ -82,6 +83,65 @@ public:
 };
 
 
+/**
+ * A MemoryReadStream over memory shared with other streams, such as a memory
+ * mapped file. Streams over a range of it can be created without copying the
+ * data, the memory is released once the last stream using it is deleted.
+ */
+class SharedMemoryReadStream : public MemoryReadStream {
+public:
+	/**
+	 * Releases the shared memory when deleted.
+	 *
+	 * The streams using the memory may be created and deleted from several
+	 * threads, so the owner counts its references atomically.
+	 */
+	class Owner {
+	public:
+		Owner() : _refCount(0) {}
+		virtual ~Owner() {}
+
+		void incRef() { atomicAdd(&_refCount, 1); }
+		void decRef() {
+			if (atomicAdd(&_refCount, -1) == 0)
+				delete this;
+		}
+
+	private:
+		volatile int32 _refCount;
+	};
+
+	/** The owner is deleted once the last stream referencing it is deleted */
+	SharedMemoryReadStream(Owner *owner, const byte *dataPtr, uint32 dataSize) :
+		MemoryReadStream(dataPtr, dataSize),
+		_owner(owner),
+		_data(dataPtr) {
+		_owner->incRef();
+	}
+
+	~SharedMemoryReadStream() {
+		_owner->decRef();
+	}
+
+	/**
+	 * Create a stream over the range [begin, end) of this stream, sharing
+	 * its memory. The new stream is independent of this one.
+	 *
+	 * The range is clamped to the size of this stream.
+	 */
+	SharedMemoryReadStream *createRangeStream(uint32 begin, uint32 end) const;
+
+	/** The data of the stream, valid as long as the stream exists */
+	const byte *getData() const { return _data; }
+
+private:
+	SharedMemoryReadStream(const SharedMemoryReadStream &);
+	SharedMemoryReadStream &operator=(const SharedMemoryReadStream &);
+
+	Owner *_owner;
+	const byte *_data;
+};
+
 /**
  * This is a MemoryReadStream subclass which adds non-endian
  * read methods whose endianness is set on the stream creation.
@@ -0,0 +1,136 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_SPSC_QUEUE_H
+#define COMMON_SPSC_QUEUE_H
+
+#include "common/scummsys.h"
+#include "common/atomic.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_spsc_queue Single producer, single consumer queue
+ * @ingroup common
+ *
+ * @brief Fixed-size queue passing items from one thread to another without locking.
+ *
+ * @{
+ */
+
+/**
+ * Ring buffer which one thread pushes items to, while another one pops them.
+ * Neither of them ever waits for the other, push() fails instead when the
+ * queue is full.
+ *
+ * Only one thread may push items and only one may pop them at any given time.
+ * Several threads sharing one of the sides must serialize their accesses.
+ *
+ * The positions are counted from the creation of the queue, and wrap around
+ * at 2^32. They let the producer check whether the consumer has popped a
+ * given item yet.
+ */
+template<class T, uint SIZE>
+class SPSCQueue {
+public:
+	SPSCQueue() : _readPos(0), _writePos(0) {
+		STATIC_ASSERT((SIZE & (SIZE - 1)) == 0, SPSCQueue_SIZE_must_be_a_power_of_two);
+	}
+
+	/** Called by the consumer, or by the producer when the consumer is not popping items. */
+	bool empty() const {
+		return atomicLoad(&_readPos) == atomicLoad(&_writePos);
+	}
+
+	/**
+	 * Called by the producer.
+	 *
+	 * @return false if the queue is full.
+	 */
+	bool push(const T &item) {
+		int32 writePos = atomicLoad(&_writePos);
+		if ((uint32)writePos - (uint32)atomicLoad(&_readPos) >= SIZE)
+			return false;
+
+		_items[writePos & (SIZE - 1)] = item;
+		atomicStore(&_writePos, (int32)((uint32)writePos + 1));
+		return true;
+	}
+
+	/**
+	 * Called by the consumer. The item stays in the queue until it is popped.
+	 *
+	 * @return the oldest item, or NULL if the queue is empty.
+	 */
+	T *front() {
+		int32 readPos = atomicLoad(&_readPos);
+		if (readPos == atomicLoad(&_writePos))
+			return nullptr;
+
+		return &_items[readPos & (SIZE - 1)];
+	}
+
+	/**
+	 * Called by the consumer.
+	 *
+	 * @return false if the queue is empty.
+	 */
+	bool pop(T &item) {
+		T *oldest = front();
+		if (!oldest)
+			return false;
+
+		item = *oldest;
+		pop();
+		return true;
+	}
+
+	/** Called by the consumer, to remove the item returned by front(). */
+	void pop() {
+		assert(!empty());
+		atomicStore(&_readPos, (int32)((uint32)atomicLoad(&_readPos) + 1));
+	}
+
+	/** Position of the next item to push. */
+	uint32 getWritePos() const {
+		return atomicLoad(&_writePos);
+	}
+
+	/**
+	 * Check whether the consumer has popped the items pushed before
+	 * the given write position.
+	 */
+	bool hasPopped(uint32 writePos) const {
+		return (int32)((uint32)atomicLoad(&_readPos) - writePos) >= 0;
+	}
+
+private:
+	T _items[SIZE];
+	volatile int32 _readPos;
+	volatile int32 _writePos;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
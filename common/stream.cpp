@@ -25,6 +25,7 @@
 #include "common/memstream.h"
 #include "common/substream.h"
 #include "common/str.h"
+#include "common/textconsole.h"
 
 namespace Common {
 
@@ -117,6 +118,18 @@ bool MemoryReadStream::seek(int32 offs, int whence) {
 	return true; // FIXME: STREAM REWRITE
 }
 
+SharedMemoryReadStream *SharedMemoryReadStream::createRangeStream(uint32 begin, uint32 end) const {
+	uint32 streamSize = size();
+	if (end > streamSize) {
+		warning("SharedMemoryReadStream::createRangeStream(): Range %u-%u is out of the stream bounds (%u)", begin, end, streamSize);
+		end = streamSize;
+	}
+	if (begin > end)
+		begin = end;
+
+	return new SharedMemoryReadStream(_owner, _data + begin, end - begin);
+}
+
 #pragma mark -
 
 enum {
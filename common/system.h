@@ -469,7 +469,22 @@ public:
 		/**
 		* For platforms that should not have a Quit button
 		*/
-		kFeatureNoQuit
+		kFeatureNoQuit,
+
+		/**
+		* The CPU supports the x86 SSE2 instructions.
+		*/
+		kFeatureCpuSSE2,
+
+		/**
+		* The CPU supports the x86 AVX2 instructions.
+		*/
+		kFeatureCpuAVX2,
+
+		/**
+		* The CPU supports the ARM NEON instructions.
+		*/
+		kFeatureCpuNEON
 
 	};
 
@@ -1366,6 +1381,78 @@ public:
 
 
 
+	/**
+	 * @name Worker threads
+	 * Engines still must not rely on threads for their main logic (see the
+	 * mutex handling notes above). However some CPU bound tasks, like
+	 * software rasterization or video decoding, can be split into independent
+	 * jobs which are worth running on several cores when the host has them.
+	 * Backends which can spawn threads implement the methods below. All
+	 * other backends keep the default implementations, and callers are
+	 * expected to run the job themselves when createThread() fails.
+	 *
+	 * @see Common::runJobs
+	 */
+	//@{
+
+	typedef struct OpaqueThread *ThreadRef;
+	typedef int (*ThreadProc)(void *param);
+
+	/**
+	 * Start running the given function on a new thread.
+	 * @param proc	the function to run.
+	 * @param param	the parameter passed to the function.
+	 * @return the newly created thread, or 0 if threads are not supported
+	 *         or an error occurred.
+	 */
+	virtual ThreadRef createThread(ThreadProc proc, void *param) { return 0; }
+
+	/**
+	 * Wait for the given thread to finish and release its resources.
+	 * @param thread	the thread to wait for.
+	 * @return the value returned by the thread function.
+	 */
+	virtual int waitThread(ThreadRef thread) { return 0; }
+
+	typedef struct OpaqueSemaphore *SemaphoreRef;
+
+	/**
+	 * Create a new semaphore, used to wake up worker threads.
+	 * @param value	the initial value of the semaphore.
+	 * @return the newly created semaphore, or 0 if threads are not supported
+	 *         or an error occurred.
+	 */
+	virtual SemaphoreRef createSemaphore(uint value) { return 0; }
+
+	/**
+	 * Wait until the value of the given semaphore is positive, then decrement it.
+	 * @param semaphore	the semaphore to wait for.
+	 */
+	virtual void waitSemaphore(SemaphoreRef semaphore) {}
+
+	/**
+	 * Increment the value of the given semaphore, waking up one of the threads
+	 * waiting for it.
+	 * @param semaphore	the semaphore to signal.
+	 */
+	virtual void signalSemaphore(SemaphoreRef semaphore) {}
+
+	/**
+	 * Delete the given semaphore. No thread may be waiting for it.
+	 * @param semaphore	the semaphore to delete.
+	 */
+	virtual void deleteSemaphore(SemaphoreRef semaphore) {}
+
+	/**
+	 * Return the number of logical CPU cores available on the host.
+	 * This is a hint for how many jobs are worth running in parallel.
+	 */
+	virtual uint getCPUCount() { return 1; }
+
+	//@}
+
+
+
 	/** @name Sound */
 	//@{
 
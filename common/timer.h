@@ -24,6 +24,7 @@
 #define COMMON_TIMER_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
 #include "common/str.h"
 #include "common/noncopyable.h"
 
@@ -50,7 +51,7 @@ public:
 	 * written following the same safety guidelines as any other threaded code.
 	 *
 	 * @note Although the interval is specified in microseconds, the actual timer resolution
-	 *       may be lower. In particular, with the SDL backend the timer resolution is 10ms.
+	 *       may be lower. In particular, with the SDL backend the timer resolution is 1ms.
 	 * @param proc		the callback
 	 * @param interval	the interval in which the timer shall be invoked (in microseconds)
 	 * @param refCon	an arbitrary void pointer; will be passed to the timer callback
@@ -64,6 +65,68 @@ public:
 	 * and no instance of this callback will be running anymore.
 	 */
 	virtual void removeTimerProc(TimerProc proc) = 0;
+
+	/**
+	 * Timings of the calls to a timer callback, in microseconds. The lateness
+	 * is the time between when a call was scheduled and when it started.
+	 *
+	 * In the histograms, bucket 0 counts the values of 0, and bucket i the
+	 * values in [2^(i - 1), 2^i). The last bucket also counts all the larger values.
+	 */
+	struct TimerStats {
+		enum {
+			kHistogramBuckets = 24
+		};
+
+		String id;
+		uint32 calls;
+		uint64 totalLateness, totalDuration;
+		uint32 maxLateness, maxDuration;
+		uint32 latenessHistogram[kHistogramBuckets];
+		uint32 durationHistogram[kHistogramBuckets];
+
+		TimerStats() { reset(); }
+
+		void reset() {
+			calls = 0;
+			totalLateness = totalDuration = 0;
+			maxLateness = maxDuration = 0;
+			for (uint i = 0; i < kHistogramBuckets; i++)
+				latenessHistogram[i] = durationHistogram[i] = 0;
+		}
+
+		void addCall(uint32 lateness, uint32 duration) {
+			calls++;
+			totalLateness += lateness;
+			totalDuration += duration;
+			if (lateness > maxLateness)
+				maxLateness = lateness;
+			if (duration > maxDuration)
+				maxDuration = duration;
+			latenessHistogram[getBucket(lateness)]++;
+			durationHistogram[getBucket(duration)]++;
+		}
+
+		static uint getBucket(uint32 value) {
+			uint bucket = 0;
+			while (value && bucket < kHistogramBuckets - 1) {
+				value >>= 1;
+				bucket++;
+			}
+			return bucket;
+		}
+	};
+
+	/**
+	 * Get the timings of the timers installed so far, by timer id.
+	 * Timer managers which don't record them return none.
+	 */
+	virtual void getTimerStats(Array<TimerStats> &stats) { stats.clear(); }
+
+	/**
+	 * Forget the timings recorded so far.
+	 */
+	virtual void resetTimerStats() {}
 };
 
 /** @} */
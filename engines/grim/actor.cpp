@@ -51,6 +51,84 @@ Shadow::Shadow() :
 		shadowMask(nullptr), shadowMaskSize(0), active(false), dontNegate(false), userData(nullptr) {
 }
 
+// struct used for path finding
+struct PathNode {
+	Sector *sect;
+	int sectIndex; // Index of the sector in the set, -1 if there is no sector
+	PathNode *parent;
+	Math::Vector3d pos;
+	float dist;
+	float cost;
+	uint order; // Order of creation, the oldest node is expanded first between nodes of equal cost
+	uint queued; // Number of times the node was queued, only the last entry of the queue is valid
+	bool closed;
+};
+
+/**
+ * Open set of the path finding, as a binary heap of the nodes to expand.
+ * The cost of a node may be lowered after it was queued, in which case it
+ * is queued again and its previous entry gets skipped.
+ */
+class PathQueue {
+public:
+	bool empty() const { return _heap.empty(); }
+
+	void push(PathNode *node) {
+		Entry entry = { node->dist + node->cost, node->order, ++node->queued, node };
+		uint i = _heap.size();
+		_heap.push_back(entry);
+		while (i > 0) {
+			uint parent = (i - 1) / 2;
+			if (!isLess(_heap[i], _heap[parent]))
+				break;
+			SWAP(_heap[i], _heap[parent]);
+			i = parent;
+		}
+	}
+
+	// Return the open node with the lowest estimated cost, or nullptr if there is none
+	PathNode *pop() {
+		while (!_heap.empty()) {
+			Entry top = _heap[0];
+			_heap[0] = _heap.back();
+			_heap.pop_back();
+			uint i = 0;
+			for (;;) {
+				uint smallest = i;
+				uint left = 2 * i + 1;
+				uint right = left + 1;
+				if (left < _heap.size() && isLess(_heap[left], _heap[smallest]))
+					smallest = left;
+				if (right < _heap.size() && isLess(_heap[right], _heap[smallest]))
+					smallest = right;
+				if (smallest == i)
+					break;
+				SWAP(_heap[i], _heap[smallest]);
+				i = smallest;
+			}
+
+			PathNode *node = top.node;
+			if (!node->closed && top.queued == node->queued)
+				return node;
+		}
+		return nullptr;
+	}
+
+private:
+	struct Entry {
+		float cost;
+		uint order;
+		uint queued;
+		PathNode *node;
+	};
+
+	static bool isLess(const Entry &a, const Entry &b) {
+		return a.cost < b.cost || (a.cost == b.cost && a.order < b.order);
+	}
+
+	Common::Array<Entry> _heap;
+};
+
 static int animTurn(float turnAmt, const Math::Angle &dest, Math::Angle *cur) {
 	Math::Angle d = dest - *cur;
 	d.normalize(-180);
@@ -611,43 +689,36 @@ void Actor::walkTo(const Math::Vector3d &p) {
 			Set *currSet = g_grim->getCurrSet();
 			currSet->findClosestSector(p, nullptr, &_destPos);
 
-			Common::List<PathNode *> openList;
-			Common::List<PathNode *> closedList;
+			int numSectors = currSet->getSectorCount();
+			// Node of each sector, once it was reached
+			Common::Array<PathNode *> sectorNodes;
+			for (int i = 0; i < numSectors; ++i)
+				sectorNodes.push_back(nullptr);
+			Common::Array<PathNode *> nodes;
+			PathQueue openList;
 
 			PathNode *start = new PathNode;
 			start->parent = nullptr;
 			start->pos = _pos;
 			start->dist = 0.f;
 			start->cost = 0.f;
-			openList.push_back(start);
+			start->order = 0;
+			start->queued = 0;
+			start->closed = false;
+			nodes.push_back(start);
+			openList.push(start);
 			currSet->findClosestSector(_pos, &start->sect, nullptr);
+			start->sectIndex = currSet->getSectorIndex(start->sect);
+			if (start->sectIndex >= 0)
+				sectorNodes[start->sectIndex] = start;
 
-			Common::List<Sector *> sectors;
-			for (int i = 0; i < currSet->getSectorCount(); ++i) {
-				Sector *s = currSet->getSectorBase(i);
-				int type = s->getType();
-				if ((type == Sector::WalkType || type == Sector::HotType || type == Sector::FunnelType) && s->isVisible()) {
-					sectors.push_back(s);
-				}
-			}
-
-			do {
-				PathNode *node = nullptr;
-				float cost = -1.f;
-				for (Common::List<PathNode *>::iterator j = openList.begin(); j != openList.end(); ++j) {
-					PathNode *n = *j;
-					float c = n->dist + n->cost;
-					if (cost < 0.f || c < cost) {
-						cost = c;
-						node = n;
-					}
-				}
-				closedList.push_back(node);
-				openList.remove(node);
+			PathNode *node;
+			while ((node = openList.pop())) {
+				node->closed = true;
 				Sector *sector = node->sect;
 
 				if (sector && sector->isPointInSector(_destPos)) {
-					PathNode *n = closedList.back();
+					PathNode *n = node;
 					// Don't put the start position in the list, or else
 					// the first angle calculated in updateWalk() will be
 					// meaningless. The only node without parent is the start
@@ -661,22 +732,20 @@ void Actor::walkTo(const Math::Vector3d &p) {
 					break;
 				}
 
-				for (Common::List<Sector *>::iterator i = sectors.begin(); i != sectors.end(); ++i) {
-					Sector *s = *i;
-					bool inClosed = false;
-					for (Common::List<PathNode *>::iterator j = closedList.begin(); j != closedList.end(); ++j) {
-						if ((*j)->sect == s) {
-							inClosed = true;
-							break;
-						}
-					}
-					if (inClosed)
+				if (node->sectIndex < 0)
+					continue;
+
+				// The "bridges" from the current sector to the others
+				const Common::Array<Set::SectorBridges> &adjacent = currSet->getAdjacentSectors(node->sectIndex);
+				for (uint i = 0; i < adjacent.size(); ++i) {
+					const Set::SectorBridges &bridges = adjacent[i];
+					Sector *s = currSet->getSectorBase(bridges.sector);
+					if (!s->isVisible())
 						continue;
 
-					// Get "bridges" from the current sector to the other.
-					Common::List<Math::Line3d> bridges = sector->getBridgesTo(s);
-					if (bridges.empty())
-						continue; // The sectors are not adjacent.
+					PathNode *n = sectorNodes[bridges.sector];
+					if (n && n->closed)
+						continue;
 
 					Math::Vector3d closestPoint;
 					if (g_grim->getGameType() == GType_GRIM)
@@ -688,8 +757,8 @@ void Actor::walkTo(const Math::Vector3d &p) {
 					Math::Line3d l(node->pos, closestPoint);
 
 					// Pick a point on the boundary of the two sectors to walk towards.
-					while (!bridges.empty()) {
-						Math::Line3d bridge = bridges.back();
+					for (int j = bridges.bridges.size() - 1; j >= 0; --j) {
+						Math::Line3d bridge = bridges.bridges[j];
 						Math::Vector3d pos;
 						const bool useXZ = (g_grim->getGameType() == GType_MONKEY4);
 
@@ -707,17 +776,9 @@ void Actor::walkTo(const Math::Vector3d &p) {
 							bestDist = dist;
 							best = pos;
 						}
-						bridges.pop_back();
 					}
 					best = handleCollisionTo(node->pos, best);
 
-					PathNode *n = nullptr;
-					for (Common::List<PathNode *>::iterator j = openList.begin(); j != openList.end(); ++j) {
-						if ((*j)->sect == s) {
-							n = *j;
-							break;
-						}
-					}
 					if (n) {
 						float newCost = node->cost + (best - node->pos).getMagnitude();
 						if (newCost < n->cost) {
@@ -725,24 +786,28 @@ void Actor::walkTo(const Math::Vector3d &p) {
 							n->parent = node;
 							n->pos = best;
 							n->dist = (n->pos - _destPos).getMagnitude();
+							openList.push(n);
 						}
 					} else {
 						n = new PathNode;
 						n->parent = node;
 						n->sect = s;
+						n->sectIndex = bridges.sector;
 						n->pos = best;
 						n->dist = (n->pos - _destPos).getMagnitude();
 						n->cost = node->cost + (n->pos - node->pos).getMagnitude();
-						openList.push_back(n);
+						n->order = nodes.size();
+						n->queued = 0;
+						n->closed = false;
+						nodes.push_back(n);
+						sectorNodes[bridges.sector] = n;
+						openList.push(n);
 					}
 				}
-			} while (!openList.empty());
-
-			for (Common::List<PathNode *>::iterator j = closedList.begin(); j != closedList.end(); ++j) {
-				delete *j;
 			}
-			for (Common::List<PathNode *>::iterator j = openList.begin(); j != openList.end(); ++j) {
-				delete *j;
+
+			for (uint i = 0; i < nodes.size(); ++i) {
+				delete nodes[i];
 			}
 
 			if (!pathFound) {
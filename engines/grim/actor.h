@@ -692,14 +692,6 @@ private:
 	// lookAt
 	Math::Vector3d _lookAtVector;
 
-	// struct used for path finding
-	struct PathNode {
-		Sector *sect;
-		PathNode *parent;
-		Math::Vector3d pos;
-		float dist;
-		float cost;
-	};
 	Common::List<Math::Vector3d> _path;
 
 	CollisionMode _collisionMode;
@@ -47,6 +47,7 @@ void Debug::registerDebugChannels() {
 	DebugMan.addDebugChannel(Patchr, "patchr", "");
 	DebugMan.addDebugChannel(Lipsync, "lipsync", "");
 	DebugMan.addDebugChannel(Sprites, "sprites", "");
+	DebugMan.addDebugChannel(TinyGL, "tinygl", "");
 }
 
 bool Debug::isChannelEnabled(DebugChannel chan) {
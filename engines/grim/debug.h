@@ -51,7 +51,8 @@ public:
 		TextObjects = 2 << 16,
 		Patchr = 2 << 17,
 		Lipsync = 2 << 18,
-		Sprites = 2 << 19
+		Sprites = 2 << 19,
+		TinyGL = 2 << 20
 	};
 
 	static void registerDebugChannels();
@@ -26,6 +26,7 @@
 #include "engines/grim/debugger.h"
 #include "engines/grim/md5check.h"
 #include "engines/grim/grim.h"
+#include "engines/grim/resource.h"
 
 namespace Grim {
 
@@ -38,6 +39,7 @@ Debugger::Debugger() :
 	registerCmd("set_renderer", WRAP_METHOD(Debugger, cmd_set_renderer));
 	registerCmd("save", WRAP_METHOD(Debugger, cmd_save));
 	registerCmd("load", WRAP_METHOD(Debugger, cmd_load));
+	registerCmd("resource_cache", WRAP_METHOD(Debugger, cmd_resource_cache));
 }
 
 Debugger::~Debugger() {
@@ -127,4 +129,26 @@ bool Debugger::cmd_load(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmd_resource_cache(int argc, const char **argv) {
+	if (!g_resourceloader) {
+		debugPrintf("The resources are not loaded\n");
+		return true;
+	}
+	if (argc >= 2) {
+		int size = atoi(argv[1]);
+		if (size < 0) {
+			debugPrintf("Usage: resource_cache [<budget in kilobytes>]\n");
+			return true;
+		}
+		ConfMan.setInt("resource_cache_size", size);
+		g_resourceloader->setCacheBudget(size * 1024);
+	}
+
+	ResourceLoader::CacheStats stats = g_resourceloader->getCacheStats();
+	debugPrintf("Cached files: %u, in use: %u\n", stats.entries, stats.pinnedEntries);
+	debugPrintf("Memory: %u KB, budget: %u KB\n", stats.memorySize / 1024, stats.budget / 1024);
+	debugPrintf("Hits: %u, misses: %u, evictions: %u\n", stats.hits, stats.misses, stats.evictions);
+	return true;
+}
+
 }
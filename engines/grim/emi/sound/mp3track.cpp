@@ -23,6 +23,7 @@
 #include "common/mutex.h"
 #include "audio/mixer.h"
 #include "audio/audiostream.h"
+#include "audio/decodeahead.h"
 #include "audio/decoders/mp3.h"
 #include "engines/grim/debug.h"
 #include "engines/grim/resource.h"
@@ -180,6 +181,7 @@ bool MP3Track::openSound(const Common::String &filename, const Common::String &s
 		cuePoints._start = *start;
 
 	Audio::SeekableAudioStream *mp3Stream = Audio::makeMP3Stream(file, DisposeAfterUse::YES);
+	mp3Stream = Audio::makeDecodeAheadStream(mp3Stream, DisposeAfterUse::YES);
 
 	if (cuePoints._loopEnd <= cuePoints._loopStart) {
 		_stream = mp3Stream;
@@ -31,6 +31,7 @@
 
 #include "engines/grim/actor.h"
 #include "engines/grim/colormap.h"
+#include "engines/grim/debug.h"
 #include "engines/grim/material.h"
 #include "engines/grim/font.h"
 #include "engines/grim/gfx_tinygl.h"
@@ -92,6 +93,7 @@ void GfxTinyGL::setupScreen(int screenW, int screenH, bool fullscreen) {
 	_zb = new TinyGL::FrameBuffer(screenW, screenH, buf);
 	TinyGL::glInit(_zb, 256);
 	tglEnableDirtyRects(ConfMan.getBool("dirtyrects"));
+	tglEnableTiledRendering(ConfMan.getBool("tiledrendering"));
 
 	_storedDisplay.create(_pixelFormat, _gameWidth * _gameHeight, DisposeAfterUse::YES);
 	_storedDisplay.clear(_gameWidth * _gameHeight);
@@ -176,6 +178,11 @@ void GfxTinyGL::clearDepthBuffer() {
 
 void GfxTinyGL::flipBuffer() {
 	TinyGL::tglPresentBuffer();
+	if (Debug::isChannelEnabled(Debug::TinyGL)) {
+		int rectanglesIn, rectanglesOut, pixelsRasterized;
+		tglGetDirtyRectsStats(&rectanglesIn, &rectanglesOut, &pixelsRasterized);
+		Debug::debug(Debug::TinyGL, "Dirty rects: %d in, %d out, %d pixels rasterized", rectanglesIn, rectanglesOut, pixelsRasterized);
+	}
 	g_system->updateScreen();
 }
 
@@ -613,8 +620,104 @@ void GfxTinyGL::getShadowColor(byte *r, byte *g, byte *b) {
 	*b = _shadowColorB;
 }
 
+// Per model buffers, the animated vertices and normals are read from the model directly
+struct TinyGLEMIModelUserData {
+	TGLuint _texCoordsBuffer;
+};
+
+// Vertices of all the faces of a mesh, unrolled so that each face is a contiguous range
+struct TinyGLMeshUserData {
+	TGLuint _meshBuffer;
+	int _numVertices;
+};
+
+void GfxTinyGL::createEMIModel(EMIModel *model) {
+	TinyGLEMIModelUserData *mud = new TinyGLEMIModelUserData;
+	model->_userData = mud;
+
+	tglGenBuffers(1, &mud->_texCoordsBuffer);
+	tglBindBuffer(TGL_ARRAY_BUFFER, mud->_texCoordsBuffer);
+	tglBufferData(TGL_ARRAY_BUFFER, model->_numVertices * 2 * sizeof(float), model->_texVerts, TGL_STATIC_DRAW);
+	tglBindBuffer(TGL_ARRAY_BUFFER, 0);
+
+	for (uint32 i = 0; i < model->_numFaces; ++i) {
+		EMIMeshFace *face = &model->_faces[i];
+		tglGenBuffers(1, &face->_indicesEBO);
+		tglBindBuffer(TGL_ELEMENT_ARRAY_BUFFER, face->_indicesEBO);
+		tglBufferData(TGL_ELEMENT_ARRAY_BUFFER, face->_faceLength * 3 * sizeof(uint32), face->_indexes, TGL_STATIC_DRAW);
+	}
+	tglBindBuffer(TGL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void GfxTinyGL::destroyEMIModel(EMIModel *model) {
+	for (uint32 i = 0; i < model->_numFaces; ++i) {
+		EMIMeshFace *face = &model->_faces[i];
+		tglDeleteBuffers(1, &face->_indicesEBO);
+		face->_indicesEBO = 0;
+	}
+
+	TinyGLEMIModelUserData *mud = static_cast<TinyGLEMIModelUserData *>(model->_userData);
+	if (mud) {
+		tglDeleteBuffers(1, &mud->_texCoordsBuffer);
+		delete mud;
+	}
+
+	model->_userData = nullptr;
+}
+
+void GfxTinyGL::createMesh(Mesh *mesh) {
+	int numVertices = 0;
+	for (int i = 0; i < mesh->_numFaces; ++i)
+		numVertices += mesh->_faces[i].getNumVertices();
+
+	// Positions, then normals, then texture coordinates
+	Common::Array<float> meshInfo;
+	meshInfo.resize(numVertices * 8);
+	float *positions = meshInfo.begin();
+	float *normals = positions + numVertices * 3;
+	float *texCoords = normals + numVertices * 3;
+
+	int offset = 0;
+	for (int i = 0; i < mesh->_numFaces; ++i) {
+		MeshFace *face = &mesh->_faces[i];
+		face->_userData = new uint32;
+		*(uint32 *)face->_userData = offset;
+
+		for (int j = 0; j < face->getNumVertices(); ++j, ++offset) {
+			memcpy(positions + 3 * offset, mesh->_vertices + 3 * face->getVertex(j), 3 * sizeof(float));
+			memcpy(normals + 3 * offset, mesh->_vertNormals + 3 * face->getVertex(j), 3 * sizeof(float));
+			if (face->hasTexture())
+				memcpy(texCoords + 2 * offset, mesh->_textureVerts + 2 * face->getTextureVertex(j), 2 * sizeof(float));
+		}
+	}
+
+	TinyGLMeshUserData *mud = new TinyGLMeshUserData;
+	mesh->_userData = mud;
+	mud->_numVertices = numVertices;
+
+	tglGenBuffers(1, &mud->_meshBuffer);
+	tglBindBuffer(TGL_ARRAY_BUFFER, mud->_meshBuffer);
+	tglBufferData(TGL_ARRAY_BUFFER, meshInfo.size() * sizeof(float), meshInfo.begin(), TGL_STATIC_DRAW);
+	tglBindBuffer(TGL_ARRAY_BUFFER, 0);
+}
+
+void GfxTinyGL::destroyMesh(const Mesh *mesh) {
+	for (int i = 0; i < mesh->_numFaces; ++i) {
+		MeshFace *face = &mesh->_faces[i];
+		delete static_cast<uint32 *>(face->_userData);
+		face->_userData = nullptr;
+	}
+
+	TinyGLMeshUserData *mud = static_cast<TinyGLMeshUserData *>(mesh->_userData);
+	if (mud) {
+		tglDeleteBuffers(1, &mud->_meshBuffer);
+		delete mud;
+	}
+}
+
 void GfxTinyGL::drawEMIModelFace(const EMIModel *model, const EMIMeshFace *face) {
 	int *indices = (int *)face->_indexes;
+	const TinyGLEMIModelUserData *mud = static_cast<const TinyGLEMIModelUserData *>(model->_userData);
 
 	tglEnable(TGL_DEPTH_TEST);
 	tglDisable(TGL_ALPHA_TEST);
@@ -626,36 +729,53 @@ void GfxTinyGL::drawEMIModelFace(const EMIModel *model, const EMIMeshFace *face)
 	if (face->_flags & EMIMeshFace::kAlphaBlend || face->_flags & EMIMeshFace::kUnknownBlend || _currentActor->hasLocalAlpha() || _alpha < 1.0f)
 		tglEnable(TGL_BLEND);
 
-	tglBegin(TGL_TRIANGLES);
-	float alpha = _alpha;
-	if (model->_meshAlphaMode == Actor::AlphaReplace) {
-		alpha *= model->_meshAlpha;
-	}
-	Math::Vector3d noLighting(1.f, 1.f, 1.f);
-	for (uint j = 0; j < face->_faceLength * 3; j++) {
-		int index = indices[j];
+	tglEnableClientState(TGL_VERTEX_ARRAY);
+	tglVertexPointer(3, TGL_FLOAT, 0, model->_drawVertices);
+	tglEnableClientState(TGL_NORMAL_ARRAY);
+	tglNormalPointer(TGL_FLOAT, 0, model->_normals);
+
+	if (!_currentShadowArray) {
+		if (face->_hasTexture) {
+			tglEnableClientState(TGL_TEXTURE_COORD_ARRAY);
+			tglBindBuffer(TGL_ARRAY_BUFFER, mud->_texCoordsBuffer);
+			tglTexCoordPointer(2, TGL_FLOAT, 0, 0);
+			tglBindBuffer(TGL_ARRAY_BUFFER, 0);
+		}
+
+		float alpha = _alpha;
+		if (model->_meshAlphaMode == Actor::AlphaReplace) {
+			alpha *= model->_meshAlpha;
+		}
+		Math::Vector3d noLighting(1.f, 1.f, 1.f);
+		_emiVertexColors.resize(model->_numVertices * 4);
+		for (uint j = 0; j < face->_faceLength * 3; j++) {
+			int index = indices[j];
 
-		if (!_currentShadowArray) {
-			if (face->_hasTexture) {
-				tglTexCoord2f(model->_texVerts[index].getX(), model->_texVerts[index].getY());
-			}
 			Math::Vector3d lighting = (face->_flags & EMIMeshFace::kNoLighting) ? noLighting : model->_lighting[index];
 			byte r = (byte)(model->_colorMap[index].r * lighting.x());
 			byte g = (byte)(model->_colorMap[index].g * lighting.y());
 			byte b = (byte)(model->_colorMap[index].b * lighting.z());
 			byte a = (int)(model->_colorMap[index].a * alpha * _currentActor->getLocalAlpha(index));
-			tglColor4ub(r, g, b, a);
+			float *color = &_emiVertexColors[index * 4];
+			color[0] = r / 255.0f;
+			color[1] = g / 255.0f;
+			color[2] = b / 255.0f;
+			color[3] = a / 255.0f;
 		}
-
-		Math::Vector3d normal = model->_normals[index];
-		Math::Vector3d vertex = model->_drawVertices[index];
-
-		tglNormal3fv(normal.getData());
-		tglVertex3fv(vertex.getData());
+		tglEnableClientState(TGL_COLOR_ARRAY);
+		tglColorPointer(4, TGL_FLOAT, 0, &_emiVertexColors[0]);
 	}
-	tglEnd();
 
+	tglBindBuffer(TGL_ELEMENT_ARRAY_BUFFER, face->_indicesEBO);
+	tglDrawElements(TGL_TRIANGLES, face->_faceLength * 3, TGL_UNSIGNED_INT, 0);
+	tglBindBuffer(TGL_ELEMENT_ARRAY_BUFFER, 0);
+
+	tglDisableClientState(TGL_VERTEX_ARRAY);
+	tglDisableClientState(TGL_NORMAL_ARRAY);
 	if (!_currentShadowArray) {
+		if (face->_hasTexture)
+			tglDisableClientState(TGL_TEXTURE_COORD_ARRAY);
+		tglDisableClientState(TGL_COLOR_ARRAY);
 		tglColor3f(1.0f, 1.0f, 1.0f);
 	}
 
@@ -670,24 +790,32 @@ void GfxTinyGL::drawEMIModelFace(const EMIModel *model, const EMIMeshFace *face)
 }
 
 void GfxTinyGL::drawModelFace(const Mesh *mesh, const MeshFace *face) {
+	const TinyGLMeshUserData *mud = static_cast<const TinyGLMeshUserData *>(mesh->_userData);
+	int numVertices = mud->_numVertices;
 	// Support transparency in actor objects, such as the message tube
 	// in Manny's Office
-	float *vertices = mesh->_vertices;
-	float *vertNormals = mesh->_vertNormals;
-	float *textureVerts = mesh->_textureVerts;
 	tglAlphaFunc(TGL_GREATER, 0.5);
 	tglEnable(TGL_ALPHA_TEST);
 	tglNormal3fv(const_cast<float *>(face->getNormal().getData()));
-	tglBegin(TGL_POLYGON);
-	for (int i = 0; i < face->getNumVertices(); i++) {
-		tglNormal3fv(vertNormals + 3 * face->getVertex(i));
 
-		if (face->hasTexture())
-			tglTexCoord2fv(textureVerts + 2 * face->getTextureVertex(i));
-
-		tglVertex3fv(vertices + 3 * face->getVertex(i));
+	tglBindBuffer(TGL_ARRAY_BUFFER, mud->_meshBuffer);
+	tglEnableClientState(TGL_VERTEX_ARRAY);
+	tglVertexPointer(3, TGL_FLOAT, 0, 0);
+	tglEnableClientState(TGL_NORMAL_ARRAY);
+	tglNormalPointer(TGL_FLOAT, 0, (void *)(numVertices * 3 * sizeof(float)));
+	if (face->hasTexture()) {
+		tglEnableClientState(TGL_TEXTURE_COORD_ARRAY);
+		tglTexCoordPointer(2, TGL_FLOAT, 0, (void *)(numVertices * 6 * sizeof(float)));
 	}
-	tglEnd();
+	tglBindBuffer(TGL_ARRAY_BUFFER, 0);
+
+	// Faces never share a vertex within a draw, so the unrolled vertices need no indices
+	tglDrawArrays(TGL_POLYGON, *(uint32 *)face->_userData, face->getNumVertices());
+
+	tglDisableClientState(TGL_VERTEX_ARRAY);
+	tglDisableClientState(TGL_NORMAL_ARRAY);
+	if (face->hasTexture())
+		tglDisableClientState(TGL_TEXTURE_COORD_ARRAY);
 	// Done with transparency-capable objects
 	tglDisable(TGL_ALPHA_TEST);
 }
@@ -1176,7 +1304,8 @@ void GfxTinyGL::createTexture(Texture *texture, const uint8 *data, const CMap *c
 	tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_WRAP_T, TGL_REPEAT);
 
 	tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_MAG_FILTER, TGL_LINEAR);
-	tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_MIN_FILTER, TGL_LINEAR);
+	// Models far away sample a smaller mipmap level
+	tglTexParameteri(TGL_TEXTURE_2D, TGL_TEXTURE_MIN_FILTER, TGL_LINEAR_MIPMAP_NEAREST);
 	tglTexImage2D(TGL_TEXTURE_2D, 0, 3, texture->_width, texture->_height, 0, format, TGL_UNSIGNED_BYTE, texdata);
 	delete[] texdata;
 }
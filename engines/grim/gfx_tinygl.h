@@ -82,6 +82,11 @@ public:
 	void drawModelFace(const Mesh *mesh, const MeshFace *face) override;
 	void drawSprite(const Sprite *sprite) override;
 
+	void createMesh(Mesh *mesh) override;
+	void destroyMesh(const Mesh *mesh) override;
+	void createEMIModel(EMIModel *model) override;
+	void destroyEMIModel(EMIModel *model) override;
+
 	void enableLights() override;
 	void disableLights() override;
 	void setupLight(Light *light, int lightId) override;
@@ -136,6 +141,7 @@ private:
 	float _alpha;
 	const Actor *_currentActor;
 	TGLenum _depthFunc;
+	Common::Array<float> _emiVertexColors;
 
 	void readPixels(int x, int y, int width, int height, uint8 *buffer);
 };
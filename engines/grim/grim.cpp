@@ -113,6 +113,7 @@ GrimEngine::GrimEngine(OSystem *syst, uint32 gameFlags, GrimGameType gameType, C
 
 	//Set default settings
 	ConfMan.registerDefault("use_arb_shaders", true);
+	ConfMan.registerDefault("resource_cache_size", 16 * 1024);
 
 	_showFps = ConfMan.getBool("show_fps");
 
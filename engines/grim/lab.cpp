@@ -40,10 +40,12 @@ Common::SeekableReadStream *LabEntry::createReadStream() const {
 
 Lab::Lab() {
 	_stream = nullptr;
+	_mappedStream = nullptr;
 }
 
 Lab::~Lab() {
 	delete _stream;
+	delete _mappedStream;
 }
 
 bool Lab::open(const Common::String &filename, bool keepStream) {
@@ -62,7 +64,11 @@ bool Lab::open(const Common::String &filename, bool keepStream) {
 		else
 			parseMonkey4FileTable(file);
 	}
-	if (result && keepStream) {
+	// When the lab is mapped into memory, the members are views into the mapping
+	Common::SharedMemoryReadStream *mappedStream = result ? file->getMappedStream() : nullptr;
+	if (mappedStream) {
+		_mappedStream = mappedStream->createRangeStream(0, mappedStream->size());
+	} else if (result && keepStream) {
 		file->seek(0, SEEK_SET);
 		byte *data = static_cast<byte*>(malloc(sizeof(byte) * file->size()));
 		file->read(data, file->size());
@@ -180,7 +186,9 @@ Common::SeekableReadStream *Lab::createReadStreamForMember(const Common::String
 	fname.toLowercase();
 	LabEntryPtr i = _entries[fname];
 
-	if (!_stream) {
+	if (_mappedStream) {
+		return _mappedStream->createRangeStream(i->_offset, i->_offset + i->_len);
+	} else if (!_stream) {
 		Common::File *file = new Common::File();
 		file->open(_labFileName);
 		return new Common::SeekableSubReadStream(file, i->_offset, i->_offset + i->_len, DisposeAfterUse::YES);
@@ -27,6 +27,7 @@
 
 namespace Common {
 	class File;
+	class SharedMemoryReadStream;
 }
 
 namespace Grim {
@@ -64,6 +65,7 @@ private:
 	typedef Common::HashMap<Common::String, LabEntryPtr, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> LabMap;
 	LabMap _entries;
 	Common::SeekableReadStream *_stream;
+	Common::SharedMemoryReadStream *_mappedStream;
 };
 
 } // end of namespace Grim
@@ -73,8 +73,12 @@ public:
 };
 
 ResourceLoader::ResourceLoader() {
-	_cacheDirty = false;
 	_cacheMemorySize = 0;
+	_cacheHits = 0;
+	_cacheMisses = 0;
+	_cacheEvictions = 0;
+	// The budget is configured in kilobytes
+	_cacheBudget = ConfMan.getInt("resource_cache_size") * 1024;
 
 	Lab *l;
 	Common::ArchiveMemberList files, updFiles;
@@ -210,8 +214,9 @@ ResourceLoader::ResourceLoader() {
 		// we _COULD_ protect this with a platform check, but the file isn't
 		// really big anyhow...
 		bool useCache = (filename == "local.m4b");
+		// The contents of the labs never change, so their members can be indexed
 		if (l->open(filename, useCache))
-			SearchMan.add(filename, l, priority--, true);
+			SearchMan.add(filename, l, priority--, true, true);
 		else
 			delete l;
 	}
@@ -229,11 +234,6 @@ void clearList(Common::List<T> &list) {
 }
 
 ResourceLoader::~ResourceLoader() {
-	for (Common::Array<ResourceCache>::iterator i = _cache.begin(); i != _cache.end(); ++i) {
-		ResourceCache &r = *i;
-		delete[] r.fname;
-		delete[] r.resPtr;
-	}
 	clearList(_models);
 	clearList(_colormaps);
 	clearList(_keyframeAnims);
@@ -241,32 +241,42 @@ ResourceLoader::~ResourceLoader() {
 	MD5Check::clear();
 }
 
-static int sortCallback(const void *entry1, const void *entry2) {
-	return scumm_stricmp(((const ResourceLoader::ResourceCache *)entry1)->fname, ((const ResourceLoader::ResourceCache *)entry2)->fname);
-}
+namespace {
 
-Common::SeekableReadStream *ResourceLoader::getFileFromCache(const Common::String &filename) const {
-	ResourceLoader::ResourceCache *entry = getEntryFromCache(filename);
-	if (!entry)
-		return nullptr;
+struct ResourceDeleter {
+	void operator()(byte *res) { delete[] res; }
+};
 
-	return new Common::MemoryReadStream(entry->resPtr, entry->len);
+/**
+ * Stream on a cached file, which keeps the file data alive and the
+ * cache entry pinned until it is destroyed.
+ */
+class CachedFileStream : public Common::MemoryReadStream {
+public:
+	CachedFileStream(const Common::SharedPtr<byte> &data, uint32 len) :
+		Common::MemoryReadStream(data.get(), len), _data(data) {}
 
-}
+private:
+	Common::SharedPtr<byte> _data;
+};
 
-ResourceLoader::ResourceCache *ResourceLoader::getEntryFromCache(const Common::String &filename) const {
-	if (_cache.empty())
-		return nullptr;
+} // end of anonymous namespace
 
-	if (_cacheDirty) {
-		qsort(_cache.begin(), _cache.size(), sizeof(ResourceCache), sortCallback);
-		_cacheDirty = false;
+Common::SeekableReadStream *ResourceLoader::getFileFromCache(const Common::String &filename) const {
+	CacheIndex::iterator it = _cacheIndex.find(filename);
+	if (it == _cacheIndex.end()) {
+		_cacheMisses++;
+		return nullptr;
 	}
+	_cacheHits++;
 
-	ResourceCache key;
-	key.fname = const_cast<char *>(filename.c_str());
+	// Move the entry to the front of the list, as the most recently used one
+	ResourceCache entry = *it->_value;
+	_cache.erase(it->_value);
+	_cache.push_front(entry);
+	it->_value = _cache.begin();
 
-	return (ResourceLoader::ResourceCache *)bsearch(&key, _cache.begin(), _cache.size(), sizeof(ResourceCache), sortCallback);
+	return new CachedFileStream(entry.resPtr, entry.len);
 }
 
 Common::SeekableReadStream *ResourceLoader::loadFile(const Common::String &filename) const {
@@ -291,12 +301,14 @@ Common::SeekableReadStream *ResourceLoader::openNewStreamFile(Common::String fna
 			if (!s)
 				return nullptr;
 
-			uint32 size = s->size();
-			byte *buf = new byte[size];
-			s->read(buf, size);
-			putIntoCache(fname, buf, size);
-			delete s;
-			s = new Common::MemoryReadStream(buf, size);
+			// The members of the labs mapped into memory don't need to be copied
+			if (!dynamic_cast<Common::SharedMemoryReadStream *>(s)) {
+				uint32 size = s->size();
+				byte *buf = new byte[size];
+				s->read(buf, size);
+				delete s;
+				s = putIntoCache(fname, buf, size);
+			}
 		}
 	} else {
 		s = loadFile(fname);
@@ -305,15 +317,55 @@ Common::SeekableReadStream *ResourceLoader::openNewStreamFile(Common::String fna
 	return Common::wrapCompressedReadStream(s);
 }
 
-void ResourceLoader::putIntoCache(const Common::String &fname, byte *res, uint32 len) const {
+Common::SeekableReadStream *ResourceLoader::putIntoCache(const Common::String &fname, byte *res, uint32 len) const {
 	ResourceCache entry;
-	entry.resPtr = res;
+	entry.fname = fname;
+	entry.resPtr = Common::SharedPtr<byte>(res, ResourceDeleter());
 	entry.len = len;
-	entry.fname = new char[fname.size() + 1];
-	strcpy(entry.fname, fname.c_str());
 	_cacheMemorySize += len;
-	_cache.push_back(entry);
-	_cacheDirty = true;
+	_cache.push_front(entry);
+	_cacheIndex[fname] = _cache.begin();
+
+	// The new file is pinned by its stream, so it will survive the eviction
+	Common::SeekableReadStream *s = new CachedFileStream(entry.resPtr, len);
+	evictFromCache();
+	return s;
+}
+
+void ResourceLoader::evictFromCache() const {
+	CacheList::iterator it = _cache.end();
+	while (_cacheMemorySize > _cacheBudget && it != _cache.begin()) {
+		--it;
+		// Streams on the file still use its data
+		if (!it->resPtr.unique())
+			continue;
+
+		_cacheMemorySize -= it->len;
+		_cacheIndex.erase(it->fname);
+		it = _cache.erase(it);
+		_cacheEvictions++;
+	}
+}
+
+void ResourceLoader::setCacheBudget(uint32 bytes) {
+	_cacheBudget = bytes;
+	evictFromCache();
+}
+
+ResourceLoader::CacheStats ResourceLoader::getCacheStats() const {
+	CacheStats stats;
+	stats.entries = _cache.size();
+	stats.pinnedEntries = 0;
+	for (CacheList::const_iterator it = _cache.begin(); it != _cache.end(); ++it) {
+		if (!it->resPtr.unique())
+			stats.pinnedEntries++;
+	}
+	stats.memorySize = _cacheMemorySize;
+	stats.budget = _cacheBudget;
+	stats.hits = _cacheHits;
+	stats.misses = _cacheMisses;
+	stats.evictions = _cacheEvictions;
+	return stats;
 }
 
 CMap *ResourceLoader::loadColormap(const Common::String &filename) {
@@ -563,23 +615,14 @@ Overlay *ResourceLoader::loadOverlay(const Common::String &filename) {
 }
 
 void ResourceLoader::uncache(const char *filename) const {
-	Common::String fname = filename;
-	fname.toLowercase();
-
-	if (_cacheDirty) {
-		qsort(_cache.begin(), _cache.size(), sizeof(ResourceCache), sortCallback);
-		_cacheDirty = false;
-	}
-
-	for (unsigned int i = 0; i < _cache.size(); i++) {
-		if (fname.compareTo(_cache[i].fname) == 0) {
-			delete[] _cache[i].fname;
-			_cacheMemorySize -= _cache[i].len;
-			delete[] _cache[i].resPtr;
-			_cache.remove_at(i);
-			_cacheDirty = true;
-		}
-	}
+	CacheIndex::iterator it = _cacheIndex.find(filename);
+	if (it == _cacheIndex.end())
+		return;
+
+	// Streams still opened on the file keep its data alive
+	_cacheMemorySize -= it->_value->len;
+	_cache.erase(it->_value);
+	_cacheIndex.erase(it);
 }
 
 void ResourceLoader::uncacheModel(Model *m) {
@@ -25,6 +25,9 @@
 
 #include "common/archive.h"
 #include "common/array.h"
+#include "common/hash-str.h"
+#include "common/list.h"
+#include "common/ptr.h"
 
 #include "engines/grim/object.h"
 
@@ -87,23 +90,49 @@ public:
 	void uncacheAnimationEmi(AnimationEmi *a);
 
 	struct ResourceCache {
-		char *fname;
-		byte *resPtr;
+		Common::String fname;
+		// Streams opened on the file share the data, the entry is pinned while they exist
+		Common::SharedPtr<byte> resPtr;
 		uint32 len;
 	};
 
+	struct CacheStats {
+		uint32 entries;
+		uint32 pinnedEntries;
+		uint32 memorySize;
+		uint32 budget;
+		uint32 hits;
+		uint32 misses;
+		uint32 evictions;
+	};
+
+	CacheStats getCacheStats() const;
+	/**
+	 * Set the maximum size of the files kept in the cache. Least recently used
+	 * files are evicted to stay below it, except the ones which still are in use.
+	 */
+	void setCacheBudget(uint32 bytes);
+
 	static Common::String fixFilename(const Common::String &filename, bool append = true);
 
 private:
 	Common::SeekableReadStream *loadFile(const Common::String &filename) const;
 	Common::SeekableReadStream *getFileFromCache(const Common::String &filename) const;
-	ResourceLoader::ResourceCache *getEntryFromCache(const Common::String &filename) const;
-	void putIntoCache(const Common::String &fname, byte *res, uint32 len) const;
+	Common::SeekableReadStream *putIntoCache(const Common::String &fname, byte *res, uint32 len) const;
+	void evictFromCache() const;
 	void uncache(const char *fname) const;
 
-	mutable Common::Array<ResourceCache> _cache;
-	mutable bool _cacheDirty;
-	mutable int32 _cacheMemorySize;
+	// Most recently used files first
+	typedef Common::List<ResourceCache> CacheList;
+	typedef Common::HashMap<Common::String, CacheList::iterator, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> CacheIndex;
+
+	mutable CacheList _cache;
+	mutable CacheIndex _cacheIndex;
+	mutable uint32 _cacheMemorySize;
+	uint32 _cacheBudget;
+	mutable uint32 _cacheHits;
+	mutable uint32 _cacheMisses;
+	mutable uint32 _cacheEvictions;
 
 	Common::List<EMIModel *> _emiModels;
 	Common::List<Model *> _models;
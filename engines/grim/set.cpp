@@ -333,6 +333,8 @@ bool Set::restoreState(SaveGame *savedState) {
 	} else {
 		_sectors = nullptr;
 	}
+	_sectorGraph.clear();
+	_sectorGraphValid.clear();
 
 	_numLights = savedState->readLESint32();
 	_lights = new Light[_numLights];
@@ -967,6 +969,7 @@ void Set::shrinkBoxes(float radius) {
 		Sector *sector = _sectors[i];
 		sector->shrink(radius);
 	}
+	invalidateSectorGraph();
 }
 
 void Set::unshrinkBoxes() {
@@ -974,6 +977,57 @@ void Set::unshrinkBoxes() {
 		Sector *sector = _sectors[i];
 		sector->unshrink();
 	}
+	invalidateSectorGraph();
+}
+
+int Set::getSectorIndex(const Sector *sector) const {
+	for (int i = 0; i < _numSectors; i++) {
+		if (_sectors[i] == sector)
+			return i;
+	}
+	return -1;
+}
+
+const Common::Array<Set::SectorBridges> &Set::getAdjacentSectors(int index) {
+	assert(index >= 0 && index < _numSectors);
+	if (_sectorGraph.size() != (uint)_numSectors) {
+		_sectorGraph.clear();
+		_sectorGraph.resize(_numSectors);
+		_sectorGraphValid.clear();
+		_sectorGraphValid.resize(_numSectors);
+	}
+
+	Common::Array<SectorBridges> &adjacent = _sectorGraph[index];
+	if (_sectorGraphValid[index])
+		return adjacent;
+
+	// The visibility of the sectors is checked by the users, so that
+	// the sectors don't have to be computed again when it changes.
+	adjacent.clear();
+	Sector *sector = _sectors[index];
+	for (int i = 0; i < _numSectors; i++) {
+		Sector *s = _sectors[i];
+		int type = s->getType();
+		if (i == index || (type != Sector::WalkType && type != Sector::HotType && type != Sector::FunnelType))
+			continue;
+
+		Common::List<Math::Line3d> bridges = sector->getBridgesTo(s);
+		if (bridges.empty())
+			continue; // The sectors are not adjacent.
+
+		SectorBridges entry;
+		entry.sector = i;
+		for (Common::List<Math::Line3d>::const_iterator it = bridges.begin(); it != bridges.end(); ++it)
+			entry.bridges.push_back(*it);
+		adjacent.push_back(entry);
+	}
+	_sectorGraphValid[index] = true;
+	return adjacent;
+}
+
+void Set::invalidateSectorGraph() {
+	for (uint i = 0; i < _sectorGraphValid.size(); i++)
+		_sectorGraphValid[i] = false;
 }
 
 void Set::setLightIntensity(const char *light, float intensity) {
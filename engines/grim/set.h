@@ -103,6 +103,19 @@ public:
 	void shrinkBoxes(float radius);
 	void unshrinkBoxes();
 
+	// A sector which can be walked to from another one, through the bridges between them
+	struct SectorBridges {
+		int sector;
+		Common::Array<Math::Line3d> bridges;
+	};
+	int getSectorIndex(const Sector *sector) const;
+	/**
+	 * Return the walkable sectors adjacent to the given one, visible or not, in the
+	 * order of their index. They are computed on the first call, and kept until the
+	 * shape of the sectors changes.
+	 */
+	const Common::Array<SectorBridges> &getAdjacentSectors(int index);
+
 	void addObjectState(const ObjectState::Ptr &s);
 	void deleteObjectState(const ObjectState::Ptr &s) {
 		_states.remove(s);
@@ -159,6 +172,10 @@ private:
 	int _numSetups, _numLights, _numSectors, _numObjectStates, _numShadows;
 	bool _enableLights;
 	Sector **_sectors;
+	void invalidateSectorGraph();
+	// Adjacent sectors of each sector, if they were computed already
+	Common::Array<Common::Array<SectorBridges> > _sectorGraph;
+	Common::Array<bool> _sectorGraphValid;
 	Light *_lights;
 	Common::List<Light *> _lightsList;
 	Common::List<Light *> _overworldLightsList;
@@ -132,6 +132,11 @@ void Archive::visit(ArchiveVisitor &visitor) {
 }
 
 Common::SeekableReadStream *Archive::dumpToMemory(uint32 offset, uint32 size) {
+	// No need to copy the data when the archive is mapped into memory
+	Common::SharedMemoryReadStream *mappedStream = _file.getMappedStream();
+	if (mappedStream)
+		return mappedStream->createRangeStream(offset, offset + size);
+
 	_file.seek(offset);
 	return _file.readStream(size);
 }
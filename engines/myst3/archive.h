@@ -123,6 +123,7 @@ public:
 	ResourceDescription(Archive *archive, const Archive::DirectorySubEntry &subentry);
 
 	bool isValid() const { return _archive && _subentry; }
+	bool operator==(const ResourceDescription &other) const { return _archive == other._archive && _subentry == other._subentry; }
 
 	Common::SeekableReadStream *getData() const;
 	uint16 getFace() const { return _subentry->face; }
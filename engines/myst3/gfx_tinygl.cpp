@@ -27,6 +27,7 @@
 #endif
 
 #include "common/config-manager.h"
+#include "common/debug-channels.h"
 #include "common/rect.h"
 #include "common/textconsole.h"
 
@@ -38,6 +39,7 @@
 
 #include "engines/myst3/gfx.h"
 #include "engines/myst3/gfx_tinygl.h"
+#include "engines/myst3/myst3.h"
 #include "engines/myst3/gfx_tinygl_texture.h"
 #include "graphics/tinygl/zblit.h"
 
@@ -73,6 +75,7 @@ void TinyGLRenderer::init() {
 	_fb = new TinyGL::FrameBuffer(kOriginalWidth, kOriginalHeight, screenBuffer);
 	TinyGL::glInit(_fb, 512);
 	tglEnableDirtyRects(ConfMan.getBool("dirtyrects"));
+	tglEnableTiledRendering(ConfMan.getBool("tiledrendering"));
 
 	tglMatrixMode(TGL_PROJECTION);
 	tglLoadIdentity();
@@ -297,6 +300,11 @@ Graphics::Surface *TinyGLRenderer::getScreenshot() {
 
 void TinyGLRenderer::flipBuffer() {
 	TinyGL::tglPresentBuffer();
+	if (DebugMan.isDebugChannelEnabled(kDebugTinyGL)) {
+		int rectanglesIn, rectanglesOut, pixelsRasterized;
+		tglGetDirtyRectsStats(&rectanglesIn, &rectanglesOut, &pixelsRasterized);
+		debugC(kDebugTinyGL, "Dirty rects: %d in, %d out, %d pixels rasterized", rectanglesIn, rectanglesOut, pixelsRasterized);
+	}
 }
 
 } // End of namespace Myst3
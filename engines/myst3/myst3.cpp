@@ -25,6 +25,7 @@
 #include "common/error.h"
 #include "common/config-manager.h"
 #include "common/file.h"
+#include "common/jobs.h"
 #include "common/util.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
@@ -41,6 +42,7 @@
 #include "engines/myst3/myst3.h"
 #include "engines/myst3/nodecube.h"
 #include "engines/myst3/nodeframe.h"
+#include "engines/myst3/prefetch.h"
 #include "engines/myst3/scene.h"
 #include "engines/myst3/state.h"
 #include "engines/myst3/cursor.h"
@@ -65,7 +67,7 @@ namespace Myst3 {
 Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 		Engine(syst), _system(syst), _gameDescription(version),
 		_db(0), _scriptEngine(0),
-		_state(0), _node(0), _scene(0), _archiveNode(0),
+		_state(0), _node(0), _scene(0), _archiveNode(0), _prefetcher(0),
 		_cursor(0), _inventory(0), _gfx(0), _menu(0),
 		_rnd(0), _sound(0), _ambient(0),
 		_inputSpacePressed(false), _inputEnterPressed(false),
@@ -81,6 +83,7 @@ Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 	DebugMan.addDebugChannel(kDebugSaveLoad, "SaveLoad", "Track Save/Load Function");
 	DebugMan.addDebugChannel(kDebugScript, "Script", "Track Script Execution");
 	DebugMan.addDebugChannel(kDebugNode, "Node", "Track Node Changes");
+	DebugMan.addDebugChannel(kDebugTinyGL, "TinyGL", "Track TinyGL Dirty Rectangles");
 
 	// Add subdirectories to the search path to allow running from a full HDD install
 	const Common::FSNode gameDataDir(ConfMan.get("path"));
@@ -113,6 +116,9 @@ Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 Myst3Engine::~Myst3Engine() {
 	DebugMan.clearAllDebugChannels();
 
+	delete _prefetcher;
+	_prefetcher = nullptr;
+
 	closeArchives();
 
 	delete _menu;
@@ -169,6 +175,7 @@ Common::Error Myst3Engine::run() {
 		_menu = new PagingMenu(this);
 	}
 	_archiveNode = new Archive();
+	_prefetcher = new NodePrefetcher(this);
 
 	_system->showMouse(false);
 
@@ -213,6 +220,8 @@ Common::Error Myst3Engine::run() {
 		}
 
 		drawFrame();
+
+		_prefetcher->update();
 	}
 
 	unloadNode();
@@ -348,6 +357,9 @@ bool Myst3Engine::isTextLanguageEnglish() const {
 }
 
 void Myst3Engine::closeArchives() {
+	if (_prefetcher)
+		_prefetcher->clear();
+
 	for (uint i = 0; i < _archivesCommon.size(); i++)
 		delete _archivesCommon[i];
 
@@ -856,6 +868,8 @@ void Myst3Engine::loadNode(uint16 nodeID, uint32 roomID, uint32 ageID) {
 
 		Common::String nodeFile = Common::String::format("%snodes.m3a", newRoomName.c_str());
 
+		// The prefetched faces belong to the archive being closed
+		_prefetcher->clear();
 		_archiveNode->close();
 		if (!_archiveNode->open(nodeFile.c_str(), newRoomName.c_str())) {
 			error("Unable to open archive %s", nodeFile.c_str());
@@ -872,6 +886,11 @@ void Myst3Engine::loadNode(uint16 nodeID, uint32 roomID, uint32 ageID) {
 	_shakeEffect = ShakeEffect::create(this);
 	_rotationEffect = RotationEffect::create(this);
 
+	// Start decoding the nodes the player may go to next
+	NodePtr nodeData = _db->getNodeData(_state->getLocationNode(), roomID, ageID);
+	if (nodeData)
+		_prefetcher->prefetchNeighbours(nodeData.get());
+
 	// WORKAROUND: In Narayan, the scripts in node NACH 9 test on var 39
 	// without first reinitializing it leading to Saavedro not always giving
 	// Releeshan to the player when he is trapped between both shields.
@@ -1395,13 +1414,21 @@ Graphics::Surface *Myst3Engine::loadTexture(uint16 id) {
 
 Graphics::Surface *Myst3Engine::decodeJpeg(const ResourceDescription *jpegDesc) {
 	Common::SeekableReadStream *jpegStream = jpegDesc->getData();
+	Graphics::Surface *bitmap = decodeJpegStream(jpegStream);
+	delete jpegStream;
+
+	if (!bitmap)
+		error("Could not decode Myst III JPEG");
 
+	return bitmap;
+}
+
+Graphics::Surface *Myst3Engine::decodeJpegStream(Common::SeekableReadStream *jpegStream) {
 	Image::JPEGDecoder jpeg;
 	jpeg.setOutputPixelFormat(Texture::getRGBAPixelFormat());
 
 	if (!jpeg.loadStream(*jpegStream))
-		error("Could not decode Myst III JPEG");
-	delete jpegStream;
+		return nullptr;
 
 	const Graphics::Surface *bitmap = jpeg.getSurface();
 	assert(bitmap->format == Texture::getRGBAPixelFormat());
@@ -1412,6 +1439,51 @@ Graphics::Surface *Myst3Engine::decodeJpeg(const ResourceDescription *jpegDesc)
 	return rgbaSurface;
 }
 
+struct JpegDecodeJob {
+	Common::SeekableReadStream *data;
+	Graphics::Surface *bitmap;
+};
+
+static void decodeJpegJob(void *param) {
+	JpegDecodeJob *job = (JpegDecodeJob *)param;
+	job->bitmap = Myst3Engine::decodeJpegStream(job->data);
+}
+
+void Myst3Engine::decodeJpegs(const ResourceDescription *jpegDescs, Graphics::Surface **bitmaps, uint count) {
+	Common::Array<JpegDecodeJob> jobs;
+	Common::Array<uint> jobIndices;
+	jobs.reserve(count);
+
+	// The archives are read from the main thread, only the decoding is done by the jobs
+	for (uint i = 0; i < count; i++) {
+		bitmaps[i] = _prefetcher->takeBitmap(jpegDescs[i]);
+		if (bitmaps[i])
+			continue;
+
+		JpegDecodeJob job;
+		job.data = jpegDescs[i].getData();
+		job.bitmap = nullptr;
+		jobs.push_back(job);
+		jobIndices.push_back(i);
+	}
+
+	Common::Array<void *> params;
+	for (uint i = 0; i < jobs.size(); i++)
+		params.push_back(&jobs[i]);
+
+	Common::runJobs(decodeJpegJob, params.data(), params.size());
+
+	for (uint i = 0; i < jobs.size(); i++) {
+		delete jobs[i].data;
+		if (!jobs[i].bitmap)
+			error("Could not decode Myst III JPEG");
+
+		bitmaps[jobIndices[i]] = jobs[i].bitmap;
+	}
+
+	debugC(kDebugNode, "Decoded %d JPEG resources, %d were prefetched", count, count - jobs.size());
+}
+
 int16 Myst3Engine::openDialog(uint16 id) {
 	Dialog *dialog;
 
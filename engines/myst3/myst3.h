@@ -38,6 +38,7 @@ struct Surface;
 
 namespace Common {
 struct Event;
+class SeekableReadStream;
 }
 
 namespace Myst3 {
@@ -47,7 +48,8 @@ enum {
 	kDebugVariable = (1 << 0),
 	kDebugSaveLoad = (1 << 1),
 	kDebugNode     = (1 << 2),
-	kDebugScript   = (1 << 3)
+	kDebugScript   = (1 << 3),
+	kDebugTinyGL   = (1 << 4)
 };
 
 enum TransitionType {
@@ -80,6 +82,7 @@ class ShakeEffect;
 class RotationEffect;
 class Transition;
 class FrameLimiter;
+class NodePrefetcher;
 struct NodeData;
 struct Myst3GameDescription;
 
@@ -133,6 +136,10 @@ public:
 
 	Graphics::Surface *loadTexture(uint16 id);
 	static Graphics::Surface *decodeJpeg(const ResourceDescription *jpegDesc);
+	/** Decode a JPEG stream, returns NULL if it is invalid. Can be called from any thread. */
+	static Graphics::Surface *decodeJpegStream(Common::SeekableReadStream *jpegStream);
+	/** Decode several JPEG resources in parallel, using the prefetched ones when available */
+	void decodeJpegs(const ResourceDescription *jpegDescs, Graphics::Surface **bitmaps, uint count);
 
 	void goToNode(uint16 nodeID, TransitionType transition);
 	void loadNode(uint16 nodeID, uint32 roomID = 0, uint32 ageID = 0);
@@ -198,6 +205,7 @@ private:
 
 	Common::Array<Archive *> _archivesCommon;
 	Archive *_archiveNode;
+	NodePrefetcher *_prefetcher;
 
 	Script *_scriptEngine;
 
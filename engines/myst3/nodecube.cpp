@@ -32,14 +32,21 @@ NodeCube::NodeCube(Myst3Engine *vm, uint16 id) :
 		Node(vm, id) {
 	_is3D = true;
 
+	ResourceDescription jpegDescs[6];
 	for (int i = 0; i < 6; i++) {
-		ResourceDescription jpegDesc = _vm->getFileDescription("", id, i + 1, Archive::kCubeFace);
+		jpegDescs[i] = _vm->getFileDescription("", id, i + 1, Archive::kCubeFace);
 
-		if (!jpegDesc.isValid())
+		if (!jpegDescs[i].isValid())
 			error("Face %d does not exist", id);
+	}
+
+	// The textures can only be created from the main thread, once the faces are decoded
+	Graphics::Surface *bitmaps[6];
+	_vm->decodeJpegs(jpegDescs, bitmaps, 6);
 
+	for (int i = 0; i < 6; i++) {
 		_faces[i] = new Face(_vm);
-		_faces[i]->setTextureFromJPEG(&jpegDesc);
+		_faces[i]->setTextureFromBitmap(bitmaps[i]);
 	}
 }
 
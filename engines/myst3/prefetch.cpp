@@ -0,0 +1,255 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/myst3/prefetch.h"
+#include "engines/myst3/database.h"
+#include "engines/myst3/myst3.h"
+#include "engines/myst3/script.h"
+#include "engines/myst3/state.h"
+
+#include "common/algorithm.h"
+#include "common/debug.h"
+
+#include "graphics/surface.h"
+
+namespace Myst3 {
+
+NodePrefetcher::NodePrefetcher(Myst3Engine *vm) :
+		_vm(vm),
+		_thread(0),
+		_enabled(true),
+		_cacheSize(0),
+		_decodingTaken(false),
+		_threadRunning(false),
+		_quit(false) {
+}
+
+NodePrefetcher::~NodePrefetcher() {
+	clear();
+}
+
+void NodePrefetcher::prefetchNeighbours(const NodeData *nodeData) {
+	if (!_enabled)
+		return;
+
+	// The nodes of the previous location are no longer wanted,
+	// the faces already decoded stay in the cache until they are evicted
+	_nodesToRead.clear();
+	{
+		Common::StackLock lock(_mutex);
+		dropJobs();
+	}
+
+	Common::Array<uint16> nodes;
+	for (uint i = 0; i < nodeData->hotspots.size() && nodes.size() < kMaxNodes; i++) {
+		const Common::Array<Opcode> &script = nodeData->hotspots[i].script;
+
+		for (uint j = 0; j < script.size() && nodes.size() < kMaxNodes; j++) {
+			int16 node = Script::getGoToNodeDestination(script[j]);
+			if (node > 0 && node != nodeData->id && Common::find(nodes.begin(), nodes.end(), node) == nodes.end())
+				nodes.push_back(node);
+		}
+	}
+
+	for (uint i = 0; i < nodes.size(); i++) {
+		Common::Array<ResourceDescription> faces;
+		for (uint face = 1; face <= 6; face++) {
+			ResourceDescription jpegDesc = _vm->getFileDescription("", nodes[i], face, Archive::kCubeFace);
+			if (!jpegDesc.isValid())
+				break; // Only the cube nodes are prefetched
+
+			if (!isCached(jpegDesc))
+				faces.push_back(jpegDesc);
+		}
+
+		if (!faces.empty())
+			_nodesToRead.push_back(faces);
+	}
+
+	debugC(kDebugNode, "Prefetching %d nodes reachable from node %d", _nodesToRead.size(), nodeData->id);
+}
+
+void NodePrefetcher::update() {
+	if (_nodesToRead.empty())
+		return;
+
+	Common::Array<ResourceDescription> faces = _nodesToRead.front();
+	_nodesToRead.pop_front();
+
+	Common::Array<DecodeJob> jobs;
+	for (uint i = 0; i < faces.size(); i++) {
+		DecodeJob job;
+		job.desc = faces[i];
+		job.data = faces[i].getData();
+		jobs.push_back(job);
+	}
+
+	Common::StackLock lock(_mutex);
+	for (uint i = 0; i < jobs.size(); i++)
+		_jobs.push_back(jobs[i]);
+
+	startThread();
+}
+
+Graphics::Surface *NodePrefetcher::takeBitmap(const ResourceDescription &jpegDesc) {
+	Common::StackLock lock(_mutex);
+
+	for (Common::List<CachedBitmap>::iterator it = _cache.begin(); it != _cache.end(); it++) {
+		if (it->desc == jpegDesc) {
+			Graphics::Surface *bitmap = it->bitmap;
+			_cacheSize -= bitmap->pitch * bitmap->h;
+			_cache.erase(it);
+			return bitmap;
+		}
+	}
+
+	// The caller is going to decode the face, there is no point in doing it twice
+	for (Common::List<DecodeJob>::iterator it = _jobs.begin(); it != _jobs.end(); it++) {
+		if (it->desc == jpegDesc) {
+			delete it->data;
+			_jobs.erase(it);
+			break;
+		}
+	}
+
+	if (_decoding == jpegDesc)
+		_decodingTaken = true;
+
+	return nullptr;
+}
+
+void NodePrefetcher::clear() {
+	_nodesToRead.clear();
+
+	{
+		Common::StackLock lock(_mutex);
+		_quit = true;
+		dropJobs();
+	}
+
+	// The thread needs the mutex to notice it has to stop
+	if (_thread) {
+		g_system->waitThread(_thread);
+		_thread = 0;
+	}
+
+	Common::StackLock lock(_mutex);
+	for (Common::List<CachedBitmap>::iterator it = _cache.begin(); it != _cache.end(); it++) {
+		it->bitmap->free();
+		delete it->bitmap;
+	}
+	_cache.clear();
+	_cacheSize = 0;
+	_threadRunning = false;
+	_quit = false;
+}
+
+void NodePrefetcher::startThread() {
+	if (_threadRunning)
+		return;
+
+	// The previous thread has nothing left to do once it is not running anymore
+	if (_thread)
+		g_system->waitThread(_thread);
+
+	_threadRunning = true;
+	_thread = g_system->createThread(threadEntry, this);
+
+	if (!_thread) {
+		// Decoding on the main thread would cause the hitches prefetching is meant to avoid
+		_threadRunning = false;
+		_enabled = false;
+		_nodesToRead.clear();
+		dropJobs();
+	}
+}
+
+void NodePrefetcher::dropJobs() {
+	for (Common::List<DecodeJob>::iterator it = _jobs.begin(); it != _jobs.end(); it++)
+		delete it->data;
+	_jobs.clear();
+}
+
+bool NodePrefetcher::isCached(const ResourceDescription &jpegDesc) {
+	Common::StackLock lock(_mutex);
+
+	for (Common::List<CachedBitmap>::iterator it = _cache.begin(); it != _cache.end(); it++) {
+		if (it->desc == jpegDesc)
+			return true;
+	}
+
+	return false;
+}
+
+int NodePrefetcher::threadEntry(void *param) {
+	((NodePrefetcher *)param)->run();
+	return 0;
+}
+
+void NodePrefetcher::run() {
+	while (true) {
+		DecodeJob job;
+		{
+			Common::StackLock lock(_mutex);
+			if (_quit || _jobs.empty()) {
+				_threadRunning = false;
+				return;
+			}
+
+			job = _jobs.front();
+			_jobs.pop_front();
+			_decoding = job.desc;
+			_decodingTaken = false;
+		}
+
+		// Decoding errors are reported when the node is loaded and the face is decoded again
+		Graphics::Surface *bitmap = Myst3Engine::decodeJpegStream(job.data);
+		delete job.data;
+
+		Common::StackLock lock(_mutex);
+		_decoding = ResourceDescription();
+		if (!bitmap)
+			continue;
+
+		if (_decodingTaken) {
+			bitmap->free();
+			delete bitmap;
+			continue;
+		}
+
+		CachedBitmap cached;
+		cached.desc = job.desc;
+		cached.bitmap = bitmap;
+		_cache.push_back(cached);
+		_cacheSize += bitmap->pitch * bitmap->h;
+
+		while (_cacheSize > kMaxCacheSize && _cache.size() > 1) {
+			Graphics::Surface *oldest = _cache.front().bitmap;
+			_cacheSize -= oldest->pitch * oldest->h;
+			oldest->free();
+			delete oldest;
+			_cache.pop_front();
+		}
+	}
+}
+
+} // End of namespace Myst3
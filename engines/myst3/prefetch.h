@@ -0,0 +1,112 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef PREFETCH_H_
+#define PREFETCH_H_
+
+#include "engines/myst3/archive.h"
+
+#include "common/list.h"
+#include "common/mutex.h"
+#include "common/system.h"
+
+namespace Graphics {
+struct Surface;
+}
+
+namespace Myst3 {
+
+class Myst3Engine;
+struct NodeData;
+
+/**
+ * Decodes the cube faces of the nodes the player can go to from the current
+ * node on a background thread, so that they are ready when the player moves.
+ *
+ * The archives are only read from the main thread, a few faces per frame,
+ * the background thread only decodes the JPEG data. The decoded faces are
+ * kept in a cache bounded by kMaxCacheSize, the oldest are dropped first.
+ */
+class NodePrefetcher {
+public:
+	NodePrefetcher(Myst3Engine *vm);
+	~NodePrefetcher();
+
+	/** Start prefetching the nodes reachable from the hotspots of a node of the current room */
+	void prefetchNeighbours(const NodeData *nodeData);
+
+	/** Read the data of the next queued node, called once per frame */
+	void update();
+
+	/**
+	 * Take a prefetched face from the cache
+	 *
+	 * @return the decoded face owned by the caller, or NULL if it isn't ready
+	 */
+	Graphics::Surface *takeBitmap(const ResourceDescription &jpegDesc);
+
+	/** Stop the decoding and free the cache, before the archives are closed */
+	void clear();
+
+private:
+	enum {
+		kMaxNodes = 4,
+		kMaxCacheSize = 48 * 1024 * 1024
+	};
+
+	struct DecodeJob {
+		ResourceDescription desc;
+		Common::SeekableReadStream *data;
+	};
+
+	struct CachedBitmap {
+		ResourceDescription desc;
+		Graphics::Surface *bitmap;
+	};
+
+	static int threadEntry(void *param);
+	void run();
+	void startThread();
+	void dropJobs();
+	bool isCached(const ResourceDescription &jpegDesc);
+
+	Myst3Engine *_vm;
+
+	// Only used by the main thread
+	Common::List<Common::Array<ResourceDescription> > _nodesToRead;
+	OSystem::ThreadRef _thread;
+	bool _enabled;
+
+	// Protects everything below
+	Common::Mutex _mutex;
+	Common::List<DecodeJob> _jobs;
+	Common::List<CachedBitmap> _cache;
+	uint32 _cacheSize;
+	ResourceDescription _decoding;
+	bool _decodingTaken;
+	bool _threadRunning;
+	bool _quit;
+};
+
+} // End of namespace Myst3
+
+#endif
@@ -381,6 +381,18 @@ const Common::String Script::describeOpcode(const Opcode &opcode) {
 	return d;
 }
 
+int16 Script::getGoToNodeDestination(const Opcode &opcode) {
+	switch (opcode.op) {
+	case 136: // goToNodeTransition
+	case 137: // goToNodeTrans2
+	case 138: // goToNodeTrans1
+	case 140: // zipToNode
+		return opcode.args[0];
+	default:
+		return 0;
+	}
+}
+
 const Common::String Script::describeArgument(char type, int16 value) {
 	switch (type) {
 	case kVar:
@@ -43,6 +43,9 @@ public:
 
 	const Common::String describeOpcode(const Opcode &opcode);
 
+	/** Node of the current room an opcode moves the player to, or 0 */
+	static int16 getGoToNodeDestination(const Opcode &opcode);
+
 private:
 	struct Context {
 		bool endScript;
@@ -23,6 +23,7 @@
 #include "engines/stark/console.h"
 
 #include "engines/stark/formats/xarc.h"
+#include "engines/stark/formats/xmg.h"
 #include "engines/stark/resources/object.h"
 #include "engines/stark/resources/anim.h"
 #include "engines/stark/resources/level.h"
@@ -34,6 +35,7 @@
 #include "engines/stark/resources/item.h"
 #include "engines/stark/resources/textureset.h"
 #include "engines/stark/services/archiveloader.h"
+#include "engines/stark/services/assetcache.h"
 #include "engines/stark/services/dialogplayer.h"
 #include "engines/stark/services/global.h"
 #include "engines/stark/services/resourceprovider.h"
@@ -44,6 +46,9 @@
 
 #include <limits.h>
 #include "common/file.h"
+#include "common/system.h"
+
+#include "graphics/surface.h"
 
 namespace Stark {
 
@@ -72,6 +77,8 @@ Console::Console() :
 	registerCmd("changeKnowledge",      WRAP_METHOD(Console, Cmd_ChangeKnowledge));
 	registerCmd("enableInventoryItem",  WRAP_METHOD(Console, Cmd_EnableInventoryItem));
 	registerCmd("extractAllTextures",   WRAP_METHOD(Console, Cmd_ExtractAllTextures));
+	registerCmd("benchmarkXMG",         WRAP_METHOD(Console, Cmd_BenchmarkXMG));
+	registerCmd("assetCache",           WRAP_METHOD(Console, Cmd_AssetCache));
 }
 
 Console::~Console() {
@@ -509,6 +516,105 @@ bool Console::Cmd_ExtractAllTextures(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::Cmd_BenchmarkXMG(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Decode all the XMG images of the game archives, and report the time spent decoding\n");
+		debugPrintf("Usage :\n");
+		debugPrintf("benchmarkXMG [number of times each image is decoded]\n");
+		return true;
+	}
+
+	uint passes = argc == 2 ? MAX(atoi(argv[1]), 1) : 1;
+
+	Resources::Root *root = StarkGlobal->getRoot();
+	if (!root) {
+		debugPrintf("The global root has not been loaded\n");
+		return true;
+	}
+
+	// The location archives are found in the folders of their levels
+	Common::Array<Common::String> archives;
+	Common::Array<Resources::Level *> levels = root->listChildren<Resources::Level>();
+	for (uint i = 0; i < levels.size(); i++) {
+		archives.push_back(StarkArchiveLoader->buildArchiveName(levels[i]));
+
+		for (uint location = 0; location < 256; location++) {
+			Common::String locationArchive = Common::String::format("%02x/%02x/%02x.xarc", levels[i]->getIndex(), location, location);
+			if (SearchMan.hasFile(locationArchive)) {
+				archives.push_back(locationArchive);
+			}
+		}
+	}
+
+	uint32 imageCount = 0;
+	uint64 pixelCount = 0;
+	uint32 totalTime = 0;
+
+	for (uint archive = 0; archive < archives.size(); archive++) {
+		Formats::XARCArchive xarc;
+		if (!xarc.open(archives[archive])) {
+			continue;
+		}
+
+		Common::ArchiveMemberList members;
+		xarc.listMatchingMembers(members, "*.xmg");
+
+		// Read the images beforehand, so that only the decoding is measured
+		Common::Array<Common::SeekableReadStream *> images;
+		for (Common::ArchiveMemberList::const_iterator it = members.begin(); it != members.end(); it++) {
+			Common::SeekableReadStream *stream = (*it)->createReadStream();
+			if (stream) {
+				images.push_back(stream->readStream(stream->size()));
+				delete stream;
+			}
+		}
+
+		uint32 startTime = g_system->getMillis();
+		for (uint pass = 0; pass < passes; pass++) {
+			for (uint i = 0; i < images.size(); i++) {
+				images[i]->seek(0);
+
+				Graphics::Surface *surface = Formats::XMGDecoder::decode(images[i]);
+				pixelCount += surface->w * surface->h;
+				surface->free();
+				delete surface;
+			}
+		}
+		totalTime += g_system->getMillis() - startTime;
+		imageCount += images.size() * passes;
+
+		for (uint i = 0; i < images.size(); i++) {
+			delete images[i];
+		}
+	}
+
+	debugPrintf("Decoded %d XMG images from %d archives in %d ms\n", imageCount, archives.size(), totalTime);
+	if (pixelCount) {
+		debugPrintf("%.2f ns per pixel\n", totalTime * 1000000.0 / pixelCount);
+	}
+
+	return true;
+}
+
+bool Console::Cmd_AssetCache(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Show the statistics of the decoded asset cache, or change its budget\n");
+		debugPrintf("Usage :\n");
+		debugPrintf("assetCache [budget in kilobytes]\n");
+		return true;
+	}
+
+	if (argc == 2) {
+		StarkAssetCache->setBudget(atoi(argv[1]) * 1024);
+	}
+
+	AssetCache::Stats stats = StarkAssetCache->getStats();
+	debugPrintf("Entries: %d, size: %d KB, budget: %d KB\n", stats.entries, stats.size / 1024, stats.budget / 1024);
+	debugPrintf("Hits: %d, misses: %d, evictions: %d\n", stats.hits, stats.misses, stats.evictions);
+
+	return true;
+}
+
 Common::Array<Resources::Anim *> Console::listAllLocationAnimations() const {
 	Common::Array<Resources::Anim *> animations;
 
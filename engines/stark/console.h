@@ -64,6 +64,8 @@ private:
 	bool Cmd_ChangeChapter(int argc, const char **argv);
 	bool Cmd_ChangeKnowledge(int argc, const char **argv);
 	bool Cmd_ExtractAllTextures(int argc, const char **argv);
+	bool Cmd_BenchmarkXMG(int argc, const char **argv);
+	bool Cmd_AssetCache(int argc, const char **argv);
 
 	Common::Array<Resources::Anim *> listAllLocationAnimations() const;
 	Common::Array<Resources::Script *> listAllLocationScripts() const;
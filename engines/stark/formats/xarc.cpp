@@ -28,6 +28,7 @@
 
 #include "common/debug.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/substream.h"
 
 namespace Stark {
@@ -95,6 +96,14 @@ Common::String XARCMember::readString(Common::ReadStream &stream) {
 
 // ARCHIVE
 
+XARCArchive::XARCArchive() :
+		_mappedStream(nullptr) {
+}
+
+XARCArchive::~XARCArchive() {
+	delete _mappedStream;
+}
+
 bool XARCArchive::open(const Common::String &filename) {
 	Common::File stream;
 	if (!stream.open(filename)) {
@@ -103,6 +112,11 @@ bool XARCArchive::open(const Common::String &filename) {
 
 	_filename = filename;
 
+	Common::SharedMemoryReadStream *mappedStream = stream.getMappedStream();
+	if (mappedStream) {
+		_mappedStream = mappedStream->createRangeStream(0, mappedStream->size());
+	}
+
 	// Unknown: always 1? version?
 	uint32 unknown = stream.readUint32LE();
 	debugC(kDebugUnknown, "Stark::XARC: \"%s\" has unknown=%d", _filename.c_str(), unknown);
@@ -194,6 +208,14 @@ Common::SeekableReadStream *XARCArchive::createReadStreamForMember(const Common:
 }
 
 Common::SeekableReadStream *XARCArchive::createReadStreamForMember(const XARCMember *member) const {
+	uint32 offset = member->getOffset();
+	uint32 length = member->getLength();
+
+	// Return a view into the mapped xarc file
+	if (_mappedStream) {
+		return _mappedStream->createRangeStream(offset, offset + length);
+	}
+
 	// Open the xarc file
 	Common::File *f = new Common::File;
 	if (!f)
@@ -205,8 +227,6 @@ Common::SeekableReadStream *XARCArchive::createReadStreamForMember(const XARCMem
 	}
 
 	// Return the substream that contains the archive member
-	uint32 offset = member->getOffset();
-	uint32 length = member->getLength();
 	return new Common::SeekableSubReadStream(f, offset, offset + length, DisposeAfterUse::YES);
 
 	// Different approach: keep the archive open and read full resources to memory
@@ -26,6 +26,10 @@
 #include "common/archive.h"
 #include "common/stream.h"
 
+namespace Common {
+class SharedMemoryReadStream;
+}
+
 namespace Stark {
 namespace Formats {
 
@@ -33,6 +37,9 @@ class XARCMember;
 
 class XARCArchive : public Common::Archive {
 public:
+	XARCArchive();
+	~XARCArchive() override;
+
 	bool open(const Common::String &filename);
 	Common::String getFilename() const;
 
@@ -48,6 +55,9 @@ public:
 private:
 	Common::String _filename;
 	Common::ArchiveMemberList _members;
+
+	// The members are views into the file when it is mapped into memory
+	Common::SharedMemoryReadStream *_mappedStream;
 };
 
 } // End of namespace Formats
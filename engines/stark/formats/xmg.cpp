@@ -24,20 +24,56 @@
 #include "engines/stark/debug.h"
 #include "engines/stark/gfx/driver.h"
 
-#include "graphics/conversion.h"
 #include "graphics/pixelformat.h"
 #include "graphics/surface.h"
 #include "common/stream.h"
+#include "common/util.h"
 #include "common/textconsole.h"
 
 namespace Stark {
 namespace Formats {
 
+/**
+ * Lookup tables computing the same colors as Graphics::YUV2RGB
+ *
+ * The chroma tables hold the offsets the chroma values add to the luminance
+ * for each component. The component tables are indexed by the luminance plus
+ * those offsets, they clip the sums and place the components in little
+ * endian RGBA pixels.
+ */
+struct YCrCbTables {
+	enum {
+		kClipOffset = 256
+	};
+
+	int16 crR[256], crG[256], cbG[256], cbB[256];
+	uint32 r[768], g[768], b[768];
+
+	YCrCbTables() {
+		for (int c = 0; c < 256; c++) {
+			crR[c] = (1357 * (c - 128)) >> 10;
+			crG[c] = -((691 * (c - 128)) >> 10);
+			cbG[c] = -((333 * (c - 128)) >> 10);
+			cbB[c] = (1715 * (c - 128)) >> 10;
+		}
+
+		for (int i = 0; i < 768; i++) {
+			uint32 component = CLIP<int>(i - kClipOffset, 0, 255);
+			r[i] = TO_LE_32(component);
+			g[i] = TO_LE_32(component << 8);
+			b[i] = TO_LE_32((255u << 24) | (component << 16));
+		}
+	}
+};
+
+static const YCrCbTables &getYCrCbTables() {
+	static const YCrCbTables tables;
+	return tables;
+}
+
 XMGDecoder::XMGDecoder(Common::ReadStream *stream) :
 		_width(0),
 		_height(0),
-		_currX(0),
-		_currY(0),
 		_stream(stream),
 		_transColor(0) {
 }
@@ -45,6 +81,7 @@ XMGDecoder::XMGDecoder(Common::ReadStream *stream) :
 Graphics::Surface *XMGDecoder::decode(Common::ReadStream *stream) {
 	XMGDecoder dec(stream);
 	dec.readHeader();
+	dec.readData();
 	return dec.decodeImage();
 }
 
@@ -84,165 +121,179 @@ void XMGDecoder::readHeader() {
 	debugC(kDebugUnknown, "Stark::XMG: unknown3 = %08x = %d", unknown3, unknown3);
 }
 
+void XMGDecoder::readData() {
+	// The blocks are decoded from memory, rather than by reading the stream byte per byte
+	Common::SeekableReadStream *seekableStream = dynamic_cast<Common::SeekableReadStream *>(_stream);
+	if (seekableStream) {
+		_data.resize(seekableStream->size() - seekableStream->pos());
+		_data.resize(_stream->read(_data.begin(), _data.size()));
+		return;
+	}
+
+	static const uint32 kChunkSize = 64 * 1024;
+	uint32 size = 0;
+	while (!_stream->eos() && !_stream->err()) {
+		_data.resize(size + kChunkSize);
+		size += _stream->read(_data.begin() + size, kChunkSize);
+	}
+	_data.resize(size);
+}
+
 Graphics::Surface *XMGDecoder::decodeImage() {
 	// Create the destination surface
 	Graphics::Surface *surface = new Graphics::Surface();
 	surface->create(_width, _height, Gfx::Driver::getRGBAPixelFormat());
 
-	_currX = 0, _currY = 0;
-	while (!_stream->eos()) {
-		if (_currX >= _width) {
-			assert(_currX == _width);
-			_currX = 0;
-			_currY += 2;
-			if (_currY >= _height)
-				break;
+	// Odd widths and heights leave partial blocks, those rows are decoded to a temporary buffer
+	uint32 blockWidth = (_width + 1) & ~1;
+	Common::Array<uint32> rowBuffer;
+
+	const byte *data = _data.begin();
+	const byte *end = _data.end();
+	for (uint32 y = 0; y < _height; y += 2) {
+		uint32 *row0 = (uint32 *)surface->getBasePtr(0, y);
+		bool drawTwoLines = y + 1 < _height;
+
+		bool complete;
+		if (drawTwoLines && blockWidth == _width) {
+			complete = decodeRowPair(data, end, row0, row0 + surface->pitch / 4);
+		} else {
+			rowBuffer.resize(2 * blockWidth);
+			memset(rowBuffer.begin(), 0, rowBuffer.size() * sizeof(uint32));
+			complete = decodeRowPair(data, end, rowBuffer.begin(), rowBuffer.begin() + blockWidth);
+
+			memcpy(row0, rowBuffer.begin(), _width * sizeof(uint32));
+			if (drawTwoLines) {
+				memcpy(row0 + surface->pitch / 4, rowBuffer.begin() + blockWidth, _width * sizeof(uint32));
+			}
+		}
+
+		if (!complete) {
+			warning("Stark::XMG: The image data ends before the end of the image");
+			break;
 		}
+	}
 
+	return surface;
+}
+
+bool XMGDecoder::decodeRowPair(const byte *&data, const byte *end, uint32 *row0, uint32 *row1) const {
+	uint32 blocks = (_width + 1) / 2;
+	uint32 x = 0;
+	while (x < blocks) {
 		// Read the number and mode of the tiles
-		byte op = _stream->readByte();
+		if (data >= end) {
+			return false;
+		}
+
+		byte op = *data++;
 		uint16 count;
 		if ((op & 0xC0) != 0xC0) {
 			count = op & 0x3F;
 		} else {
-			count = ((op & 0xF) << 8) + _stream->readByte();
+			if (data >= end) {
+				return false;
+			}
+			count = ((op & 0xF) << 8) + *data++;
 			op <<= 2;
 		}
 		op &= 0xC0;
 
+		if (count > blocks - x) {
+			error("Stark::XMG: A serie of %d blocks overflows the row", count);
+		}
+
 		// Process the current serie
-		for (int i = 0; i < count; i++) {
-			Block block = decodeBlock(op);
-			drawBlock(block, surface);
+		uint32 blockSize;
+		switch (op) {
+			case 0x00:
+				// YCrCb
+				blockSize = 6;
+				break;
+			case 0x40:
+				// Trans
+				blockSize = 0;
+				break;
+			case 0x80:
+				// RGB
+				blockSize = 12;
+				break;
+			default:
+				error("Unsupported color mode '%d'", op);
 		}
-	}
 
-	return surface;
-}
+		bool truncated = blockSize && (uint32)(end - data) < count * blockSize;
+		if (truncated) {
+			count = (end - data) / blockSize;
+		}
 
-XMGDecoder::Block XMGDecoder::decodeBlock(byte op) {
-	Block block;
+		switch (op) {
+			case 0x00:
+				convertYCrCb(data, count, row0 + 2 * x, row1 + 2 * x);
+				break;
+			case 0x40:
+				memset(row0 + 2 * x, 0, 2 * count * sizeof(uint32));
+				memset(row1 + 2 * x, 0, 2 * count * sizeof(uint32));
+				break;
+			default:
+				convertRGB(data, count, row0 + 2 * x, row1 + 2 * x);
+				break;
+		}
 
-	switch (op) {
-		case 0x00:
-			// YCrCb
-			block = processYCrCb();
-			break;
-		case 0x40:
-			// Trans
-			block = processTrans();
-			break;
-		case 0x80:
-			// RGB
-			block = processRGB();
-			break;
-		default:
-			error("Unsupported color mode '%d'", op);
+		data += count * blockSize;
+		x += count;
+
+		if (truncated) {
+			return false;
+		}
 	}
 
-	return block;
+	return true;
 }
 
-void XMGDecoder::drawBlock(const Block &block, Graphics::Surface *surface) {
-	uint32 *pixels = (uint32 *)surface->getBasePtr(_currX, _currY);
+void XMGDecoder::convertYCrCb(const byte *src, uint count, uint32 *row0, uint32 *row1) {
+	const YCrCbTables &tables = getYCrCbTables();
 
-	bool drawTwoColumns = _currX + 1 < _width;
-	bool drawTwoLines = _currY + 1 < _height;
+	for (uint i = 0; i < count; i++) {
+		// Each block has four luminance values and shares its chroma values
+		byte cr = src[4];
+		byte cb = src[5];
 
-	pixels[0] = TO_LE_32(block.a1);
+		const uint32 *r = tables.r + YCrCbTables::kClipOffset + tables.crR[cr];
+		const uint32 *g = tables.g + YCrCbTables::kClipOffset + tables.crG[cr] + tables.cbG[cb];
+		const uint32 *b = tables.b + YCrCbTables::kClipOffset + tables.cbB[cb];
 
-	if (drawTwoColumns) {
-		pixels[1] = TO_LE_32(block.a2);
-	}
-
-	if (drawTwoLines) {
-		pixels[_width + 0] = TO_LE_32(block.b1);
-	}
+		row0[0] = r[src[0]] | g[src[0]] | b[src[0]];
+		row0[1] = r[src[1]] | g[src[1]] | b[src[1]];
+		row1[0] = r[src[2]] | g[src[2]] | b[src[2]];
+		row1[1] = r[src[3]] | g[src[3]] | b[src[3]];
 
-	if (drawTwoColumns && drawTwoLines) {
-		pixels[_width + 1] = TO_LE_32(block.b2);
+		src += 6;
+		row0 += 2;
+		row1 += 2;
 	}
-
-	_currX += drawTwoColumns ? 2 : 1;
 }
 
-XMGDecoder::Block XMGDecoder::processYCrCb() {
-	byte y0, y1, y2, y3;
-	byte cr, cb;
-
-	y0 = _stream->readByte();
-	y1 = _stream->readByte();
-	y2 = _stream->readByte();
-	y3 = _stream->readByte();
-	cr = _stream->readByte();
-	cb = _stream->readByte();
-
-	byte r, g, b;
-	Block block;
-
-	Graphics::YUV2RGB(y0, cb, cr, r, g, b);
-	block.a1 = (255u << 24) + (b << 16) + (g << 8) + r;
-
-	Graphics::YUV2RGB(y1, cb, cr, r, g, b);
-	block.a2 = (255u << 24) + (b << 16) + (g << 8) + r;
+void XMGDecoder::convertRGB(const byte *src, uint count, uint32 *row0, uint32 *row1) const {
+	for (uint i = 0; i < count; i++) {
+		row0[0] = convertRGBPixel(src + 0);
+		row0[1] = convertRGBPixel(src + 3);
+		row1[0] = convertRGBPixel(src + 6);
+		row1[1] = convertRGBPixel(src + 9);
 
-	Graphics::YUV2RGB(y2, cb, cr, r, g, b);
-	block.b1 = (255u << 24) + (b << 16) + (g << 8) + r;
-
-	Graphics::YUV2RGB(y3, cb, cr, r, g, b);
-	block.b2 = (255u << 24) + (b << 16) + (g << 8) + r;
-
-	return block;
+		src += 12;
+		row0 += 2;
+		row1 += 2;
+	}
 }
 
-XMGDecoder::Block XMGDecoder::processTrans() {
-	Block block;
-
-	block.a1 = 0;
-	block.a2 = 0;
-	block.b1 = 0;
-	block.b2 = 0;
-
-	return block;
-}
+uint32 XMGDecoder::convertRGBPixel(const byte *src) const {
+	uint32 color = src[0] | (src[1] << 8) | (src[2] << 16);
+	if (color == _transColor) {
+		return 0;
+	}
 
-XMGDecoder::Block XMGDecoder::processRGB() {
-	Block block;
-	uint32 color;
-
-	color = _stream->readUint16LE();
-	color += _stream->readByte() << 16;
-	if (color != _transColor)
-		color += 255 << 24;
-	else
-		color = 0;
-	block.a1 = color;
-
-	color = _stream->readUint16LE();
-	color += _stream->readByte() << 16;
-	if (color != _transColor)
-		color += 255 << 24;
-	else
-		color = 0;
-	block.a2 = color;
-
-	color = _stream->readUint16LE();
-	color += _stream->readByte() << 16;
-	if (color != _transColor)
-		color += 255 << 24;
-	else
-		color = 0;
-	block.b1 = color;
-
-	color = _stream->readUint16LE();
-	color += _stream->readByte() << 16;
-	if (color != _transColor)
-		color += 255 << 24;
-	else
-		color = 0;
-	block.b2 = color;
-
-	return block;
+	return TO_LE_32((255u << 24) | color);
 }
 
 } // End of namespace Formats
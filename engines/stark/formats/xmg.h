@@ -23,6 +23,7 @@
 #ifndef STARK_XMG_H
 #define STARK_XMG_H
 
+#include "common/array.h"
 #include "common/stream.h"
 
 namespace Graphics {
@@ -43,28 +44,30 @@ public:
 private:
 	explicit XMGDecoder(Common::ReadStream *stream);
 
-	struct Block {
-		uint32 a1, a2;
-		uint32 b1, b2;
-	};
-
 	void readHeader();
+	void readData();
 	Graphics::Surface *decodeImage();
-	Block decodeBlock(byte op);
-	void drawBlock(const Block &block, Graphics::Surface *surface);
 
-	Block processYCrCb();
-	Block processTrans();
-	Block processRGB();
+	/**
+	 * Decode the blocks of a pair of rows from the image data
+	 *
+	 * The rows have to be large enough for a whole number of blocks.
+	 * Returns false if the image data ends before the rows are complete.
+	 */
+	bool decodeRowPair(const byte *&data, const byte *end, uint32 *row0, uint32 *row1) const;
+
+	static void convertYCrCb(const byte *src, uint count, uint32 *row0, uint32 *row1);
+	void convertRGB(const byte *src, uint count, uint32 *row0, uint32 *row1) const;
+	uint32 convertRGBPixel(const byte *src) const;
 
 	uint32 _width;
 	uint32 _height;
 
-	uint32 _currX;
-	uint32 _currY;
-
 	Common::ReadStream *_stream;
 
+	/** The image data following the header */
+	Common::Array<byte> _data;
+
 	/**
 	 * The transparency color in the RGB and transparency blocks.
 	 * In the output surface, the transparent color is black with zero
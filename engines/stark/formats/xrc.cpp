@@ -131,7 +131,7 @@ Common::String XRCReadStream::getArchiveName() const {
 	return _archiveName;
 }
 
-Resources::Object *XRCReader::importTree(XARCArchive *archive) {
+Resources::Object *XRCReader::importTree(XARCArchive *archive, Common::Array<Resources::Object *> *postReadQueue) {
 	// Find the XRC file
 	Common::ArchiveMemberList members;
 	archive->listMatchingMembers(members, "*.xrc");
@@ -147,20 +147,24 @@ Resources::Object *XRCReader::importTree(XARCArchive *archive) {
 	XRCReadStream *xrcStream = new XRCReadStream(archive->getFilename(), stream);
 
 	// Import the resource tree
-	Resources::Object *root = importResource(xrcStream, nullptr);
+	Resources::Object *root = importResource(xrcStream, nullptr, postReadQueue);
 
 	delete xrcStream;
 
 	return root;
 }
 
-Resources::Object *XRCReader::importResource(XRCReadStream *stream, Resources::Object *parent) {
+Resources::Object *XRCReader::importResource(XRCReadStream *stream, Resources::Object *parent, Common::Array<Resources::Object *> *postReadQueue) {
 	Resources::Object *resource = createResource(stream, parent);
 	importResourceData(stream, resource);
-	importResourceChildren(stream, resource);
+	importResourceChildren(stream, resource, postReadQueue);
 
 	// Resource lifecycle update
-	resource->onPostRead();
+	if (postReadQueue) {
+		postReadQueue->push_back(resource);
+	} else {
+		resource->onPostRead();
+	}
 
 	return resource;
 }
@@ -311,7 +315,7 @@ void XRCReader::importResourceData(XRCReadStream *stream, Resources::Object *res
 	}
 }
 
-void XRCReader::importResourceChildren(XRCReadStream *stream, Resources::Object *resource) {
+void XRCReader::importResourceChildren(XRCReadStream *stream, Resources::Object *resource, Common::Array<Resources::Object *> *postReadQueue) {
 	// Get the number of children
 	uint16 numChildren = stream->readUint16LE();
 
@@ -323,7 +327,7 @@ void XRCReader::importResourceChildren(XRCReadStream *stream, Resources::Object
 
 	// Read the children resources
 	for (int i = 0; i < numChildren; i++) {
-		Resources::Object *child = importResource(stream, resource);
+		Resources::Object *child = importResource(stream, resource, postReadQueue);
 
 		// Add child to parent
 		resource->addChild(child);
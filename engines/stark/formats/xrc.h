@@ -71,13 +71,17 @@ class XRCReader {
 public:
 	/**
 	 * Build a resource tree from a stream
+	 *
+	 * When postReadQueue is set, the resources are not initialised. They are
+	 * added to the queue instead, in the order their onPostRead method is
+	 * to be called.
 	 */
-	static Resources::Object *importTree(XARCArchive *archive);
+	static Resources::Object *importTree(XARCArchive *archive, Common::Array<Resources::Object *> *postReadQueue = nullptr);
 
 protected:
-	static Resources::Object *importResource(XRCReadStream *stream, Resources::Object *parent);
+	static Resources::Object *importResource(XRCReadStream *stream, Resources::Object *parent, Common::Array<Resources::Object *> *postReadQueue);
 	static Resources::Object *createResource(XRCReadStream *stream, Resources::Object *parent);
-	static void importResourceChildren(XRCReadStream *stream, Resources::Object *resource);
+	static void importResourceChildren(XRCReadStream *stream, Resources::Object *resource, Common::Array<Resources::Object *> *postReadQueue);
 	static void importResourceData(XRCReadStream* stream, Resources::Object* resource);
 };
 
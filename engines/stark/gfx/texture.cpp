@@ -60,5 +60,14 @@ const Texture *TextureSet::getTexture(const Common::String &name) const {
 	return nullptr;
 }
 
+uint32 TextureSet::getSize() const {
+	uint32 size = 0;
+	for (TextureMap::const_iterator it = _texMap.begin(); it != _texMap.end(); ++it) {
+		size += it->_value->width() * it->_value->height() * 4;
+	}
+
+	return size;
+}
+
 } // End of namespace Gfx
 } // End of namespace Stark
@@ -95,6 +95,11 @@ public:
 	 */
 	const Texture *getTexture(const Common::String &name) const;
 
+	/**
+	 * Get the size of the pixels of the textures, in bytes
+	 */
+	uint32 getSize() const;
+
 private:
 	typedef Common::HashMap<Common::String, Texture *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> TextureMap;
 
@@ -70,6 +70,7 @@ MODULE_OBJS := \
 	savemetadata.o \
 	scene.o \
 	services/archiveloader.o \
+	services/assetcache.o \
 	services/dialogplayer.o \
 	services/diary.o \
 	services/fontprovider.o \
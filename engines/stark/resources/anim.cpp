@@ -38,6 +38,7 @@
 #include "engines/stark/resources/textureset.h"
 
 #include "engines/stark/services/archiveloader.h"
+#include "engines/stark/services/assetcache.h"
 #include "engines/stark/services/global.h"
 #include "engines/stark/services/services.h"
 #include "engines/stark/services/settings.h"
@@ -212,6 +213,12 @@ void AnimImages::saveLoad(ResourceSerializer *serializer) {
 }
 
 AnimProp::~AnimProp() {
+	// Keep the decoded mesh and textures for when the resource is loaded again
+	if (!_meshFilenames.empty()) {
+		StarkAssetCache->put(_archiveName, _meshFilenames[0], _visual->releaseModel());
+	}
+	StarkAssetCache->put(_archiveName, _textureFilename, _visual->releaseTexture());
+
 	delete _visual;
 }
 
@@ -249,13 +256,21 @@ void AnimProp::onPostRead() {
 		error("Unexpected mesh count in prop anim: '%d'", _meshFilenames.size());
 	}
 
-	ArchiveReadStream *stream = StarkArchiveLoader->getFile(_meshFilenames[0], _archiveName);
-	_visual->setModel(Formats::BiffMeshReader::read(stream));
-	delete stream;
+	Formats::BiffMesh *mesh = StarkAssetCache->take<Formats::BiffMesh>(_archiveName, _meshFilenames[0]);
+	if (!mesh) {
+		ArchiveReadStream *stream = StarkArchiveLoader->getFile(_meshFilenames[0], _archiveName);
+		mesh = Formats::BiffMeshReader::read(stream);
+		delete stream;
+	}
+	_visual->setModel(mesh);
 
-	stream = StarkArchiveLoader->getFile(_textureFilename, _archiveName);
-	_visual->setTexture(Formats::TextureSetReader::read(stream));
-	delete stream;
+	Gfx::TextureSet *textureSet = StarkAssetCache->take<Gfx::TextureSet>(_archiveName, _textureFilename);
+	if (!textureSet) {
+		ArchiveReadStream *stream = StarkArchiveLoader->getFile(_textureFilename, _archiveName);
+		textureSet = Formats::TextureSetReader::read(stream);
+		delete stream;
+	}
+	_visual->setTexture(textureSet);
 }
 
 void AnimProp::printData() {
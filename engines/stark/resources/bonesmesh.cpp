@@ -25,6 +25,7 @@
 #include "engines/stark/model/animhandler.h"
 #include "engines/stark/model/model.h"
 #include "engines/stark/services/archiveloader.h"
+#include "engines/stark/services/assetcache.h"
 #include "engines/stark/services/services.h"
 #include "engines/stark/formats/xrc.h"
 
@@ -32,7 +33,8 @@ namespace Stark {
 namespace Resources {
 
 BonesMesh::~BonesMesh() {
-	delete _model;
+	// Keep the decoded mesh for when the resource is loaded again
+	StarkAssetCache->put(_archiveName, _filename, _model);
 }
 
 BonesMesh::BonesMesh(Object *parent, byte subType, uint16 index, const Common::String &name) :
@@ -47,6 +49,11 @@ void BonesMesh::readData(Formats::XRCReadStream *stream) {
 }
 
 void BonesMesh::onPostRead() {
+	_model = StarkAssetCache->take<Model>(_archiveName, _filename);
+	if (_model) {
+		return;
+	}
+
 	ArchiveReadStream *stream = StarkArchiveLoader->getFile(_filename, _archiveName);
 
 	_model = new Model();
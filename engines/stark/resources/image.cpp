@@ -29,6 +29,7 @@
 #include "engines/stark/formats/xrc.h"
 #include "engines/stark/resources/location.h"
 #include "engines/stark/services/archiveloader.h"
+#include "engines/stark/services/assetcache.h"
 #include "engines/stark/services/settings.h"
 #include "engines/stark/services/services.h"
 #include "engines/stark/visual/effects/bubbles.h"
@@ -177,6 +178,12 @@ Common::Point Image::getHotspotPosition(uint index) const {
 }
 
 ImageStill::~ImageStill() {
+	// Keep the decoded image for when the resource is loaded again
+	VisualImageXMG *visual = _visual ? _visual->get<VisualImageXMG>() : nullptr;
+	if (visual) {
+		StarkAssetCache->put(_archiveName, _filename, visual);
+		_visual = nullptr;
+	}
 }
 
 ImageStill::ImageStill(Object *parent, byte subType, uint16 index, const Common::String &name) :
@@ -212,6 +219,13 @@ void ImageStill::initVisual() {
 		return; // No file to load
 	}
 
+	VisualImageXMG *cachedVisual = StarkAssetCache->take<VisualImageXMG>(_archiveName, _filename);
+	if (cachedVisual) {
+		cachedVisual->setHotSpot(_hotspot);
+		_visual = cachedVisual;
+		return;
+	}
+
 	Common::ReadStream *xmgStream = StarkArchiveLoader->getFile(_filename, _archiveName);
 
 	VisualImageXMG *visual = new VisualImageXMG(StarkGfx);
@@ -32,6 +32,7 @@
 #include "engines/stark/gfx/texture.h"
 
 #include "engines/stark/services/archiveloader.h"
+#include "engines/stark/services/assetcache.h"
 #include "engines/stark/services/services.h"
 #include "engines/stark/services/settings.h"
 
@@ -43,7 +44,8 @@ namespace Stark {
 namespace Resources {
 
 TextureSet::~TextureSet() {
-	delete _textureSet;
+	// Keep the decoded textures for when the resource is loaded again
+	StarkAssetCache->put(_archiveName, _filename, _textureSet);
 }
 
 TextureSet::TextureSet(Object *parent, byte subType, uint16 index, const Common::String &name) :
@@ -62,7 +64,9 @@ void TextureSet::readData(Formats::XRCReadStream *stream) {
 }
 
 void TextureSet::onPostRead() {
-	if (StarkSettings->isAssetsModEnabled()) {
+	_textureSet = StarkAssetCache->take<Gfx::TextureSet>(_archiveName, _filename);
+
+	if (!_textureSet && StarkSettings->isAssetsModEnabled()) {
 		_textureSet = readOverrideDdsArchive();
 	}
 
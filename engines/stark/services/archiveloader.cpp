@@ -22,6 +22,9 @@
 
 #include "engines/stark/services/archiveloader.h"
 
+#include "common/algorithm.h"
+#include "common/system.h"
+
 #include "engines/stark/formats/xrc.h"
 #include "engines/stark/resources/level.h"
 #include "engines/stark/resources/location.h"
@@ -31,7 +34,9 @@ namespace Stark {
 ArchiveLoader::LoadedArchive::LoadedArchive(const Common::String& archiveName) :
 		_filename(archiveName),
 		_root(nullptr),
-		_useCount(0) {
+		_useCount(0),
+		_preloaded(false),
+		_nextPostRead(0) {
 	if (!_xarc.open(archiveName)) {
 		error("Unable to open archive '%s'", archiveName.c_str());
 	}
@@ -49,6 +54,30 @@ void ArchiveLoader::LoadedArchive::importResources() {
 	_root = Formats::XRCReader::importTree(&_xarc);
 }
 
+void ArchiveLoader::LoadedArchive::importTree() {
+	_root = Formats::XRCReader::importTree(&_xarc, &_postReadQueue);
+	_nextPostRead = 0;
+}
+
+void ArchiveLoader::LoadedArchive::continueImport(uint32 endTime) {
+	// At least one resource is initialised, so that the import always progresses
+	do {
+		// Resource lifecycle update
+		_postReadQueue[_nextPostRead++]->onPostRead();
+	} while (_nextPostRead < _postReadQueue.size() && g_system->getMillis() < endTime);
+
+	if (_nextPostRead == _postReadQueue.size()) {
+		_postReadQueue.clear();
+		_nextPostRead = 0;
+	}
+}
+
+void ArchiveLoader::LoadedArchive::finishImport() {
+	while (isImportPending()) {
+		continueImport(g_system->getMillis());
+	}
+}
+
 ArchiveLoader::~ArchiveLoader() {
 	for (LoadedArchiveList::iterator it = _archives.begin(); it != _archives.end(); it++) {
 		delete *it;
@@ -57,6 +86,15 @@ ArchiveLoader::~ArchiveLoader() {
 
 bool ArchiveLoader::load(const Common::String &archiveName) {
 	if (hasArchive(archiveName)) {
+		LoadedArchive *archive = findArchive(archiveName);
+		if (archive->isPreloaded()) {
+			// The resources were imported ahead of time, the caller takes over the preload reference
+			archive->finishImport();
+			archive->setPreloaded(false);
+			archive->decUsage();
+			return true;
+		}
+
 		// Already loaded
 		return false;
 	}
@@ -69,6 +107,45 @@ bool ArchiveLoader::load(const Common::String &archiveName) {
 	return true;
 }
 
+bool ArchiveLoader::preload(const Common::String &archiveName) {
+	if (hasArchive(archiveName) || !SearchMan.hasFile(archiveName)) {
+		return false;
+	}
+
+	LoadedArchive *archive = new LoadedArchive(archiveName);
+	_archives.push_back(archive);
+
+	archive->importTree();
+
+	// Keep the archive until it is used
+	archive->setPreloaded(true);
+	archive->incUsage();
+
+	return true;
+}
+
+bool ArchiveLoader::continuePreloading(uint32 maxMillis) {
+	for (LoadedArchiveList::iterator it = _archives.begin(); it != _archives.end(); it++) {
+		LoadedArchive *archive = *it;
+		if (archive->isPreloaded() && archive->isImportPending()) {
+			archive->continueImport(g_system->getMillis() + maxMillis);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ArchiveLoader::releasePreloaded(const Common::Array<Common::String> &keep) {
+	for (LoadedArchiveList::iterator it = _archives.begin(); it != _archives.end(); it++) {
+		LoadedArchive *archive = *it;
+		if (archive->isPreloaded() && Common::find(keep.begin(), keep.end(), archive->getFilename()) == keep.end()) {
+			archive->setPreloaded(false);
+			archive->decUsage();
+		}
+	}
+}
+
 void ArchiveLoader::unloadUnused() {
 	for (LoadedArchiveList::iterator it = _archives.begin(); it != _archives.end(); it++) {
 		if (!(*it)->isInUse()) {
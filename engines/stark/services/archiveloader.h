@@ -23,6 +23,7 @@
 #ifndef STARK_SERVICES_ARCHIVE_LOADER_H
 #define STARK_SERVICES_ARCHIVE_LOADER_H
 
+#include "common/array.h"
 #include "common/list.h"
 #include "common/str.h"
 #include "common/substream.h"
@@ -67,9 +68,35 @@ class ArchiveLoader {
 public:
 	~ArchiveLoader();
 
-	/** Load a Xarc archive, and add it to the managed archives list */
+	/**
+	 * Load a Xarc archive, and add it to the managed archives list
+	 *
+	 * @return true when the resources still need their lifecycle updates,
+	 * because the archive was just loaded or was only preloaded
+	 */
 	bool load(const Common::String &archiveName);
 
+	/**
+	 * Start importing a Xarc archive ahead of its use
+	 *
+	 * Only the resource tree is read, its resources are initialised by
+	 * continuePreloading. The archive holds a reference until it is loaded
+	 * or the preloads are released.
+	 *
+	 * @return true if the archive import was started
+	 */
+	bool preload(const Common::String &archiveName);
+
+	/**
+	 * Initialise the resources of the preloaded archives for about maxMillis
+	 *
+	 * @return false if there were no resources left to initialise
+	 */
+	bool continuePreloading(uint32 maxMillis);
+
+	/** Drop the references of the preloaded archives which are not in the list */
+	void releasePreloaded(const Common::Array<Common::String> &keep);
+
 	/** Unload all the unused Xarc archives */
 	void unloadUnused();
 
@@ -102,15 +129,31 @@ private:
 
 		void importResources();
 
+		/** Import the resource tree, without initialising the resources */
+		void importTree();
+		/** Initialise the resources of the tree until endTime, in milliseconds */
+		void continueImport(uint32 endTime);
+		/** Initialise the remaining resources of the tree */
+		void finishImport();
+		bool isImportPending() const { return !_postReadQueue.empty(); }
+
 		bool isInUse() const { return _useCount > 0; }
 		void incUsage() { _useCount++; }
 		void decUsage() { _useCount = MAX<int>(_useCount - 1, 0); }
 
+		bool isPreloaded() const { return _preloaded; }
+		void setPreloaded(bool preloaded) { _preloaded = preloaded; }
+
 	private:
 		uint _useCount;
+		bool _preloaded;
 		Common::String _filename;
 		Formats::XARCArchive _xarc;
 		Resources::Object *_root;
+
+		// The resources of the tree, in their initialisation order
+		Common::Array<Resources::Object *> _postReadQueue;
+		uint _nextPostRead;
 	};
 
 	typedef Common::List<LoadedArchive *> LoadedArchiveList;
@@ -0,0 +1,149 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "engines/stark/services/assetcache.h"
+
+#include "engines/stark/formats/biffmesh.h"
+#include "engines/stark/gfx/texture.h"
+#include "engines/stark/model/model.h"
+#include "engines/stark/visual/image.h"
+
+namespace Stark {
+
+AssetCache::AssetCache() :
+		_size(0),
+		_budget(kDefaultBudget),
+		_hits(0),
+		_misses(0),
+		_evictions(0) {
+}
+
+AssetCache::~AssetCache() {
+	clear();
+}
+
+Common::String AssetCache::buildKey(const Common::String &archiveName, const Common::String &fileName) {
+	return archiveName + ":" + fileName;
+}
+
+uint32 AssetCache::getAssetSize(const VisualImageXMG *image) {
+	return image->getWidth() * image->getHeight() * 4;
+}
+
+uint32 AssetCache::getAssetSize(const Gfx::TextureSet *textureSet) {
+	return textureSet->getSize();
+}
+
+uint32 AssetCache::getAssetSize(const Model *model) {
+	uint32 size = model->getVertices().size() * sizeof(VertNode);
+
+	const Common::Array<Face *> &faces = model->getFaces();
+	for (uint i = 0; i < faces.size(); i++) {
+		size += sizeof(Face) + faces[i]->vertexIndices.size() * sizeof(uint32);
+	}
+
+	return size + model->getBones().size() * sizeof(BoneNode);
+}
+
+uint32 AssetCache::getAssetSize(const Formats::BiffMesh *mesh) {
+	uint32 size = mesh->getVertices().size() * sizeof(Formats::BiffMesh::Vertex);
+
+	const Common::Array<Face> &faces = mesh->getFaces();
+	for (uint i = 0; i < faces.size(); i++) {
+		size += sizeof(Face) + faces[i].vertexIndices.size() * sizeof(uint32);
+	}
+
+	return size;
+}
+
+AssetCache::Asset *AssetCache::findAsset(const Common::String &key) {
+	EntryIndex::iterator it = _index.find(key);
+	if (it == _index.end()) {
+		return nullptr;
+	}
+
+	return it->_value->asset;
+}
+
+void AssetCache::addEntry(const Common::String &key, Asset *asset, uint32 size) {
+	if (_index.contains(key)) {
+		// Another resource using the same member has already been unloaded
+		delete asset;
+		return;
+	}
+
+	Entry entry;
+	entry.key = key;
+	entry.asset = asset;
+	entry.size = size;
+
+	_entries.push_front(entry);
+	_index.setVal(key, _entries.begin());
+	_size += size;
+
+	evict();
+}
+
+void AssetCache::removeEntry(const Common::String &key) {
+	EntryList::iterator it = _index.getVal(key);
+
+	_size -= it->size;
+	delete it->asset;
+
+	_entries.erase(it);
+	_index.erase(key);
+}
+
+void AssetCache::evict() {
+	while (_size > _budget) {
+		removeEntry(_entries.back().key);
+		_evictions++;
+	}
+}
+
+void AssetCache::clear() {
+	for (EntryList::iterator it = _entries.begin(); it != _entries.end(); it++) {
+		delete it->asset;
+	}
+
+	_entries.clear();
+	_index.clear();
+	_size = 0;
+}
+
+AssetCache::Stats AssetCache::getStats() const {
+	Stats stats;
+	stats.entries = _entries.size();
+	stats.size = _size;
+	stats.budget = _budget;
+	stats.hits = _hits;
+	stats.misses = _misses;
+	stats.evictions = _evictions;
+	return stats;
+}
+
+void AssetCache::setBudget(uint32 bytes) {
+	_budget = bytes;
+	evict();
+}
+
+} // End of namespace Stark
@@ -0,0 +1,169 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef STARK_SERVICES_ASSET_CACHE_H
+#define STARK_SERVICES_ASSET_CACHE_H
+
+#include "common/hash-str.h"
+#include "common/hashmap.h"
+#include "common/list.h"
+#include "common/str.h"
+
+namespace Stark {
+
+namespace Formats {
+class BiffMesh;
+}
+
+namespace Gfx {
+class TextureSet;
+}
+
+class Model;
+class VisualImageXMG;
+
+/**
+ * Decoded asset cache
+ *
+ * Keeps the images, textures and meshes decoded from the archive members
+ * of the resources which were unloaded. Coming back to a location then
+ * reuses them instead of decoding the members again.
+ *
+ * An asset is owned either by a resource or by the cache. The least recently
+ * cached assets are deleted when the size of the cached assets exceeds the budget.
+ */
+class AssetCache {
+public:
+	struct Stats {
+		uint32 entries;
+		uint32 size;
+		uint32 budget;
+		uint32 hits;
+		uint32 misses;
+		uint32 evictions;
+	};
+
+	AssetCache();
+	~AssetCache();
+
+	/** Take back the ownership of the asset decoded from an archive member, or return nullptr if it is not cached */
+	template<class T>
+	T *take(const Common::String &archiveName, const Common::String &fileName);
+
+	/** Give the ownership of the asset decoded from an archive member to the cache */
+	template<class T>
+	void put(const Common::String &archiveName, const Common::String &fileName, T *asset);
+
+	/** Delete all the cached assets */
+	void clear();
+
+	Stats getStats() const;
+
+	/** Set the maximum size of the cached assets, in bytes */
+	void setBudget(uint32 bytes);
+
+private:
+	class Asset {
+	public:
+		virtual ~Asset() {}
+	};
+
+	template<class T>
+	class TypedAsset : public Asset {
+	public:
+		explicit TypedAsset(T *asset) : _asset(asset) {}
+		~TypedAsset() override { delete _asset; }
+
+		T *release() {
+			T *asset = _asset;
+			_asset = nullptr;
+			return asset;
+		}
+
+	private:
+		T *_asset;
+	};
+
+	struct Entry {
+		Common::String key;
+		Asset *asset;
+		uint32 size;
+	};
+
+	// Most recently cached assets first
+	typedef Common::List<Entry> EntryList;
+	typedef Common::HashMap<Common::String, EntryList::iterator> EntryIndex;
+
+	static const uint32 kDefaultBudget = 64 * 1024 * 1024;
+
+	static Common::String buildKey(const Common::String &archiveName, const Common::String &fileName);
+
+	/** Approximate memory size of the assets */
+	static uint32 getAssetSize(const VisualImageXMG *image);
+	static uint32 getAssetSize(const Gfx::TextureSet *textureSet);
+	static uint32 getAssetSize(const Model *model);
+	static uint32 getAssetSize(const Formats::BiffMesh *mesh);
+
+	Asset *findAsset(const Common::String &key);
+	void addEntry(const Common::String &key, Asset *asset, uint32 size);
+	void removeEntry(const Common::String &key);
+	void evict();
+
+	EntryList _entries;
+	EntryIndex _index;
+	uint32 _size;
+	uint32 _budget;
+
+	uint32 _hits;
+	uint32 _misses;
+	uint32 _evictions;
+};
+
+template<class T>
+T *AssetCache::take(const Common::String &archiveName, const Common::String &fileName) {
+	Common::String key = buildKey(archiveName, fileName);
+
+	TypedAsset<T> *asset = dynamic_cast<TypedAsset<T> *>(findAsset(key));
+	if (!asset) {
+		_misses++;
+		return nullptr;
+	}
+
+	T *decoded = asset->release();
+	removeEntry(key);
+	_hits++;
+
+	return decoded;
+}
+
+template<class T>
+void AssetCache::put(const Common::String &archiveName, const Common::String &fileName, T *asset) {
+	if (!asset) {
+		return;
+	}
+
+	addEntry(buildKey(archiveName, fileName), new TypedAsset<T>(asset), getAssetSize(asset));
+}
+
+} // End of namespace Stark
+
+#endif // STARK_SERVICES_ASSET_CACHE_H
@@ -22,8 +22,11 @@
 
 #include "engines/stark/services/resourceprovider.h"
 
+#include "common/algorithm.h"
+
 #include "engines/stark/resources/bookmark.h"
 #include "engines/stark/resources/camera.h"
+#include "engines/stark/resources/command.h"
 #include "engines/stark/resources/floor.h"
 #include "engines/stark/resources/item.h"
 #include "engines/stark/resources/knowledgeset.h"
@@ -48,6 +51,7 @@ ResourceProvider::ResourceProvider(ArchiveLoader *archiveLoader, StateProvider *
 		_global(global),
 		_locationChangeRequest(false),
 		_restoreCurrentState(false),
+		_nextNeighbourArchive(0),
 		_nextDirection(0) {
 }
 
@@ -254,6 +258,7 @@ void ResourceProvider::performLocationChange() {
 	}
 
 	current->getLocation()->resetAnimationBlending();
+	findNeighbourLocations();
 	purgeOldLocations();
 
 	_locationChangeRequest = false;
@@ -333,6 +338,59 @@ void ResourceProvider::purgeOldLocations() {
 	_archiveLoader->unloadUnused();
 }
 
+void ResourceProvider::findNeighbourLocations() {
+	Current *current = _global->getCurrent();
+	Resources::Level *level = current->getLevel();
+
+	_neighbourArchives.clear();
+	_nextNeighbourArchive = 0;
+
+	// The exits are the location changes performed by the scripts of the location
+	Common::Array<Resources::Command *> commands = current->getLocation()->listChildrenRecursive<Resources::Command>();
+	for (uint i = 0; i < commands.size() && _neighbourArchives.size() < kMaxPreloadedLocations; i++) {
+		if (commands[i]->getSubType() != Resources::Command::kLocationGoTo
+				&& commands[i]->getSubType() != Resources::Command::kLocationGoToNewCD) {
+			continue;
+		}
+
+		Common::Array<Resources::Command::Argument> arguments = commands[i]->getArguments();
+		uint levelIndex = strtol(arguments[0].stringValue.c_str(), nullptr, 16);
+		uint locationIndex = strtol(arguments[1].stringValue.c_str(), nullptr, 16);
+
+		// Only the locations of the current level can be imported without loading another level
+		if (levelIndex != level->getIndex() || locationIndex == current->getLocation()->getIndex()) {
+			continue;
+		}
+
+		Resources::Location *location = level->findChildWithIndex<Resources::Location>(locationIndex);
+		if (!location) {
+			continue;
+		}
+
+		Common::String archiveName = _archiveLoader->buildArchiveName(level, location);
+		if (Common::find(_neighbourArchives.begin(), _neighbourArchives.end(), archiveName) == _neighbourArchives.end()) {
+			_neighbourArchives.push_back(archiveName);
+		}
+	}
+
+	// Drop the preloaded locations the new location has no exit to, they are unloaded with the old locations
+	_archiveLoader->releasePreloaded(_neighbourArchives);
+}
+
+void ResourceProvider::preloadNeighbourLocation() {
+	// The resources of the archive being preloaded are initialised over several frames
+	if (_archiveLoader->continuePreloading(kPreloadMillisPerFrame)) {
+		return;
+	}
+
+	while (_nextNeighbourArchive < _neighbourArchives.size()) {
+		// Read at most one resource tree per frame
+		if (_archiveLoader->preload(_neighbourArchives[_nextNeighbourArchive++])) {
+			break;
+		}
+	}
+}
+
 void ResourceProvider::commitActiveLocationsState() {
 	// Save active location states
 	for (CurrentList::const_iterator it = _locations.begin(); it != _locations.end(); it++) {
@@ -355,6 +413,11 @@ void ResourceProvider::shutdown() {
 
 	_locationStack.clear();
 
+	// Release the preloaded locations
+	_neighbourArchives.clear();
+	_nextNeighbourArchive = 0;
+	_archiveLoader->releasePreloaded(_neighbourArchives);
+
 	// Flush the locations list
 	for (CurrentList::const_iterator it = _locations.begin(); it != _locations.end(); it++) {
 		Current *location = *it;
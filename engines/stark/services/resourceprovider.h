@@ -23,7 +23,9 @@
 #ifndef STARK_SERVICES_RESOURCE_PROVIDER_H
 #define STARK_SERVICES_RESOURCE_PROVIDER_H
 
+#include "common/array.h"
 #include "common/list.h"
+#include "common/str.h"
 
 #include "engines/stark/resourcereference.h"
 
@@ -76,6 +78,16 @@ public:
 	 */
 	void performLocationChange();
 
+	/**
+	 * Import a slice of the resources of the locations the current location has exits to
+	 *
+	 * Meant to be called on the frames without a location change, so that taking
+	 * an exit does not need to read and import the next location's archive.
+	 * Each call either reads the resource tree of a location, or initialises its
+	 * resources for about kPreloadMillisPerFrame.
+	 */
+	void preloadNeighbourLocation();
+
 	/** Set the initial position and direction for the next location change */
 	void setNextLocationPosition(const ResourceReference &bookmark, int32 direction);
 
@@ -112,6 +124,7 @@ private:
 	Current *findLocation(uint16 level, uint16 location) const;
 
 	void purgeOldLocations();
+	void findNeighbourLocations();
 
 	void runLocationChangeScripts(Resources::Object *resource, uint32 scriptCallMode);
 	void setAprilInitialPosition();
@@ -126,6 +139,15 @@ private:
 
 	CurrentList _locations;
 
+	/** The maximum number of neighbouring locations kept preloaded */
+	static const uint kMaxPreloadedLocations = 3;
+
+	/** The time spent initialising the preloaded resources per frame, in milliseconds */
+	static const uint32 kPreloadMillisPerFrame = 2;
+
+	Common::Array<Common::String> _neighbourArchives;
+	uint _nextNeighbourArchive;
+
 	ResourceReference _nextPositionBookmarkReference;
 	int32 _nextDirection;
 };
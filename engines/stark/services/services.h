@@ -37,6 +37,7 @@ class Driver;
 }
 
 class ArchiveLoader;
+class AssetCache;
 class DialogPlayer;
 class Diary;
 class FontProvider;
@@ -58,6 +59,7 @@ class StarkServices : public Common::Singleton<StarkServices> {
 public:
 	StarkServices() {
 		archiveLoader = nullptr;
+		assetCache = nullptr;
 		dialogPlayer = nullptr;
 		diary = nullptr;
 		gfx = nullptr;
@@ -76,6 +78,7 @@ public:
 	}
 
 	ArchiveLoader *archiveLoader;
+	AssetCache *assetCache;
 	DialogPlayer *dialogPlayer;
 	Diary *diary;
 	Gfx::Driver *gfx;
@@ -95,6 +98,7 @@ public:
 
 /** Shortcuts for accessing the services. */
 #define StarkArchiveLoader      StarkServices::instance().archiveLoader
+#define StarkAssetCache         StarkServices::instance().assetCache
 #define StarkDialogPlayer       StarkServices::instance().dialogPlayer
 #define StarkDiary              StarkServices::instance().diary
 #define StarkGfx                StarkServices::instance().gfx
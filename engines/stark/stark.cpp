@@ -30,6 +30,7 @@
 #include "engines/stark/scene.h"
 #include "engines/stark/services/userinterface.h"
 #include "engines/stark/services/archiveloader.h"
+#include "engines/stark/services/assetcache.h"
 #include "engines/stark/services/dialogplayer.h"
 #include "engines/stark/services/diary.h"
 #include "engines/stark/services/fontprovider.h"
@@ -86,6 +87,7 @@ StarkEngine::~StarkEngine() {
 	delete StarkServices::instance().global;
 	delete StarkServices::instance().stateProvider;
 	delete StarkServices::instance().archiveLoader;
+	delete StarkServices::instance().assetCache;
 	delete StarkServices::instance().userInterface;
 	delete StarkServices::instance().fontProvider;
 	delete StarkServices::instance().settings;
@@ -111,6 +113,7 @@ Common::Error StarkEngine::run() {
 	StarkServices &services = StarkServices::instance();
 	services.gfx = gfx;
 	services.archiveLoader = new ArchiveLoader();
+	services.assetCache = new AssetCache();
 	services.stateProvider = new StateProvider();
 	services.global = new Global();
 	services.resourceProvider = new ResourceProvider(services.archiveLoader, services.stateProvider, services.global);
@@ -150,6 +153,9 @@ Common::Error StarkEngine::run() {
 	services.staticProvider->shutdown();
 	services.resourceProvider->shutdown();
 
+	// Release the cached textures while the graphics driver is still there
+	services.assetCache->clear();
+
 	return Common::kNoError;
 }
 
@@ -167,6 +173,8 @@ void StarkEngine::mainLoop() {
 		if (StarkResourceProvider->hasLocationChangeRequest()) {
 			StarkGlobal->setNormalSpeed();
 			StarkResourceProvider->performLocationChange();
+		} else if (StarkUserInterface->isInGameScreen()) {
+			StarkResourceProvider->preloadNeighbourLocation();
 		}
 
 		StarkUserInterface->doQueuedScreenChange();
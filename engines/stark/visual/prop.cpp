@@ -56,6 +56,18 @@ void VisualProp::setTexture(Gfx::TextureSet *texture) {
 	_texture = texture;
 }
 
+Formats::BiffMesh *VisualProp::releaseModel() {
+	Formats::BiffMesh *model = _model;
+	_model = nullptr;
+	return model;
+}
+
+Gfx::TextureSet *VisualProp::releaseTexture() {
+	Gfx::TextureSet *texture = _texture;
+	_texture = nullptr;
+	return texture;
+}
+
 Math::Matrix4 VisualProp::getModelMatrix(const Math::Vector3d& position, float direction) {
 	Math::Matrix4 posMatrix;
 	posMatrix.setPosition(position);
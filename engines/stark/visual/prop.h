@@ -50,6 +50,10 @@ public:
 	void setModel(Formats::BiffMesh *model);
 	void setTexture(Gfx::TextureSet *texture);
 
+	/** Give up the ownership of the model and the texture */
+	Formats::BiffMesh *releaseModel();
+	Gfx::TextureSet *releaseTexture();
+
 	bool intersectRay(const Math::Ray &ray, const Math::Vector3d &position, float direction);
 	virtual void render(const Math::Vector3d &position, float direction, const Gfx::LightEntryArray &lights) = 0;
 
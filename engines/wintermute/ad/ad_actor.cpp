@@ -43,6 +43,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/particles/part_emitter.h"
 #include "engines/wintermute/base/base_engine.h"
 
@@ -940,10 +941,12 @@ void AdActor::initLine(const BasePoint &startPt, const BasePoint &endPt) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GoTo / GoToAsync
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GoTo") == 0 || strcmp(name, "GoToAsync") == 0) {
+	SC_NAME_CASE("GoTo")
+	SC_NAME_ALIAS("GoToAsync") {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -958,7 +961,8 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GoToObject / GoToObjectAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GoToObject") == 0 || strcmp(name, "GoToObjectAsync") == 0) {
+	SC_NAME_CASE("GoToObject")
+	SC_NAME_ALIAS("GoToObjectAsync") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		if (!val->isNative()) {
@@ -988,7 +992,8 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// TurnTo / TurnToAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TurnTo") == 0 || strcmp(name, "TurnToAsync") == 0) {
+	SC_NAME_CASE("TurnTo")
+	SC_NAME_ALIAS("TurnToAsync") {
 		stack->correctParams(1);
 		int dir;
 		ScValue *val = stack->pop();
@@ -1017,7 +1022,7 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// IsWalking
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsWalking") == 0) {
+	SC_NAME_CASE("IsWalking") {
 		stack->correctParams(0);
 		stack->pushBool(_state == STATE_FOLLOWING_PATH);
 		return STATUS_OK;
@@ -1030,7 +1035,7 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	// Let's just call turnTo() for current direction to finalize movement
 	// Return value is never used
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopWalking") == 0) {
+	SC_NAME_CASE("StopWalking") {
 		stack->correctParams(0);
 		turnTo(_dir);
 		stack->pushNULL();
@@ -1049,7 +1054,7 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//     90 on "Slow" settings
 	// Return value is never used
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSpeedWalkAnim") == 0) {
+	SC_NAME_CASE("SetSpeedWalkAnim") {
 		stack->correctParams(1);
 		int speedWalk = stack->pop()->getInt();
 		for (uint32 dir = 0; dir < NUM_DIRECTIONS; dir++) {
@@ -1075,7 +1080,7 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// MergeAnims
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MergeAnims") == 0) {
+	SC_NAME_CASE("MergeAnims") {
 		stack->correctParams(1);
 		stack->pushBool(DID_SUCCEED(mergeAnims(stack->pop()->getString())));
 		return STATUS_OK;
@@ -1084,7 +1089,7 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// UnloadAnim
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UnloadAnim") == 0) {
+	SC_NAME_CASE("UnloadAnim") {
 		stack->correctParams(1);
 		const char *animName = stack->pop()->getString();
 
@@ -1116,14 +1121,17 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// HasAnim
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasAnim") == 0) {
+	SC_NAME_CASE("HasAnim") {
 		stack->correctParams(1);
 		const char *animName = stack->pop()->getString();
 		stack->pushBool(getAnimByName(animName) != nullptr);
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return AdTalkHolder::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -1131,24 +1139,25 @@ bool AdActor::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *AdActor::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Direction
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Direction") {
+	SC_NAME_CASE("Direction") {
 		_scValue->setInt(_dir);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("actor");
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// TalkAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TalkAnimName") {
+	SC_NAME_CASE("TalkAnimName") {
 		_scValue->setString(_talkAnimName);
 		return _scValue;
 	}
@@ -1156,7 +1165,7 @@ ScValue *AdActor::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WalkAnimName") {
+	SC_NAME_CASE("WalkAnimName") {
 		_scValue->setString(_walkAnimName);
 		return _scValue;
 	}
@@ -1164,7 +1173,7 @@ ScValue *AdActor::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// IdleAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "IdleAnimName") {
+	SC_NAME_CASE("IdleAnimName") {
 		_scValue->setString(_idleAnimName);
 		return _scValue;
 	}
@@ -1172,7 +1181,7 @@ ScValue *AdActor::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TurnLeftAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TurnLeftAnimName") {
+	SC_NAME_CASE("TurnLeftAnimName") {
 		_scValue->setString(_turnLeftAnimName);
 		return _scValue;
 	}
@@ -1180,21 +1189,25 @@ ScValue *AdActor::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TurnRightAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TurnRightAnimName") {
+	SC_NAME_CASE("TurnRightAnimName") {
 		_scValue->setString(_turnRightAnimName);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return AdTalkHolder::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool AdActor::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Direction
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Direction") == 0) {
+	SC_NAME_CASE("Direction") {
 		int dir = value->getInt();
 		if (dir >= 0 && dir < NUM_DIRECTIONS) {
 			_dir = (TDirection)dir;
@@ -1205,7 +1218,7 @@ bool AdActor::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TalkAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TalkAnimName") == 0) {
+	SC_NAME_CASE("TalkAnimName") {
 		if (value->isNULL()) {
 			_talkAnimName = "talk";
 		} else {
@@ -1217,7 +1230,7 @@ bool AdActor::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WalkAnimName") == 0) {
+	SC_NAME_CASE("WalkAnimName") {
 		if (value->isNULL()) {
 			_walkAnimName = "walk";
 		} else {
@@ -1229,7 +1242,7 @@ bool AdActor::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// IdleAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IdleAnimName") == 0) {
+	SC_NAME_CASE("IdleAnimName") {
 		if (value->isNULL()) {
 			_idleAnimName = "idle";
 		} else {
@@ -1241,7 +1254,7 @@ bool AdActor::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TurnLeftAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TurnLeftAnimName") == 0) {
+	SC_NAME_CASE("TurnLeftAnimName") {
 		if (value->isNULL()) {
 			_turnLeftAnimName = "turnleft";
 		} else {
@@ -1253,16 +1266,19 @@ bool AdActor::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TurnRightAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TurnRightAnimName") == 0) {
+	SC_NAME_CASE("TurnRightAnimName") {
 		if (value->isNULL()) {
 			_turnRightAnimName = "turnright";
 		} else {
 			_turnRightAnimName = value->getString();
 		}
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return AdTalkHolder::scSetProperty(name, value);
 	}
+	}
 }
 
 
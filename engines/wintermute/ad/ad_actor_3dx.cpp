@@ -52,6 +52,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/sound/base_sound.h"
 #include "engines/wintermute/utils/path_util.h"
 #include "engines/wintermute/utils/utils.h"
@@ -1269,10 +1270,12 @@ int AdActor3DX::getHeight() {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// PlayAnim / PlayAnimAsync
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "PlayAnim") == 0 || strcmp(name, "PlayAnimAsync") == 0) {
+	SC_NAME_CASE("PlayAnim")
+	SC_NAME_ALIAS("PlayAnimAsync") {
 		bool async = strcmp(name, "PlayAnimAsync") == 0;
 		stack->correctParams(1);
 		if (!playAnim3DX(stack->pop()->getString(), true /*!Async*/)) {
@@ -1288,7 +1291,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// StopAnim
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopAnim") == 0) {
+	SC_NAME_CASE("StopAnim") {
 		stack->correctParams(1);
 		int transTime = stack->pop()->getInt(_defaultStopTransTime);
 		bool ret = false;
@@ -1302,7 +1305,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// StopAnimChannel
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopAnimChannel") == 0) {
+	SC_NAME_CASE("StopAnimChannel") {
 		stack->correctParams(2);
 		int channel = stack->pop()->getInt();
 		int transTime = stack->pop()->getInt();
@@ -1318,7 +1321,8 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// PlayAnimChannel / PlayAnimChannelAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlayAnimChannel") == 0 || strcmp(name, "PlayAnimChannelAsync") == 0) {
+	SC_NAME_CASE("PlayAnimChannel")
+	SC_NAME_ALIAS("PlayAnimChannelAsync") {
 		bool async = strcmp(name, "PlayAnimChannelAsync") == 0;
 
 		stack->correctParams(2);
@@ -1339,7 +1343,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// IsAnimPlaying
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsAnimPlaying") == 0) {
+	SC_NAME_CASE("IsAnimPlaying") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		const char *animName;
@@ -1361,7 +1365,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// IsAnimChannelPlaying
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsAnimChannelPlaying") == 0) {
+	SC_NAME_CASE("IsAnimChannelPlaying") {
 		stack->correctParams(2);
 		int channel = stack->pop()->getInt(0);
 		ScValue *val = stack->pop();
@@ -1384,7 +1388,8 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// AddAttachment / AddMesh
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddAttachment") == 0 || strcmp(name, "AddMesh") == 0) {
+	SC_NAME_CASE("AddAttachment")
+	SC_NAME_ALIAS("AddMesh") {
 		if (strcmp(name, "AddMesh") == 0)
 			_gameRef->LOG(0, "Warning: AddMesh is now obsolete, use AddAttachment");
 
@@ -1429,7 +1434,8 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveAttachment / RemoveMesh
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveAttachment") == 0 || strcmp(name, "RemoveMesh") == 0) {
+	SC_NAME_CASE("RemoveAttachment")
+	SC_NAME_ALIAS("RemoveMesh") {
 		if (strcmp(name, "RemoveMesh") == 0) {
 			_gameRef->LOG(0, "Warning: RemoveMesh is now obsolete, use RemoveAttachment");
 		}
@@ -1457,7 +1463,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetAttachment
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetAttachment") == 0) {
+	SC_NAME_CASE("GetAttachment") {
 		stack->correctParams(1);
 		const char *attachmentName = stack->pop()->getString();
 
@@ -1481,7 +1487,8 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GoTo3D / GoTo3DAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GoTo3D") == 0 || strcmp(name, "GoTo3DAsync") == 0) {
+	SC_NAME_CASE("GoTo3D")
+	SC_NAME_ALIAS("GoTo3DAsync") {
 		stack->correctParams(3);
 		Math::Vector3d pos;
 		pos.x() = stack->pop()->getFloat();
@@ -1501,7 +1508,8 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GoTo / GoToAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GoTo") == 0 || strcmp(name, "GoToAsync") == 0) {
+	SC_NAME_CASE("GoTo")
+	SC_NAME_ALIAS("GoToAsync") {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1542,7 +1550,8 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GoToObject / GoToObjectAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GoToObject") == 0 || strcmp(name, "GoToObjectAsync") == 0) {
+	SC_NAME_CASE("GoToObject")
+	SC_NAME_ALIAS("GoToObjectAsync") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		if (!val->isNative()) {
@@ -1624,7 +1633,8 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// TurnTo / TurnToAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TurnTo") == 0 || strcmp(name, "TurnToAsync") == 0) {
+	SC_NAME_CASE("TurnTo")
+	SC_NAME_ALIAS("TurnToAsync") {
 		stack->correctParams(1);
 		int dir;
 		ScValue *val = stack->pop();
@@ -1663,7 +1673,8 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// TurnToAngle / TurnToAngleAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TurnToAngle") == 0 || strcmp(name, "TurnToAngleAsync") == 0) {
+	SC_NAME_CASE("TurnToAngle")
+	SC_NAME_ALIAS("TurnToAngleAsync") {
 		stack->correctParams(1);
 		float angle = -stack->pop()->getFloat();
 
@@ -1687,7 +1698,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// IsWalking
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsWalking") == 0) {
+	SC_NAME_CASE("IsWalking") {
 		stack->correctParams(0);
 		stack->pushBool(_state == STATE_FOLLOWING_PATH);
 		return true;
@@ -1696,7 +1707,8 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// DirectWalk / DirectWalkBack
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DirectWalk") == 0 || strcmp(name, "DirectWalkBack") == 0) {
+	SC_NAME_CASE("DirectWalk")
+	SC_NAME_ALIAS("DirectWalkBack") {
 		stack->correctParams(2);
 
 		ScValue *valVelocity = stack->pop();
@@ -1728,7 +1740,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// DirectWalkStop
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DirectWalkStop") == 0) {
+	SC_NAME_CASE("DirectWalkStop") {
 		stack->correctParams(0);
 		_directWalkMode = DIRECT_WALK_NONE;
 		stack->pushBool(true);
@@ -1738,7 +1750,8 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// DirectTurnLeft / DirectTurnRight
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DirectTurnLeft") == 0 || strcmp(name, "DirectTurnRight") == 0) {
+	SC_NAME_CASE("DirectTurnLeft")
+	SC_NAME_ALIAS("DirectTurnRight") {
 		stack->correctParams(2);
 
 		ScValue *valVelocity = stack->pop();
@@ -1770,7 +1783,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// DirectTurnStop
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DirectTurnStop") == 0) {
+	SC_NAME_CASE("DirectTurnStop") {
 		stack->correctParams(0);
 		_directTurnMode = DIRECT_TURN_NONE;
 		stack->pushBool(true);
@@ -1780,7 +1793,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetTexture
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetTexture") == 0) {
+	SC_NAME_CASE("SetTexture") {
 		stack->correctParams(2);
 		const char *materialName = stack->pop()->getString();
 		const char *textureFilename = stack->pop()->getString();
@@ -1797,7 +1810,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetTheoraTexture
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetTheoraTexture") == 0) {
+	SC_NAME_CASE("SetTheoraTexture") {
 		stack->correctParams(2);
 		const char *materialName = stack->pop()->getString();
 		const char *theoraFilename = stack->pop()->getString();
@@ -1813,7 +1826,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetEffect
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetEffect") == 0) {
+	SC_NAME_CASE("SetEffect") {
 		stack->correctParams(2);
 //		const char *materialName = stack->pop()->getString();
 //		const char *effectFilename = stack->pop()->getString();
@@ -1827,7 +1840,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveEffect
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveEffect") == 0) {
+	SC_NAME_CASE("RemoveEffect") {
 		stack->correctParams(1);
 //		const char *materialName = stack->pop()->getString();
 		stack->pop();
@@ -1842,7 +1855,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetEffectParam
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetEffectParam") == 0) {
+	SC_NAME_CASE("SetEffectParam") {
 		stack->correctParams(3);
 //		const char *materialName = stack->pop()->getString();
 //		const char *paramName = stack->pop()->getString();
@@ -1860,7 +1873,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetEffectParamVector
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetEffectParamVector") == 0) {
+	SC_NAME_CASE("SetEffectParamVector") {
 		stack->correctParams(6);
 //		const char *materialName = stack->pop()->getString();
 //		const char *paramName = stack->pop()->getString();
@@ -1884,7 +1897,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetEffectParamColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetEffectParamColor") == 0) {
+	SC_NAME_CASE("SetEffectParamColor") {
 		stack->correctParams(3);
 //		const char *materialName = stack->pop()->getString();
 //		const char *paramName = stack->pop()->getString();
@@ -1902,7 +1915,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// MergeAnims
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MergeAnims") == 0) {
+	SC_NAME_CASE("MergeAnims") {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -1913,7 +1926,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// UnloadAnim
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UnloadAnim") == 0) {
+	SC_NAME_CASE("UnloadAnim") {
 		stack->correctParams(1);
 		const char *animName = stack->pop()->getString();
 
@@ -1924,7 +1937,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetAnimTransitionTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetAnimTransitionTime") == 0) {
+	SC_NAME_CASE("SetAnimTransitionTime") {
 		stack->correctParams(3);
 		const char *animFrom = stack->pop()->getString();
 		const char *animTo = stack->pop()->getString();
@@ -1956,7 +1969,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetAnimTransitionTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetAnimTransitionTime") == 0) {
+	SC_NAME_CASE("GetAnimTransitionTime") {
 		stack->correctParams(2);
 		const char *animFrom = stack->pop()->getString();
 		const char *animTo = stack->pop()->getString();
@@ -1977,7 +1990,7 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// CreateParticleEmitterBone
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateParticleEmitterBone") == 0) {
+	SC_NAME_CASE("CreateParticleEmitterBone") {
 		stack->correctParams(4);
 		const char *boneName = stack->pop()->getString();
 		float offsetX = stack->pop()->getFloat();
@@ -1992,19 +2005,23 @@ bool AdActor3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 		}
 
 		return true;
-	} else {
+	}
+	default:
+	unknownName: {
 		return AdObject3D::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////
 ScValue *AdActor3DX::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("actor3dx");
 		return _scValue;
 	}
@@ -2012,7 +2029,7 @@ ScValue *AdActor3DX::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TalkAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TalkAnimName") {
+	SC_NAME_CASE("TalkAnimName") {
 		_scValue->setString(_talkAnimName);
 		return _scValue;
 	}
@@ -2020,7 +2037,7 @@ ScValue *AdActor3DX::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TalkAnimChannel
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TalkAnimChannel") {
+	SC_NAME_CASE("TalkAnimChannel") {
 		_scValue->setInt(_talkAnimChannel);
 		return _scValue;
 	}
@@ -2028,7 +2045,7 @@ ScValue *AdActor3DX::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WalkAnimName") {
+	SC_NAME_CASE("WalkAnimName") {
 		_scValue->setString(_talkAnimName);
 		return _scValue;
 	}
@@ -2036,7 +2053,7 @@ ScValue *AdActor3DX::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// IdleAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "IdleAnimName") {
+	SC_NAME_CASE("IdleAnimName") {
 		_scValue->setString(_idleAnimName);
 		return _scValue;
 	}
@@ -2044,7 +2061,7 @@ ScValue *AdActor3DX::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TurnLeftAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TurnLeftAnimName") {
+	SC_NAME_CASE("TurnLeftAnimName") {
 		_scValue->setString(_turnLeftAnimName);
 		return _scValue;
 	}
@@ -2052,7 +2069,7 @@ ScValue *AdActor3DX::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TurnRightAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TurnRightAnimName") {
+	SC_NAME_CASE("TurnRightAnimName") {
 		_scValue->setString(_turnRightAnimName);
 		return _scValue;
 	}
@@ -2060,7 +2077,8 @@ ScValue *AdActor3DX::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// DirectionAngle / DirAngle
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "DirectionAngle" || name == "DirAngle") {
+	SC_NAME_CASE("DirectionAngle")
+	SC_NAME_ALIAS("DirAngle") {
 		_scValue->setFloat(_angle.getDegrees());
 		return _scValue;
 	}
@@ -2068,7 +2086,7 @@ ScValue *AdActor3DX::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Direction
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Direction") {
+	SC_NAME_CASE("Direction") {
 		_scValue->setInt(angleToDir(_angle.getDegrees()));
 		return _scValue;
 	}
@@ -2076,7 +2094,7 @@ ScValue *AdActor3DX::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AnimTransitionTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AnimTransitionTime") {
+	SC_NAME_CASE("AnimTransitionTime") {
 		_scValue->setInt(_defaultTransTime);
 		return _scValue;
 	}
@@ -2084,7 +2102,7 @@ ScValue *AdActor3DX::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AnimStopTransitionTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AnimStopTransitionTime") {
+	SC_NAME_CASE("AnimStopTransitionTime") {
 		_scValue->setInt(_defaultStopTransTime);
 		return _scValue;
 	}
@@ -2092,22 +2110,25 @@ ScValue *AdActor3DX::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// GoToTolerance
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "GoToTolerance") {
+	SC_NAME_CASE("GoToTolerance") {
 		_scValue->setInt(_goToTolerance);
 		return _scValue;
 	}
 
-	else {
+	default:
+	unknownName: {
 		return AdObject3D::scGetProperty(name);
 	}
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////
 bool AdActor3DX::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// TalkAnimName
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "TalkAnimName") == 0) {
+	SC_NAME_CASE("TalkAnimName") {
 		if (value->isNULL()) {
 			_talkAnimName = "talk";
 		} else {
@@ -2120,7 +2141,7 @@ bool AdActor3DX::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TalkAnimChannel
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TalkAnimChannel") == 0) {
+	SC_NAME_CASE("TalkAnimChannel") {
 		_talkAnimChannel = value->getInt();
 		return true;
 	}
@@ -2128,7 +2149,7 @@ bool AdActor3DX::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WalkAnimName") == 0) {
+	SC_NAME_CASE("WalkAnimName") {
 		if (value->isNULL()) {
 			_talkAnimName = "walk";
 		} else {
@@ -2140,7 +2161,7 @@ bool AdActor3DX::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// IdleAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IdleAnimName") == 0) {
+	SC_NAME_CASE("IdleAnimName") {
 		if (value->isNULL()) {
 			_idleAnimName = "idle";
 		} else {
@@ -2153,7 +2174,7 @@ bool AdActor3DX::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TurnLeftAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TurnLeftAnimName") == 0) {
+	SC_NAME_CASE("TurnLeftAnimName") {
 		if (value->isNULL()) {
 			_turnLeftAnimName = "turnleft";
 		} else {
@@ -2166,7 +2187,7 @@ bool AdActor3DX::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TurnRightAnimName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TurnRightAnimName") == 0) {
+	SC_NAME_CASE("TurnRightAnimName") {
 		if (value->isNULL()) {
 			_turnRightAnimName = "turnright";
 		} else {
@@ -2178,7 +2199,8 @@ bool AdActor3DX::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// DirectionAngle / DirAngle
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DirectionAngle") == 0 || strcmp(name, "DirAngle") == 0) {
+	SC_NAME_CASE("DirectionAngle")
+	SC_NAME_ALIAS("DirAngle") {
 		_angle = value->getFloat();
 		_angle.normalize(0.0f);
 		return true;
@@ -2187,7 +2209,7 @@ bool AdActor3DX::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Direction
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Direction") == 0) {
+	SC_NAME_CASE("Direction") {
 		_angle = dirToAngle((TDirection)value->getInt());
 		return true;
 	}
@@ -2195,7 +2217,7 @@ bool AdActor3DX::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AnimTransitionTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AnimTransitionTime") == 0) {
+	SC_NAME_CASE("AnimTransitionTime") {
 		_defaultTransTime = value->getInt();
 		return true;
 	}
@@ -2203,7 +2225,7 @@ bool AdActor3DX::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AnimStopTransitionTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AnimStopTransitionTime") == 0) {
+	SC_NAME_CASE("AnimStopTransitionTime") {
 		_defaultStopTransTime = value->getInt();
 		return true;
 	}
@@ -2211,14 +2233,16 @@ bool AdActor3DX::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// GoToTolerance
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GoToTolerance") == 0) {
+	SC_NAME_CASE("GoToTolerance") {
 		_goToTolerance = value->getInt();
 		return true;
 	}
 
-	else {
+	default:
+	unknownName: {
 		return AdObject3D::scSetProperty(name, value);
 	}
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////
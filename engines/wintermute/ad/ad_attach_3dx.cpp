@@ -35,6 +35,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 
 namespace Wintermute {
 
@@ -130,10 +131,12 @@ Common::String AdAttach3DX::getParentBone() {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdAttach3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// PlayAnim / PlayAnimAsync
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "PlayAnim") == 0 || strcmp(name, "PlayAnimAsync") == 0) {
+	SC_NAME_CASE("PlayAnim")
+	SC_NAME_ALIAS("PlayAnimAsync") {
 		stack->correctParams(1);
 		Common::String animName = stack->pop()->getString();
 		if (!_modelX || !_modelX->playAnim(0, animName, 0, true)) {
@@ -149,7 +152,7 @@ bool AdAttach3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// StopAnim
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopAnim") == 0) {
+	SC_NAME_CASE("StopAnim") {
 		stack->correctParams(0);
 		bool ret = false;
 		if (_modelX) {
@@ -163,7 +166,7 @@ bool AdAttach3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// StopAnimChannel
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopAnimChannel") == 0) {
+	SC_NAME_CASE("StopAnimChannel") {
 		stack->correctParams(1);
 		int channel = stack->pop()->getInt();
 		bool ret = false;
@@ -178,7 +181,8 @@ bool AdAttach3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// PlayAnimChannel / PlayAnimChannelAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlayAnimChannel") == 0 || strcmp(name, "PlayAnimChannelAsync") == 0) {
+	SC_NAME_CASE("PlayAnimChannel")
+	SC_NAME_ALIAS("PlayAnimChannelAsync") {
 		stack->correctParams(2);
 		int channel = stack->pop()->getInt();
 		const char *animName = stack->pop()->getString();
@@ -195,9 +199,11 @@ bool AdAttach3DX::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 		return true;
 	}
 
-	else {
+	default:
+	unknownName: {
 		return AdObject3D::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -50,6 +50,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/sound/base_sound.h"
 #include "engines/wintermute/video/video_theora_player.h"
 #include "engines/wintermute/utils/utils.h"
@@ -740,10 +741,11 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		return STATUS_OK;
 	}
 
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// PlayTheora
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlayTheora") == 0) {
+	SC_NAME_CASE("PlayTheora") {
 		stack->correctParams(4);
 		const char *filename = stack->pop()->getString();
 		bool looping = stack->pop()->getBool(false);
@@ -770,7 +772,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// StopTheora
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopTheora") == 0) {
+	SC_NAME_CASE("StopTheora") {
 		stack->correctParams(0);
 		if (_theora) {
 			_theora->stop();
@@ -787,7 +789,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// IsTheoraPlaying
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsTheoraPlaying") == 0) {
+	SC_NAME_CASE("IsTheoraPlaying") {
 		stack->correctParams(0);
 		if (_theora && _theora->isPlaying()) {
 			stack->pushBool(true);
@@ -801,7 +803,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// PauseTheora
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PauseTheora") == 0) {
+	SC_NAME_CASE("PauseTheora") {
 		stack->correctParams(0);
 		if (_theora && _theora->isPlaying()) {
 			_theora->pause();
@@ -816,7 +818,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ResumeTheora
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ResumeTheora") == 0) {
+	SC_NAME_CASE("ResumeTheora") {
 		stack->correctParams(0);
 		if (_theora && _theora->isPaused()) {
 			_theora->resume();
@@ -831,7 +833,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// IsTheoraPaused
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsTheoraPaused") == 0) {
+	SC_NAME_CASE("IsTheoraPaused") {
 		stack->correctParams(0);
 		if (_theora && _theora->isPaused()) {
 			stack->pushBool(true);
@@ -850,7 +852,8 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// If target entity is not found, do nothing
 	// Else shift nodes of the layer to put current entity behind/after target entity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetBeforeEntity") == 0 || strcmp(name, "SetAfterEntity") == 0) {
+	SC_NAME_CASE("SetBeforeEntity")
+	SC_NAME_ALIAS("SetAfterEntity") {
 		stack->correctParams(1);
 		const char *nodeName = stack->pop()->getString();
 
@@ -900,7 +903,8 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// [WME Kinjal 1.4] GetLayer / GetIndex
 	// Find current entity's layer and node index
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetLayer") == 0 || strcmp(name, "GetIndex") == 0) {
+	SC_NAME_CASE("GetLayer")
+	SC_NAME_ALIAS("GetIndex") {
 		stack->correctParams(0);
 
 		for (uint32 i = 0; i < ((AdGame *)_gameRef)->_scene->_layers.size(); i++) {
@@ -926,7 +930,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateRegion
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateRegion") == 0) {
+	SC_NAME_CASE("CreateRegion") {
 		stack->correctParams(0);
 		if (!_region) {
 			_region = new BaseRegion(_gameRef);
@@ -944,7 +948,7 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteRegion
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteRegion") == 0) {
+	SC_NAME_CASE("DeleteRegion") {
 		stack->correctParams(0);
 		if (_region) {
 			_gameRef->unregisterObject(_region);
@@ -955,9 +959,12 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		}
 
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return AdTalkHolder::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -965,10 +972,11 @@ bool AdEntity::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("entity");
 		return _scValue;
 	}
@@ -976,7 +984,7 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Item
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Item") {
+	SC_NAME_CASE("Item") {
 		if (_item) {
 			_scValue->setString(_item);
 		} else {
@@ -989,7 +997,7 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Subtype (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Subtype") {
+	SC_NAME_CASE("Subtype") {
 		if (_subtype == ENTITY_SOUND) {
 			_scValue->setString("sound");
 		} else {
@@ -1002,7 +1010,7 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkToX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WalkToX") {
+	SC_NAME_CASE("WalkToX") {
 		_scValue->setInt(_walkToX);
 		return _scValue;
 	}
@@ -1010,7 +1018,7 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkToY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WalkToY") {
+	SC_NAME_CASE("WalkToY") {
 		_scValue->setInt(_walkToY);
 		return _scValue;
 	}
@@ -1019,7 +1027,7 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// [FoxTail] HintX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "HintX") {
+	SC_NAME_CASE("HintX") {
 		_scValue->setInt(_hintX);
 		return _scValue;
 	}
@@ -1027,7 +1035,7 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// [FoxTail] HintY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "HintY") {
+	SC_NAME_CASE("HintY") {
 		_scValue->setInt(_hintY);
 		return _scValue;
 	}
@@ -1036,7 +1044,7 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkToDirection
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WalkToDirection") {
+	SC_NAME_CASE("WalkToDirection") {
 		_scValue->setInt((int)_walkToDir);
 		return _scValue;
 	}
@@ -1044,26 +1052,30 @@ ScValue *AdEntity::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Region (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Region") {
+	SC_NAME_CASE("Region") {
 		if (_region) {
 			_scValue->setNative(_region, true);
 		} else {
 			_scValue->setNULL();
 		}
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return AdTalkHolder::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool AdEntity::scSetProperty(const char *name, ScValue *value) {
 
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Item
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Item") == 0) {
+	SC_NAME_CASE("Item") {
 		setItem(value->getString());
 		return STATUS_OK;
 	}
@@ -1071,7 +1083,7 @@ bool AdEntity::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkToX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WalkToX") == 0) {
+	SC_NAME_CASE("WalkToX") {
 		_walkToX = value->getInt();
 		return STATUS_OK;
 	}
@@ -1079,7 +1091,7 @@ bool AdEntity::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkToY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WalkToY") == 0) {
+	SC_NAME_CASE("WalkToY") {
 		_walkToY = value->getInt();
 		return STATUS_OK;
 	}
@@ -1088,7 +1100,7 @@ bool AdEntity::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// [FoxTail] HintX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HintX") == 0) {
+	SC_NAME_CASE("HintX") {
 		_hintX = value->getInt();
 		return STATUS_OK;
 	}
@@ -1096,7 +1108,7 @@ bool AdEntity::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// HintY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HintY") == 0) {
+	SC_NAME_CASE("HintY") {
 		_hintY = value->getInt();
 		return STATUS_OK;
 	}
@@ -1105,15 +1117,18 @@ bool AdEntity::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// WalkToDirection
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WalkToDirection") == 0) {
+	SC_NAME_CASE("WalkToDirection") {
 		int dir = value->getInt();
 		if (dir >= 0 && dir < NUM_DIRECTIONS) {
 			_walkToDir = (TDirection)dir;
 		}
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return AdTalkHolder::scSetProperty(name, value);
 	}
+	}
 }
 
 
@@ -59,6 +59,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/ui/ui_entity.h"
 #include "engines/wintermute/ui/ui_window.h"
 #include "engines/wintermute/utils/utils.h"
@@ -353,10 +354,11 @@ void AdGame::finishSentences() {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// ChangeScene
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "ChangeScene") == 0) {
+	SC_NAME_CASE("ChangeScene") {
 		stack->correctParams(3);
 		const char *filename = stack->pop()->getString();
 		ScValue *valFadeOut = stack->pop();
@@ -382,7 +384,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadActor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadActor") == 0) {
+	SC_NAME_CASE("LoadActor") {
 		stack->correctParams(1);
 		AdActor *act = new AdActor(_gameRef);
 		if (act && DID_SUCCEED(act->loadFile(stack->pop()->getString()))) {
@@ -400,7 +402,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadActor3D
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadActor3D") == 0) {
+	SC_NAME_CASE("LoadActor3D") {
 		stack->correctParams(1);
 		// assume that we have an .X model here
 		// wme3d has also support for .ms3d files
@@ -420,7 +422,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// UnloadActor3D
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UnloadActor3D") == 0) {
+	SC_NAME_CASE("UnloadActor3D") {
 		// this does the same as UnloadActor etc. ..
 		// even WmeLite has this script call in AdScene
 		stack->correctParams(1);
@@ -440,7 +442,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadEntity") == 0) {
+	SC_NAME_CASE("LoadEntity") {
 		stack->correctParams(1);
 		AdEntity *ent = new AdEntity(_gameRef);
 		if (ent && DID_SUCCEED(ent->loadFile(stack->pop()->getString()))) {
@@ -457,7 +459,10 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// UnloadObject / UnloadActor / UnloadEntity / DeleteEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UnloadObject") == 0 || strcmp(name, "UnloadActor") == 0 || strcmp(name, "UnloadEntity") == 0 || strcmp(name, "DeleteEntity") == 0) {
+	SC_NAME_CASE("UnloadObject")
+	SC_NAME_ALIAS("UnloadActor")
+	SC_NAME_ALIAS("UnloadEntity")
+	SC_NAME_ALIAS("DeleteEntity") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		AdObject *obj = (AdObject *)val->getNative();
@@ -484,7 +489,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// CreateEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateEntity") == 0) {
+	SC_NAME_CASE("CreateEntity") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -500,7 +505,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// CreateItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateItem") == 0) {
+	SC_NAME_CASE("CreateItem") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -516,7 +521,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteItem") == 0) {
+	SC_NAME_CASE("DeleteItem") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -538,7 +543,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// QueryItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "QueryItem") == 0) {
+	SC_NAME_CASE("QueryItem") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -565,7 +570,9 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// AddResponse/AddResponseOnce/AddResponseOnceGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddResponse") == 0 || strcmp(name, "AddResponseOnce") == 0 || strcmp(name, "AddResponseOnceGame") == 0) {
+	SC_NAME_CASE("AddResponse")
+	SC_NAME_ALIAS("AddResponseOnce")
+	SC_NAME_ALIAS("AddResponseOnceGame") {
 		stack->correctParams(6);
 		int id = stack->pop()->getInt();
 		const char *text = stack->pop()->getString();
@@ -617,7 +624,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ResetResponse
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ResetResponse") == 0) {
+	SC_NAME_CASE("ResetResponse") {
 		stack->correctParams(1);
 		int id = stack->pop()->getInt(-1);
 		resetResponse(id);
@@ -628,7 +635,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ClearResponses
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ClearResponses") == 0) {
+	SC_NAME_CASE("ClearResponses") {
 		stack->correctParams(0);
 		_responseBox->clearResponses();
 		_responseBox->clearButtons();
@@ -639,7 +646,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetResponse
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetResponse") == 0) {
+	SC_NAME_CASE("GetResponse") {
 		stack->correctParams(1);
 		bool autoSelectLast = stack->pop()->getBool();
 
@@ -675,7 +682,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetNumResponses
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetNumResponses") == 0) {
+	SC_NAME_CASE("GetNumResponses") {
 		stack->correctParams(0);
 		if (_responseBox) {
 			_responseBox->weedResponses();
@@ -691,7 +698,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// StartDlgBranch
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StartDlgBranch") == 0) {
+	SC_NAME_CASE("StartDlgBranch") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		Common::String branchName;
@@ -710,7 +717,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// EndDlgBranch
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EndDlgBranch") == 0) {
+	SC_NAME_CASE("EndDlgBranch") {
 		stack->correctParams(1);
 
 		const char *branchName = nullptr;
@@ -728,7 +735,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetCurrentDlgBranch
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetCurrentDlgBranch") == 0) {
+	SC_NAME_CASE("GetCurrentDlgBranch") {
 		stack->correctParams(0);
 
 		if (_dlgPendingBranches.size() > 0) {
@@ -743,35 +750,35 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// TakeItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TakeItem") == 0) {
+	SC_NAME_CASE("TakeItem") {
 		return _invObject->scCallMethod(script, stack, thisStack, name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// DropItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DropItem") == 0) {
+	SC_NAME_CASE("DropItem") {
 		return _invObject->scCallMethod(script, stack, thisStack, name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// GetItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetItem") == 0) {
+	SC_NAME_CASE("GetItem") {
 		return _invObject->scCallMethod(script, stack, thisStack, name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// HasItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasItem") == 0) {
+	SC_NAME_CASE("HasItem") {
 		return _invObject->scCallMethod(script, stack, thisStack, name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// IsItemTaken
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsItemTaken") == 0) {
+	SC_NAME_CASE("IsItemTaken") {
 		stack->correctParams(1);
 
 		ScValue *val = stack->pop();
@@ -800,7 +807,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetInventoryWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetInventoryWindow") == 0) {
+	SC_NAME_CASE("GetInventoryWindow") {
 		stack->correctParams(0);
 		if (_inventoryBox && _inventoryBox->_window) {
 			stack->pushNative(_inventoryBox->_window, true);
@@ -814,7 +821,8 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetResponsesWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetResponsesWindow") == 0 || strcmp(name, "GetResponseWindow") == 0) {
+	SC_NAME_CASE("GetResponsesWindow")
+	SC_NAME_ALIAS("GetResponseWindow") {
 		stack->correctParams(0);
 		if (_responseBox && _responseBox->getResponseWindow()) {
 			stack->pushNative(_responseBox->getResponseWindow(), true);
@@ -828,7 +836,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadResponseBox
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadResponseBox") == 0) {
+	SC_NAME_CASE("LoadResponseBox") {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -848,7 +856,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadInventoryBox
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadInventoryBox") == 0) {
+	SC_NAME_CASE("LoadInventoryBox") {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -868,7 +876,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadItems
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadItems") == 0) {
+	SC_NAME_CASE("LoadItems") {
 		stack->correctParams(2);
 		const char *filename = stack->pop()->getString();
 		bool merge = stack->pop()->getBool(false);
@@ -882,7 +890,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// AddSpeechDir
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddSpeechDir") == 0) {
+	SC_NAME_CASE("AddSpeechDir") {
 		stack->correctParams(1);
 		const char *dir = stack->pop()->getString();
 		stack->pushBool(DID_SUCCEED(addSpeechDir(dir)));
@@ -893,7 +901,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveSpeechDir
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveSpeechDir") == 0) {
+	SC_NAME_CASE("RemoveSpeechDir") {
 		stack->correctParams(1);
 		const char *dir = stack->pop()->getString();
 		stack->pushBool(DID_SUCCEED(removeSpeechDir(dir)));
@@ -904,7 +912,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetSceneViewport
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSceneViewport") == 0) {
+	SC_NAME_CASE("SetSceneViewport") {
 		stack->correctParams(4);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -936,7 +944,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	// Used while changing cursor type at some included script
 	// Return value is never used
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetInventoryBoxHideSelected") == 0) {
+	SC_NAME_CASE("SetInventoryBoxHideSelected") {
 		stack->correctParams(1);
 		_inventoryBox->_hideSelected = stack->pop()->getBool(false);
 		stack->pushNULL();
@@ -944,9 +952,11 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	}
 #endif
 
-	else {
+	default:
+	unknownName: {
 		return BaseGame::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -954,17 +964,18 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *AdGame::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("game");
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Scene
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Scene") {
+	SC_NAME_CASE("Scene") {
 		if (_scene) {
 			_scValue->setNative(_scene, true);
 		} else {
@@ -976,7 +987,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SelectedItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SelectedItem") {
+	SC_NAME_CASE("SelectedItem") {
 		//if (_selectedItem) _scValue->setString(_selectedItem->_name);
 		if (_selectedItem) {
 			_scValue->setNative(_selectedItem, true);
@@ -989,14 +1000,14 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumItems
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumItems") {
+	SC_NAME_CASE("NumItems") {
 		return _invObject->scGetProperty(name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// SmartItemCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SmartItemCursor") {
+	SC_NAME_CASE("SmartItemCursor") {
 		_scValue->setBool(_smartItemCursor);
 		return _scValue;
 	}
@@ -1004,7 +1015,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// InventoryVisible
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "InventoryVisible") {
+	SC_NAME_CASE("InventoryVisible") {
 		_scValue->setBool(_inventoryBox && _inventoryBox->_visible);
 		return _scValue;
 	}
@@ -1012,7 +1023,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// InventoryScrollOffset
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "InventoryScrollOffset") {
+	SC_NAME_CASE("InventoryScrollOffset") {
 		if (_inventoryBox) {
 			_scValue->setInt(_inventoryBox->_scrollOffset);
 		} else {
@@ -1025,7 +1036,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ResponsesVisible (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ResponsesVisible") {
+	SC_NAME_CASE("ResponsesVisible") {
 		_scValue->setBool(_stateEx == GAME_WAITING_RESPONSE);
 		return _scValue;
 	}
@@ -1033,7 +1044,8 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PrevScene / PreviousScene (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PrevScene" || name == "PreviousScene") {
+	SC_NAME_CASE("PrevScene")
+	SC_NAME_ALIAS("PreviousScene") {
 		if (!_prevSceneName) {
 			_scValue->setString("");
 		} else {
@@ -1045,7 +1057,8 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PrevSceneFilename / PreviousSceneFilename (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PrevSceneFilename" || name == "PreviousSceneFilename") {
+	SC_NAME_CASE("PrevSceneFilename")
+	SC_NAME_ALIAS("PreviousSceneFilename") {
 		if (!_prevSceneFilename) {
 			_scValue->setString("");
 		} else {
@@ -1057,7 +1070,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// LastResponse (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "LastResponse") {
+	SC_NAME_CASE("LastResponse") {
 		if (!_responseBox || !_responseBox->getLastResponseText()) {
 			_scValue->setString("");
 		} else {
@@ -1069,7 +1082,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// LastResponseOrig (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "LastResponseOrig") {
+	SC_NAME_CASE("LastResponseOrig") {
 		if (!_responseBox || !_responseBox->getLastResponseTextOrig()) {
 			_scValue->setString("");
 		} else {
@@ -1081,7 +1094,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// InventoryObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "InventoryObject") {
+	SC_NAME_CASE("InventoryObject") {
 		if (_inventoryOwner == _invObject) {
 			_scValue->setNative(this, true);
 		} else {
@@ -1094,7 +1107,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TotalNumItems
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TotalNumItems") {
+	SC_NAME_CASE("TotalNumItems") {
 		_scValue->setInt(_items.size());
 		return _scValue;
 	}
@@ -1102,7 +1115,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TalkSkipButton
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TalkSkipButton") {
+	SC_NAME_CASE("TalkSkipButton") {
 		_scValue->setInt(_talkSkipButton);
 		return _scValue;
 	}
@@ -1111,7 +1124,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// VideoSkipButton
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "VideoSkipButton") {
+	SC_NAME_CASE("VideoSkipButton") {
 		warning("AdGame::scGetProperty VideoSkipButton not implemented");
 		_scValue->setInt(0);
 		return _scValue;
@@ -1121,7 +1134,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ChangingScene
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ChangingScene") {
+	SC_NAME_CASE("ChangingScene") {
 		_scValue->setBool(_scheduledScene != nullptr);
 		return _scValue;
 	}
@@ -1129,7 +1142,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// StartupScene
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "StartupScene") {
+	SC_NAME_CASE("StartupScene") {
 		if (!_startupScene) {
 			_scValue->setNULL();
 		} else {
@@ -1138,19 +1151,22 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 		return _scValue;
 	}
 
-	else {
+	default:
+	unknownName: {
 		return BaseGame::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool AdGame::scSetProperty(const char *name, ScValue *value) {
 
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SelectedItem
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SelectedItem") == 0) {
+	SC_NAME_CASE("SelectedItem") {
 		if (value->isNULL()) {
 			_selectedItem = nullptr;
 		} else {
@@ -1174,7 +1190,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SmartItemCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SmartItemCursor") == 0) {
+	SC_NAME_CASE("SmartItemCursor") {
 		_smartItemCursor = value->getBool();
 		return STATUS_OK;
 	}
@@ -1182,7 +1198,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// InventoryVisible
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InventoryVisible") == 0) {
+	SC_NAME_CASE("InventoryVisible") {
 		if (_inventoryBox) {
 			_inventoryBox->_visible = value->getBool();
 		}
@@ -1192,7 +1208,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// InventoryObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InventoryObject") == 0) {
+	SC_NAME_CASE("InventoryObject") {
 		if (_inventoryOwner && _inventoryBox) {
 			_inventoryOwner->getInventory()->_scrollOffset = _inventoryBox->_scrollOffset;
 		}
@@ -1218,7 +1234,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// InventoryScrollOffset
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InventoryScrollOffset") == 0) {
+	SC_NAME_CASE("InventoryScrollOffset") {
 		if (_inventoryBox) {
 			_inventoryBox->_scrollOffset = value->getInt();
 		}
@@ -1228,7 +1244,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TalkSkipButton
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TalkSkipButton") == 0) {
+	SC_NAME_CASE("TalkSkipButton") {
 		int val = value->getInt();
 		if (val < 0) {
 			val = 0;
@@ -1244,7 +1260,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// VideoSkipButton
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "VideoSkipButton") == 0) {
+	SC_NAME_CASE("VideoSkipButton") {
 		warning("AdGame::scSetProperty VideoSkipButton not implemented");
 		return STATUS_OK;
 	}
@@ -1253,7 +1269,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// StartupScene
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StartupScene") == 0) {
+	SC_NAME_CASE("StartupScene") {
 		if (value == nullptr) {
 			delete[] _startupScene;
 			_startupScene = nullptr;
@@ -1264,9 +1280,11 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 		return STATUS_OK;
 	}
 
-	else {
+	default:
+	unknownName: {
 		return BaseGame::scSetProperty(name, value);
 	}
+	}
 }
 
 
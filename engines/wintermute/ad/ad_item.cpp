@@ -39,6 +39,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/utils/utils.h"
 #include "engines/wintermute/platform_osystem.h"
 #include "common/str.h"
@@ -458,10 +459,11 @@ bool AdItem::display(int x, int y) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetHoverSprite
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetHoverSprite") == 0) {
+	SC_NAME_CASE("SetHoverSprite") {
 		stack->correctParams(1);
 
 		bool setCurrent = false;
@@ -490,7 +492,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetHoverSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHoverSprite") == 0) {
+	SC_NAME_CASE("GetHoverSprite") {
 		stack->correctParams(0);
 
 		if (!_spriteHover || !_spriteHover->getFilename()) {
@@ -504,7 +506,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetHoverSpriteObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHoverSpriteObject") == 0) {
+	SC_NAME_CASE("GetHoverSpriteObject") {
 		stack->correctParams(0);
 		if (!_spriteHover) {
 			stack->pushNULL();
@@ -517,7 +519,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetNormalCursor
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetNormalCursor") == 0) {
+	SC_NAME_CASE("SetNormalCursor") {
 		stack->correctParams(1);
 
 		const char *filename = stack->pop()->getString();
@@ -541,7 +543,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	// Used while changing cursor type at some included script
 	// Return value is never used
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveNormalCursor") == 0) {
+	SC_NAME_CASE("RemoveNormalCursor") {
 		stack->correctParams(0);
 
 		delete _cursorNormal;
@@ -555,7 +557,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetNormalCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetNormalCursor") == 0) {
+	SC_NAME_CASE("GetNormalCursor") {
 		stack->correctParams(0);
 
 		if (!_cursorNormal || !_cursorNormal->getFilename()) {
@@ -569,7 +571,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetNormalCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetNormalCursorObject") == 0) {
+	SC_NAME_CASE("GetNormalCursorObject") {
 		stack->correctParams(0);
 
 		if (!_cursorNormal) {
@@ -583,7 +585,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetHoverCursor
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetHoverCursor") == 0) {
+	SC_NAME_CASE("SetHoverCursor") {
 		stack->correctParams(1);
 
 		const char *filename = stack->pop()->getString();
@@ -607,7 +609,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	// Used while changing cursor type at some included script
 	// Return value is never used
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveHoverCursor") == 0) {
+	SC_NAME_CASE("RemoveHoverCursor") {
 		stack->correctParams(0);
 
 		delete _cursorHover;
@@ -621,7 +623,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetHoverCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHoverCursor") == 0) {
+	SC_NAME_CASE("GetHoverCursor") {
 		stack->correctParams(0);
 
 		if (!_cursorHover || !_cursorHover->getFilename()) {
@@ -635,7 +637,7 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetHoverCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHoverCursorObject") == 0) {
+	SC_NAME_CASE("GetHoverCursorObject") {
 		stack->correctParams(0);
 
 		if (!_cursorHover) {
@@ -644,9 +646,12 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 			stack->pushNative(_cursorHover, true);
 		}
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return AdTalkHolder::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -654,10 +659,11 @@ bool AdItem::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *AdItem::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("item");
 		return _scValue;
 	}
@@ -665,7 +671,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Name") {
+	SC_NAME_CASE("Name") {
 		_scValue->setString(getName());
 		return _scValue;
 	}
@@ -673,7 +679,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// DisplayAmount
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "DisplayAmount") {
+	SC_NAME_CASE("DisplayAmount") {
 		_scValue->setBool(_displayAmount);
 		return _scValue;
 	}
@@ -681,7 +687,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Amount
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Amount") {
+	SC_NAME_CASE("Amount") {
 		_scValue->setInt(_amount);
 		return _scValue;
 	}
@@ -689,7 +695,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountOffsetX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AmountOffsetX") {
+	SC_NAME_CASE("AmountOffsetX") {
 		_scValue->setInt(_amountOffsetX);
 		return _scValue;
 	}
@@ -697,7 +703,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountOffsetY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AmountOffsetY") {
+	SC_NAME_CASE("AmountOffsetY") {
 		_scValue->setInt(_amountOffsetY);
 		return _scValue;
 	}
@@ -705,7 +711,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountAlign
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AmountAlign") {
+	SC_NAME_CASE("AmountAlign") {
 		_scValue->setInt(_amountAlign);
 		return _scValue;
 	}
@@ -713,7 +719,7 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountString
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AmountString") {
+	SC_NAME_CASE("AmountString") {
 		if (!_amountString) {
 			_scValue->setNULL();
 		} else {
@@ -725,21 +731,25 @@ ScValue *AdItem::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorCombined
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CursorCombined") {
+	SC_NAME_CASE("CursorCombined") {
 		_scValue->setBool(_cursorCombined);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return AdTalkHolder::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool AdItem::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	SC_NAME_CASE("Name") {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -747,7 +757,7 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// DisplayAmount
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DisplayAmount") == 0) {
+	SC_NAME_CASE("DisplayAmount") {
 		_displayAmount = value->getBool();
 		return STATUS_OK;
 	}
@@ -755,7 +765,7 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Amount
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Amount") == 0) {
+	SC_NAME_CASE("Amount") {
 		_amount = value->getInt();
 		return STATUS_OK;
 	}
@@ -763,7 +773,7 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountOffsetX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AmountOffsetX") == 0) {
+	SC_NAME_CASE("AmountOffsetX") {
 		_amountOffsetX = value->getInt();
 		return STATUS_OK;
 	}
@@ -771,7 +781,7 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountOffsetY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AmountOffsetY") == 0) {
+	SC_NAME_CASE("AmountOffsetY") {
 		_amountOffsetY = value->getInt();
 		return STATUS_OK;
 	}
@@ -779,7 +789,7 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountAlign
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AmountAlign") == 0) {
+	SC_NAME_CASE("AmountAlign") {
 		_amountAlign = (TTextAlign)value->getInt();
 		return STATUS_OK;
 	}
@@ -787,7 +797,7 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmountString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AmountString") == 0) {
+	SC_NAME_CASE("AmountString") {
 		if (value->isNULL()) {
 			delete[] _amountString;
 			_amountString = nullptr;
@@ -800,12 +810,15 @@ bool AdItem::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorCombined
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CursorCombined") == 0) {
+	SC_NAME_CASE("CursorCombined") {
 		_cursorCombined = value->getBool();
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return AdTalkHolder::scSetProperty(name, value);
 	}
+	}
 }
 
 
@@ -27,7 +27,9 @@
  */
 
 #include "engines/wintermute/base/base_game.h"
+#include "engines/wintermute/ad/ad_game.h"
 #include "engines/wintermute/ad/ad_layer.h"
+#include "engines/wintermute/ad/ad_scene.h"
 #include "engines/wintermute/ad/ad_scene_node.h"
 #include "engines/wintermute/base/base_dynamic_buffer.h"
 #include "engines/wintermute/base/base_file_manager.h"
@@ -35,6 +37,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/platform_osystem.h"
 #include "common/str.h"
 
@@ -235,10 +238,11 @@ bool AdLayer::loadBuffer(char *buffer, bool complete) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetNode
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetNode") == 0) {
+	SC_NAME_CASE("GetNode") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		int node = -1;
@@ -275,7 +279,8 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// AddRegion / AddEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddRegion") == 0 || strcmp(name, "AddEntity") == 0) {
+	SC_NAME_CASE("AddRegion")
+	SC_NAME_ALIAS("AddEntity") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -296,13 +301,15 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 			stack->pushNative(entity, true);
 		}
 		_nodes.add(node);
+		invalidateWalkGrid();
 		return STATUS_OK;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// InsertRegion / InsertEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InsertRegion") == 0 || strcmp(name, "InsertEntity") == 0) {
+	SC_NAME_CASE("InsertRegion")
+	SC_NAME_ALIAS("InsertEntity") {
 		stack->correctParams(2);
 		int index = stack->pop()->getInt();
 		ScValue *val = stack->pop();
@@ -331,6 +338,7 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 		} else {
 			_nodes.add(node);
 		}
+		invalidateWalkGrid();
 
 		return STATUS_OK;
 	}
@@ -338,7 +346,7 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteNode
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteNode") == 0) {
+	SC_NAME_CASE("DeleteNode") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -370,11 +378,15 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 				break;
 			}
 		}
+		invalidateWalkGrid();
 		stack->pushBool(true);
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -382,10 +394,11 @@ bool AdLayer::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("layer");
 		return _scValue;
 	}
@@ -393,7 +406,7 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumNodes (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumNodes") {
+	SC_NAME_CASE("NumNodes") {
 		_scValue->setInt(_nodes.size());
 		return _scValue;
 	}
@@ -401,7 +414,7 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Width
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Width") {
+	SC_NAME_CASE("Width") {
 		_scValue->setInt(_width);
 		return _scValue;
 	}
@@ -409,7 +422,7 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Height
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Height") {
+	SC_NAME_CASE("Height") {
 		_scValue->setInt(_height);
 		return _scValue;
 	}
@@ -417,7 +430,7 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Main (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Main") {
+	SC_NAME_CASE("Main") {
 		_scValue->setBool(_main);
 		return _scValue;
 	}
@@ -425,7 +438,7 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CloseUp
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CloseUp") {
+	SC_NAME_CASE("CloseUp") {
 		_scValue->setBool(_closeUp);
 		return _scValue;
 	}
@@ -433,21 +446,25 @@ ScValue *AdLayer::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Active") {
+	SC_NAME_CASE("Active") {
 		_scValue->setBool(_active);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool AdLayer::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	SC_NAME_CASE("Name") {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -455,7 +472,7 @@ bool AdLayer::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// CloseUp
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CloseUp") == 0) {
+	SC_NAME_CASE("CloseUp") {
 		_closeUp = value->getBool();
 		return STATUS_OK;
 	}
@@ -463,29 +480,31 @@ bool AdLayer::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Width
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Width") == 0) {
+	SC_NAME_CASE("Width") {
 		_width = value->getInt();
 		if (_width < 0) {
 			_width = 0;
 		}
+		invalidateWalkGrid();
 		return STATUS_OK;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Height
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Height") == 0) {
+	SC_NAME_CASE("Height") {
 		_height = value->getInt();
 		if (_height < 0) {
 			_height = 0;
 		}
+		invalidateWalkGrid();
 		return STATUS_OK;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Active") == 0) {
+	SC_NAME_CASE("Active") {
 		bool b = value->getBool();
 		if (b == false && _main) {
 			_gameRef->LOG(0, "Warning: cannot deactivate scene's main layer");
@@ -493,9 +512,22 @@ bool AdLayer::scSetProperty(const char *name, ScValue *value) {
 			_active = b;
 		}
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scSetProperty(name, value);
 	}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdLayer::invalidateWalkGrid() {
+	// The scene only fills its walk grid from the main layer
+	AdScene *scene = ((AdGame *)_gameRef)->_scene;
+	if (_main && scene) {
+		scene->invalidateWalkGrid();
+	}
 }
 
 
@@ -51,6 +51,9 @@ public:
 	bool scSetProperty(const char *name, ScValue *value) override;
 	bool scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) override;
 	const char *scToString() override;
+
+private:
+	void invalidateWalkGrid();
 };
 
 } // End of namespace Wintermute
@@ -48,6 +48,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/sound/base_sound.h"
 #include "common/str.h"
 #include "common/util.h"
@@ -194,10 +195,12 @@ bool AdObject::update() {
 //////////////////////////////////////////////////////////////////////////
 bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
 
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// PlayAnim / PlayAnimAsync
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "PlayAnim") == 0 || strcmp(name, "PlayAnimAsync") == 0) {
+	SC_NAME_CASE("PlayAnim")
+	SC_NAME_ALIAS("PlayAnimAsync") {
 		stack->correctParams(1);
 		if (DID_FAIL(playAnim(stack->pop()->getString()))) {
 			stack->pushBool(false);
@@ -213,7 +216,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Reset
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Reset") == 0) {
+	SC_NAME_CASE("Reset") {
 		stack->correctParams(0);
 		reset();
 		stack->pushNULL();
@@ -223,7 +226,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// IsTalking
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsTalking") == 0) {
+	SC_NAME_CASE("IsTalking") {
 		stack->correctParams(0);
 		stack->pushBool(_state == STATE_TALKING);
 		return STATUS_OK;
@@ -232,7 +235,8 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// StopTalk / StopTalking
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopTalk") == 0 || strcmp(name, "StopTalking") == 0) {
+	SC_NAME_CASE("StopTalk")
+	SC_NAME_ALIAS("StopTalking") {
 		stack->correctParams(0);
 		if (_sentence) {
 			_sentence->finish();
@@ -250,7 +254,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ForceTalkAnim
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ForceTalkAnim") == 0) {
+	SC_NAME_CASE("ForceTalkAnim") {
 		stack->correctParams(1);
 		const char *animName = stack->pop()->getString();
 		delete[] _forcedTalkAnimName;
@@ -265,7 +269,8 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Talk / TalkAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Talk") == 0 || strcmp(name, "TalkAsync") == 0) {
+	SC_NAME_CASE("Talk")
+	SC_NAME_ALIAS("TalkAsync") {
 		stack->correctParams(5);
 
 		const char *text    = stack->pop()->getString();
@@ -299,7 +304,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// StickToRegion
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StickToRegion") == 0) {
+	SC_NAME_CASE("StickToRegion") {
 		stack->correctParams(1);
 
 		AdLayer *main = ((AdGame *)_gameRef)->_scene->_mainLayer;
@@ -342,7 +347,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetFont
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetFont") == 0) {
+	SC_NAME_CASE("SetFont") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -359,7 +364,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetFont
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFont") == 0) {
+	SC_NAME_CASE("GetFont") {
 		stack->correctParams(0);
 		if (_font && _font->getFilename()) {
 			stack->pushString(_font->getFilename());
@@ -372,7 +377,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// TakeItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TakeItem") == 0) {
+	SC_NAME_CASE("TakeItem") {
 		stack->correctParams(2);
 
 		if (!_inventory) {
@@ -403,7 +408,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DropItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DropItem") == 0) {
+	SC_NAME_CASE("DropItem") {
 		stack->correctParams(1);
 
 		if (!_inventory) {
@@ -430,7 +435,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetItem") == 0) {
+	SC_NAME_CASE("GetItem") {
 		stack->correctParams(1);
 
 		if (!_inventory) {
@@ -458,7 +463,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// HasItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasItem") == 0) {
+	SC_NAME_CASE("HasItem") {
 		stack->correctParams(1);
 
 		if (!_inventory) {
@@ -488,7 +493,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateParticleEmitter
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateParticleEmitter") == 0) {
+	SC_NAME_CASE("CreateParticleEmitter") {
 		stack->correctParams(3);
 		bool followParent = stack->pop()->getBool();
 		int offsetX = stack->pop()->getInt();
@@ -507,7 +512,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteParticleEmitter
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteParticleEmitter") == 0) {
+	SC_NAME_CASE("DeleteParticleEmitter") {
 		stack->correctParams(0);
 		if (_partEmitter) {
 			_gameRef->unregisterObject(_partEmitter);
@@ -521,7 +526,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// AddAttachment
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddAttachment") == 0) {
+	SC_NAME_CASE("AddAttachment") {
 		stack->correctParams(4);
 		const char *filename = stack->pop()->getString();
 		bool preDisplay = stack->pop()->getBool(true);
@@ -557,7 +562,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveAttachment
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveAttachment") == 0) {
+	SC_NAME_CASE("RemoveAttachment") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		bool found = false;
@@ -606,7 +611,7 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetAttachment
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetAttachment") == 0) {
+	SC_NAME_CASE("GetAttachment") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -651,9 +656,12 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		}
 
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -661,10 +669,11 @@ bool AdObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *AdObject::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("object");
 		return _scValue;
 	}
@@ -672,7 +681,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Active") {
+	SC_NAME_CASE("Active") {
 		_scValue->setBool(_active);
 		return _scValue;
 	}
@@ -680,7 +689,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// IgnoreItems
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "IgnoreItems") {
+	SC_NAME_CASE("IgnoreItems") {
 		_scValue->setBool(_ignoreItems);
 		return _scValue;
 	}
@@ -688,7 +697,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SceneIndependent
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SceneIndependent") {
+	SC_NAME_CASE("SceneIndependent") {
 		_scValue->setBool(_sceneIndependent);
 		return _scValue;
 	}
@@ -696,7 +705,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesWidth
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SubtitlesWidth") {
+	SC_NAME_CASE("SubtitlesWidth") {
 		_scValue->setInt(_subtitlesWidth);
 		return _scValue;
 	}
@@ -704,7 +713,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosRelative
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SubtitlesPosRelative") {
+	SC_NAME_CASE("SubtitlesPosRelative") {
 		_scValue->setBool(_subtitlesModRelative);
 		return _scValue;
 	}
@@ -712,7 +721,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SubtitlesPosX") {
+	SC_NAME_CASE("SubtitlesPosX") {
 		_scValue->setInt(_subtitlesModX);
 		return _scValue;
 	}
@@ -720,7 +729,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SubtitlesPosY") {
+	SC_NAME_CASE("SubtitlesPosY") {
 		_scValue->setInt(_subtitlesModY);
 		return _scValue;
 	}
@@ -728,7 +737,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosXCenter
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SubtitlesPosXCenter") {
+	SC_NAME_CASE("SubtitlesPosXCenter") {
 		_scValue->setBool(_subtitlesModXCenter);
 		return _scValue;
 	}
@@ -736,7 +745,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumItems (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumItems") {
+	SC_NAME_CASE("NumItems") {
 		_scValue->setInt(getInventory()->_takenItems.size());
 		return _scValue;
 	}
@@ -744,7 +753,7 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ParticleEmitter (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ParticleEmitter") {
+	SC_NAME_CASE("ParticleEmitter") {
 		if (_partEmitter) {
 			_scValue->setNative(_partEmitter, true);
 		} else {
@@ -757,22 +766,26 @@ ScValue *AdObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumAttachments (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumAttachments") {
+	SC_NAME_CASE("NumAttachments") {
 		_scValue->setInt(_attachmentsPre.size() + _attachmentsPost.size());
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool AdObject::scSetProperty(const char *name, ScValue *value) {
 
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Active") == 0) {
+	SC_NAME_CASE("Active") {
 		_active = value->getBool();
 		return STATUS_OK;
 	}
@@ -780,7 +793,7 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// IgnoreItems
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IgnoreItems") == 0) {
+	SC_NAME_CASE("IgnoreItems") {
 		_ignoreItems = value->getBool();
 		return STATUS_OK;
 	}
@@ -788,7 +801,7 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SceneIndependent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SceneIndependent") == 0) {
+	SC_NAME_CASE("SceneIndependent") {
 		_sceneIndependent = value->getBool();
 		return STATUS_OK;
 	}
@@ -796,7 +809,7 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesWidth
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SubtitlesWidth") == 0) {
+	SC_NAME_CASE("SubtitlesWidth") {
 		_subtitlesWidth = value->getInt();
 		return STATUS_OK;
 	}
@@ -804,7 +817,7 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosRelative
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SubtitlesPosRelative") == 0) {
+	SC_NAME_CASE("SubtitlesPosRelative") {
 		_subtitlesModRelative = value->getBool();
 		return STATUS_OK;
 	}
@@ -812,7 +825,7 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SubtitlesPosX") == 0) {
+	SC_NAME_CASE("SubtitlesPosX") {
 		_subtitlesModX = value->getInt();
 		return STATUS_OK;
 	}
@@ -820,7 +833,7 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SubtitlesPosY") == 0) {
+	SC_NAME_CASE("SubtitlesPosY") {
 		_subtitlesModY = value->getInt();
 		return STATUS_OK;
 	}
@@ -828,12 +841,15 @@ bool AdObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesPosXCenter
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SubtitlesPosXCenter") == 0) {
+	SC_NAME_CASE("SubtitlesPosXCenter") {
 		_subtitlesModXCenter = value->getBool();
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scSetProperty(name, value);
 	}
+	}
 }
 
 
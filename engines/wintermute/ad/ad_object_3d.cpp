@@ -36,6 +36,7 @@
 #include "engines/wintermute/base/gfx/x/modelx.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/dcgf.h"
 #include "engines/wintermute/utils/utils.h"
 
@@ -147,10 +148,11 @@ bool AdObject3D::setupLights() {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdObject3D::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SkipTo
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SkipTo") == 0) {
+	SC_NAME_CASE("SkipTo") {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -163,7 +165,7 @@ bool AdObject3D::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SkipTo3D
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SkipTo3D") == 0) {
+	SC_NAME_CASE("SkipTo3D") {
 		stack->correctParams(3);
 		_posVector.x() = stack->pop()->getFloat();
 		_posVector.y() = stack->pop()->getFloat();
@@ -177,7 +179,7 @@ bool AdObject3D::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetBonePosition2D
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetBonePosition2D") == 0) {
+	SC_NAME_CASE("GetBonePosition2D") {
 		stack->correctParams(1);
 		const char *boneName = stack->pop()->getString();
 		int x = 0, y = 0;
@@ -194,7 +196,7 @@ bool AdObject3D::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetBonePosition3D
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetBonePosition3D") == 0) {
+	SC_NAME_CASE("GetBonePosition3D") {
 		stack->correctParams(1);
 		const char *boneName = stack->pop()->getString();
 		Math::Vector3d pos(0, 0, 0);
@@ -213,7 +215,7 @@ bool AdObject3D::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// AddIgnoredLight
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddIgnoredLight") == 0) {
+	SC_NAME_CASE("AddIgnoredLight") {
 		stack->correctParams(1);
 		char *lightName = nullptr;
 		BaseUtils::setString(&lightName, stack->pop()->getString());
@@ -223,7 +225,7 @@ bool AdObject3D::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveIgnoredLight
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveIgnoredLight") == 0) {
+	SC_NAME_CASE("RemoveIgnoredLight") {
 		stack->correctParams(1);
 		char *lightName = nullptr;
 		BaseUtils::setString(&lightName, stack->pop()->getString());
@@ -231,19 +233,22 @@ bool AdObject3D::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 		return true;
 	}
 
-	else {
+	default:
+	unknownName: {
 		return AdObject::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////
 ScValue *AdObject3D::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Angle
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Angle") {
+	SC_NAME_CASE("Angle") {
 		float tmp = 0.0f;
 		_scValue->setFloat(tmp);
 		_angle = tmp;
@@ -252,21 +257,21 @@ ScValue *AdObject3D::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PosX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PosX") {
+	SC_NAME_CASE("PosX") {
 		_scValue->setFloat(_posVector.x());
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// PosY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PosY") {
+	SC_NAME_CASE("PosY") {
 		_scValue->setFloat(_posVector.y());
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// PosZ
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PosZ") {
+	SC_NAME_CASE("PosZ") {
 		// scripts will expect a Direct3D coordinate system
 		_scValue->setFloat(-_posVector.z());
 		return _scValue;
@@ -274,21 +279,22 @@ ScValue *AdObject3D::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Velocity
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Velocity") {
+	SC_NAME_CASE("Velocity") {
 		_scValue->setFloat(_velocity);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// AngularVelocity / AngVelocity
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AngularVelocity" || name == "AngVelocity") {
+	SC_NAME_CASE("AngularVelocity")
+	SC_NAME_ALIAS("AngVelocity") {
 		_scValue->setFloat(_angVelocity);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// DropToFloor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "DropToFloor") {
+	SC_NAME_CASE("DropToFloor") {
 		_scValue->setBool(_dropToFloor);
 		return _scValue;
 	}
@@ -296,7 +302,7 @@ ScValue *AdObject3D::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ShadowType
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ShadowType") {
+	SC_NAME_CASE("ShadowType") {
 		_scValue->setInt(_shadowType);
 		return _scValue;
 	}
@@ -304,7 +310,7 @@ ScValue *AdObject3D::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Shadow (obsolete)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Shadow") {
+	SC_NAME_CASE("Shadow") {
 		_scValue->setBool(_shadowType > SHADOW_NONE);
 		return _scValue;
 	}
@@ -312,7 +318,7 @@ ScValue *AdObject3D::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SimpleShadow (obsolete)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SimpleShadow") {
+	SC_NAME_CASE("SimpleShadow") {
 		_scValue->setBool(_shadowType == SHADOW_SIMPLE);
 		return _scValue;
 	}
@@ -320,7 +326,7 @@ ScValue *AdObject3D::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ShadowColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ShadowColor") {
+	SC_NAME_CASE("ShadowColor") {
 		_scValue->setInt(_shadowColor);
 		return _scValue;
 	}
@@ -328,7 +334,7 @@ ScValue *AdObject3D::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Scale") {
+	SC_NAME_CASE("Scale") {
 		_scValue->setFloat(_scale3D * 100.0f);
 		return _scValue;
 	}
@@ -336,7 +342,7 @@ ScValue *AdObject3D::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// DrawBackfaces
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "DrawBackfaces") {
+	SC_NAME_CASE("DrawBackfaces") {
 		_scValue->setBool(_drawBackfaces);
 		return _scValue;
 	}
@@ -344,7 +350,7 @@ ScValue *AdObject3D::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmbientLightColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AmbientLightColor") {
+	SC_NAME_CASE("AmbientLightColor") {
 		if (_hasAmbientLightColor) {
 			_scValue->setInt(_ambientLightColor);
 		} else {
@@ -354,39 +360,42 @@ ScValue *AdObject3D::scGetProperty(const Common::String &name) {
 		return _scValue;
 	}
 
-	else {
+	default:
+	unknownName: {
 		return AdObject::scGetProperty(name);
 	}
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////
 bool AdObject3D::scSetProperty(const char *name, ScValue *value) {
 
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Angle
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Angle") == 0) {
+	SC_NAME_CASE("Angle") {
 		_angle = value->getFloat();
 		return true;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// PosX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PosX") == 0) {
+	SC_NAME_CASE("PosX") {
 		_posVector.x() = value->getFloat();
 		return true;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// PosY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PosY") == 0) {
+	SC_NAME_CASE("PosY") {
 		_posVector.y() = value->getFloat();
 		return true;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// PosZ
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PosZ") == 0) {
+	SC_NAME_CASE("PosZ") {
 		// scripts will expect a Direct3D coordinate system
 		_posVector.z() = -value->getFloat();
 		return true;
@@ -395,7 +404,7 @@ bool AdObject3D::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// X
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "X") == 0) {
+	SC_NAME_CASE("X") {
 		_posX = value->getInt();
 		AdGame *adGame = (AdGame *)_gameRef;
 		Math::Vector3d pos;
@@ -408,7 +417,7 @@ bool AdObject3D::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Y
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Y") == 0) {
+	SC_NAME_CASE("Y") {
 		_posY = value->getInt();
 		AdGame *adGame = (AdGame *)_gameRef;
 		Math::Vector3d pos;
@@ -421,21 +430,22 @@ bool AdObject3D::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Velocity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Velocity") == 0) {
+	SC_NAME_CASE("Velocity") {
 		_velocity = value->getFloat();
 		return true;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// AngularVelocity / AngVelocity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AngularVelocity") == 0 || strcmp(name, "AngVelocity") == 0) {
+	SC_NAME_CASE("AngularVelocity")
+	SC_NAME_ALIAS("AngVelocity") {
 		_angVelocity = value->getFloat();
 		return true;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// DropToFloor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DropToFloor") == 0) {
+	SC_NAME_CASE("DropToFloor") {
 		_dropToFloor = value->getBool();
 		return true;
 	}
@@ -443,7 +453,7 @@ bool AdObject3D::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Shadow (obsolete)
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Shadow") == 0) {
+	SC_NAME_CASE("Shadow") {
 		if (value->getBool()) {
 			_shadowType = SHADOW_STENCIL;
 		} else {
@@ -455,7 +465,7 @@ bool AdObject3D::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ShadowType
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ShadowType") == 0) {
+	SC_NAME_CASE("ShadowType") {
 		_shadowType = (TShadowType)value->getInt();
 		if (_shadowType < 0) {
 			_shadowType = SHADOW_NONE;
@@ -471,7 +481,7 @@ bool AdObject3D::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SimpleShadow (obsolete)
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SimpleShadow") == 0) {
+	SC_NAME_CASE("SimpleShadow") {
 		if (value->getBool()) {
 			_shadowType = SHADOW_SIMPLE;
 		} else {
@@ -484,7 +494,7 @@ bool AdObject3D::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ShadowColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ShadowColor") == 0) {
+	SC_NAME_CASE("ShadowColor") {
 		_shadowColor = value->getInt();
 		return true;
 	}
@@ -492,7 +502,7 @@ bool AdObject3D::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Scale") == 0) {
+	SC_NAME_CASE("Scale") {
 		_scale3D = value->getFloat() / 100.0f;
 		return true;
 	}
@@ -500,7 +510,7 @@ bool AdObject3D::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// DrawBackfaces
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DrawBackfaces") == 0) {
+	SC_NAME_CASE("DrawBackfaces") {
 		_drawBackfaces = value->getBool();
 		return true;
 	}
@@ -508,7 +518,7 @@ bool AdObject3D::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmbientLightColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AmbientLightColor") == 0) {
+	SC_NAME_CASE("AmbientLightColor") {
 		if (value->isNULL()) {
 			_ambientLightColor = 0x00000000;
 			_hasAmbientLightColor = false;
@@ -519,9 +529,11 @@ bool AdObject3D::scSetProperty(const char *name, ScValue *value) {
 		return true;
 	}
 
-	else {
+	default:
+	unknownName: {
 		return AdObject::scSetProperty(name, value);
 	}
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -27,12 +27,15 @@
  */
 
 #include "engines/wintermute/ad/ad_region.h"
+#include "engines/wintermute/ad/ad_game.h"
+#include "engines/wintermute/ad/ad_scene.h"
 #include "engines/wintermute/base/base_dynamic_buffer.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/base/base_parser.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 
 namespace Wintermute {
 
@@ -263,10 +266,11 @@ bool AdRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *AdRegion::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("ad region");
 		return _scValue;
 	}
@@ -274,7 +278,7 @@ ScValue *AdRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Name") {
+	SC_NAME_CASE("Name") {
 		_scValue->setString(getName());
 		return _scValue;
 	}
@@ -282,7 +286,7 @@ ScValue *AdRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Blocked
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Blocked") {
+	SC_NAME_CASE("Blocked") {
 		_scValue->setBool(_blocked);
 		return _scValue;
 	}
@@ -290,7 +294,7 @@ ScValue *AdRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Decoration
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Decoration") {
+	SC_NAME_CASE("Decoration") {
 		_scValue->setBool(_decoration);
 		return _scValue;
 	}
@@ -298,7 +302,7 @@ ScValue *AdRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Scale") {
+	SC_NAME_CASE("Scale") {
 		_scValue->setFloat(_zoom);
 		return _scValue;
 	}
@@ -306,21 +310,25 @@ ScValue *AdRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AlphaColor") {
+	SC_NAME_CASE("AlphaColor") {
 		_scValue->setInt((int)_alpha);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseRegion::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool AdRegion::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	SC_NAME_CASE("Name") {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -328,23 +336,25 @@ bool AdRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Blocked
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Blocked") == 0) {
+	SC_NAME_CASE("Blocked") {
 		_blocked = value->getBool();
+		invalidateWalkGrid();
 		return STATUS_OK;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Decoration
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Decoration") == 0) {
+	SC_NAME_CASE("Decoration") {
 		_decoration = value->getBool();
+		invalidateWalkGrid();
 		return STATUS_OK;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Scale
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Scale") == 0) {
+	SC_NAME_CASE("Scale") {
 		_zoom = value->getFloat();
 		return STATUS_OK;
 	}
@@ -352,12 +362,40 @@ bool AdRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AlphaColor") == 0) {
+	SC_NAME_CASE("AlphaColor") {
 		_alpha = (uint32)value->getInt();
 		return STATUS_OK;
-	} else {
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Active
+	//////////////////////////////////////////////////////////////////////////
+	SC_NAME_CASE("Active") {
+		invalidateWalkGrid();
+		return BaseRegion::scSetProperty(name, value);
+	}
+	default:
+	unknownName: {
 		return BaseRegion::scSetProperty(name, value);
 	}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdRegion::createRegion() {
+	// Called whenever the points change
+	invalidateWalkGrid();
+	return BaseRegion::createRegion();
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdRegion::invalidateWalkGrid() {
+	AdScene *scene = ((AdGame *)_gameRef)->_scene;
+	if (scene) {
+		scene->invalidateWalkGrid();
+	}
 }
 
 
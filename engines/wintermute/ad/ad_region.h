@@ -42,6 +42,7 @@ public:
 	bool loadFile(const char *filename);
 	bool loadBuffer(char *buffer, bool complete = true);
 	bool saveAsText(BaseDynamicBuffer *buffer, int indent) override;
+	bool createRegion() override;
 
 	bool hasDecoration() const;
 	bool isBlocked() const;
@@ -53,6 +54,8 @@ public:
 	bool scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) override;
 	const char *scToString() override;
 private:
+	void invalidateWalkGrid();
+
 	uint32 _alpha;
 	float _zoom;
 	bool _blocked;
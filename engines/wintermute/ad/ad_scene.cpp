@@ -55,6 +55,7 @@
 #include "engines/wintermute/base/base_viewport.h"
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/ui/ui_window.h"
@@ -115,6 +116,8 @@ void AdScene::setDefaults() {
 #endif
 
 	_pfPointsNum = 0;
+	_walkGridWidth = _walkGridHeight = 0;
+	_walkGridDirty = true;
 	_persistentState = false;
 	_persistentStateSprites = true;
 
@@ -200,6 +203,10 @@ void AdScene::cleanup() {
 	}
 	_pfPath.clear();
 	_pfPointsNum = 0;
+	_pfOpen.clear();
+
+	_walkGrid.clear();
+	_walkGridDirty = true;
 
 	for (uint32 i = 0; i < _objects.size(); i++) {
 		_gameRef->unregisterObject(_objects[i]);
@@ -229,6 +236,8 @@ bool AdScene::getPath(const BasePoint &source, const BasePoint &target, AdPath *
 		_pfTargetPath->reset();
 		_pfTargetPath->setReady(false);
 
+		updateWalkGrid();
+
 		// prepare working path
 		pfPointsStart();
 
@@ -239,11 +248,11 @@ bool AdScene::getPath(const BasePoint &source, const BasePoint &target, AdPath *
 		int startX = source.x;
 		int startY = source.y;
 		int bestDistance = 1000;
-		if (isBlockedAt(startX, startY, true, requester)) {
+		if (blockedAt(startX, startY, true, requester)) {
 			int tolerance = 2;
 			for (int xxx = startX - tolerance; xxx <= startX + tolerance; xxx++) {
 				for (int yyy = startY - tolerance; yyy <= startY + tolerance; yyy++) {
-					if (isWalkableAt(xxx, yyy, true, requester)) {
+					if (!blockedAt(xxx, yyy, true, requester)) {
 						int distance = abs(xxx - source.x) + abs(yyy - source.y);
 						if (distance < bestDistance) {
 							startX = xxx;
@@ -285,6 +294,13 @@ bool AdScene::getPath(const BasePoint &source, const BasePoint &target, AdPath *
 			}
 		}
 
+		// Search right away, the path is usually found in much less time than the
+		// frame allows; otherwise the search goes on in the next frames
+		uint32 start = _gameRef->_currentTime;
+		while (!_pfReady && g_system->getMillis() - start <= _pfMaxTime) {
+			pathFinderStep();
+		}
+
 		return true;
 	}
 }
@@ -297,7 +313,7 @@ void AdScene::pfAddWaypointGroup(AdWaypointGroup *wpt, BaseObject *requester) {
 	}
 
 	for (uint32 i = 0; i < wpt->_points.size(); i++) {
-		if (isBlockedAt(wpt->_points[i]->x, wpt->_points[i]->y, true, requester)) {
+		if (blockedAt(wpt->_points[i]->x, wpt->_points[i]->y, true, requester)) {
 			continue;
 		}
 
@@ -362,8 +378,21 @@ uint32 AdScene::getAlphaAt(int x, int y, bool colorCheck) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
-	bool ret = true;
+	updateWalkGrid();
+	return blockedAt(x, y, checkFreeObjects, requester);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
+	// The pixels which aren't blocked are walkable
+	updateWalkGrid();
+	return !blockedAt(x, y, checkFreeObjects, requester);
+}
+
 
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::blockedAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
 	if (checkFreeObjects) {
 		for (uint32 i = 0; i < _objects.size(); i++) {
 			if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
@@ -382,17 +411,33 @@ bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *reque
 		}
 	}
 
+	if (x < 0 || y < 0 || x >= _walkGridWidth || y >= _walkGridHeight) {
+		return regionsBlockAt(x, y);
+	}
+
+	if (_walkGrid.empty()) {
+		_walkGrid.resize(((uint32)_walkGridWidth * _walkGridHeight + 3) / 4);
+	}
+	uint32 index = (uint32)y * _walkGridWidth + x;
+	byte &cell = _walkGrid[index / 4];
+	int shift = (index % 4) * 2;
+	// 0 for the pixels not tested yet, 1 for the walkable ones and 2 for the blocked ones
+	int state = (cell >> shift) & 3;
+	if (state == 0) {
+		state = regionsBlockAt(x, y) ? 2 : 1;
+		cell |= state << shift;
+	}
+	return state == 2;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::regionsBlockAt(int x, int y) {
+	bool ret = true;
 
 	if (_mainLayer) {
 		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
 			AdSceneNode *node = _mainLayer->_nodes[i];
-			/*
-			if (Node->_type == OBJECT_REGION && Node->_region->_active && Node->_region->_blocked && Node->_region->PointInRegion(X, Y))
-			{
-			    ret = true;
-			    break;
-			}
-			*/
 			if (node->_type == OBJECT_REGION && node->_region->_active && !node->_region->hasDecoration() && node->_region->pointInRegion(x, y)) {
 				if (node->_region->isBlocked()) {
 					ret = true;
@@ -408,42 +453,20 @@ bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *reque
 
 
 //////////////////////////////////////////////////////////////////////////
-bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
-	bool ret = false;
-
-	if (checkFreeObjects) {
-		for (uint32 i = 0; i < _objects.size(); i++) {
-			if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
-				if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return false;
-				}
-			}
-		}
-		AdGame *adGame = (AdGame *)_gameRef;
-		for (uint32 i = 0; i < adGame->_objects.size(); i++) {
-			if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
-				if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return false;
-				}
-			}
-		}
+void AdScene::updateWalkGrid() {
+	if (!_walkGridDirty) {
+		return;
 	}
+	_walkGridDirty = false;
+	_walkGrid.clear();
+	_walkGridWidth = _mainLayer ? _mainLayer->_width : 0;
+	_walkGridHeight = _mainLayer ? _mainLayer->_height : 0;
+}
 
 
-	if (_mainLayer) {
-		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
-			AdSceneNode *node = _mainLayer->_nodes[i];
-			if (node->_type == OBJECT_REGION && node->_region->_active && !node->_region->hasDecoration() && node->_region->pointInRegion(x, y)) {
-				if (node->_region->isBlocked()) {
-					ret = false;
-					break;
-				} else {
-					ret = true;
-				}
-			}
-		}
-	}
-	return ret;
+//////////////////////////////////////////////////////////////////////////
+void AdScene::invalidateWalkGrid() {
+	_walkGridDirty = true;
 }
 
 
@@ -471,7 +494,7 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 		y = y1;
 
 		for (xCount = x1; xCount < x2; xCount++) {
-			if (isBlockedAt(xCount, (int)y, true, requester)) {
+			if (blockedAt(xCount, (int)y, true, requester)) {
 				return -1;
 			}
 			y += yStep;
@@ -486,7 +509,7 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 		x = x1;
 
 		for (yCount = y1; yCount < y2; yCount++) {
-			if (isBlockedAt((int)x, yCount, true, requester)) {
+			if (blockedAt((int)x, yCount, true, requester)) {
 				return -1;
 			}
 			x += xStep;
@@ -497,17 +520,91 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 
 
 //////////////////////////////////////////////////////////////////////////
-void AdScene::pathFinderStep() {
-	int i;
-	// get lowest unmarked
-	int lowestDist = INT_MAX_VALUE;
-	AdPathPoint *lowestPt = nullptr;
+// The length of the line between the points, which getPointsDist() returns
+// when nothing blocks it
+static int pfLineLength(const BasePoint &p1, const BasePoint &p2) {
+	return MAX(abs(p2.x - p1.x), abs(p2.y - p1.y));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+int AdScene::pfGetCost(int index) {
+	AdPathPoint *point = _pfPath[index];
+	return point->_distance + pfLineLength(*point, *_pfTarget);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfOpenAdd(int index) {
+	PathFinderNode node;
+	node._cost = pfGetCost(index);
+	node._index = index;
+
+	uint32 pos = _pfOpen.size();
+	_pfOpen.push_back(node);
+	while (pos > 0) {
+		uint32 parent = (pos - 1) / 2;
+		if (!node.before(_pfOpen[parent])) {
+			break;
+		}
+		_pfOpen[pos] = _pfOpen[parent];
+		pos = parent;
+	}
+	_pfOpen[pos] = node;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+AdPathPoint *AdScene::pfOpenTakeLowest() {
+	// The points are added again when they get closer, their previous nodes are skipped
+	while (!_pfOpen.empty()) {
+		PathFinderNode lowest = _pfOpen[0];
+		PathFinderNode last = _pfOpen.back();
+		_pfOpen.pop_back();
+
+		uint32 size = _pfOpen.size();
+		if (size > 0) {
+			uint32 pos = 0;
+			while (2 * pos + 1 < size) {
+				uint32 child = 2 * pos + 1;
+				if (child + 1 < size && _pfOpen[child + 1].before(_pfOpen[child])) {
+					child++;
+				}
+				if (!_pfOpen[child].before(last)) {
+					break;
+				}
+				_pfOpen[pos] = _pfOpen[child];
+				pos = child;
+			}
+			_pfOpen[pos] = last;
+		}
 
-	for (i = 0; i < _pfPointsNum; i++)
-		if (!_pfPath[i]->_marked && _pfPath[i]->_distance < lowestDist) {
-			lowestDist = _pfPath[i]->_distance;
-			lowestPt = _pfPath[i];
+		if (!_pfPath[lowest._index]->_marked && lowest._cost == pfGetCost(lowest._index)) {
+			return _pfPath[lowest._index];
 		}
+	}
+	return nullptr;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfOpenRebuild() {
+	_pfOpen.clear();
+	if (_pfReady) {
+		return;
+	}
+	for (int i = 0; i < _pfPointsNum; i++) {
+		if (!_pfPath[i]->_marked && _pfPath[i]->_distance < INT_MAX_VALUE) {
+			pfOpenAdd(i);
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pathFinderStep() {
+	// get lowest unmarked
+	AdPathPoint *lowestPt = pfOpenTakeLowest();
 
 	if (lowestPt == nullptr) { // no path -> terminate PathFinder
 		_pfReady = true;
@@ -526,23 +623,33 @@ void AdScene::pathFinderStep() {
 
 		_pfReady = true;
 		_pfTargetPath->setReady(true);
+		_pfOpen.clear();
 		return;
 	}
 
-	// otherwise keep on searching
-	for (i = 0; i < _pfPointsNum; i++)
-		if (!_pfPath[i]->_marked) {
-			int j = getPointsDist(*lowestPt, *_pfPath[i], _pfRequester);
-			if (j != -1 && lowestPt->_distance + j < _pfPath[i]->_distance) {
-				_pfPath[i]->_distance = lowestPt->_distance + j;
-				_pfPath[i]->_origin = lowestPt;
+	// otherwise keep on searching, without following the lines which
+	// couldn't get the points any closer even if nothing blocked them
+	for (int i = 0; i < _pfPointsNum; i++) {
+		AdPathPoint *point = _pfPath[i];
+		if (!point->_marked && lowestPt->_distance + pfLineLength(*lowestPt, *point) < point->_distance) {
+			int j = getPointsDist(*lowestPt, *point, _pfRequester);
+			if (j != -1 && lowestPt->_distance + j < point->_distance) {
+				point->_distance = lowestPt->_distance + j;
+				point->_origin = lowestPt;
+				pfOpenAdd(i);
 			}
 		}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::initLoop() {
+	if (!_pfReady) {
+		// The regions may have changed since the previous frame
+		updateWalkGrid();
+	}
+
 #ifdef _DEBUGxxxx
 	int nu_steps = 0;
 	uint32 start = _gameRef->_currentTime;
@@ -743,6 +850,7 @@ bool AdScene::loadBuffer(char *buffer, bool complete) {
 				_layers.add(layer);
 				if (layer->_main) {
 					_mainLayer = layer;
+					_walkGridDirty = true;
 					_width = layer->_width;
 					_height = layer->_height;
 				}
@@ -1529,10 +1637,11 @@ void AdScene::skipTo(int offsetX, int offsetY) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// LoadActor
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "LoadActor") == 0) {
+	SC_NAME_CASE("LoadActor") {
 		stack->correctParams(1);
 		AdActor *act = new AdActor(_gameRef);
 		if (act && DID_SUCCEED(act->loadFile(stack->pop()->getString()))) {
@@ -1550,7 +1659,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadActor3D
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "LoadActor3D") == 0) {
+	SC_NAME_CASE("LoadActor3D") {
 		stack->correctParams(1);
 		AdActor3DX *act = new AdActor3DX(_gameRef);
 		if (act && DID_SUCCEED(act->loadFile(stack->pop()->getString()))) {
@@ -1567,7 +1676,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadEntity") == 0) {
+	SC_NAME_CASE("LoadEntity") {
 		stack->correctParams(1);
 		AdEntity *ent = new AdEntity(_gameRef);
 		if (ent && DID_SUCCEED(ent->loadFile(stack->pop()->getString()))) {
@@ -1584,7 +1693,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// CreateEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateEntity") == 0) {
+	SC_NAME_CASE("CreateEntity") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -1600,7 +1709,11 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// UnloadObject / UnloadActor / UnloadEntity / UnloadActor3D / DeleteEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UnloadObject") == 0 || strcmp(name, "UnloadActor") == 0 || strcmp(name, "UnloadEntity") == 0 || strcmp(name, "UnloadActor3D") == 0 || strcmp(name, "DeleteEntity") == 0) {
+	SC_NAME_CASE("UnloadObject")
+	SC_NAME_ALIAS("UnloadActor")
+	SC_NAME_ALIAS("UnloadEntity")
+	SC_NAME_ALIAS("UnloadActor3D")
+	SC_NAME_ALIAS("DeleteEntity") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		AdObject *obj = (AdObject *)val->getNative();
@@ -1616,7 +1729,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SkipTo
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SkipTo") == 0) {
+	SC_NAME_CASE("SkipTo") {
 		stack->correctParams(2);
 		ScValue *val1 = stack->pop();
 		ScValue *val2 = stack->pop();
@@ -1632,7 +1745,8 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollTo / ScrollToAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScrollTo") == 0 || strcmp(name, "ScrollToAsync") == 0) {
+	SC_NAME_CASE("ScrollTo")
+	SC_NAME_ALIAS("ScrollToAsync") {
 		stack->correctParams(2);
 		ScValue *val1 = stack->pop();
 		ScValue *val2 = stack->pop();
@@ -1651,7 +1765,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetLayer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetLayer") == 0) {
+	SC_NAME_CASE("GetLayer") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		if (val->isInt()) {
@@ -1681,7 +1795,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetWaypointGroup
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetWaypointGroup") == 0) {
+	SC_NAME_CASE("GetWaypointGroup") {
 		stack->correctParams(1);
 		int group = stack->pop()->getInt();
 		if (group < 0 || group >= (int32)_waypointGroups.size()) {
@@ -1695,7 +1809,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetNode
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetNode") == 0) {
+	SC_NAME_CASE("GetNode") {
 		stack->correctParams(1);
 		const char *nodeName = stack->pop()->getString();
 
@@ -1724,7 +1838,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetFreeNode
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFreeNode") == 0) {
+	SC_NAME_CASE("GetFreeNode") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -1755,7 +1869,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetRegionAt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetRegionAt") == 0) {
+	SC_NAME_CASE("GetRegionAt") {
 		stack->correctParams(3);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1786,7 +1900,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// IsBlockedAt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsBlockedAt") == 0) {
+	SC_NAME_CASE("IsBlockedAt") {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1798,7 +1912,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// IsWalkableAt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsWalkableAt") == 0) {
+	SC_NAME_CASE("IsWalkableAt") {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1810,7 +1924,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetScaleAt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetScaleAt") == 0) {
+	SC_NAME_CASE("GetScaleAt") {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1822,7 +1936,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetRotationAt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetRotationAt") == 0) {
+	SC_NAME_CASE("GetRotationAt") {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1834,7 +1948,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// IsScrolling
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsScrolling") == 0) {
+	SC_NAME_CASE("IsScrolling") {
 		stack->correctParams(0);
 		bool ret = false;
 		if (_autoScroll) {
@@ -1850,7 +1964,8 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// FadeOut / FadeOutAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeOut") == 0 || strcmp(name, "FadeOutAsync") == 0) {
+	SC_NAME_CASE("FadeOut")
+	SC_NAME_ALIAS("FadeOutAsync") {
 		stack->correctParams(5);
 		uint32 duration = stack->pop()->getInt(500);
 		byte red = stack->pop()->getInt(0);
@@ -1870,7 +1985,8 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// FadeIn / FadeInAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeIn") == 0 || strcmp(name, "FadeInAsync") == 0) {
+	SC_NAME_CASE("FadeIn")
+	SC_NAME_ALIAS("FadeInAsync") {
 		stack->correctParams(5);
 		uint32 duration = stack->pop()->getInt(500);
 		byte red = stack->pop()->getInt(0);
@@ -1890,7 +2006,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetFadeColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFadeColor") == 0) {
+	SC_NAME_CASE("GetFadeColor") {
 		stack->correctParams(0);
 		stack->pushInt(_fader->getCurrentColor());
 		return STATUS_OK;
@@ -1899,7 +2015,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// IsPointInViewport
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsPointInViewport") == 0) {
+	SC_NAME_CASE("IsPointInViewport") {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -1911,7 +2027,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// EnableNode3D
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EnableNode3D") == 0) {
+	SC_NAME_CASE("EnableNode3D") {
 		stack->correctParams(1);
 		const char *nodeName = stack->pop()->getString();
 
@@ -1929,7 +2045,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// DisableNode3D
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DisableNode3D") == 0) {
+	SC_NAME_CASE("DisableNode3D") {
 		stack->correctParams(1);
 		const char *nodeName = stack->pop()->getString();
 
@@ -1947,7 +2063,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// IsNode3DEnabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsNode3DEnabled") == 0) {
+	SC_NAME_CASE("IsNode3DEnabled") {
 		stack->correctParams(1);
 		const char *nodeName = stack->pop()->getString();
 
@@ -1965,7 +2081,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// EnableLight
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EnableLight") == 0) {
+	SC_NAME_CASE("EnableLight") {
 		stack->correctParams(1);
 
 		const char *lightName = stack->pop()->getString();
@@ -1983,7 +2099,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// DisableLight
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DisableLight") == 0) {
+	SC_NAME_CASE("DisableLight") {
 		stack->correctParams(1);
 
 		const char *lightName = stack->pop()->getString();
@@ -2001,7 +2117,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// IsLightEnabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsLightEnabled") == 0) {
+	SC_NAME_CASE("IsLightEnabled") {
 		stack->correctParams(1);
 
 		const char *lightName = stack->pop()->getString();
@@ -2019,7 +2135,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetLightName
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetLightName") == 0) {
+	SC_NAME_CASE("GetLightName") {
 		stack->correctParams(1);
 
 		int index = stack->pop()->getInt();
@@ -2036,7 +2152,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetLightColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetLightColor") == 0) {
+	SC_NAME_CASE("SetLightColor") {
 		stack->correctParams(2);
 
 		const char *lightName = stack->pop()->getString();
@@ -2055,7 +2171,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetLightColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetLightColor") == 0) {
+	SC_NAME_CASE("GetLightColor") {
 		stack->correctParams(1);
 		const char *lightName = stack->pop()->getString();
 
@@ -2071,7 +2187,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetLightPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetLightPosition") == 0) {
+	SC_NAME_CASE("GetLightPosition") {
 		stack->correctParams(1);
 		const char *lightName = stack->pop()->getString();
 
@@ -2095,7 +2211,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetActiveCamera
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetActiveCamera") == 0) {
+	SC_NAME_CASE("SetActiveCamera") {
 		stack->correctParams(1);
 
 		const char *cameraName = stack->pop()->getString();
@@ -2118,7 +2234,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// EnableFog
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EnableFog") == 0) {
+	SC_NAME_CASE("EnableFog") {
 		stack->correctParams(3);
 		_fogParameters._enabled = true;
 		_fogParameters._color = stack->pop()->getInt();
@@ -2132,7 +2248,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// DisableFog
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DisableFog") == 0) {
+	SC_NAME_CASE("DisableFog") {
 		stack->correctParams(0);
 		_fogParameters._enabled = false;
 
@@ -2144,7 +2260,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetViewport
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetViewport") == 0) {
+	SC_NAME_CASE("SetViewport") {
 		stack->correctParams(4);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -2173,7 +2289,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// AddLayer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddLayer") == 0) {
+	SC_NAME_CASE("AddLayer") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -2195,7 +2311,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// InsertLayer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InsertLayer") == 0) {
+	SC_NAME_CASE("InsertLayer") {
 		stack->correctParams(2);
 		int index = stack->pop()->getInt();
 		ScValue *val = stack->pop();
@@ -2226,7 +2342,7 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteLayer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteLayer") == 0) {
+	SC_NAME_CASE("DeleteLayer") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -2266,28 +2382,11 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 		stack->pushBool(true);
 		return STATUS_OK;
 	}
-
-#ifdef ENABLE_WME3D
-	//////////////////////////////////////////////////////////////////////////
-	// EnableFog
-	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EnableFog") == 0) {
-		stack->correctParams(3);
-		stack->pushNULL();
-		return STATUS_OK;
-	}
-
-	//////////////////////////////////////////////////////////////////////////
-	// DisableFog
-	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DisableFog") == 0) {
-		stack->correctParams(0);
-		stack->pushNULL();
-		return STATUS_OK;
-	} else {
+	default:
+	unknownName: {
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
-#endif
+	}
 }
 
 
@@ -2295,10 +2394,11 @@ bool AdScene::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *AdScene::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("scene");
 		return _scValue;
 	}
@@ -2306,7 +2406,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumLayers (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumLayers") {
+	SC_NAME_CASE("NumLayers") {
 		_scValue->setInt(_layers.size());
 		return _scValue;
 	}
@@ -2314,7 +2414,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumWaypointGroups (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumWaypointGroups") {
+	SC_NAME_CASE("NumWaypointGroups") {
 		_scValue->setInt(_waypointGroups.size());
 		return _scValue;
 	}
@@ -2322,7 +2422,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MainLayer (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MainLayer") {
+	SC_NAME_CASE("MainLayer") {
 		if (_mainLayer) {
 			_scValue->setNative(_mainLayer, true);
 		} else {
@@ -2335,7 +2435,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumFreeNodes (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumFreeNodes") {
+	SC_NAME_CASE("NumFreeNodes") {
 		_scValue->setInt(_objects.size());
 		return _scValue;
 	}
@@ -2343,7 +2443,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MouseX (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MouseX") {
+	SC_NAME_CASE("MouseX") {
 		int32 viewportX;
 		getViewportOffset(&viewportX);
 
@@ -2354,7 +2454,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MouseY (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MouseY") {
+	SC_NAME_CASE("MouseY") {
 		int32 viewportY;
 		getViewportOffset(nullptr, &viewportY);
 
@@ -2365,7 +2465,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutoScroll
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AutoScroll") {
+	SC_NAME_CASE("AutoScroll") {
 		_scValue->setBool(_autoScroll);
 		return _scValue;
 	}
@@ -2374,7 +2474,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ShowGeometry
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ShowGeometry") {
+	SC_NAME_CASE("ShowGeometry") {
 		_scValue->setBool(_showGeometry);
 		return _scValue;
 	}
@@ -2383,7 +2483,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PersistentState
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PersistentState") {
+	SC_NAME_CASE("PersistentState") {
 		_scValue->setBool(_persistentState);
 		return _scValue;
 	}
@@ -2391,7 +2491,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PersistentStateSprites
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PersistentStateSprites") {
+	SC_NAME_CASE("PersistentStateSprites") {
 		_scValue->setBool(_persistentStateSprites);
 		return _scValue;
 	}
@@ -2399,7 +2499,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollPixelsX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScrollPixelsX") {
+	SC_NAME_CASE("ScrollPixelsX") {
 		_scValue->setInt(_scrollPixelsH);
 		return _scValue;
 	}
@@ -2407,7 +2507,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollPixelsY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScrollPixelsY") {
+	SC_NAME_CASE("ScrollPixelsY") {
 		_scValue->setInt(_scrollPixelsV);
 		return _scValue;
 	}
@@ -2416,7 +2516,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollSpeedX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScrollSpeedX") {
+	SC_NAME_CASE("ScrollSpeedX") {
 		_scValue->setInt(_scrollTimeH);
 		return _scValue;
 	}
@@ -2424,7 +2524,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollSpeedY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScrollSpeedY") {
+	SC_NAME_CASE("ScrollSpeedY") {
 		_scValue->setInt(_scrollTimeV);
 		return _scValue;
 	}
@@ -2432,7 +2532,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// OffsetX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "OffsetX") {
+	SC_NAME_CASE("OffsetX") {
 		_scValue->setInt(_offsetLeft);
 		return _scValue;
 	}
@@ -2440,7 +2540,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// OffsetY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "OffsetY") {
+	SC_NAME_CASE("OffsetY") {
 		_scValue->setInt(_offsetTop);
 		return _scValue;
 	}
@@ -2449,7 +2549,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// GeometryFile
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "GeometryFile") {
+	SC_NAME_CASE("GeometryFile") {
 		if (_sceneGeometry && _sceneGeometry->getFilename()) {
 			_scValue->setString(_sceneGeometry->getFilename());
 		} else {
@@ -2462,7 +2562,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WaypointsHeight
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WaypointsHeight") {
+	SC_NAME_CASE("WaypointsHeight") {
 		if (_sceneGeometry) {
 			_scValue->setFloat(_sceneGeometry->_waypointHeight);
 		} else {
@@ -2476,7 +2576,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Width (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Width") {
+	SC_NAME_CASE("Width") {
 		if (_mainLayer) {
 			_scValue->setInt(_mainLayer->_width);
 		} else {
@@ -2489,7 +2589,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxShadowType
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MaxShadowType") {
+	SC_NAME_CASE("MaxShadowType") {
 		_scValue->setInt(_maxShadowType);
 		return _scValue;
 	}
@@ -2497,7 +2597,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmbientLightColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AmbientLightColor") {
+	SC_NAME_CASE("AmbientLightColor") {
 		_scValue->setInt(_ambientLightColor);
 		return _scValue;
 	}
@@ -2505,7 +2605,7 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumLights
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumLights") {
+	SC_NAME_CASE("NumLights") {
 		if (_sceneGeometry) {
 			_scValue->setInt(_sceneGeometry->_lights.size());
 		} else {
@@ -2519,25 +2619,29 @@ ScValue *AdScene::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Height (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Height") {
+	SC_NAME_CASE("Height") {
 		if (_mainLayer) {
 			_scValue->setInt(_mainLayer->_height);
 		} else {
 			_scValue->setInt(0);
 		}
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	SC_NAME_CASE("Name") {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -2545,7 +2649,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutoScroll
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AutoScroll") == 0) {
+	SC_NAME_CASE("AutoScroll") {
 		_autoScroll = value->getBool();
 		return STATUS_OK;
 	}
@@ -2554,7 +2658,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ShowGeometry
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ShowGeometry") == 0) {
+	SC_NAME_CASE("ShowGeometry") {
 		_showGeometry = value->getBool();
 		return _scValue;
 	}
@@ -2563,7 +2667,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// PersistentState
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PersistentState") == 0) {
+	SC_NAME_CASE("PersistentState") {
 		_persistentState = value->getBool();
 		return STATUS_OK;
 	}
@@ -2571,7 +2675,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// PersistentStateSprites
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PersistentStateSprites") == 0) {
+	SC_NAME_CASE("PersistentStateSprites") {
 		_persistentStateSprites = value->getBool();
 		return STATUS_OK;
 	}
@@ -2579,7 +2683,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollPixelsX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScrollPixelsX") == 0) {
+	SC_NAME_CASE("ScrollPixelsX") {
 		_scrollPixelsH = value->getInt();
 		return STATUS_OK;
 	}
@@ -2587,7 +2691,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollPixelsY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScrollPixelsY") == 0) {
+	SC_NAME_CASE("ScrollPixelsY") {
 		_scrollPixelsV = value->getInt();
 		return STATUS_OK;
 	}
@@ -2595,7 +2699,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollSpeedX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScrollSpeedX") == 0) {
+	SC_NAME_CASE("ScrollSpeedX") {
 		_scrollTimeH = value->getInt();
 		if (_scrollTimeH == 0) {
 			warning("_scrollTimeH can't be 0, resetting to default");
@@ -2607,7 +2711,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScrollSpeedY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScrollSpeedY") == 0) {
+	SC_NAME_CASE("ScrollSpeedY") {
 		_scrollTimeV = value->getInt();
 		if (_scrollTimeV == 0) {
 			warning("_scrollTimeV can't be 0, resetting to default");
@@ -2619,7 +2723,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// OffsetX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "OffsetX") == 0) {
+	SC_NAME_CASE("OffsetX") {
 		_offsetLeft = value->getInt();
 
 		int32 viewportWidth, viewportHeight;
@@ -2635,7 +2739,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// OffsetY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "OffsetY") == 0) {
+	SC_NAME_CASE("OffsetY") {
 		_offsetTop = value->getInt();
 
 		int32 viewportWidth, viewportHeight;
@@ -2653,7 +2757,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// WaypointsHeight
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WaypointsHeight") == 0) {
+	SC_NAME_CASE("WaypointsHeight") {
 		if (_sceneGeometry) {
 			_sceneGeometry->_waypointHeight = value->getFloat();
 			_sceneGeometry->dropWaypoints();
@@ -2665,7 +2769,7 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxShadowType
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MaxShadowType") == 0) {
+	SC_NAME_CASE("MaxShadowType") {
 		setMaxShadowType(static_cast<TShadowType>(value->getInt()));
 		return STATUS_OK;
 	}
@@ -2673,15 +2777,17 @@ bool AdScene::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AmbientLightColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AmbientLightColor") == 0) {
+	SC_NAME_CASE("AmbientLightColor") {
 		_ambientLightColor = value->getInt();
 		return STATUS_OK;
 	}
 #endif
 
-	else {
+	default:
+	unknownName: {
 		return BaseObject::scSetProperty(name, value);
 	}
+	}
 }
 
 
@@ -2986,6 +3092,9 @@ bool AdScene::persist(BasePersistenceManager *persistMgr) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::afterLoad() {
+	pfOpenRebuild();
+	_walkGridDirty = true;
+
 #ifdef ENABLE_WME3D
 	if (_sceneGeometry) {
 		int activeCamera = _sceneGeometry->_activeCamera;
@@ -3004,6 +3113,8 @@ bool AdScene::correctTargetPoint2(int32 startX, int32 startY, int32 *targetX, in
 	int32 xLength, yLength, xCount, yCount;
 	int32 x1, y1, x2, y2;
 
+	updateWalkGrid();
+
 	x1 = *targetX;
 	y1 = *targetY;
 	x2 = startX;
@@ -3019,7 +3130,7 @@ bool AdScene::correctTargetPoint2(int32 startX, int32 startY, int32 *targetX, in
 		y = y1;
 
 		for (xCount = x1; xCount < x2; xCount++) {
-			if (isWalkableAt(xCount, (int)y, checkFreeObjects, requester)) {
+			if (!blockedAt(xCount, (int)y, checkFreeObjects, requester)) {
 				*targetX = xCount;
 				*targetY = (int)y;
 				return STATUS_OK;
@@ -3032,7 +3143,7 @@ bool AdScene::correctTargetPoint2(int32 startX, int32 startY, int32 *targetX, in
 		x = x1;
 
 		for (yCount = y1; yCount < y2; yCount++) {
-			if (isWalkableAt((int)x, yCount, checkFreeObjects, requester)) {
+			if (!blockedAt((int)x, yCount, checkFreeObjects, requester)) {
 				*targetX = (int)x;
 				*targetY = yCount;
 				return STATUS_OK;
@@ -3049,7 +3160,8 @@ bool AdScene::correctTargetPoint(int32 startX, int32 startY, int32 *argX, int32
 	int32 x = *argX;
 	int32 y = *argY;
 
-	if (isWalkableAt(x, y, checkFreeObjects, requester) || !_mainLayer) {
+	updateWalkGrid();
+	if (!blockedAt(x, y, checkFreeObjects, requester) || !_mainLayer) {
 		return STATUS_OK;
 	}
 
@@ -3057,7 +3169,7 @@ bool AdScene::correctTargetPoint(int32 startX, int32 startY, int32 *argX, int32
 	int lengthRight = 0;
 	bool foundRight = false;
 	for (x = *argX, y = *argY; x < _mainLayer->_width; x++, lengthRight++) {
-		if (isWalkableAt(x, y, checkFreeObjects, requester) && isWalkableAt(x - 5, y, checkFreeObjects, requester)) {
+		if (!blockedAt(x, y, checkFreeObjects, requester) && !blockedAt(x - 5, y, checkFreeObjects, requester)) {
 			foundRight = true;
 			break;
 		}
@@ -3067,7 +3179,7 @@ bool AdScene::correctTargetPoint(int32 startX, int32 startY, int32 *argX, int32
 	int lengthLeft = 0;
 	bool foundLeft = false;
 	for (x = *argX, y = *argY; x >= 0; x--, lengthLeft--) {
-		if (isWalkableAt(x, y, checkFreeObjects, requester) && isWalkableAt(x + 5, y, checkFreeObjects, requester)) {
+		if (!blockedAt(x, y, checkFreeObjects, requester) && !blockedAt(x + 5, y, checkFreeObjects, requester)) {
 			foundLeft = true;
 			break;
 		}
@@ -3077,7 +3189,7 @@ bool AdScene::correctTargetPoint(int32 startX, int32 startY, int32 *argX, int32
 	int lengthUp = 0;
 	bool foundUp = false;
 	for (x = *argX, y = *argY; y >= 0; y--, lengthUp--) {
-		if (isWalkableAt(x, y, checkFreeObjects, requester) && isWalkableAt(x, y + 5, checkFreeObjects, requester)) {
+		if (!blockedAt(x, y, checkFreeObjects, requester) && !blockedAt(x, y + 5, checkFreeObjects, requester)) {
 			foundUp = true;
 			break;
 		}
@@ -3087,7 +3199,7 @@ bool AdScene::correctTargetPoint(int32 startX, int32 startY, int32 *argX, int32
 	int lengthDown = 0;
 	bool foundDown = false;
 	for (x = *argX, y = *argY; y < _mainLayer->_height; y++, lengthDown++) {
-		if (isWalkableAt(x, y, checkFreeObjects, requester) && isWalkableAt(x, y - 5, checkFreeObjects, requester)) {
+		if (!blockedAt(x, y, checkFreeObjects, requester) && !blockedAt(x, y - 5, checkFreeObjects, requester)) {
 			foundDown = true;
 			break;
 		}
@@ -3129,7 +3241,7 @@ bool AdScene::correctTargetPoint(int32 startX, int32 startY, int32 *argX, int32
 		*argY = *argY + offsetY;
 	}
 
-	if (!isWalkableAt(*argX, *argY)) {
+	if (blockedAt(*argX, *argY, false, nullptr)) {
 		return correctTargetPoint2(startX, startY, argX, argY, checkFreeObjects, requester);
 	} else {
 		return STATUS_OK;
@@ -3140,6 +3252,7 @@ bool AdScene::correctTargetPoint(int32 startX, int32 startY, int32 *argX, int32
 //////////////////////////////////////////////////////////////////////////
 void AdScene::pfPointsStart() {
 	_pfPointsNum = 0;
+	_pfOpen.resize(0);
 }
 
 
@@ -3155,6 +3268,9 @@ void AdScene::pfPointsAdd(int x, int y, int distance) {
 		_pfPath[_pfPointsNum]->_origin = nullptr;
 	}
 
+	if (distance < INT_MAX_VALUE) {
+		pfOpenAdd(_pfPointsNum);
+	}
 	_pfPointsNum++;
 }
 
@@ -3350,6 +3466,7 @@ bool AdScene::persistState(bool saving) {
 						nodeState->_active = node->_region->_active;
 					} else {
 						node->_region->_active = nodeState->_active;
+						_walkGridDirty = true;
 					}
 				}
 				break;
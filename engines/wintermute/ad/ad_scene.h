@@ -133,6 +133,8 @@ public:
 	void pathFinderStep();
 	bool isBlockedAt(int x, int y, bool checkFreeObjects = false, BaseObject *requester = nullptr);
 	bool isWalkableAt(int x, int y, bool checkFreeObjects = false, BaseObject *requester = nullptr);
+	// To be called when the regions of the main layer change
+	void invalidateWalkGrid();
 	AdLayer *_mainLayer;
 	float getZoomAt(int x, int y);
 	bool getPath(const BasePoint &source, const BasePoint &target, AdPath *path, BaseObject *requester = nullptr);
@@ -193,6 +195,34 @@ private:
 	BaseObject *_pfRequester;
 	BaseArray<AdPathPoint *> _pfPath;
 
+	// The points of _pfPath reached but not marked yet, as a binary heap ordered
+	// by their distance plus the shortest distance left to the target
+	struct PathFinderNode {
+		int32 _cost;
+		int32 _index;
+
+		// Points of equal cost are taken in the order of _pfPath
+		bool before(const PathFinderNode &other) const {
+			return _cost < other._cost || (_cost == other._cost && _index < other._index);
+		}
+	};
+	Common::Array<PathFinderNode> _pfOpen;
+	int pfGetCost(int index);
+	void pfOpenAdd(int index);
+	AdPathPoint *pfOpenTakeLowest();
+	void pfOpenRebuild();
+
+	// Whether the regions of the main layer block the pixels, two bits per pixel,
+	// filled as the pixels are tested. It is dropped when the main layer or its
+	// regions change.
+	Common::Array<byte> _walkGrid;
+	int32 _walkGridWidth;
+	int32 _walkGridHeight;
+	bool _walkGridDirty;
+	void updateWalkGrid();
+	bool blockedAt(int x, int y, bool checkFreeObjects, BaseObject *requester);
+	bool regionsBlockAt(int x, int y);
+
 	int32 _offsetTop;
 	int32 _offsetLeft;
 
@@ -35,6 +35,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_ext_array.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/platform_osystem.h"
 #include "common/str.h"
 
@@ -125,10 +126,11 @@ BaseSprite *AdTalkHolder::getTalkStance(const char *stance) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetSprite
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetSprite") == 0) {
+	SC_NAME_CASE("SetSprite") {
 		stack->correctParams(1);
 
 		ScValue *val = stack->pop();
@@ -167,7 +169,7 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	//////////////////////////////////////////////////////////////////////////
 	// GetSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSprite") == 0) {
+	SC_NAME_CASE("GetSprite") {
 		stack->correctParams(0);
 
 		if (!_sprite || !_sprite->getFilename()) {
@@ -181,7 +183,7 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	//////////////////////////////////////////////////////////////////////////
 	// GetSpriteObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSpriteObject") == 0) {
+	SC_NAME_CASE("GetSpriteObject") {
 		stack->correctParams(0);
 
 		if (!_sprite) {
@@ -195,7 +197,7 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	//////////////////////////////////////////////////////////////////////////
 	// AddTalkSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddTalkSprite") == 0) {
+	SC_NAME_CASE("AddTalkSprite") {
 		stack->correctParams(2);
 
 		const char *filename = stack->pop()->getString();
@@ -216,7 +218,7 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveTalkSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveTalkSprite") == 0) {
+	SC_NAME_CASE("RemoveTalkSprite") {
 		stack->correctParams(2);
 
 		const char *filename = stack->pop()->getString();
@@ -247,7 +249,7 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	// Later state is restored with this.SetTalkSprite(array_talk_sprites[0])
 	// Return value should be array
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetTalkSprites") == 0) {
+	SC_NAME_CASE("GetTalkSprites") {
 		stack->correctParams(1);
 		bool ex = stack->pop()->getBool();
 		BaseArray<BaseSprite *> &sprites = ex ? _talkSpritesEx : _talkSprites;
@@ -267,7 +269,7 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	//////////////////////////////////////////////////////////////////////////
 	// SetTalkSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetTalkSprite") == 0) {
+	SC_NAME_CASE("SetTalkSprite") {
 		stack->correctParams(2);
 
 		const char *filename = stack->pop()->getString();
@@ -293,9 +295,12 @@ bool AdTalkHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 			stack->pushBool(true);
 		}
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return AdObject::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -38,6 +38,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "common/str.h"
 
 namespace Wintermute {
@@ -435,10 +436,11 @@ bool BaseFrame::persist(BasePersistenceManager *persistMgr) {
 //////////////////////////////////////////////////////////////////////////
 bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
 
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetSound
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetSound") == 0) {
+	SC_NAME_CASE("GetSound") {
 		stack->correctParams(0);
 
 		if (_sound && _sound->getFilename()) {
@@ -452,7 +454,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// SetSound
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetSound") == 0) {
+	SC_NAME_CASE("SetSound") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		delete _sound;
@@ -476,7 +478,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// GetSubframe
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetSubframe") == 0) {
+	SC_NAME_CASE("GetSubframe") {
 		stack->correctParams(1);
 		int index = stack->pop()->getInt(-1);
 		if (index < 0 || index >= (int32)_subframes.size()) {
@@ -492,7 +494,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteSubframe
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteSubframe") == 0) {
+	SC_NAME_CASE("DeleteSubframe") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		if (val->isInt()) {
@@ -517,7 +519,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// AddSubframe
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddSubframe") == 0) {
+	SC_NAME_CASE("AddSubframe") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		const char *filename = nullptr;
@@ -539,7 +541,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// InsertSubframe
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InsertSubframe") == 0) {
+	SC_NAME_CASE("InsertSubframe") {
 		stack->correctParams(2);
 		int index = stack->pop()->getInt();
 		if (index < 0) {
@@ -567,25 +569,10 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 		return STATUS_OK;
 	}
 
-	//////////////////////////////////////////////////////////////////////////
-	// GetEvent
-	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSubframe") == 0) {
-		stack->correctParams(1);
-		int index = stack->pop()->getInt(-1);
-		if (index < 0 || index >= (int32)_applyEvent.size()) {
-			script->runtimeError("Frame.GetEvent: Event index %d is out of range.", index);
-			stack->pushNULL();
-		} else {
-			stack->pushString(_applyEvent[index]);
-		}
-		return STATUS_OK;
-	}
-
 	//////////////////////////////////////////////////////////////////////////
 	// AddEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddEvent") == 0) {
+	SC_NAME_CASE("AddEvent") {
 		stack->correctParams(1);
 		const char *event = stack->pop()->getString();
 		for (uint32 i = 0; i < _applyEvent.size(); i++) {
@@ -602,7 +589,7 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteEvent") == 0) {
+	SC_NAME_CASE("DeleteEvent") {
 		stack->correctParams(1);
 		const char *event = stack->pop()->getString();
 		for (uint32 i = 0; i < _applyEvent.size(); i++) {
@@ -617,13 +604,15 @@ bool BaseFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStac
 	}
 
 	//////////////////////////////////////////////////////////////////////////
-	else {
+	default:
+	unknownName: {
 		if (_subframes.size() == 1) {
 			return _subframes[0]->scCallMethod(script, stack, thisStack, name);
 		} else {
 			return BaseScriptable::scCallMethod(script, stack, thisStack, name);
 		}
 	}
+	}
 }
 
 
@@ -634,10 +623,11 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	}
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("frame");
 		return _scValue;
 	}
@@ -645,7 +635,7 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Delay
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Delay") {
+	SC_NAME_CASE("Delay") {
 		_scValue->setInt(_delay);
 		return _scValue;
 	}
@@ -653,7 +643,7 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Keyframe
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Keyframe") {
+	SC_NAME_CASE("Keyframe") {
 		_scValue->setBool(_keyframe);
 		return _scValue;
 	}
@@ -661,7 +651,7 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// KillSounds
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "KillSounds") {
+	SC_NAME_CASE("KillSounds") {
 		_scValue->setBool(_killSound);
 		return _scValue;
 	}
@@ -669,7 +659,7 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MoveX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MoveX") {
+	SC_NAME_CASE("MoveX") {
 		_scValue->setInt(_moveX);
 		return _scValue;
 	}
@@ -677,7 +667,7 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MoveY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MoveY") {
+	SC_NAME_CASE("MoveY") {
 		_scValue->setInt(_moveY);
 		return _scValue;
 	}
@@ -685,7 +675,7 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumSubframes (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumSubframes") {
+	SC_NAME_CASE("NumSubframes") {
 		_scValue->setInt(_subframes.size());
 		return _scValue;
 	}
@@ -693,28 +683,31 @@ ScValue *BaseFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumEvents (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumEvents") {
+	SC_NAME_CASE("NumEvents") {
 		_scValue->setInt(_applyEvent.size());
 		return _scValue;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
-	else {
+	default:
+	unknownName: {
 		if (_subframes.size() == 1) {
 			return _subframes[0]->scGetProperty(name);
 		} else {
 			return BaseScriptable::scGetProperty(name);
 		}
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseFrame::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Delay
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Delay") == 0) {
+	SC_NAME_CASE("Delay") {
 		_delay = MAX(0, value->getInt());
 		return STATUS_OK;
 	}
@@ -722,7 +715,7 @@ bool BaseFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Keyframe
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Keyframe") == 0) {
+	SC_NAME_CASE("Keyframe") {
 		_keyframe = value->getBool();
 		return STATUS_OK;
 	}
@@ -730,7 +723,7 @@ bool BaseFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// KillSounds
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "KillSounds") == 0) {
+	SC_NAME_CASE("KillSounds") {
 		_killSound = value->getBool();
 		return STATUS_OK;
 	}
@@ -738,7 +731,7 @@ bool BaseFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MoveX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MoveX") == 0) {
+	SC_NAME_CASE("MoveX") {
 		_moveX = value->getInt();
 		return STATUS_OK;
 	}
@@ -746,19 +739,21 @@ bool BaseFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MoveY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MoveY") == 0) {
+	SC_NAME_CASE("MoveY") {
 		_moveY = value->getInt();
 		return STATUS_OK;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
-	else {
+	default:
+	unknownName: {
 		if (_subframes.size() == 1) {
 			return _subframes[0]->scSetProperty(name, value);
 		} else {
 			return BaseScriptable::scSetProperty(name, value);
 		}
 	}
+	}
 }
 
 
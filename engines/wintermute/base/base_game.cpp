@@ -56,6 +56,7 @@
 #include "engines/wintermute/base/scriptables/script_engine.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/sound/base_sound.h"
 #include "engines/wintermute/ext/plugins.h"
 #include "engines/wintermute/video/video_player.h"
@@ -183,6 +184,7 @@ BaseGame::BaseGame(const Common::String &targetName) : BaseObject(this), _target
 
 	_smartCache = false;
 	_surfaceGCCycleTime = 10000;
+	_surfaceMemoryBudget = 0;
 
 	_reportTextureFormat = false;
 
@@ -324,6 +326,7 @@ bool BaseGame::cleanup() {
 		_regObjects[i] = nullptr;
 	}
 	_regObjects.clear();
+	_regObjectCount.clear();
 
 	_windows.clear(); // refs only
 	_focusedWindow = nullptr; // ref only
@@ -404,6 +407,15 @@ bool BaseGame::initConfManSettings() {
 	if (!_smartCache) {
 		LOG(0, "Smart cache is DISABLED");
 	}
+
+	// In megabytes, the surfaces with a limited life time are evicted by least recent use past it
+	if (ConfMan.hasKey("surface_cache_budget")) {
+		// Saturated, the budget in bytes has to fit in 32 bits
+		int budget = CLIP<int>(ConfMan.getInt("surface_cache_budget"), 0, 4095);
+		_surfaceMemoryBudget = (uint32)budget * 1024 * 1024;
+	} else {
+		_surfaceMemoryBudget = 256 * 1024 * 1024;
+	}
 	return STATUS_OK;
 }
 
@@ -1060,10 +1072,11 @@ bool BaseGame::loadBuffer(char *buffer, bool complete) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// LOG
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "LOG") == 0) {
+	SC_NAME_CASE("LOG") {
 		stack->correctParams(1);
 		LOG(0, stack->pop()->getString());
 		stack->pushNULL();
@@ -1073,7 +1086,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Caption
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Caption") == 0) {
+	SC_NAME_CASE("Caption") {
 		bool res = BaseObject::scCallMethod(script, stack, thisStack, name);
 		setWindowTitle();
 		return res;
@@ -1082,7 +1095,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Msg
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Msg") == 0) {
+	SC_NAME_CASE("Msg") {
 		stack->correctParams(1);
 		quickMessage(stack->pop()->getString());
 		stack->pushNULL();
@@ -1092,7 +1105,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RunScript
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RunScript") == 0) {
+	SC_NAME_CASE("RunScript") {
 		_gameRef->LOG(0, "**Warning** The 'RunScript' method is now obsolete. Use 'AttachScript' instead (same syntax)");
 		stack->correctParams(1);
 		if (DID_FAIL(addScript(stack->pop()->getString()))) {
@@ -1107,7 +1120,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LoadStringTable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadStringTable") == 0) {
+	SC_NAME_CASE("LoadStringTable") {
 		stack->correctParams(2);
 		const char *filename = stack->pop()->getString();
 		ScValue *val = stack->pop();
@@ -1131,7 +1144,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ValidObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ValidObject") == 0) {
+	SC_NAME_CASE("ValidObject") {
 		stack->correctParams(1);
 		BaseScriptable *obj = stack->pop()->getNative();
 		if (validObject((BaseObject *) obj)) {
@@ -1146,7 +1159,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Reset
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Reset") == 0) {
+	SC_NAME_CASE("Reset") {
 		stack->correctParams(0);
 		resetContent();
 		stack->pushNULL();
@@ -1158,7 +1171,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// UnloadObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UnloadObject") == 0) {
+	SC_NAME_CASE("UnloadObject") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		BaseObject *obj = (BaseObject *)val->getNative();
@@ -1174,7 +1187,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LoadWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadWindow") == 0) {
+	SC_NAME_CASE("LoadWindow") {
 		stack->correctParams(1);
 		UIWindow *win = new UIWindow(_gameRef);
 		if (win && DID_SUCCEED(win->loadFile(stack->pop()->getString()))) {
@@ -1192,7 +1205,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ExpandString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ExpandString") == 0) {
+	SC_NAME_CASE("ExpandString") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		char *str = new char[strlen(val->getString()) + 1];
@@ -1203,14 +1216,10 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		return STATUS_OK;
 	}
 
-	else if (_musicSystem->scCallMethod(script, stack, thisStack, name) == STATUS_OK) {
-		return STATUS_OK;
-	}
-
 	//////////////////////////////////////////////////////////////////////////
 	// SetMousePos
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetMousePos") == 0) {
+	SC_NAME_CASE("SetMousePos") {
 		stack->correctParams(2);
 		int32 x = stack->pop()->getInt();
 		int32 y = stack->pop()->getInt();
@@ -1231,7 +1240,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LockMouseRect
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LockMouseRect") == 0) {
+	SC_NAME_CASE("LockMouseRect") {
 		stack->correctParams(4);
 		int left = stack->pop()->getInt();
 		int top = stack->pop()->getInt();
@@ -1254,7 +1263,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// PlayVideo
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlayVideo") == 0) {
+	SC_NAME_CASE("PlayVideo") {
 		_gameRef->LOG(0, "Warning: Game.PlayVideo() is now deprecated. Use Game.PlayTheora() instead.");
 
 		stack->correctParams(6);
@@ -1296,7 +1305,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// PlayTheora
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlayTheora") == 0) {
+	SC_NAME_CASE("PlayTheora") {
 		stack->correctParams(7);
 		const char *filename = stack->pop()->getString();
 		ScValue *valType = stack->pop();
@@ -1341,7 +1350,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// QuitGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "QuitGame") == 0) {
+	SC_NAME_CASE("QuitGame") {
 		stack->correctParams(0);
 		stack->pushNULL();
 		_quitting = true;
@@ -1355,7 +1364,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// Used at SaveGameSettings() and Game.RegistryFlush()
 	// Called after a series of RegWriteNumber calls
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegistryFlush") == 0) {
+	SC_NAME_CASE("RegistryFlush") {
 		stack->correctParams(0);
 		ConfMan.flushToDisk();
 		stack->pushNULL();
@@ -1366,7 +1375,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RegWriteNumber
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegWriteNumber") == 0) {
+	SC_NAME_CASE("RegWriteNumber") {
 		stack->correctParams(2);
 		const char *key = stack->pop()->getString();
 		int val = stack->pop()->getInt();
@@ -1379,7 +1388,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RegReadNumber
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegReadNumber") == 0) {
+	SC_NAME_CASE("RegReadNumber") {
 		stack->correctParams(2);
 		const char *key = stack->pop()->getString();
 		int initVal = stack->pop()->getInt();
@@ -1395,7 +1404,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RegWriteString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegWriteString") == 0) {
+	SC_NAME_CASE("RegWriteString") {
 		stack->correctParams(2);
 		const char *key = stack->pop()->getString();
 		const char *val = stack->pop()->getString();
@@ -1409,7 +1418,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RegReadString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegReadString") == 0) {
+	SC_NAME_CASE("RegReadString") {
 		stack->correctParams(2);
 		const char *key = stack->pop()->getString();
 		const char *initVal = stack->pop()->getString();
@@ -1421,7 +1430,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SaveGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SaveGame") == 0) {
+	SC_NAME_CASE("SaveGame") {
 		stack->correctParams(3);
 		int slot = stack->pop()->getInt();
 		const char *xdesc = stack->pop()->getString();
@@ -1441,7 +1450,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LoadGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadGame") == 0) {
+	SC_NAME_CASE("LoadGame") {
 		stack->correctParams(1);
 		_scheduledLoadSlot = stack->pop()->getInt();
 		_loading = true;
@@ -1453,7 +1462,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// IsSaveSlotUsed
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsSaveSlotUsed") == 0) {
+	SC_NAME_CASE("IsSaveSlotUsed") {
 		stack->correctParams(1);
 		int slot = stack->pop()->getInt();
 		stack->pushBool(SaveLoad::isSaveSlotUsed(slot));
@@ -1463,7 +1472,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetSaveSlotDescription
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSaveSlotDescription") == 0) {
+	SC_NAME_CASE("GetSaveSlotDescription") {
 		stack->correctParams(1);
 		int slot = stack->pop()->getInt();
 		Common::String desc = SaveLoad::getSaveSlotDescription(slot);
@@ -1479,7 +1488,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// Timestamps should be comparable types
 	// Used to sort saved games by timestamps at save.script & load.script
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSaveSlotDescriptionTimestamp") == 0) {
+	SC_NAME_CASE("GetSaveSlotDescriptionTimestamp") {
 		stack->correctParams(1);
 		int slot = stack->pop()->getInt();
 
@@ -1518,7 +1527,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// Checks if given slot stores game state of compatible game version
 	// This version always returs true
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ValidSaveSlotVersion") == 0) {
+	SC_NAME_CASE("ValidSaveSlotVersion") {
 		stack->correctParams(1);
 		/* int slot = */ stack->pop()->getInt();
 		// do nothing
@@ -1530,7 +1539,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// EmptySaveSlot
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EmptySaveSlot") == 0) {
+	SC_NAME_CASE("EmptySaveSlot") {
 		stack->correctParams(1);
 		int slot = stack->pop()->getInt();
 		SaveLoad::emptySaveSlot(slot);
@@ -1541,7 +1550,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetGlobalSFXVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetGlobalSFXVolume") == 0) {
+	SC_NAME_CASE("SetGlobalSFXVolume") {
 		stack->correctParams(1);
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kSFXSoundType, (byte)stack->pop()->getInt());
 		stack->pushNULL();
@@ -1551,7 +1560,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetGlobalSpeechVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetGlobalSpeechVolume") == 0) {
+	SC_NAME_CASE("SetGlobalSpeechVolume") {
 		stack->correctParams(1);
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kSpeechSoundType, (byte)stack->pop()->getInt());
 		stack->pushNULL();
@@ -1561,7 +1570,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetGlobalMusicVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetGlobalMusicVolume") == 0) {
+	SC_NAME_CASE("SetGlobalMusicVolume") {
 		stack->correctParams(1);
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kMusicSoundType, (byte)stack->pop()->getInt());
 		stack->pushNULL();
@@ -1571,7 +1580,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetGlobalMasterVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetGlobalMasterVolume") == 0) {
+	SC_NAME_CASE("SetGlobalMasterVolume") {
 		stack->correctParams(1);
 		_gameRef->_soundMgr->setMasterVolumePercent((byte)stack->pop()->getInt());
 		stack->pushNULL();
@@ -1581,7 +1590,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetGlobalSFXVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGlobalSFXVolume") == 0) {
+	SC_NAME_CASE("GetGlobalSFXVolume") {
 		stack->correctParams(0);
 		stack->pushInt(_soundMgr->getVolumePercent(Audio::Mixer::kSFXSoundType));
 		return STATUS_OK;
@@ -1590,7 +1599,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetGlobalSpeechVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGlobalSpeechVolume") == 0) {
+	SC_NAME_CASE("GetGlobalSpeechVolume") {
 		stack->correctParams(0);
 		stack->pushInt(_soundMgr->getVolumePercent(Audio::Mixer::kSpeechSoundType));
 		return STATUS_OK;
@@ -1599,7 +1608,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetGlobalMusicVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGlobalMusicVolume") == 0) {
+	SC_NAME_CASE("GetGlobalMusicVolume") {
 		stack->correctParams(0);
 		stack->pushInt(_soundMgr->getVolumePercent(Audio::Mixer::kMusicSoundType));
 		return STATUS_OK;
@@ -1608,7 +1617,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetGlobalMasterVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGlobalMasterVolume") == 0) {
+	SC_NAME_CASE("GetGlobalMasterVolume") {
 		stack->correctParams(0);
 		stack->pushInt(_soundMgr->getMasterVolumePercent());
 		return STATUS_OK;
@@ -1617,7 +1626,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetActiveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetActiveCursor") == 0) {
+	SC_NAME_CASE("SetActiveCursor") {
 		stack->correctParams(1);
 		if (DID_SUCCEED(setActiveCursor(stack->pop()->getString()))) {
 			stack->pushBool(true);
@@ -1631,7 +1640,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetActiveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetActiveCursor") == 0) {
+	SC_NAME_CASE("GetActiveCursor") {
 		stack->correctParams(0);
 		if (!_activeCursor || !_activeCursor->getFilename()) {
 			stack->pushNULL();
@@ -1645,7 +1654,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetActiveCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetActiveCursorObject") == 0) {
+	SC_NAME_CASE("GetActiveCursorObject") {
 		stack->correctParams(0);
 		if (!_activeCursor) {
 			stack->pushNULL();
@@ -1659,7 +1668,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveActiveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveActiveCursor") == 0) {
+	SC_NAME_CASE("RemoveActiveCursor") {
 		stack->correctParams(0);
 		delete _activeCursor;
 		_activeCursor = nullptr;
@@ -1671,7 +1680,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// HasActiveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasActiveCursor") == 0) {
+	SC_NAME_CASE("HasActiveCursor") {
 		stack->correctParams(0);
 
 		if (_activeCursor) {
@@ -1686,7 +1695,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// FileExists
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FileExists") == 0) {
+	SC_NAME_CASE("FileExists") {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -1698,7 +1707,10 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// FadeOut / FadeOutAsync / SystemFadeOut / SystemFadeOutAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeOut") == 0 || strcmp(name, "FadeOutAsync") == 0 || strcmp(name, "SystemFadeOut") == 0 || strcmp(name, "SystemFadeOutAsync") == 0) {
+	SC_NAME_CASE("FadeOut")
+	SC_NAME_ALIAS("FadeOutAsync")
+	SC_NAME_ALIAS("SystemFadeOut")
+	SC_NAME_ALIAS("SystemFadeOutAsync") {
 		stack->correctParams(5);
 		uint32 duration = stack->pop()->getInt(500);
 		byte red = stack->pop()->getInt(0);
@@ -1727,7 +1739,10 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// FadeIn / FadeInAsync / SystemFadeIn / SystemFadeInAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeIn") == 0 || strcmp(name, "FadeInAsync") == 0 || strcmp(name, "SystemFadeIn") == 0 || strcmp(name, "SystemFadeInAsync") == 0) {
+	SC_NAME_CASE("FadeIn")
+	SC_NAME_ALIAS("FadeInAsync")
+	SC_NAME_ALIAS("SystemFadeIn")
+	SC_NAME_ALIAS("SystemFadeInAsync") {
 		stack->correctParams(5);
 		uint32 duration = stack->pop()->getInt(500);
 		byte red = stack->pop()->getInt(0);
@@ -1749,7 +1764,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetFadeColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFadeColor") == 0) {
+	SC_NAME_CASE("GetFadeColor") {
 		stack->correctParams(0);
 		stack->pushInt(_fader->getCurrentColor());
 		return STATUS_OK;
@@ -1758,7 +1773,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Screenshot
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Screenshot") == 0) {
+	SC_NAME_CASE("Screenshot") {
 		stack->correctParams(1);
 		char filename[MAX_PATH_LENGTH];
 
@@ -1784,7 +1799,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ScreenshotEx
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScreenshotEx") == 0) {
+	SC_NAME_CASE("ScreenshotEx") {
 		stack->correctParams(3);
 		const char *filename = stack->pop()->getString();
 		int sizeX = stack->pop()->getInt(_renderer->getWidth());
@@ -1799,7 +1814,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateWindow") == 0) {
+	SC_NAME_CASE("CreateWindow") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -1816,7 +1831,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteWindow") == 0) {
+	SC_NAME_CASE("DeleteWindow") {
 		stack->correctParams(1);
 		BaseObject *obj = (BaseObject *)stack->pop()->getNative();
 		for (uint32 i = 0; i < _windows.size(); i++) {
@@ -1833,7 +1848,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// OpenDocument
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "OpenDocument") == 0) {
+	SC_NAME_CASE("OpenDocument") {
 		stack->correctParams(1);
 		g_system->openUrl(stack->pop()->getString());
 		stack->pushNULL();
@@ -1843,7 +1858,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DEBUG_DumpClassRegistry
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DEBUG_DumpClassRegistry") == 0) {
+	SC_NAME_CASE("DEBUG_DumpClassRegistry") {
 		stack->correctParams(0);
 		DEBUG_DumpClassRegistry();
 		stack->pushNULL();
@@ -1853,7 +1868,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetLoadingScreen
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetLoadingScreen") == 0) {
+	SC_NAME_CASE("SetLoadingScreen") {
 		stack->correctParams(3);
 		ScValue *val = stack->pop();
 		int loadImageX = stack->pop()->getInt();
@@ -1871,7 +1886,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetSavingScreen
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSavingScreen") == 0) {
+	SC_NAME_CASE("SetSavingScreen") {
 		stack->correctParams(3);
 		ScValue *val = stack->pop();
 		int saveImageX = stack->pop()->getInt();
@@ -1889,7 +1904,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetWaitCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetWaitCursor") == 0) {
+	SC_NAME_CASE("SetWaitCursor") {
 		stack->correctParams(1);
 		if (DID_SUCCEED(setWaitCursor(stack->pop()->getString()))) {
 			stack->pushBool(true);
@@ -1903,7 +1918,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveWaitCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveWaitCursor") == 0) {
+	SC_NAME_CASE("RemoveWaitCursor") {
 		stack->correctParams(0);
 		delete _cursorNoninteractive;
 		_cursorNoninteractive = nullptr;
@@ -1916,7 +1931,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetWaitCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetWaitCursor") == 0) {
+	SC_NAME_CASE("GetWaitCursor") {
 		stack->correctParams(0);
 		if (!_cursorNoninteractive || !_cursorNoninteractive->getFilename()) {
 			stack->pushNULL();
@@ -1930,7 +1945,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetWaitCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetWaitCursorObject") == 0) {
+	SC_NAME_CASE("GetWaitCursorObject") {
 		stack->correctParams(0);
 		if (!_cursorNoninteractive) {
 			stack->pushNULL();
@@ -1944,7 +1959,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ClearScriptCache
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ClearScriptCache") == 0) {
+	SC_NAME_CASE("ClearScriptCache") {
 		stack->correctParams(0);
 		stack->pushBool(DID_SUCCEED(_scEngine->emptyScriptCache()));
 		return STATUS_OK;
@@ -1953,7 +1968,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DisplayLoadingIcon
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DisplayLoadingIcon") == 0) {
+	SC_NAME_CASE("DisplayLoadingIcon") {
 		stack->correctParams(4);
 
 		const char *filename = stack->pop()->getString();
@@ -1979,7 +1994,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// HideLoadingIcon
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HideLoadingIcon") == 0) {
+	SC_NAME_CASE("HideLoadingIcon") {
 		stack->correctParams(0);
 		delete _loadingIcon;
 		_loadingIcon = nullptr;
@@ -1990,7 +2005,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DumpTextureStats
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DumpTextureStats") == 0) {
+	SC_NAME_CASE("DumpTextureStats") {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -2003,7 +2018,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// AccOutputText
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AccOutputText") == 0) {
+	SC_NAME_CASE("AccOutputText") {
 		stack->correctParams(2);
 		/* const char *str = */	stack->pop()->getString();
 		/* int type = */ stack->pop()->getInt();
@@ -2017,7 +2032,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// IsShadowTypeSupported
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsShadowTypeSupported") == 0) {
+	SC_NAME_CASE("IsShadowTypeSupported") {
 		stack->correctParams(1);
 		TShadowType type = static_cast<TShadowType>(stack->pop()->getInt());
 
@@ -2046,7 +2061,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// StoreSaveThumbnail
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StoreSaveThumbnail") == 0) {
+	SC_NAME_CASE("StoreSaveThumbnail") {
 		stack->correctParams(0);
 		stack->pushBool(storeSaveThumbnail());
 		return STATUS_OK;
@@ -2055,7 +2070,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteSaveThumbnail
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteSaveThumbnail") == 0) {
+	SC_NAME_CASE("DeleteSaveThumbnail") {
 		stack->correctParams(0);
 		deleteSaveThumbnail();
 		stack->pushNULL();
@@ -2065,7 +2080,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetFileChecksum
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFileChecksum") == 0) {
+	SC_NAME_CASE("GetFileChecksum") {
 		stack->correctParams(2);
 		const char *filename = stack->pop()->getString();
 		bool asHex = stack->pop()->getBool(false);
@@ -2113,7 +2128,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// * 90123679: may be returned at "mainMenu.script" to make "Buy Game" button visible
 	// Used at "Pole Chudes" only
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSpriteControl") == 0) {
+	SC_NAME_CASE("GetSpriteControl") {
 		stack->correctParams(0);
 		stack->pushInt(44332211L);
 		return STATUS_OK;
@@ -2124,7 +2139,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// Additional method to be called before RandomSeed()
 	// Used at "Pole Chudes" only
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RandomInitSeed") == 0) {
+	SC_NAME_CASE("RandomInitSeed") {
 		stack->correctParams(1);
 		int seed = stack->pop()->getInt();
 
@@ -2139,7 +2154,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// Similar to usual Random() function, but using seed provided earlier
 	// Used at "Pole Chudes" only
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RandomSeed") == 0) {
+	SC_NAME_CASE("RandomSeed") {
 		stack->correctParams(2);
 
 		int from = stack->pop()->getInt();
@@ -2157,7 +2172,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// Game script turn off scaling if returned value is "1024;768"
 	// Used at "Papa's Daughters 1" only
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetImageInfo") == 0) {
+	SC_NAME_CASE("GetImageInfo") {
 		stack->correctParams(1);
 		/*const char *filename =*/ stack->pop()->getString();
 		stack->pushString("1024;768");
@@ -2168,7 +2183,14 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// [HeroCraft] A lot of functions used for self-check
 	// Used at "Papa's Daughters 2" only
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteItems") == 0 || strcmp(name, "CreateActorItems") == 0 || strcmp(name, "DeleteActorItems") == 0 || strcmp(name, "PrepareItems") == 0 || strcmp(name, "CreateEntityItems") == 0 || strcmp(name, "DeleteEntityItems") == 0 || strcmp(name, "PrepareItemsWin") == 0 || strcmp(name, "CreateItems") == 0) {
+	SC_NAME_CASE("DeleteItems")
+	SC_NAME_ALIAS("CreateActorItems")
+	SC_NAME_ALIAS("DeleteActorItems")
+	SC_NAME_ALIAS("PrepareItems")
+	SC_NAME_ALIAS("CreateEntityItems")
+	SC_NAME_ALIAS("DeleteEntityItems")
+	SC_NAME_ALIAS("PrepareItemsWin")
+	SC_NAME_ALIAS("CreateItems") {
 		stack->correctParams(3);
 		uint32 a = (uint32)stack->pop()->getInt();
 		uint32 b = (uint32)stack->pop()->getInt();
@@ -2194,7 +2216,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// EnableScriptProfiling
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EnableScriptProfiling") == 0) {
+	SC_NAME_CASE("EnableScriptProfiling") {
 		stack->correctParams(0);
 		_scEngine->enableProfiling();
 		stack->pushNULL();
@@ -2205,7 +2227,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DisableScriptProfiling
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DisableScriptProfiling") == 0) {
+	SC_NAME_CASE("DisableScriptProfiling") {
 		stack->correctParams(0);
 		_scEngine->disableProfiling();
 		stack->pushNULL();
@@ -2219,7 +2241,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// Returns 0 on fullscreen and 1 on window
 	// Used to init and update controls at options.script and methods.script
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetScreenType") == 0) {
+	SC_NAME_CASE("GetScreenType") {
 		stack->correctParams(0);
 		int type = _renderer->isWindowed() ? 1 : 0;
 		stack->pushInt(type);
@@ -2234,7 +2256,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// Used to init and update controls at options.script and methods.script
 	// This implementation always return 2 to fake window size of 2*320 x 2*180
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetScreenMode") == 0) {
+	SC_NAME_CASE("GetScreenMode") {
 		stack->correctParams(0);
 		stack->pushInt(2);
 
@@ -2250,7 +2272,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// Available screen modes are calcucated as 2...N, N*320<w and N*180<h
 	// This implementation fakes available size as 2*320 x 2*180 only
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetDesktopDisplayMode") == 0) {
+	SC_NAME_CASE("GetDesktopDisplayMode") {
 		stack->correctParams(0);
 		stack->pushInt(2 * 180 + 1);
 		stack->pushInt(2 * 320 + 1);
@@ -2276,7 +2298,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// Used to change screen type&mode at options.script and methods.script
 	// Return value is never used
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetScreenTypeMode") == 0) {
+	SC_NAME_CASE("SetScreenTypeMode") {
 		stack->correctParams(2);
 		int type = stack->pop()->getInt();
 		stack->pop()->getInt(); //mode is unused
@@ -2294,7 +2316,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// This implementation does nothing
 	// Return value is never used
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ChangeWindowGrab") == 0) {
+	SC_NAME_CASE("ChangeWindowGrab") {
 		stack->correctParams(0);
 		stack->pushNULL();
 
@@ -2309,7 +2331,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// This implementation looks up at savegame storage and for actual files 
 	// Return value expected to be an Array of Strings
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFiles") == 0) {
+	SC_NAME_CASE("GetFiles") {
 		stack->correctParams(1);
 		const char *pattern = stack->pop()->getString();
 
@@ -2331,7 +2353,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ShowStatusLine
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ShowStatusLine") == 0) {
+	SC_NAME_CASE("ShowStatusLine") {
 		stack->correctParams(0);
 		// Block kept to show intention of opcode.
 		/*#ifdef __IPHONEOS__
@@ -2345,7 +2367,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// HideStatusLine
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HideStatusLine") == 0) {
+	SC_NAME_CASE("HideStatusLine") {
 		stack->correctParams(0);
 		// Block kept to show intention of opcode.
 		/*#ifdef __IPHONEOS__
@@ -2354,8 +2376,14 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		stack->pushNULL();
 
 		return STATUS_OK;
-	} else {
-		return BaseObject::scCallMethod(script, stack, thisStack, name);
+	}
+	default:
+	unknownName:
+		if (_musicSystem->scCallMethod(script, stack, thisStack, name) == STATUS_OK) {
+			return STATUS_OK;
+		} else {
+			return BaseObject::scCallMethod(script, stack, thisStack, name);
+		}
 	}
 }
 
@@ -2364,24 +2392,25 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("game");
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Name") {
+	SC_NAME_CASE("Name") {
 		_scValue->setString(getName());
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Hwnd (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Hwnd") {
+	SC_NAME_CASE("Hwnd") {
 		_scValue->setInt((int)_renderer->_window);
 		return _scValue;
 	}
@@ -2389,7 +2418,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CurrentTime (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CurrentTime") {
+	SC_NAME_CASE("CurrentTime") {
 		_scValue->setInt((int)getTimer()->getTime());
 		return _scValue;
 	}
@@ -2397,7 +2426,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WindowsTime (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WindowsTime") {
+	SC_NAME_CASE("WindowsTime") {
 		_scValue->setInt((int)g_system->getMillis());
 		return _scValue;
 	}
@@ -2405,7 +2434,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// WindowedMode (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "WindowedMode") {
+	SC_NAME_CASE("WindowedMode") {
 		_scValue->setBool(_renderer->isWindowed());
 		return _scValue;
 	}
@@ -2413,7 +2442,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MouseX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MouseX") {
+	SC_NAME_CASE("MouseX") {
 		_scValue->setInt(_mousePos.x);
 		return _scValue;
 	}
@@ -2421,7 +2450,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MouseY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MouseY") {
+	SC_NAME_CASE("MouseY") {
 		_scValue->setInt(_mousePos.y);
 		return _scValue;
 	}
@@ -2429,7 +2458,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MainObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MainObject") {
+	SC_NAME_CASE("MainObject") {
 		_scValue->setNative(_mainObject, true);
 		return _scValue;
 	}
@@ -2437,7 +2466,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ActiveObject (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ActiveObject") {
+	SC_NAME_CASE("ActiveObject") {
 		_scValue->setNative(_activeObject, true);
 		return _scValue;
 	}
@@ -2445,7 +2474,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScreenWidth (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScreenWidth") {
+	SC_NAME_CASE("ScreenWidth") {
 		_scValue->setInt(_renderer->getWidth());
 		return _scValue;
 	}
@@ -2453,7 +2482,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScreenHeight (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScreenHeight") {
+	SC_NAME_CASE("ScreenHeight") {
 		_scValue->setInt(_renderer->getHeight());
 		return _scValue;
 	}
@@ -2461,7 +2490,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Interactive
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Interactive") {
+	SC_NAME_CASE("Interactive") {
 		_scValue->setBool(_interactive);
 		return _scValue;
 	}
@@ -2469,7 +2498,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// DebugMode (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "DebugMode") {
+	SC_NAME_CASE("DebugMode") {
 		_scValue->setBool(_debugDebugMode);
 		return _scValue;
 	}
@@ -2477,7 +2506,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SoundAvailable (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SoundAvailable") {
+	SC_NAME_CASE("SoundAvailable") {
 		_scValue->setBool(_soundMgr->_soundAvailable);
 		return _scValue;
 	}
@@ -2485,7 +2514,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SFXVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SFXVolume") {
+	SC_NAME_CASE("SFXVolume") {
 		_gameRef->LOG(0, "**Warning** The SFXVolume attribute is obsolete");
 		_scValue->setInt(_soundMgr->getVolumePercent(Audio::Mixer::kSFXSoundType));
 		return _scValue;
@@ -2494,7 +2523,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SpeechVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SpeechVolume") {
+	SC_NAME_CASE("SpeechVolume") {
 		_gameRef->LOG(0, "**Warning** The SpeechVolume attribute is obsolete");
 		_scValue->setInt(_soundMgr->getVolumePercent(Audio::Mixer::kSpeechSoundType));
 		return _scValue;
@@ -2503,7 +2532,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MusicVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MusicVolume") {
+	SC_NAME_CASE("MusicVolume") {
 		_gameRef->LOG(0, "**Warning** The MusicVolume attribute is obsolete");
 		_scValue->setInt(_soundMgr->getVolumePercent(Audio::Mixer::kMusicSoundType));
 		return _scValue;
@@ -2512,7 +2541,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MasterVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MasterVolume") {
+	SC_NAME_CASE("MasterVolume") {
 		_gameRef->LOG(0, "**Warning** The MasterVolume attribute is obsolete");
 		_scValue->setInt(_soundMgr->getMasterVolumePercent());
 		return _scValue;
@@ -2521,7 +2550,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Keyboard (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Keyboard") {
+	SC_NAME_CASE("Keyboard") {
 		if (_keyboardState) {
 			_scValue->setNative(_keyboardState, true);
 		} else {
@@ -2534,7 +2563,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Subtitles
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Subtitles") {
+	SC_NAME_CASE("Subtitles") {
 		_scValue->setBool(_subtitles);
 		return _scValue;
 	}
@@ -2542,14 +2571,14 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesSpeed
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SubtitlesSpeed") {
+	SC_NAME_CASE("SubtitlesSpeed") {
 		_scValue->setInt(_subtitlesSpeed);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// VideoSubtitles
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "VideoSubtitles") {
+	SC_NAME_CASE("VideoSubtitles") {
 		_scValue->setBool(_videoSubtitles);
 		return _scValue;
 	}
@@ -2557,7 +2586,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// FPS (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "FPS") {
+	SC_NAME_CASE("FPS") {
 		_scValue->setInt(_fps);
 		return _scValue;
 	}
@@ -2566,7 +2595,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Shadows (obsolete)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Shadows") {
+	SC_NAME_CASE("Shadows") {
 		_scValue->setBool(_maxShadowType > SHADOW_NONE);
 		return _scValue;
 	}
@@ -2574,7 +2603,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SimpleShadows (obsolete)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SimpleShadows") {
+	SC_NAME_CASE("SimpleShadows") {
 		_scValue->setBool(_maxShadowType == SHADOW_SIMPLE);
 		return _scValue;
 	}
@@ -2582,7 +2611,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SupportsRealTimeShadows (obsolete)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SupportsRealTimeShadows") {
+	SC_NAME_CASE("SupportsRealTimeShadows") {
 		_renderer3D->enableShadows();
 		_scValue->setBool(_supportsRealTimeShadows);
 		return _scValue;
@@ -2591,7 +2620,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxShadowType
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MaxShadowType") {
+	SC_NAME_CASE("MaxShadowType") {
 		_scValue->setInt(_maxShadowType);
 		return _scValue;
 	}
@@ -2599,7 +2628,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxActiveLights
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MaxActiveLights") {
+	SC_NAME_CASE("MaxActiveLights") {
 		if (_useD3D) {
 			_scValue->setInt(_renderer3D->maximumLightsCount());
 		} else {
@@ -2612,7 +2641,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Direct3DDevice
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Direct3DDevice") {
+	SC_NAME_CASE("Direct3DDevice") {
 		warning("BaseGame::scGetProperty Direct3D device is not available");
 		_scValue->setNULL();
 
@@ -2622,7 +2651,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// DirectDrawInterface
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "DirectDrawInterface") {
+	SC_NAME_CASE("DirectDrawInterface") {
 		warning("BaseGame::scGetProperty DirectDraw interface is not available");
 		_scValue->setNULL();
 
@@ -2632,7 +2661,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// HardwareTL
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "HardwareTL") {
+	SC_NAME_CASE("HardwareTL") {
 		// TODO: Once we have a TinyGL renderer, we could potentially return false here
 		// otherwise, as long as WME3D is enabled, vertex processing is done by the hardware
 		_scValue->setBool(true);
@@ -2642,7 +2671,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// UsedMemory
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "UsedMemory") {
+	SC_NAME_CASE("UsedMemory") {
 		// wme only returns a non-zero value in debug mode
 		_scValue->setInt(0);
 		return _scValue;
@@ -2652,7 +2681,8 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AcceleratedMode / Accelerated (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AcceleratedMode" || name == "Accelerated") {
+	SC_NAME_CASE("AcceleratedMode")
+	SC_NAME_ALIAS("Accelerated") {
 		_scValue->setBool(_useD3D);
 		return _scValue;
 	}
@@ -2660,7 +2690,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextEncoding
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TextEncoding") {
+	SC_NAME_CASE("TextEncoding") {
 		_scValue->setInt(_textEncoding);
 		return _scValue;
 	}
@@ -2668,7 +2698,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextRTL
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TextRTL") {
+	SC_NAME_CASE("TextRTL") {
 		_scValue->setBool(_textRTL);
 		return _scValue;
 	}
@@ -2676,7 +2706,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SoundBufferSize
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SoundBufferSize") {
+	SC_NAME_CASE("SoundBufferSize") {
 		_scValue->setInt(_soundBufferSizeSec);
 		return _scValue;
 	}
@@ -2684,7 +2714,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SuspendedRendering
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SuspendedRendering") {
+	SC_NAME_CASE("SuspendedRendering") {
 		_scValue->setBool(_suspendedRendering);
 		return _scValue;
 	}
@@ -2692,7 +2722,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SuppressScriptErrors
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SuppressScriptErrors") {
+	SC_NAME_CASE("SuppressScriptErrors") {
 		_scValue->setBool(_suppressScriptErrors);
 		return _scValue;
 	}
@@ -2701,7 +2731,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Frozen
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Frozen") {
+	SC_NAME_CASE("Frozen") {
 		_scValue->setBool(_state == GAME_FROZEN);
 		return _scValue;
 	}
@@ -2709,7 +2739,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccTTSEnabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccTTSEnabled") {
+	SC_NAME_CASE("AccTTSEnabled") {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2717,7 +2747,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccTTSTalk
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccTTSTalk") {
+	SC_NAME_CASE("AccTTSTalk") {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2725,7 +2755,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccTTSCaptions
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccTTSCaptions") {
+	SC_NAME_CASE("AccTTSCaptions") {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2733,7 +2763,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccTTSKeypress
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccTTSKeypress") {
+	SC_NAME_CASE("AccTTSKeypress") {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2741,7 +2771,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccKeyboardEnabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccKeyboardEnabled") {
+	SC_NAME_CASE("AccKeyboardEnabled") {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2749,7 +2779,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccKeyboardCursorSkip
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccKeyboardCursorSkip") {
+	SC_NAME_CASE("AccKeyboardCursorSkip") {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2757,7 +2787,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccKeyboardPause
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccKeyboardPause") {
+	SC_NAME_CASE("AccKeyboardPause") {
 		_scValue->setBool(false);
 		return _scValue;
 	}
@@ -2765,7 +2795,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutorunDisabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AutorunDisabled") {
+	SC_NAME_CASE("AutorunDisabled") {
 		_scValue->setBool(_autorunDisabled);
 		return _scValue;
 	}
@@ -2773,7 +2803,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SaveDirectory (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SaveDirectory") {
+	SC_NAME_CASE("SaveDirectory") {
 		AnsiString dataDir = "saves"; // See also: SXDirectory::scGetProperty("TempDirectory")
 		_scValue->setString(dataDir.c_str());
 		return _scValue;
@@ -2782,7 +2812,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutoSaveOnExit
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AutoSaveOnExit") {
+	SC_NAME_CASE("AutoSaveOnExit") {
 		_scValue->setBool(_autoSaveOnExit);
 		return _scValue;
 	}
@@ -2790,7 +2820,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutoSaveSlot
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AutoSaveSlot") {
+	SC_NAME_CASE("AutoSaveSlot") {
 		_scValue->setInt(_autoSaveSlot);
 		return _scValue;
 	}
@@ -2798,7 +2828,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorHidden
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CursorHidden") {
+	SC_NAME_CASE("CursorHidden") {
 		_scValue->setBool(_cursorHidden);
 		return _scValue;
 	}
@@ -2808,7 +2838,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	// [FoxTail] SystemLanguage (RO)
 	// Returns Steam API language name string
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SystemLanguage") {
+	SC_NAME_CASE("SystemLanguage") {
 		switch (Common::parseLanguage(ConfMan.get("language"))) {
 		case Common::CZ_CZE:
 			_scValue->setString("czech");
@@ -2885,7 +2915,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	// Used to display full game version at options.script in UpdateControls()
 	// Returns FoxTail engine version number as a dotted string
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "BuildVersion") {
+	SC_NAME_CASE("BuildVersion") {
 		if (BaseEngine::instance().getTargetExecutable() == FOXTAIL_1_2_227) {
 			_scValue->setString("1.2.227");
 		} else if (BaseEngine::instance().getTargetExecutable() == FOXTAIL_1_2_230) {
@@ -2911,7 +2941,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	// Used to display full game version at options.script in UpdateControls()
 	// Returns FoxTail version number as a string
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "GameVersion") {
+	SC_NAME_CASE("GameVersion") {
 		uint32 gameVersion = 0;
 		BaseFileManager *fileManager = BaseEngine::instance().getFileManager();
 		if (fileManager) {
@@ -2927,7 +2957,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Platform (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Platform") {
+	SC_NAME_CASE("Platform") {
 		_scValue->setString(BasePlatform::getPlatformName().c_str());
 		return _scValue;
 	}
@@ -2935,7 +2965,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// DeviceType (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "DeviceType") {
+	SC_NAME_CASE("DeviceType") {
 		_scValue->setString(getDeviceType().c_str());
 		return _scValue;
 	}
@@ -2943,7 +2973,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MostRecentSaveSlot (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MostRecentSaveSlot") {
+	SC_NAME_CASE("MostRecentSaveSlot") {
 		if (!ConfMan.hasKey("most_recent_saveslot")) {
 			_scValue->setInt(-1);
 		} else {
@@ -2955,23 +2985,27 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Store (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Store") {
+	SC_NAME_CASE("Store") {
 		_scValue->setNULL();
 		error("Request for a SXStore-object, which is not supported by ScummVM");
 
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseGame::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	SC_NAME_CASE("Name") {
 		setName(value->getString());
 
 		return STATUS_OK;
@@ -2980,7 +3014,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MouseX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MouseX") == 0) {
+	SC_NAME_CASE("MouseX") {
 		_mousePos.x = value->getInt();
 		resetMousePos();
 		return STATUS_OK;
@@ -2989,25 +3023,16 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MouseY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MouseY") == 0) {
+	SC_NAME_CASE("MouseY") {
 		_mousePos.y = value->getInt();
 		resetMousePos();
 		return STATUS_OK;
 	}
 
-	//////////////////////////////////////////////////////////////////////////
-	// Caption
-	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Name") == 0) {
-		bool res = BaseObject::scSetProperty(name, value);
-		setWindowTitle();
-		return res;
-	}
-
 	//////////////////////////////////////////////////////////////////////////
 	// MainObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MainObject") == 0) {
+	SC_NAME_CASE("MainObject") {
 		BaseScriptable *obj = value->getNative();
 		if (obj == nullptr || validObject((BaseObject *)obj)) {
 			_mainObject = (BaseObject *)obj;
@@ -3018,7 +3043,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Interactive
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Interactive") == 0) {
+	SC_NAME_CASE("Interactive") {
 		setInteractive(value->getBool());
 		return STATUS_OK;
 	}
@@ -3026,7 +3051,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SFXVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SFXVolume") == 0) {
+	SC_NAME_CASE("SFXVolume") {
 		_gameRef->LOG(0, "**Warning** The SFXVolume attribute is obsolete");
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kSFXSoundType, (byte)value->getInt());
 		return STATUS_OK;
@@ -3035,7 +3060,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SpeechVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SpeechVolume") == 0) {
+	SC_NAME_CASE("SpeechVolume") {
 		_gameRef->LOG(0, "**Warning** The SpeechVolume attribute is obsolete");
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kSpeechSoundType, (byte)value->getInt());
 		return STATUS_OK;
@@ -3044,7 +3069,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MusicVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MusicVolume") == 0) {
+	SC_NAME_CASE("MusicVolume") {
 		_gameRef->LOG(0, "**Warning** The MusicVolume attribute is obsolete");
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kMusicSoundType, (byte)value->getInt());
 		return STATUS_OK;
@@ -3053,7 +3078,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MasterVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MasterVolume") == 0) {
+	SC_NAME_CASE("MasterVolume") {
 		_gameRef->LOG(0, "**Warning** The MasterVolume attribute is obsolete");
 		_gameRef->_soundMgr->setMasterVolumePercent((byte)value->getInt());
 		return STATUS_OK;
@@ -3062,7 +3087,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Subtitles
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Subtitles") == 0) {
+	SC_NAME_CASE("Subtitles") {
 		_subtitles = value->getBool();
 		return STATUS_OK;
 	}
@@ -3070,7 +3095,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SubtitlesSpeed
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SubtitlesSpeed") == 0) {
+	SC_NAME_CASE("SubtitlesSpeed") {
 		_subtitlesSpeed = value->getInt();
 		return STATUS_OK;
 	}
@@ -3078,7 +3103,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// VideoSubtitles
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "VideoSubtitles") == 0) {
+	SC_NAME_CASE("VideoSubtitles") {
 		_videoSubtitles = value->getBool();
 		return STATUS_OK;
 	}
@@ -3087,7 +3112,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Shadows (obsolete)
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Shadows") == 0) {
+	SC_NAME_CASE("Shadows") {
 		if (value->getBool()) {
 			setMaxShadowType(SHADOW_STENCIL);
 		} else {
@@ -3100,7 +3125,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SimpleShadows (obsolete)
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SimpleShadows") == 0) {
+	SC_NAME_CASE("SimpleShadows") {
 		if (value->getBool()) {
 			setMaxShadowType(SHADOW_SIMPLE);
 		} else {
@@ -3113,7 +3138,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxShadowType
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MaxShadowType") == 0) {
+	SC_NAME_CASE("MaxShadowType") {
 		setMaxShadowType(static_cast<TShadowType>(value->getInt()));
 		return STATUS_OK;
 	}
@@ -3122,7 +3147,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextEncoding
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TextEncoding") == 0) {
+	SC_NAME_CASE("TextEncoding") {
 		int enc = value->getInt();
 		if (enc < 0) {
 			enc = 0;
@@ -3137,7 +3162,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextRTL
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TextRTL") == 0) {
+	SC_NAME_CASE("TextRTL") {
 		_textRTL = value->getBool();
 		return STATUS_OK;
 	}
@@ -3145,7 +3170,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SoundBufferSize
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundBufferSize") == 0) {
+	SC_NAME_CASE("SoundBufferSize") {
 		_soundBufferSizeSec = value->getInt();
 		_soundBufferSizeSec = MAX<int32>(3, _soundBufferSizeSec);
 		return STATUS_OK;
@@ -3154,7 +3179,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SuspendedRendering
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SuspendedRendering") == 0) {
+	SC_NAME_CASE("SuspendedRendering") {
 		_suspendedRendering = value->getBool();
 		return STATUS_OK;
 	}
@@ -3162,7 +3187,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SuppressScriptErrors
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SuppressScriptErrors") == 0) {
+	SC_NAME_CASE("SuppressScriptErrors") {
 		_suppressScriptErrors = value->getBool();
 		return STATUS_OK;
 	}
@@ -3170,7 +3195,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutorunDisabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AutorunDisabled") == 0) {
+	SC_NAME_CASE("AutorunDisabled") {
 		_autorunDisabled = value->getBool();
 		return STATUS_OK;
 	}
@@ -3178,7 +3203,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutoSaveOnExit
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AutoSaveOnExit") == 0) {
+	SC_NAME_CASE("AutoSaveOnExit") {
 		_autoSaveOnExit = value->getBool();
 		return STATUS_OK;
 	}
@@ -3186,7 +3211,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AutoSaveSlot
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AutoSaveSlot") == 0) {
+	SC_NAME_CASE("AutoSaveSlot") {
 		_autoSaveSlot = value->getInt();
 		return STATUS_OK;
 	}
@@ -3194,12 +3219,15 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorHidden
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CursorHidden") == 0) {
+	SC_NAME_CASE("CursorHidden") {
 		_cursorHidden = value->getBool();
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scSetProperty(name, value);
 	}
+	}
 }
 
 
@@ -3264,6 +3292,7 @@ void BaseGame::quickMessageForm(char *fmt, ...) {
 //////////////////////////////////////////////////////////////////////////
 bool BaseGame::registerObject(BaseObject *object) {
 	_regObjects.add(object);
+	_regObjectCount[object]++;
 	return STATUS_OK;
 }
 
@@ -3299,6 +3328,13 @@ bool BaseGame::unregisterObject(BaseObject *object) {
 	}
 
 	// destroy object
+	RegObjectCountMap::iterator count = _regObjectCount.find(object);
+	if (count == _regObjectCount.end()) {
+		return STATUS_FAILED;
+	}
+	if (--count->_value == 0) {
+		_regObjectCount.erase(count);
+	}
 	for (uint32 i = 0; i < _regObjects.size(); i++) {
 		if (_regObjects[i] == object) {
 			_regObjects.remove_at(i);
@@ -3337,12 +3373,7 @@ bool BaseGame::validObject(BaseObject *object) {
 		return true;
 	}
 
-	for (uint32 i = 0; i < _regObjects.size(); i++) {
-		if (_regObjects[i] == object) {
-			return true;
-		}
-	}
-	return false;
+	return _regObjectCount.contains(object);
 }
 
 
@@ -3350,99 +3381,109 @@ bool BaseGame::validObject(BaseObject *object) {
 bool BaseGame::externalCall(ScScript *script, ScStack *stack, ScStack *thisStack, char *name) {
 	ScValue *thisObj;
 
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// LOG
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "LOG") == 0) {
+	SC_NAME_CASE("LOG") {
 		stack->correctParams(1);
 		_gameRef->LOG(0, "sc: %s", stack->pop()->getString());
 		stack->pushNULL();
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// String
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "String") == 0) {
+	SC_NAME_CASE("String") {
 		thisObj = thisStack->getTop();
 
 		thisObj->setNative(makeSXString(_gameRef,  stack));
 		stack->pushNULL();
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// MemBuffer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MemBuffer") == 0) {
+	SC_NAME_CASE("MemBuffer") {
 		thisObj = thisStack->getTop();
 
 		thisObj->setNative(makeSXMemBuffer(_gameRef,  stack));
 		stack->pushNULL();
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// File
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "File") == 0) {
+	SC_NAME_CASE("File") {
 		thisObj = thisStack->getTop();
 
 		thisObj->setNative(makeSXFile(_gameRef,  stack));
 		stack->pushNULL();
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Directory
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Directory") == 0) {
+	SC_NAME_CASE("Directory") {
 		thisObj = thisStack->getTop();
 
 		thisObj->setNative(makeSXDirectory(_gameRef));
 		stack->pushNULL();
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Date
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Date") == 0) {
+	SC_NAME_CASE("Date") {
 		thisObj = thisStack->getTop();
 
 		thisObj->setNative(makeSXDate(_gameRef,  stack));
 		stack->pushNULL();
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Array
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Array") == 0) {
+	SC_NAME_CASE("Array") {
 		thisObj = thisStack->getTop();
 
 		thisObj->setNative(makeSXArray(_gameRef,  stack));
 		stack->pushNULL();
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Object
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Object") == 0) {
+	SC_NAME_CASE("Object") {
 		thisObj = thisStack->getTop();
 
 		thisObj->setNative(makeSXObject(_gameRef,  stack));
 		stack->pushNULL();
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Sleep
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Sleep") == 0) {
+	SC_NAME_CASE("Sleep") {
 		stack->correctParams(1);
 
 		script->sleep((uint32)stack->pop()->getInt());
 		stack->pushNULL();
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// WaitFor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WaitFor") == 0) {
+	SC_NAME_CASE("WaitFor") {
 		stack->correctParams(1);
 
 		BaseScriptable *obj = stack->pop()->getNative();
@@ -3450,34 +3491,39 @@ bool BaseGame::externalCall(ScScript *script, ScStack *stack, ScStack *thisStack
 			script->waitForExclusive((BaseObject *)obj);
 		}
 		stack->pushNULL();
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Random
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Random") == 0) {
+	SC_NAME_CASE("Random") {
 		stack->correctParams(2);
 
 		int from = stack->pop()->getInt();
 		int to   = stack->pop()->getInt();
 
 		stack->pushInt(BaseUtils::randomInt(from, to));
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// SetScriptTimeSlice
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetScriptTimeSlice") == 0) {
+	SC_NAME_CASE("SetScriptTimeSlice") {
 		stack->correctParams(1);
 
 		script->_timeSlice = (uint32)stack->pop()->getInt();
 		stack->pushNULL();
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// MakeRGBA / MakeRGB / RGB
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MakeRGBA") == 0 || strcmp(name, "MakeRGB") == 0 || strcmp(name, "RGB") == 0) {
+	SC_NAME_CASE("MakeRGBA")
+	SC_NAME_ALIAS("MakeRGB")
+	SC_NAME_ALIAS("RGB") {
 		stack->correctParams(4);
 		int r = stack->pop()->getInt();
 		int g = stack->pop()->getInt();
@@ -3491,141 +3537,155 @@ bool BaseGame::externalCall(ScScript *script, ScStack *stack, ScStack *thisStack
 		}
 
 		stack->pushInt(BYTETORGBA(r, g, b, a));
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// MakeHSL
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MakeHSL") == 0) {
+	SC_NAME_CASE("MakeHSL") {
 		stack->correctParams(3);
 		int h = stack->pop()->getInt();
 		int s = stack->pop()->getInt();
 		int l = stack->pop()->getInt();
 
 		stack->pushInt(BaseUtils::HSLtoRGB(h, s, l));
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// GetRValue
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetRValue") == 0) {
+	SC_NAME_CASE("GetRValue") {
 		stack->correctParams(1);
 
 		uint32 rgba = (uint32)stack->pop()->getInt();
 		stack->pushInt(RGBCOLGetR(rgba));
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// GetGValue
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGValue") == 0) {
+	SC_NAME_CASE("GetGValue") {
 		stack->correctParams(1);
 
 		uint32 rgba = (uint32)stack->pop()->getInt();
 		stack->pushInt(RGBCOLGetG(rgba));
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// GetBValue
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetBValue") == 0) {
+	SC_NAME_CASE("GetBValue") {
 		stack->correctParams(1);
 
 		uint32 rgba = (uint32)stack->pop()->getInt();
 		stack->pushInt(RGBCOLGetB(rgba));
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// GetAValue
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetAValue") == 0) {
+	SC_NAME_CASE("GetAValue") {
 		stack->correctParams(1);
 
 		uint32 rgba = (uint32)stack->pop()->getInt();
 		stack->pushInt(RGBCOLGetA(rgba));
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// GetHValue
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHValue") == 0) {
+	SC_NAME_CASE("GetHValue") {
 		stack->correctParams(1);
 		uint32 rgb = (uint32)stack->pop()->getInt();
 
 		byte H, S, L;
 		BaseUtils::RGBtoHSL(rgb, &H, &S, &L);
 		stack->pushInt(H);
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// GetSValue
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSValue") == 0) {
+	SC_NAME_CASE("GetSValue") {
 		stack->correctParams(1);
 		uint32 rgb = (uint32)stack->pop()->getInt();
 
 		byte H, S, L;
 		BaseUtils::RGBtoHSL(rgb, &H, &S, &L);
 		stack->pushInt(S);
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// GetLValue
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetLValue") == 0) {
+	SC_NAME_CASE("GetLValue") {
 		stack->correctParams(1);
 		uint32 rgb = (uint32)stack->pop()->getInt();
 
 		byte H, S, L;
 		BaseUtils::RGBtoHSL(rgb, &H, &S, &L);
 		stack->pushInt(L);
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Debug
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Debug") == 0) {
+	SC_NAME_CASE("Debug") {
 		stack->correctParams(0);
 		stack->pushNULL();
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// ToString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ToString") == 0) {
+	SC_NAME_CASE("ToString") {
 		stack->correctParams(1);
 		const char *str = stack->pop()->getString();
 		char *str2 = new char[strlen(str) + 1];
 		strcpy(str2, str);
 		stack->pushString(str2);
 		delete[] str2;
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// ToInt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ToInt") == 0) {
+	SC_NAME_CASE("ToInt") {
 		stack->correctParams(1);
 		int val = stack->pop()->getInt();
 		stack->pushInt(val);
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// ToFloat
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ToFloat") == 0) {
+	SC_NAME_CASE("ToFloat") {
 		stack->correctParams(1);
 		double val = stack->pop()->getFloat();
 		stack->pushFloat(val);
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// ToBool
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ToBool") == 0) {
+	SC_NAME_CASE("ToBool") {
 		stack->correctParams(1);
 		bool val = stack->pop()->getBool();
 		stack->pushBool(val);
+		break;
 	}
 
 #ifdef ENABLE_FOXTAIL
@@ -3635,7 +3695,7 @@ bool BaseGame::externalCall(ScScript *script, ScStack *stack, ScStack *thisStack
 	// If true is returned, then ToInt() is called for same parameter
 	// ToInt(string) implementation is using atoi(), so let's use it here too
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsNumber") == 0) {
+	SC_NAME_CASE("IsNumber") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		
@@ -3648,6 +3708,7 @@ bool BaseGame::externalCall(ScScript *script, ScStack *stack, ScStack *thisStack
 		}
 
 		stack->pushBool(result);
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -3657,7 +3718,7 @@ bool BaseGame::externalCall(ScScript *script, ScStack *stack, ScStack *thisStack
 	// All the delimeters ever used in FoxTail are:
 	//   " ", "@", "#", "$", "&", ",", "\\", "@h", "@i", "@p", "@s"
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Split") == 0) {
+	SC_NAME_CASE("Split") {
 		stack->correctParams(2);
 		const char *str = stack->pop()->getString();
 		Common::String sep = stack->pop()->getString();
@@ -3690,13 +3751,16 @@ bool BaseGame::externalCall(ScScript *script, ScStack *stack, ScStack *thisStack
 		stack->pushNative(arr, false);
 
 		delete[] copy;
+		break;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// [FoxTail] Trim / lTrim / rTrim
 	// Removes whitespaces from a string from the left & right
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Trim") == 0 || strcmp(name, "lTrim") == 0 || strcmp(name, "rTrim") == 0) {
+	SC_NAME_CASE("Trim")
+	SC_NAME_ALIAS("lTrim")
+	SC_NAME_ALIAS("rTrim") {
 		stack->correctParams(1);
 		const char *str = stack->pop()->getString();
 		char *copy = new char[strlen(str) + 1];
@@ -3713,22 +3777,27 @@ bool BaseGame::externalCall(ScScript *script, ScStack *stack, ScStack *thisStack
 		stack->pushString(ptr);
 
 		delete[] copy;
+		break;
 	}
 #endif
 
 	//////////////////////////////////////////////////////////////////////////
 	// Plugins: emulate object constructors from known "wme_*.dll" plugins
 	//////////////////////////////////////////////////////////////////////////
-	else if(!DID_FAIL(EmulatePluginCall(_gameRef, stack, thisStack, name))) {
-		return STATUS_OK;
-	}
+	default:
+	unknownName:
+		if(!DID_FAIL(EmulatePluginCall(_gameRef, stack, thisStack, name))) {
+			return STATUS_OK;
+		}
 
-	//////////////////////////////////////////////////////////////////////////
-	// failure
-	else {
-		script->runtimeError("Call to undefined function '%s'. Ignored.", name);
-		stack->correctParams(0);
-		stack->pushNULL();
+		//////////////////////////////////////////////////////////////////////////
+		// failure
+		else {
+			script->runtimeError("Call to undefined function '%s'. Ignored.", name);
+			stack->correctParams(0);
+			stack->pushNULL();
+		}
+		break;
 	}
 
 	return STATUS_OK;
@@ -3847,6 +3916,12 @@ bool BaseGame::persist(BasePersistenceManager *persistMgr) {
 	persistMgr->transferBool(TMEMBER(_quitting));
 
 	_regObjects.persist(persistMgr);
+	if (!persistMgr->getIsSaving()) {
+		_regObjectCount.clear();
+		for (uint32 i = 0; i < _regObjects.size(); i++) {
+			_regObjectCount[_regObjects[i]]++;
+		}
+	}
 
 	persistMgr->transferPtr(TMEMBER_PTR(_scEngine));
 	//persistMgr->transfer(TMEMBER(_soundMgr));
@@ -37,6 +37,8 @@
 #include "engines/wintermute/math/rect32.h"
 #include "engines/wintermute/debugger.h"
 #include "common/events.h"
+#include "common/hash-ptr.h"
+#include "common/hashmap.h"
 #include "common/random.h"
 #if EXTENDED_DEBUGGER_ENABLED
 #include "engines/wintermute/base/scriptables/debuggable/debuggable_script_engine.h"
@@ -209,6 +211,7 @@ public:
 	const char* getGameTargetName() const { return _targetName.c_str(); }
 	void setGameTargetName(const Common::String& targetName) { _targetName = targetName; }
 	uint32 _surfaceGCCycleTime;
+	uint32 _surfaceMemoryBudget; // bytes, 0 for no limit
 	bool _smartCache; // RO
 	bool _subtitles; // RO
 
@@ -364,6 +367,9 @@ private:
 	BaseArray<UIWindow *> _windows;
 	BaseArray<BaseViewport *> _viewportStack;
 	BaseArray<BaseObject *> _regObjects;
+	// How many times each object appears in _regObjects, for the validity checks
+	typedef Common::HashMap<BaseObject *, uint32> RegObjectCountMap;
+	RegObjectCountMap _regObjectCount;
 
 	AnsiString getDeviceType() const;
 
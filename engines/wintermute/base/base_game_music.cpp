@@ -33,6 +33,7 @@
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/sound/base_sound.h"
 
 namespace Wintermute {
@@ -249,10 +250,12 @@ bool BaseGameMusic::persistCrossfadeSettings(BasePersistenceManager *persistMgr)
 }
 
 bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// PlayMusic / PlayMusicChannel
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "PlayMusic") == 0 || strcmp(name, "PlayMusicChannel") == 0) {
+	SC_NAME_CASE("PlayMusic")
+	SC_NAME_ALIAS("PlayMusicChannel") {
 		int channel = 0;
 		if (strcmp(name, "PlayMusic") == 0) {
 			stack->correctParams(3);
@@ -280,7 +283,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// StopMusic / StopMusicChannel
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopMusic") == 0 || strcmp(name, "StopMusicChannel") == 0) {
+	SC_NAME_CASE("StopMusic")
+	SC_NAME_ALIAS("StopMusicChannel") {
 		int channel = 0;
 
 		if (strcmp(name, "StopMusic") == 0) {
@@ -301,7 +305,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// PauseMusic / PauseMusicChannel
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PauseMusic") == 0 || strcmp(name, "PauseMusicChannel") == 0) {
+	SC_NAME_CASE("PauseMusic")
+	SC_NAME_ALIAS("PauseMusicChannel") {
 		int channel = 0;
 
 		if (strcmp(name, "PauseMusic") == 0) {
@@ -322,7 +327,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// ResumeMusic / ResumeMusicChannel
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ResumeMusic") == 0 || strcmp(name, "ResumeMusicChannel") == 0) {
+	SC_NAME_CASE("ResumeMusic")
+	SC_NAME_ALIAS("ResumeMusicChannel") {
 		int channel = 0;
 		if (strcmp(name, "ResumeMusic") == 0) {
 			stack->correctParams(0);
@@ -342,7 +348,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// GetMusic / GetMusicChannel
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetMusic") == 0 || strcmp(name, "GetMusicChannel") == 0) {
+	SC_NAME_CASE("GetMusic")
+	SC_NAME_ALIAS("GetMusicChannel") {
 		int channel = 0;
 		if (strcmp(name, "GetMusic") == 0) {
 			stack->correctParams(0);
@@ -365,7 +372,9 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// SetMusicPosition / SetMusicChannelPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetMusicPosition") == 0 || strcmp(name, "SetMusicChannelPosition") == 0 || strcmp(name, "SetMusicPositionChannel") == 0) {
+	SC_NAME_CASE("SetMusicPosition")
+	SC_NAME_ALIAS("SetMusicChannelPosition")
+	SC_NAME_ALIAS("SetMusicPositionChannel") {
 		int channel = 0;
 		if (strcmp(name, "SetMusicPosition") == 0) {
 			stack->correctParams(1);
@@ -388,7 +397,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// GetMusicPosition / GetMusicChannelPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetMusicPosition") == 0 || strcmp(name, "GetMusicChannelPosition") == 0) {
+	SC_NAME_CASE("GetMusicPosition")
+	SC_NAME_ALIAS("GetMusicChannelPosition") {
 		int channel = 0;
 		if (strcmp(name, "GetMusicPosition") == 0) {
 			stack->correctParams(0);
@@ -408,7 +418,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// IsMusicPlaying / IsMusicChannelPlaying
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsMusicPlaying") == 0 || strcmp(name, "IsMusicChannelPlaying") == 0) {
+	SC_NAME_CASE("IsMusicPlaying")
+	SC_NAME_ALIAS("IsMusicChannelPlaying") {
 		int channel = 0;
 		if (strcmp(name, "IsMusicPlaying") == 0) {
 			stack->correctParams(0);
@@ -428,7 +439,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// SetMusicVolume / SetMusicChannelVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetMusicVolume") == 0 || strcmp(name, "SetMusicChannelVolume") == 0) {
+	SC_NAME_CASE("SetMusicVolume")
+	SC_NAME_ALIAS("SetMusicChannelVolume") {
 		int channel = 0;
 		if (strcmp(name, "SetMusicVolume") == 0) {
 			stack->correctParams(1);
@@ -453,7 +465,8 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// GetMusicVolume / GetMusicChannelVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetMusicVolume") == 0 || strcmp(name, "GetMusicChannelVolume") == 0) {
+	SC_NAME_CASE("GetMusicVolume")
+	SC_NAME_ALIAS("GetMusicChannelVolume") {
 		int channel = 0;
 		if (strcmp(name, "GetMusicVolume") == 0) {
 			stack->correctParams(0);
@@ -474,7 +487,7 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// MusicCrossfade
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MusicCrossfade") == 0) {
+	SC_NAME_CASE("MusicCrossfade") {
 		stack->correctParams(4);
 		int channel1 = stack->pop()->getInt(0);
 		int channel2 = stack->pop()->getInt(0);
@@ -505,7 +518,7 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// [FoxTail] MusicCrossfadeVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MusicCrossfadeVolume") == 0) {
+	SC_NAME_CASE("MusicCrossfadeVolume") {
 		stack->correctParams(4);
 		int channel = stack->pop()->getInt(0);
 		int volume1 = stack->pop()->getInt(0);
@@ -536,7 +549,7 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 	//////////////////////////////////////////////////////////////////////////
 	// GetSoundLength
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSoundLength") == 0) {
+	SC_NAME_CASE("GetSoundLength") {
 		stack->correctParams(1);
 
 		int length = 0;
@@ -550,9 +563,12 @@ bool BaseGameMusic::scCallMethod(ScScript *script, ScStack *stack, ScStack *this
 		}
 		stack->pushInt(length);
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return STATUS_FAILED;
 	}
+	}
 }
 
 } // End of namespace Wintermute
@@ -30,6 +30,7 @@
 #include "engines/wintermute/base/base_keyboard_state.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "common/system.h"
 #include "common/keyboard.h"
 
@@ -364,10 +365,11 @@ bool BaseKeyboardState::scCallMethod(ScScript *script, ScStack *stack, ScStack *
 ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("keyboard");
 		return _scValue;
 	}
@@ -375,7 +377,7 @@ ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Key
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Key") {
+	SC_NAME_CASE("Key") {
 		if (_currentPrintable) {
 			char key[2];
 			key[0] = (char)_currentCharCode;
@@ -391,7 +393,7 @@ ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Printable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Printable") {
+	SC_NAME_CASE("Printable") {
 		_scValue->setBool(_currentPrintable);
 		return _scValue;
 	}
@@ -399,7 +401,7 @@ ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// KeyCode
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "KeyCode") {
+	SC_NAME_CASE("KeyCode") {
 		_scValue->setInt(_currentCharCode);
 		return _scValue;
 	}
@@ -407,7 +409,7 @@ ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// IsShift
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "IsShift") {
+	SC_NAME_CASE("IsShift") {
 		_scValue->setBool(_currentShift);
 		return _scValue;
 	}
@@ -415,7 +417,7 @@ ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// IsAlt
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "IsAlt") {
+	SC_NAME_CASE("IsAlt") {
 		_scValue->setBool(_currentAlt);
 		return _scValue;
 	}
@@ -423,12 +425,15 @@ ScValue *BaseKeyboardState::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// IsControl
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "IsControl") {
+	SC_NAME_CASE("IsControl") {
 		_scValue->setBool(_currentControl);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptable::scGetProperty(name);
 	}
+	}
 }
 
 
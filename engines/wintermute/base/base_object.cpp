@@ -30,6 +30,7 @@
 #include "engines/wintermute/base/base_parser.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/sound/base_sound.h"
 #include "engines/wintermute/base/sound/base_sound_manager.h"
 #include "engines/wintermute/base/base_game.h"
@@ -202,10 +203,11 @@ bool BaseObject::listen(BaseScriptHolder *param1, uint32 param2) {
 //////////////////////////////////////////////////////////////////////////
 bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
 
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SkipTo
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SkipTo") == 0) {
+	SC_NAME_CASE("SkipTo") {
 		stack->correctParams(2);
 		_posX = stack->pop()->getInt();
 		_posY = stack->pop()->getInt();
@@ -218,7 +220,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// Caption
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Caption") == 0) {
+	SC_NAME_CASE("Caption") {
 		stack->correctParams(1);
 		stack->pushString(getCaption(stack->pop()->getInt()));
 
@@ -228,7 +230,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetCursor") == 0) {
+	SC_NAME_CASE("SetCursor") {
 		stack->correctParams(1);
 		if (DID_SUCCEED(setCursor(stack->pop()->getString()))) {
 			stack->pushBool(true);
@@ -242,7 +244,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveCursor") == 0) {
+	SC_NAME_CASE("RemoveCursor") {
 		stack->correctParams(0);
 		if (!_sharedCursors) {
 			delete _cursor;
@@ -259,7 +261,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetCursor") == 0) {
+	SC_NAME_CASE("GetCursor") {
 		stack->correctParams(0);
 		if (!_cursor || !_cursor->getFilename()) {
 			stack->pushNULL();
@@ -273,7 +275,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetCursorObject") == 0) {
+	SC_NAME_CASE("GetCursorObject") {
 		stack->correctParams(0);
 		if (!_cursor) {
 			stack->pushNULL();
@@ -287,7 +289,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// HasCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasCursor") == 0) {
+	SC_NAME_CASE("HasCursor") {
 		stack->correctParams(0);
 
 		if (_cursor) {
@@ -302,7 +304,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetCaption
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetCaption") == 0) {
+	SC_NAME_CASE("SetCaption") {
 		stack->correctParams(2);
 		setCaption(stack->pop()->getString(), stack->pop()->getInt());
 		stack->pushNULL();
@@ -313,7 +315,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// LoadSound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadSound") == 0) {
+	SC_NAME_CASE("LoadSound") {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 		if (DID_SUCCEED(playSFX(filename, false, false))) {
@@ -328,7 +330,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// PlaySound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlaySound") == 0) {
+	SC_NAME_CASE("PlaySound") {
 		stack->correctParams(3);
 
 		const char *filename;
@@ -364,7 +366,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// PlaySoundEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlaySoundEvent") == 0) {
+	SC_NAME_CASE("PlaySoundEvent") {
 		stack->correctParams(2);
 
 		const char *filename;
@@ -392,7 +394,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// StopSound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopSound") == 0) {
+	SC_NAME_CASE("StopSound") {
 		stack->correctParams(0);
 
 		if (DID_FAIL(stopSFX())) {
@@ -406,7 +408,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// PauseSound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PauseSound") == 0) {
+	SC_NAME_CASE("PauseSound") {
 		stack->correctParams(0);
 
 		if (DID_FAIL(pauseSFX())) {
@@ -420,7 +422,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// ResumeSound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ResumeSound") == 0) {
+	SC_NAME_CASE("ResumeSound") {
 		stack->correctParams(0);
 
 		if (DID_FAIL(resumeSFX())) {
@@ -434,7 +436,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// IsSoundPlaying
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsSoundPlaying") == 0) {
+	SC_NAME_CASE("IsSoundPlaying") {
 		stack->correctParams(0);
 
 		if (_sFX && _sFX->isPlaying()) {
@@ -448,7 +450,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetSoundPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSoundPosition") == 0) {
+	SC_NAME_CASE("SetSoundPosition") {
 		stack->correctParams(1);
 
 		uint32 time = stack->pop()->getInt();
@@ -463,7 +465,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetSoundPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSoundPosition") == 0) {
+	SC_NAME_CASE("GetSoundPosition") {
 		stack->correctParams(0);
 
 		if (!_sFX) {
@@ -477,7 +479,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetSoundVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSoundVolume") == 0) {
+	SC_NAME_CASE("SetSoundVolume") {
 		stack->correctParams(1);
 
 		int volume = stack->pop()->getInt();
@@ -492,7 +494,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetSoundVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSoundVolume") == 0) {
+	SC_NAME_CASE("GetSoundVolume") {
 		stack->correctParams(0);
 
 		if (!_sFX) {
@@ -507,7 +509,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetShadowImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetShadowImage") == 0) {
+	SC_NAME_CASE("SetShadowImage") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -529,7 +531,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetShadowImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetShadowImage") == 0) {
+	SC_NAME_CASE("GetShadowImage") {
 		stack->correctParams(0);
 
 		if (_shadowImage) {
@@ -544,7 +546,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetLightPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetLightPosition") == 0) {
+	SC_NAME_CASE("SetLightPosition") {
 		stack->correctParams(3);
 
 		double x = stack->pop()->getFloat();
@@ -564,7 +566,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	// Used to save/restore ambient sounds
 	// Should contain '\\' character, because Split("\\") is called on result 
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSoundFilename") == 0) {
+	SC_NAME_CASE("GetSoundFilename") {
 		stack->correctParams(0);
 
 		if (!_sFX) {
@@ -579,7 +581,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SoundFXNone
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundFXNone") == 0) {
+	SC_NAME_CASE("SoundFXNone") {
 		stack->correctParams(0);
 		_sFXType = SFX_NONE;
 		_sFXParam1 = 0;
@@ -594,7 +596,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SoundFXEcho
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundFXEcho") == 0) {
+	SC_NAME_CASE("SoundFXEcho") {
 		stack->correctParams(4);
 		_sFXType = SFX_ECHO;
 		_sFXParam1 = (float)stack->pop()->getFloat(0); // Wet/Dry Mix [%] (0-100)
@@ -609,7 +611,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SoundFXReverb
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundFXReverb") == 0) {
+	SC_NAME_CASE("SoundFXReverb") {
 		stack->correctParams(4);
 		_sFXType = SFX_REVERB;
 		_sFXParam1 = (float)stack->pop()->getFloat(0); // In Gain [dB] (-96 - 0)
@@ -619,9 +621,12 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 		stack->pushNULL();
 
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptHolder::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -629,10 +634,11 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("object");
 		return _scValue;
 	}
@@ -640,7 +646,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Caption
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Caption") {
+	SC_NAME_CASE("Caption") {
 		_scValue->setString(getCaption(1));
 		return _scValue;
 	}
@@ -648,7 +654,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// X
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "X") {
+	SC_NAME_CASE("X") {
 		_scValue->setInt(_posX);
 		return _scValue;
 	}
@@ -656,7 +662,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Y
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Y") {
+	SC_NAME_CASE("Y") {
 		_scValue->setInt(_posY);
 		return _scValue;
 	}
@@ -664,7 +670,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Height (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Height") {
+	SC_NAME_CASE("Height") {
 		_scValue->setInt(getHeight());
 		return _scValue;
 	}
@@ -672,7 +678,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Ready (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Ready") {
+	SC_NAME_CASE("Ready") {
 		_scValue->setBool(_ready);
 		return _scValue;
 	}
@@ -680,7 +686,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Movable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Movable") {
+	SC_NAME_CASE("Movable") {
 		_scValue->setBool(_movable);
 		return _scValue;
 	}
@@ -688,7 +694,8 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Registrable/Interactive
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Registrable" || name == "Interactive") {
+	SC_NAME_CASE("Registrable")
+	SC_NAME_ALIAS("Interactive") {
 		_scValue->setBool(_registrable);
 		return _scValue;
 	}
@@ -696,21 +703,22 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Zoomable/Scalable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Zoomable" || name == "Scalable") {
+	SC_NAME_CASE("Zoomable")
+	SC_NAME_ALIAS("Scalable") {
 		_scValue->setBool(_zoomable);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Rotatable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Rotatable") {
+	SC_NAME_CASE("Rotatable") {
 		_scValue->setBool(_rotatable);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AlphaColor") {
+	SC_NAME_CASE("AlphaColor") {
 		_scValue->setInt((int)_alphaColor);
 		return _scValue;
 	}
@@ -718,7 +726,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// BlendMode
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "BlendMode") {
+	SC_NAME_CASE("BlendMode") {
 		_scValue->setInt((int)_blendMode);
 		return _scValue;
 	}
@@ -726,7 +734,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Scale") {
+	SC_NAME_CASE("Scale") {
 		if (_scale < 0) {
 			_scValue->setNULL();
 		} else {
@@ -738,7 +746,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScaleX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScaleX") {
+	SC_NAME_CASE("ScaleX") {
 		if (_scaleX < 0) {
 			_scValue->setNULL();
 		} else {
@@ -750,7 +758,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScaleY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScaleY") {
+	SC_NAME_CASE("ScaleY") {
 		if (_scaleY < 0) {
 			_scValue->setNULL();
 		} else {
@@ -762,7 +770,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// RelativeScale
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "RelativeScale") {
+	SC_NAME_CASE("RelativeScale") {
 		_scValue->setFloat((double)_relativeScale);
 		return _scValue;
 	}
@@ -770,7 +778,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Rotate
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Rotate") {
+	SC_NAME_CASE("Rotate") {
 		if (!_rotateValid) {
 			_scValue->setNULL();
 		} else {
@@ -782,7 +790,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// RelativeRotate
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "RelativeRotate") {
+	SC_NAME_CASE("RelativeRotate") {
 		_scValue->setFloat((double)_relativeRotate);
 		return _scValue;
 	}
@@ -790,14 +798,14 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Colorable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Colorable") {
+	SC_NAME_CASE("Colorable") {
 		_scValue->setBool(_shadowable);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// SoundPanning
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SoundPanning") {
+	SC_NAME_CASE("SoundPanning") {
 		_scValue->setBool(_autoSoundPanning);
 		return _scValue;
 	}
@@ -805,7 +813,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SaveState
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SaveState") {
+	SC_NAME_CASE("SaveState") {
 		_scValue->setBool(_saveState);
 		return _scValue;
 	}
@@ -813,7 +821,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NonIntMouseEvents
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NonIntMouseEvents") {
+	SC_NAME_CASE("NonIntMouseEvents") {
 		_scValue->setBool(_nonIntMouseEvents);
 		return _scValue;
 	}
@@ -821,21 +829,25 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccCaption
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccCaption") {
+	SC_NAME_CASE("AccCaption") {
 		_scValue->setNULL();
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptHolder::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseObject::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Caption
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Caption") == 0) {
+	SC_NAME_CASE("Caption") {
 		setCaption(value->getString());
 		return STATUS_OK;
 	}
@@ -843,7 +855,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// X
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "X") == 0) {
+	SC_NAME_CASE("X") {
 		_posX = value->getInt();
 		afterMove();
 		return STATUS_OK;
@@ -852,7 +864,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Y
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Y") == 0) {
+	SC_NAME_CASE("Y") {
 		_posY = value->getInt();
 		afterMove();
 		return STATUS_OK;
@@ -861,7 +873,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Movable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Movable") == 0) {
+	SC_NAME_CASE("Movable") {
 		_movable = value->getBool();
 		return STATUS_OK;
 	}
@@ -869,7 +881,8 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Registrable/Interactive
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Registrable") == 0 || strcmp(name, "Interactive") == 0) {
+	SC_NAME_CASE("Registrable")
+	SC_NAME_ALIAS("Interactive") {
 		_registrable = value->getBool();
 		return STATUS_OK;
 	}
@@ -877,7 +890,8 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Zoomable/Scalable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Zoomable") == 0 || strcmp(name, "Scalable") == 0) {
+	SC_NAME_CASE("Zoomable")
+	SC_NAME_ALIAS("Scalable") {
 		_zoomable = value->getBool();
 		return STATUS_OK;
 	}
@@ -885,7 +899,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Rotatable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Rotatable") == 0) {
+	SC_NAME_CASE("Rotatable") {
 		_rotatable = value->getBool();
 		return STATUS_OK;
 	}
@@ -893,7 +907,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AlphaColor") == 0) {
+	SC_NAME_CASE("AlphaColor") {
 		_alphaColor = (uint32)value->getInt();
 		return STATUS_OK;
 	}
@@ -901,7 +915,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// BlendMode
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "BlendMode") == 0) {
+	SC_NAME_CASE("BlendMode") {
 		int i = value->getInt();
 		if (i < Graphics::BLEND_NORMAL || i >= Graphics::NUM_BLEND_MODES) {
 			i = Graphics::BLEND_NORMAL;
@@ -913,7 +927,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Scale") == 0) {
+	SC_NAME_CASE("Scale") {
 		if (value->isNULL()) {
 			_scale = -1;
 		} else {
@@ -925,7 +939,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScaleX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScaleX") == 0) {
+	SC_NAME_CASE("ScaleX") {
 		if (value->isNULL()) {
 			_scaleX = -1;
 		} else {
@@ -937,7 +951,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ScaleY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScaleY") == 0) {
+	SC_NAME_CASE("ScaleY") {
 		if (value->isNULL()) {
 			_scaleY = -1;
 		} else {
@@ -949,7 +963,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// RelativeScale
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RelativeScale") == 0) {
+	SC_NAME_CASE("RelativeScale") {
 		_relativeScale = (float)value->getFloat();
 		return STATUS_OK;
 	}
@@ -957,7 +971,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Rotate
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Rotate") == 0) {
+	SC_NAME_CASE("Rotate") {
 		if (value->isNULL()) {
 			_rotate = 0.0f;
 			_rotateValid = false;
@@ -971,7 +985,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// RelativeRotate
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RelativeRotate") == 0) {
+	SC_NAME_CASE("RelativeRotate") {
 		_relativeRotate = (float)value->getFloat();
 		return STATUS_OK;
 	}
@@ -979,7 +993,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Colorable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Colorable") == 0) {
+	SC_NAME_CASE("Colorable") {
 		_shadowable = value->getBool();
 		return STATUS_OK;
 	}
@@ -987,7 +1001,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SoundPanning
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundPanning") == 0) {
+	SC_NAME_CASE("SoundPanning") {
 		_autoSoundPanning = value->getBool();
 		if (!_autoSoundPanning) {
 			resetSoundPan();
@@ -998,7 +1012,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SaveState
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SaveState") == 0) {
+	SC_NAME_CASE("SaveState") {
 		_saveState = value->getBool();
 		return STATUS_OK;
 	}
@@ -1006,7 +1020,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// NonIntMouseEvents
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "NonIntMouseEvents") == 0) {
+	SC_NAME_CASE("NonIntMouseEvents") {
 		_nonIntMouseEvents = value->getBool();
 		return STATUS_OK;
 	}
@@ -1014,11 +1028,14 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccCaption
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AccCaption") == 0) {
+	SC_NAME_CASE("AccCaption") {
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptHolder::scSetProperty(name, value);
 	}
+	}
 }
 
 
@@ -34,6 +34,7 @@
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/platform_osystem.h"
 
@@ -224,10 +225,11 @@ bool BaseRegion::loadBuffer(char *buffer, bool complete) {
 //////////////////////////////////////////////////////////////////////////
 bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
 
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// AddPoint
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "AddPoint") == 0) {
+	SC_NAME_CASE("AddPoint") {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -243,7 +245,7 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// InsertPoint
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InsertPoint") == 0) {
+	SC_NAME_CASE("InsertPoint") {
 		stack->correctParams(3);
 		int index = stack->pop()->getInt();
 		int x = stack->pop()->getInt();
@@ -264,7 +266,7 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetPoint
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetPoint") == 0) {
+	SC_NAME_CASE("SetPoint") {
 		stack->correctParams(3);
 		int index = stack->pop()->getInt();
 		int x = stack->pop()->getInt();
@@ -286,7 +288,7 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// RemovePoint
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemovePoint") == 0) {
+	SC_NAME_CASE("RemovePoint") {
 		stack->correctParams(1);
 		int index = stack->pop()->getInt();
 
@@ -308,7 +310,7 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetPoint
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetPoint") == 0) {
+	SC_NAME_CASE("GetPoint") {
 		stack->correctParams(1);
 		int index = stack->pop()->getInt();
 
@@ -323,9 +325,12 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 		}
 
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -333,10 +338,11 @@ bool BaseRegion::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 ScValue *BaseRegion::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("region");
 		return _scValue;
 	}
@@ -344,7 +350,7 @@ ScValue *BaseRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Name") {
+	SC_NAME_CASE("Name") {
 		_scValue->setString(getName());
 		return _scValue;
 	}
@@ -352,7 +358,7 @@ ScValue *BaseRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Active
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Active") {
+	SC_NAME_CASE("Active") {
 		_scValue->setBool(_active);
 		return _scValue;
 	}
@@ -360,12 +366,15 @@ ScValue *BaseRegion::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumPoints
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumPoints") {
+	SC_NAME_CASE("NumPoints") {
 		_scValue->setInt(_points.size());
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scGetProperty(name);
 	}
+	}
 }
 
 
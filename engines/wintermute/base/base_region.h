@@ -46,7 +46,7 @@ public:
 	BaseRegion(BaseGame *inGame);
 	~BaseRegion() override;
 	bool pointInRegion(int x, int y);
-	bool createRegion();
+	virtual bool createRegion();
 	bool loadFile(const char *filename);
 	bool loadBuffer(char *buffer, bool complete = true);
 	Rect32 _rect;
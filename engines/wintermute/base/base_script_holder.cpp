@@ -34,6 +34,7 @@
 #include "engines/wintermute/base/scriptables/script_engine.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 
 namespace Wintermute {
 
@@ -117,10 +118,11 @@ bool BaseScriptHolder::listen(BaseScriptHolder *param1, uint32 param2) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// DEBUG_CrashMe
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "DEBUG_CrashMe") == 0) {
+	SC_NAME_CASE("DEBUG_CrashMe") {
 		stack->correctParams(0);
 		byte *p = 0;
 		*p = 10;
@@ -132,7 +134,7 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 	//////////////////////////////////////////////////////////////////////////
 	// ApplyEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ApplyEvent") == 0) {
+	SC_NAME_CASE("ApplyEvent") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		bool ret;
@@ -150,7 +152,7 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 	//////////////////////////////////////////////////////////////////////////
 	// CanHandleEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CanHandleEvent") == 0) {
+	SC_NAME_CASE("CanHandleEvent") {
 		stack->correctParams(1);
 		stack->pushBool(canHandleEvent(stack->pop()->getString()));
 
@@ -160,7 +162,7 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 	//////////////////////////////////////////////////////////////////////////
 	// CanHandleMethod
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CanHandleMethod") == 0) {
+	SC_NAME_CASE("CanHandleMethod") {
 		stack->correctParams(1);
 		stack->pushBool(canHandleMethod(stack->pop()->getString()));
 
@@ -170,7 +172,7 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 	//////////////////////////////////////////////////////////////////////////
 	// AttachScript
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AttachScript") == 0) {
+	SC_NAME_CASE("AttachScript") {
 		stack->correctParams(1);
 		stack->pushBool(DID_SUCCEED(addScript(stack->pop()->getString())));
 
@@ -180,7 +182,7 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 	//////////////////////////////////////////////////////////////////////////
 	// DetachScript
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DetachScript") == 0) {
+	SC_NAME_CASE("DetachScript") {
 		stack->correctParams(2);
 		const char *filename = stack->pop()->getString();
 		bool killThreads = stack->pop()->getBool(false);
@@ -200,7 +202,7 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 	//////////////////////////////////////////////////////////////////////////
 	// IsScriptRunning
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsScriptRunning") == 0) {
+	SC_NAME_CASE("IsScriptRunning") {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 		bool ret = false;
@@ -213,9 +215,12 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 		stack->pushBool(ret);
 
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptable::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -223,10 +228,11 @@ bool BaseScriptHolder::scCallMethod(ScScript *script, ScStack *stack, ScStack *t
 ScValue *BaseScriptHolder::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("script_holder");
 		return _scValue;
 	}
@@ -234,7 +240,7 @@ ScValue *BaseScriptHolder::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Name") {
+	SC_NAME_CASE("Name") {
 		_scValue->setString(getName());
 		return _scValue;
 	}
@@ -242,12 +248,15 @@ ScValue *BaseScriptHolder::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Filename (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Filename") {
+	SC_NAME_CASE("Filename") {
 		_scValue->setString(_filename);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptable::scGetProperty(name);
 	}
+	}
 }
 
 
@@ -41,6 +41,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/detection.h"
 
 namespace Wintermute {
@@ -565,10 +566,11 @@ bool BaseSprite::persist(BasePersistenceManager *persistMgr) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetFrame
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetFrame") == 0) {
+	SC_NAME_CASE("GetFrame") {
 		stack->correctParams(1);
 		int index = stack->pop()->getInt(-1);
 		if (index < 0 || index >= (int32)_frames.size()) {
@@ -583,7 +585,7 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteFrame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteFrame") == 0) {
+	SC_NAME_CASE("DeleteFrame") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		if (val->isInt()) {
@@ -611,7 +613,7 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// Reset
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Reset") == 0) {
+	SC_NAME_CASE("Reset") {
 		stack->correctParams(0);
 		reset();
 		stack->pushNULL();
@@ -621,7 +623,7 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// AddFrame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddFrame") == 0) {
+	SC_NAME_CASE("AddFrame") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		const char *filename = nullptr;
@@ -648,7 +650,7 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// InsertFrame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InsertFrame") == 0) {
+	SC_NAME_CASE("InsertFrame") {
 		stack->correctParams(2);
 		int index = stack->pop()->getInt();
 		if (index < 0) {
@@ -684,7 +686,7 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// Pause
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Pause") == 0) {
+	SC_NAME_CASE("Pause") {
 		stack->correctParams(0);
 		_paused = true;
 		stack->pushNULL();
@@ -694,14 +696,17 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// Play
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Play") == 0) {
+	SC_NAME_CASE("Play") {
 		stack->correctParams(0);
 		_paused = false;
 		stack->pushNULL();
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptHolder::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -709,10 +714,11 @@ bool BaseSprite::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("sprite");
 		return _scValue;
 	}
@@ -720,7 +726,7 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumFrames (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumFrames") {
+	SC_NAME_CASE("NumFrames") {
 		_scValue->setInt(_frames.size());
 		return _scValue;
 	}
@@ -728,7 +734,7 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CurrentFrame
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CurrentFrame") {
+	SC_NAME_CASE("CurrentFrame") {
 		_scValue->setInt(_currentFrame);
 		return _scValue;
 	}
@@ -736,7 +742,7 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PixelPerfect
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PixelPerfect") {
+	SC_NAME_CASE("PixelPerfect") {
 		_scValue->setBool(_precise);
 		return _scValue;
 	}
@@ -744,7 +750,7 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Looping
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Looping") {
+	SC_NAME_CASE("Looping") {
 		_scValue->setBool(_looping);
 		return _scValue;
 	}
@@ -752,7 +758,7 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Owner (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Owner") {
+	SC_NAME_CASE("Owner") {
 		if (_owner == nullptr) {
 			_scValue->setNULL();
 		} else {
@@ -764,7 +770,7 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Finished (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Finished") {
+	SC_NAME_CASE("Finished") {
 		_scValue->setBool(_finished);
 		return _scValue;
 	}
@@ -772,21 +778,25 @@ ScValue *BaseSprite::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Paused (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Paused") {
+	SC_NAME_CASE("Paused") {
 		_scValue->setBool(_paused);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptHolder::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseSprite::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// CurrentFrame
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "CurrentFrame") == 0) {
+	SC_NAME_CASE("CurrentFrame") {
 		_currentFrame = value->getInt(0);
 		if (_currentFrame >= (int32)_frames.size() || _currentFrame < 0) {
 			_currentFrame = -1;
@@ -798,7 +808,7 @@ bool BaseSprite::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// PixelPerfect
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PixelPerfect") == 0) {
+	SC_NAME_CASE("PixelPerfect") {
 		_precise = value->getBool();
 		return STATUS_OK;
 	}
@@ -806,12 +816,15 @@ bool BaseSprite::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Looping
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Looping") == 0) {
+	SC_NAME_CASE("Looping") {
 		_looping = value->getBool();
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptHolder::scSetProperty(name, value);
 	}
+	}
 }
 
 
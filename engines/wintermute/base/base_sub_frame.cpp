@@ -37,6 +37,7 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "graphics/transform_tools.h"
 #include "graphics/transform_struct.h"
 
@@ -420,10 +421,11 @@ bool BaseSubFrame::persist(BasePersistenceManager *persistMgr) {
 //////////////////////////////////////////////////////////////////////////
 bool BaseSubFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
 
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetImage
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetImage") == 0) {
+	SC_NAME_CASE("GetImage") {
 		stack->correctParams(0);
 
 		if (!_surfaceFilename) {
@@ -440,7 +442,7 @@ bool BaseSubFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	// Used to find sprite center at methods.script in fix_offset()
 	// Return value is integer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHeight") == 0) {
+	SC_NAME_CASE("GetHeight") {
 		stack->correctParams(0);
 		if (_surface) {
 			stack->pushInt(_surface->getHeight());
@@ -455,7 +457,7 @@ bool BaseSubFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	// Used to find sprite center at methods.script in fix_offset()
 	// Return value is integer
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetWidth") == 0) {
+	SC_NAME_CASE("GetWidth") {
 		stack->correctParams(0);
 		if (_surface) {
 			stack->pushInt(_surface->getWidth());
@@ -470,7 +472,7 @@ bool BaseSubFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	// Used for dynamic light at mixing.script in make_RGB() and make_HSV()
 	// Return value is passed to Game.GetRValue(), Game.GetGValue(), etc...
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetPixelAt") == 0) {
+	SC_NAME_CASE("GetPixelAt") {
 		stack->correctParams(2);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -488,7 +490,7 @@ bool BaseSubFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 	//////////////////////////////////////////////////////////////////////////
 	// SetImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetImage") == 0) {
+	SC_NAME_CASE("SetImage") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -510,9 +512,12 @@ bool BaseSubFrame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisS
 		}
 
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptable::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -523,10 +528,11 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	}
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("subframe");
 		return _scValue;
 	}
@@ -534,7 +540,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AlphaColor") {
+	SC_NAME_CASE("AlphaColor") {
 
 		_scValue->setInt((int)_alpha);
 		return _scValue;
@@ -543,7 +549,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TransparentColor (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TransparentColor") {
+	SC_NAME_CASE("TransparentColor") {
 		_scValue->setInt((int)_transparent);
 		return _scValue;
 	}
@@ -551,7 +557,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Is2DOnly
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Is2DOnly") {
+	SC_NAME_CASE("Is2DOnly") {
 		_scValue->setBool(_2DOnly);
 		return _scValue;
 	}
@@ -559,7 +565,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Is3DOnly
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Is3DOnly") {
+	SC_NAME_CASE("Is3DOnly") {
 		_scValue->setBool(_3DOnly);
 		return _scValue;
 	}
@@ -567,7 +573,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MirrorX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MirrorX") {
+	SC_NAME_CASE("MirrorX") {
 		_scValue->setBool(_mirrorX);
 		return _scValue;
 	}
@@ -575,7 +581,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MirrorY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MirrorY") {
+	SC_NAME_CASE("MirrorY") {
 		_scValue->setBool(_mirrorY);
 		return _scValue;
 	}
@@ -583,7 +589,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Decoration
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Decoration") {
+	SC_NAME_CASE("Decoration") {
 		_scValue->setBool(_decoration);
 		return _scValue;
 	}
@@ -591,7 +597,7 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// HotspotX
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "HotspotX") {
+	SC_NAME_CASE("HotspotX") {
 		_scValue->setInt(_hotspotX);
 		return _scValue;
 	}
@@ -599,21 +605,25 @@ ScValue *BaseSubFrame::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// HotspotY
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "HotspotY") {
+	SC_NAME_CASE("HotspotY") {
 		_scValue->setInt(_hotspotY);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptable::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaColor
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "AlphaColor") == 0) {
+	SC_NAME_CASE("AlphaColor") {
 		_alpha = (uint32)value->getInt();
 		return STATUS_OK;
 	}
@@ -621,7 +631,7 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Is2DOnly
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Is2DOnly") == 0) {
+	SC_NAME_CASE("Is2DOnly") {
 		_2DOnly = value->getBool();
 		return STATUS_OK;
 	}
@@ -629,7 +639,7 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Is3DOnly
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Is3DOnly") == 0) {
+	SC_NAME_CASE("Is3DOnly") {
 		_3DOnly = value->getBool();
 		return STATUS_OK;
 	}
@@ -637,7 +647,7 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MirrorX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MirrorX") == 0) {
+	SC_NAME_CASE("MirrorX") {
 		_mirrorX = value->getBool();
 		return STATUS_OK;
 	}
@@ -645,7 +655,7 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MirrorY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MirrorY") == 0) {
+	SC_NAME_CASE("MirrorY") {
 		_mirrorY = value->getBool();
 		return STATUS_OK;
 	}
@@ -653,7 +663,7 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Decoration
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Decoration") == 0) {
+	SC_NAME_CASE("Decoration") {
 		_decoration = value->getBool();
 		return STATUS_OK;
 	}
@@ -661,7 +671,7 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// HotspotX
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HotspotX") == 0) {
+	SC_NAME_CASE("HotspotX") {
 		_hotspotX = value->getInt();
 		return STATUS_OK;
 	}
@@ -669,12 +679,15 @@ bool BaseSubFrame::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// HotspotY
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HotspotY") == 0) {
+	SC_NAME_CASE("HotspotY") {
 		_hotspotY = value->getInt();
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptable::scSetProperty(name, value);
 	}
+	}
 }
 
 
@@ -33,6 +33,8 @@
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/platform_osystem.h"
+#include "common/algorithm.h"
+#include "common/array.h"
 #include "common/str.h"
 
 namespace Wintermute {
@@ -42,6 +44,7 @@ namespace Wintermute {
 //////////////////////////////////////////////////////////////////////
 BaseSurfaceStorage::BaseSurfaceStorage(BaseGame *inGame) : BaseClass(inGame) {
 	_lastCleanupTime = 0;
+	_memoryCheckPending = false;
 }
 
 
@@ -53,13 +56,14 @@ BaseSurfaceStorage::~BaseSurfaceStorage() {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseSurfaceStorage::cleanup(bool warn) {
-	for (uint32 i = 0; i < _surfaces.size(); i++) {
+	for (SurfaceMap::iterator it = _surfaces.begin(); it != _surfaces.end(); ++it) {
 		if (warn) {
-			BaseEngine::LOG(0, "BaseSurfaceStorage warning: purging surface '%s', usage:%d", _surfaces[i]->getFileName(), _surfaces[i]->_referenceCount);
+			BaseEngine::LOG(0, "BaseSurfaceStorage warning: purging surface '%s', usage:%d", it->_value->getFileName(), it->_value->_referenceCount);
 		}
-		delete _surfaces[i];
+		delete it->_value;
 	}
 	_surfaces.clear();
+	_memoryCheckPending = false;
 
 	return STATUS_OK;
 }
@@ -69,33 +73,94 @@ bool BaseSurfaceStorage::cleanup(bool warn) {
 bool BaseSurfaceStorage::initLoop() {
 	if (_gameRef->_smartCache && _gameRef->getLiveTimer()->getTime() - _lastCleanupTime >= _gameRef->_surfaceGCCycleTime) {
 		_lastCleanupTime = _gameRef->getLiveTimer()->getTime();
-		sortSurfaces();
-		for (uint32 i = 0; i < _surfaces.size(); i++) {
-			if (_surfaces[i]->_lifeTime <= 0) {
-				break;
-			}
-
-			if (_surfaces[i]->_lifeTime > 0 && _surfaces[i]->_valid && (int)(_gameRef->getLiveTimer()->getTime() - _surfaces[i]->_lastUsedTime) >= _surfaces[i]->_lifeTime) {
-				//_gameRef->QuickMessageForm("Invalidating: %s", _surfaces[i]->_filename);
-				_surfaces[i]->invalidate();
+		for (SurfaceMap::iterator it = _surfaces.begin(); it != _surfaces.end(); ++it) {
+			BaseSurface *surface = it->_value;
+			if (surface->_lifeTime > 0 && surface->_valid && (int)(_gameRef->getLiveTimer()->getTime() - surface->_lastUsedTime) >= surface->_lifeTime) {
+				//_gameRef->QuickMessageForm("Invalidating: %s", surface->_filename);
+				surface->invalidate();
 			}
 		}
+		_memoryCheckPending = true;
+	}
+
+	if (_gameRef->_smartCache && _memoryCheckPending) {
+		enforceMemoryBudget();
 	}
 	return STATUS_OK;
 }
 
 
-//////////////////////////////////////////////////////////////////////
-bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
-	for (uint32 i = 0; i < _surfaces.size(); i++) {
-		if (_surfaces[i] == surface) {
-			_surfaces[i]->_referenceCount--;
-			if (_surfaces[i]->_referenceCount <= 0) {
-				delete _surfaces[i];
-				_surfaces.remove_at(i);
-			}
+//////////////////////////////////////////////////////////////////////////
+void BaseSurfaceStorage::enforceMemoryBudget() {
+	_memoryCheckPending = false;
+
+	uint32 budget = _gameRef->_surfaceMemoryBudget;
+	if (budget == 0) {
+		return;
+	}
+
+	// Only the surfaces with a limited life time may be evicted
+	Common::Array<BaseSurface *> candidates;
+	uint32 used = 0;
+	for (SurfaceMap::iterator it = _surfaces.begin(); it != _surfaces.end(); ++it) {
+		BaseSurface *surface = it->_value;
+		if (surface->_lifeTime > 0 && surface->_valid) {
+			candidates.push_back(surface);
+			used += getSurfaceMemory(surface);
+		}
+	}
+	if (used <= budget) {
+		return;
+	}
+
+	Common::sort(candidates.begin(), candidates.end(), surfaceUseCB);
+
+	// The surfaces drawn during this frame are kept, they would be reloaded right away
+	uint32 now = _gameRef->getLiveTimer()->getTime();
+	for (uint32 i = 0; i < candidates.size() && used > budget; i++) {
+		BaseSurface *surface = candidates[i];
+		if (surface->_lastUsedTime == now) {
 			break;
 		}
+		// Measured first, the size of an invalidated surface would load it again
+		uint32 surfaceMemory = getSurfaceMemory(surface);
+		if (DID_SUCCEED(surface->invalidate())) {
+			used -= surfaceMemory;
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool BaseSurfaceStorage::surfaceUseCB(const BaseSurface *s1, const BaseSurface *s2) {
+	// least recently used first
+	return s1->_lastUsedTime < s2->_lastUsedTime;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+uint32 BaseSurfaceStorage::getSurfaceMemory(BaseSurface *surface) {
+	return surface->getWidth() * surface->getHeight() * 4;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+void BaseSurfaceStorage::requestMemoryCheck() {
+	_memoryCheckPending = true;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
+	SurfaceMap::iterator it = _surfaces.find(surface->getFileNameStr());
+	if (it == _surfaces.end() || it->_value != surface) {
+		return STATUS_OK;
+	}
+
+	surface->_referenceCount--;
+	if (surface->_referenceCount <= 0) {
+		_surfaces.erase(it);
+		delete surface;
 	}
 	return STATUS_OK;
 }
@@ -103,11 +168,10 @@ bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 
 //////////////////////////////////////////////////////////////////////
 BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool defaultCK, byte ckRed, byte ckGreen, byte ckBlue, int lifeTime, bool keepLoaded) {
-	for (uint32 i = 0; i < _surfaces.size(); i++) {
-		if (scumm_stricmp(_surfaces[i]->getFileName(), filename.c_str()) == 0) {
-			_surfaces[i]->_referenceCount++;
-			return _surfaces[i];
-		}
+	SurfaceMap::iterator it = _surfaces.find(filename);
+	if (it != _surfaces.end()) {
+		it->_value->_referenceCount++;
+		return it->_value;
 	}
 
 	if (!BaseFileManager::getEngineInstance()->hasFile(filename)) {
@@ -133,7 +197,11 @@ BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool
 		return nullptr;
 	} else {
 		surface->_referenceCount = 1;
-		_surfaces.push_back(surface);
+		_surfaces[surface->getFileNameStr()] = surface;
+		if (surface->_lifeTime > 0) {
+			surface->_lastUsedTime = _gameRef->getLiveTimer()->getTime();
+			_memoryCheckPending = true;
+		}
 		return surface;
 	}
 }
@@ -142,8 +210,8 @@ BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool
 //////////////////////////////////////////////////////////////////////
 bool BaseSurfaceStorage::restoreAll() {
 	bool ret;
-	for (uint32 i = 0; i < _surfaces.size(); i++) {
-		ret = _surfaces[i]->restore();
+	for (SurfaceMap::iterator it = _surfaces.begin(); it != _surfaces.end(); ++it) {
+		ret = it->_value->restore();
 		if (ret != STATUS_OK) {
 			BaseEngine::LOG(0, "BaseSurfaceStorage::RestoreAll failed");
 			return ret;
@@ -169,38 +237,4 @@ bool BaseSurfaceStorage::persist(BasePersistenceManager *persistMgr)
 */
 
 
-//////////////////////////////////////////////////////////////////////////
-bool BaseSurfaceStorage::sortSurfaces() {
-	Common::sort(_surfaces.begin(), _surfaces.end(), surfaceSortCB);
-	return STATUS_OK;
-}
-
-
-//////////////////////////////////////////////////////////////////////////
-bool BaseSurfaceStorage::surfaceSortCB(const BaseSurface *s1, const BaseSurface *s2) {
-	// sort by life time
-	if (s1->_lifeTime <= 0 && s2->_lifeTime > 0) {
-		return false;
-	} else if (s1->_lifeTime > 0 && s2->_lifeTime <= 0) {
-		return true;
-	}
-
-
-	// sort by validity
-	if (s1->_valid && !s2->_valid) {
-		return true;
-	} else if (!s1->_valid && s2->_valid) {
-		return false;
-	}
-
-	// sort by time
-	else if (s1->_lastUsedTime > s2->_lastUsedTime) {
-		return false;
-	} else if (s1->_lastUsedTime < s2->_lastUsedTime) {
-		return true;
-	} else {
-		return false;
-	}
-}
-
 } // End of namespace Wintermute
@@ -30,7 +30,8 @@
 #define WINTERMUTE_BASE_SURFACE_STORAGE_H
 
 #include "engines/wintermute/base/base.h"
-#include "common/array.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
 
 namespace Wintermute {
 class BaseSurface;
@@ -38,18 +39,24 @@ class BaseSurfaceStorage : public BaseClass {
 public:
 	uint32 _lastCleanupTime;
 	bool initLoop();
-	bool sortSurfaces();
-	static bool surfaceSortCB(const BaseSurface *arg1, const BaseSurface *arg2);
 	bool cleanup(bool warn = false);
 	//DECLARE_PERSISTENT(BaseSurfaceStorage, BaseClass);
 
 	bool restoreAll();
 	BaseSurface *addSurface(const Common::String &filename, bool defaultCK = true, byte ckRed = 0, byte ckGreen = 0, byte ckBlue = 0, int lifeTime = -1, bool keepLoaded = false);
 	bool removeSurface(BaseSurface *surface);
+	void requestMemoryCheck();
 	BaseSurfaceStorage(BaseGame *inGame);
 	~BaseSurfaceStorage() override;
 
-	Common::Array<BaseSurface *> _surfaces;
+	typedef Common::HashMap<Common::String, BaseSurface *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> SurfaceMap;
+	SurfaceMap _surfaces;
+private:
+	void enforceMemoryBudget();
+	static uint32 getSurfaceMemory(BaseSurface *surface);
+	static bool surfaceUseCB(const BaseSurface *s1, const BaseSurface *s2);
+
+	bool _memoryCheckPending;
 };
 
 } // End of namespace Wintermute
@@ -29,13 +29,12 @@
 #include "engines/wintermute/base/file/base_file_entry.h"
 #include "engines/wintermute/base/file/base_package.h"
 #include "common/stream.h"
-#include "common/substream.h"
 #include "common/zlib.h"
 
 namespace Wintermute {
 
 Common::SeekableReadStream *BaseFileEntry::createReadStream() const {
-	Common::SeekableReadStream *file = _package->getFilePointer();
+	Common::SeekableReadStream *file = _package->createReadStream(_offset, _offset + _length);
 	if (!file) {
 		return nullptr;
 	}
@@ -43,9 +42,7 @@ Common::SeekableReadStream *BaseFileEntry::createReadStream() const {
 	bool compressed = (_compressedLength != 0);
 
 	if (compressed) {
-		file = Common::wrapCompressedReadStream(new Common::SeekableSubReadStream(file, _offset, _offset + _length, DisposeAfterUse::YES), _length); //
-	} else {
-		file = new Common::SeekableSubReadStream(file, _offset, _offset + _length, DisposeAfterUse::YES);
+		file = Common::wrapCompressedReadStream(file, _length);
 	}
 
 	file->seek(0);
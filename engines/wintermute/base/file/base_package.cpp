@@ -32,7 +32,9 @@
 #include "engines/wintermute/base/file/dcpackage.h"
 #include "engines/wintermute/wintermute.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/stream.h"
+#include "common/substream.h"
 #include "common/debug.h"
 
 namespace Wintermute {
@@ -42,12 +44,27 @@ BasePackage::BasePackage() {
 	_cd = 0;
 	_priority = 0;
 	_boundToExe = false;
+	_mappedStream = nullptr;
 }
 
-Common::SeekableReadStream *BasePackage::getFilePointer() {
-	Common::SeekableReadStream *stream = _fsnode.createReadStream();
+BasePackage::~BasePackage() {
+	delete _mappedStream;
+}
+
+Common::SeekableReadStream *BasePackage::createReadStream(uint32 begin, uint32 end) {
+	if (!_mappedStream) {
+		Common::SeekableReadStream *stream = _fsnode.createReadStream();
+		if (!stream) {
+			return nullptr;
+		}
+
+		_mappedStream = dynamic_cast<Common::SharedMemoryReadStream *>(stream);
+		if (!_mappedStream) {
+			return new Common::SeekableSubReadStream(stream, begin, end, DisposeAfterUse::YES);
+		}
+	}
 
-	return stream;
+	return _mappedStream->createRangeStream(begin, end);
 }
 
 static bool findPackageSignature(Common::SeekableReadStream *f, uint32 *offset) {
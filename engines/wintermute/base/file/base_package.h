@@ -33,16 +33,25 @@
 #include "common/stream.h"
 #include "common/fs.h"
 
+namespace Common {
+class SharedMemoryReadStream;
+}
+
 namespace Wintermute {
 class BasePackage {
 public:
-	Common::SeekableReadStream *getFilePointer();
+	Common::SeekableReadStream *createReadStream(uint32 begin, uint32 end);
 	Common::FSNode _fsnode;
 	bool _boundToExe;
 	byte _priority;
 	Common::String _name;
 	int32 _cd;
 	BasePackage();
+	~BasePackage();
+
+private:
+	// The package file once it is mapped into memory, the files are views into it
+	Common::SharedMemoryReadStream *_mappedStream;
 };
 
 class PackageSet : public Common::Archive {
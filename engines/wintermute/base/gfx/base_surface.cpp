@@ -28,6 +28,7 @@
 
 #include "engines/wintermute/wintypes.h"
 #include "engines/wintermute/base/base_game.h"
+#include "engines/wintermute/base/base_surface_storage.h"
 #include "engines/wintermute/base/gfx/base_surface.h"
 
 namespace Wintermute {
@@ -128,6 +129,10 @@ bool BaseSurface::prepareToDraw() {
 
 	if (!_valid) {
 		//_gameRef->LOG(0, "Reviving: %s", _filename);
+		// The surfaces the storage may evict take memory again
+		if (_lifeTime > 0 && _gameRef->_surfaceStorage) {
+			_gameRef->_surfaceStorage->requestMemoryCheck();
+		}
 		return create(_filename.c_str(), _ckDefault, _ckRed, _ckGreen, _ckBlue, _lifeTime, _keepLoaded);
 	} else {
 		return STATUS_OK;
@@ -34,12 +34,17 @@
 #include "engines/wintermute/math/math_util.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_sprite.h"
+#include "engines/wintermute/wintermute.h"
 #include "common/system.h"
 #include "graphics/transparent_surface.h"
 #include "common/queue.h"
 #include "common/config-manager.h"
+#include "common/debug.h"
 
 #define DIRTY_RECT_LIMIT 800
+// Every dirty rect is a pass over the render queue, past this number the
+// new rects are merged with the ones they grow the least
+#define DIRTY_RECT_MAX_RECTS 16
 
 namespace Wintermute {
 
@@ -57,13 +62,15 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
-	_dirtyRect = nullptr;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
 	}
 
 	_lastScreenChangeID = g_system->getScreenChangeID();
+
+	memset(&_frameStats, 0, sizeof(_frameStats));
+	memset(&_lastFrameStats, 0, sizeof(_lastFrameStats));
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -75,8 +82,6 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 		delete ticket;
 	}
 
-	delete _dirtyRect;
-
 	_renderSurface->free();
 	delete _renderSurface;
 	_blankSurface->free();
@@ -162,8 +167,7 @@ bool BaseRenderOSystem::forcedFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -173,6 +177,7 @@ bool BaseRenderOSystem::flip() {
 		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
 			(*it)->_wantsDraw = false;
 		}
+		indexTickets();
 
 		addDirtyRect(_renderRect);
 		return true;
@@ -192,6 +197,7 @@ bool BaseRenderOSystem::flip() {
 				++it;
 			}
 		}
+		_frameStats.pixels = _renderRect.width() * _renderRect.height();
 	}
 
 	int oldScreenChangeID = _lastScreenChangeID;
@@ -202,15 +208,18 @@ bool BaseRenderOSystem::flip() {
 		if (_disableDirtyRects || screenChanged) {
 			g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
-		//  g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
 
 	g_system->updateScreen();
 
+	_lastFrameStats = _frameStats;
+	memset(&_frameStats, 0, sizeof(_frameStats));
+	debugC(2, kWintermuteDebugRender, "Frame: %d dirty rects, %d pixels redrawn, %d tickets drawn, %d tickets reused",
+	       _lastFrameStats.dirtyRects, _lastFrameStats.pixels, _lastFrameStats.ticketsDrawn, _lastFrameStats.ticketsReused);
+
 	return STATUS_OK;
 }
 
@@ -306,22 +315,23 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
-		RenderQueueIterator it = _lastFrameIter;
-		++it;
-		// Avoid calling end() and operator* every time, when potentially going through
-		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
-		RenderTicket *compareTicket = nullptr;
-		for (; it != endIterator; ++it) {
-			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
-				if (_disableDirtyRects) {
-					drawFromSurface(compareTicket);
-				} else {
-					drawFromQueuedTicket(it);
+		// The tickets of the previous frame which weren't reused yet all come after
+		// _lastFrameIter, in the same order: the first matching one is taken.
+		Common::HashMap<uint32, int32>::const_iterator first = _lastFrameHashes.find(compare.getHash());
+		int32 index = first != _lastFrameHashes.end() ? first->_value : -1;
+		while (index != -1) {
+			IndexedTicket &indexed = _lastFrameTickets[index];
+			// The reused tickets may have been moved, their iterators are not valid anymore
+			if (!indexed.reused) {
+				RenderTicket *compareTicket = *indexed.pos;
+				if (*(compareTicket) == compare && compareTicket->_isValid) {
+					indexed.reused = true;
+					_frameStats.ticketsReused++;
+					drawFromQueuedTicket(indexed.pos);
+					return;
 				}
-				return;
 			}
+			index = indexed.nextWithHash;
 		}
 	}
 	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
@@ -386,12 +396,74 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 }
 
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
-	} else {
-		_dirtyRect->extend(rect);
+	Common::Rect dirtyRect(rect);
+	dirtyRect.clip(_renderRect);
+	if (dirtyRect.isEmpty()) {
+		return;
+	}
+
+	// Merge the rect with the ones it overlaps, or which can be merged with it
+	// without covering more pixels, until it is disjoint from all of them
+	uint32 area = dirtyRect.width() * dirtyRect.height();
+	for (uint i = 0; i < _dirtyRects.size();) {
+		const Common::Rect &other = _dirtyRects[i];
+		Common::Rect merged(dirtyRect);
+		merged.extend(other);
+		uint32 mergedArea = merged.width() * merged.height();
+		if (dirtyRect.intersects(other) || mergedArea <= area + other.width() * other.height()) {
+			dirtyRect = merged;
+			area = mergedArea;
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			i++;
+		}
+	}
+
+	if (_dirtyRects.size() >= DIRTY_RECT_MAX_RECTS) {
+		uint best = 0;
+		uint32 bestGrowth = 0xFFFFFFFF;
+		for (uint i = 0; i < _dirtyRects.size(); i++) {
+			Common::Rect merged(dirtyRect);
+			merged.extend(_dirtyRects[i]);
+			uint32 growth = merged.width() * merged.height() - _dirtyRects[i].width() * _dirtyRects[i].height();
+			if (growth < bestGrowth) {
+				best = i;
+				bestGrowth = growth;
+			}
+		}
+		dirtyRect.extend(_dirtyRects[best]);
+		_dirtyRects.remove_at(best);
+		// The merged rect may overlap others now
+		addDirtyRect(dirtyRect);
+		return;
+	}
+
+	_dirtyRects.push_back(dirtyRect);
+}
+
+void BaseRenderOSystem::indexTickets() {
+	_lastFrameTickets.resize(0);
+	_lastFrameHashes.clear();
+	for (RenderQueueIterator it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		IndexedTicket indexed;
+		indexed.pos = it;
+		indexed.nextWithHash = -1;
+		indexed.reused = false;
+		_lastFrameTickets.push_back(indexed);
+	}
+
+	// Chain the tickets with the same hash in the order of the queue
+	for (int32 i = (int32)_lastFrameTickets.size() - 1; i >= 0; i--) {
+		uint32 hash = (*_lastFrameTickets[i].pos)->getHash();
+		Common::HashMap<uint32, int32>::iterator first = _lastFrameHashes.find(hash);
+		if (first != _lastFrameHashes.end()) {
+			_lastFrameTickets[i].nextWithHash = first->_value;
+			first->_value = i;
+		} else {
+			_lastFrameHashes[hash] = i;
+		}
 	}
-	_dirtyRect->clip(_renderRect);
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -410,53 +482,62 @@ void BaseRenderOSystem::drawTickets() {
 			++it;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
+	if (_dirtyRects.empty()) {
 		it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			RenderTicket *ticket = *it;
 			ticket->_wantsDraw = false;
 			++it;
 		}
+		indexTickets();
 		return;
 	}
 
-	it = _renderQueue.begin();
 	_lastFrameIter = _renderQueue.end();
 	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
 	// the background color. Typical use-case: Fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
+	RenderTicket *opaqueTicket = nullptr;
+	if (!_renderQueue.empty() && _renderQueue.front() == _renderQueue.back() && _renderQueue.front()->_transform._alphaDisable == true) {
+		opaqueTicket = _renderQueue.front();
+	}
+
+	// Each dirty rect is redrawn and copied to the screen on its own
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		const Common::Rect &dirtyRect = _dirtyRects[i];
 		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+		if (!opaqueTicket || dirtyRect != opaqueTicket->_dstRect) {
 			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+			_renderSurface->fillRect(dirtyRect, _clearColor);
 		}
-		// Otherwise Do NOT fill.
-	} else {
-		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
-	}
-	for (; it != _renderQueue.end(); ++it) {
-		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
-			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
-			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
-			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
-			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
-
-			drawFromSurface(ticket, &pos, &dstClip);
-			_needsFlip = true;
+		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+			RenderTicket *ticket = *it;
+			if (ticket->_dstRect.intersects(dirtyRect)) {
+				// dstClip is the area we want redrawn.
+				Common::Rect dstClip(ticket->_dstRect);
+				// reduce it to the dirty rect
+				dstClip.clip(dirtyRect);
+				// we need to keep track of the position to redraw the dirty rect
+				Common::Rect pos(dstClip);
+				int16 offsetX = ticket->_dstRect.left;
+				int16 offsetY = ticket->_dstRect.top;
+				// convert from screen-coords to surface-coords.
+				dstClip.translate(-offsetX, -offsetY);
+
+				drawFromSurface(ticket, &pos, &dstClip);
+				_needsFlip = true;
+				_frameStats.ticketsDrawn++;
+			}
 		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
-		ticket->_wantsDraw = false;
+		g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(dirtyRect.left, dirtyRect.top), _renderSurface->pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
+		_frameStats.pixels += dirtyRect.width() * dirtyRect.height();
+	}
+	_frameStats.dirtyRects = _dirtyRects.size();
+
+	// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		(*it)->_wantsDraw = false;
 	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
 	it = _renderQueue.begin();
 	// Clean out the old tickets
@@ -470,7 +551,7 @@ void BaseRenderOSystem::drawTickets() {
 			++it;
 		}
 	}
-
+	indexTickets();
 }
 
 // Replacement for SDL2's SDL_RenderCopy
@@ -592,6 +673,8 @@ void BaseRenderOSystem::endSaveLoad() {
 		it = _renderQueue.erase(it);
 		delete ticket;
 	}
+	_lastFrameTickets.clear();
+	_lastFrameHashes.clear();
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
 	_skipThisFrame = true;
@@ -32,6 +32,8 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "common/rect.h"
 #include "graphics/surface.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/list.h"
 #include "graphics/transform_struct.h"
 
@@ -115,12 +117,29 @@ public:
 	void endSaveLoad() override;
 	void drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform);
 	BaseSurface *createSurface() override;
+
+	struct FrameStats {
+		uint32 dirtyRects;    ///< Number of disjoint dirty rects redrawn
+		uint32 pixels;        ///< Number of pixels cleared, redrawn and copied to the screen
+		uint32 ticketsDrawn;  ///< Number of tickets drawn in the dirty rects
+		uint32 ticketsReused; ///< Number of tickets matching one of the previous frame
+	};
+	/**
+	 * Statistics of the last frame, also printed on the "renderer" debug channel.
+	 */
+	const FrameStats &getFrameStats() const { return _lastFrameStats; }
 private:
 	/**
-	 * Mark a specified rect of the screen as dirty.
+	 * Mark a specified rect of the screen as dirty. The dirty rects are kept
+	 * disjoint: the rect is merged with the ones it overlaps.
 	 * @param rect the region to be marked as dirty
 	 */
 	void addDirtyRect(const Common::Rect &rect);
+	/**
+	 * Index the tickets of the frame, so that drawSurface() finds them
+	 * by their hash in the next frame.
+	 */
+	void indexTickets();
 	/**
 	 * Traverse the tickets that are dirty, and draw them
 	 */
@@ -129,8 +148,19 @@ private:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	Common::Rect *_dirtyRect;
+	Common::Array<Common::Rect> _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
+	// The tickets of the previous frame in the order of the queue, with the index
+	// of the next one with the same hash, and the index of the first one for each hash
+	struct IndexedTicket {
+		RenderQueueIterator pos;
+		int32 nextWithHash;
+		bool reused;
+	};
+	Common::Array<IndexedTicket> _lastFrameTickets;
+	Common::HashMap<uint32, int32> _lastFrameHashes;
+	FrameStats _frameStats;
+	FrameStats _lastFrameStats;
 
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
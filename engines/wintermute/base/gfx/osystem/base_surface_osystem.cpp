@@ -64,7 +64,10 @@ BaseSurfaceOSystem::~BaseSurfaceOSystem() {
 	delete[] _alphaMask;
 	_alphaMask = nullptr;
 
-	_gameRef->addMem(-_width * _height * 4);
+	// The memory of the invalidated surfaces was already released
+	if (_valid) {
+		_gameRef->addMem(-_width * _height * 4);
+	}
 	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
 	renderer->invalidateTicketsFromSurface(this);
 }
@@ -346,6 +349,27 @@ bool BaseSurfaceOSystem::endPixelOp() {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+bool BaseSurfaceOSystem::invalidate() {
+	// Only the surfaces loaded from a file can be loaded again when drawn
+	if (!_loaded || _filename.empty()) {
+		return STATUS_FAILED;
+	}
+
+	_surface->free();
+	delete[] _alphaMask;
+	_alphaMask = nullptr;
+
+	_gameRef->addMem(-_width * _height * 4);
+	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
+	renderer->invalidateTicketsFromSurface(this);
+
+	_loaded = false;
+	_valid = false;
+	return STATUS_OK;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool BaseSurfaceOSystem::display(int x, int y, Rect32 rect, Graphics::TSpriteBlendMode blendMode, bool mirrorX, bool mirrorY) {
 	_rotation = 0;
@@ -408,6 +432,8 @@ bool BaseSurfaceOSystem::displayTiled(int x, int y, Rect32 rect, int numTimesX,
 bool BaseSurfaceOSystem::drawSprite(int x, int y, Rect32 *rect, Rect32 *newRect, Graphics::TransformStruct transform) {
 	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
 
+	// Marks the surface as used, the surface cache evicts the least recently used ones
+	prepareToDraw();
 	if (!_loaded) {
 		finishLoad();
 	}
@@ -35,6 +35,10 @@
 
 namespace Wintermute {
 
+static inline uint32 hashStep(uint32 hash, uint32 value) {
+	return (hash ^ value) * 16777619;
+}
+
 RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct transform) :
 	_owner(owner),
 	_srcRect(*srcRect),
@@ -42,6 +46,28 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	_isValid(true),
 	_wantsDraw(true),
 	_transform(transform) {
+	// FNV-1a over the values operator== compares
+	_hash = hashStep(2166136261u, (uint32)(size_t)owner);
+	_hash = hashStep(_hash, _srcRect.left);
+	_hash = hashStep(_hash, _srcRect.top);
+	_hash = hashStep(_hash, _srcRect.right);
+	_hash = hashStep(_hash, _srcRect.bottom);
+	_hash = hashStep(_hash, _dstRect.left);
+	_hash = hashStep(_hash, _dstRect.top);
+	_hash = hashStep(_hash, _dstRect.right);
+	_hash = hashStep(_hash, _dstRect.bottom);
+	_hash = hashStep(_hash, _transform._angle);
+	_hash = hashStep(_hash, _transform._zoom.x);
+	_hash = hashStep(_hash, _transform._zoom.y);
+	_hash = hashStep(_hash, _transform._offset.x);
+	_hash = hashStep(_hash, _transform._offset.y);
+	_hash = hashStep(_hash, _transform._flip);
+	_hash = hashStep(_hash, _transform._alphaDisable);
+	_hash = hashStep(_hash, _transform._blendMode);
+	_hash = hashStep(_hash, _transform._rgbaMod);
+	_hash = hashStep(_hash, _transform._numTimesX);
+	_hash = hashStep(_hash, _transform._numTimesY);
+
 	if (surf) {
 		_surface = new Graphics::Surface();
 		_surface->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
@@ -32,6 +32,7 @@
 #include "engines/wintermute/math/matrix4.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/timer.h"
 #include "engines/wintermute/base/base_region.h"
@@ -458,10 +459,11 @@ bool PartEmitter::removeForce(const Common::String &name) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetBorder
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetBorder") == 0) {
+	SC_NAME_CASE("SetBorder") {
 		stack->correctParams(4);
 		int borderX      = stack->pop()->getInt();
 		int borderY      = stack->pop()->getInt();
@@ -475,7 +477,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// SetBorderThickness
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetBorderThickness") == 0) {
+	SC_NAME_CASE("SetBorderThickness") {
 		stack->correctParams(4);
 		int left   = stack->pop()->getInt();
 		int right  = stack->pop()->getInt();
@@ -489,7 +491,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// AddSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddSprite") == 0) {
+	SC_NAME_CASE("AddSprite") {
 		stack->correctParams(1);
 		const char *spriteFile = stack->pop()->getString();
 		stack->pushBool(DID_SUCCEED(addSprite(spriteFile)));
@@ -499,7 +501,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveSprite
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveSprite") == 0) {
+	SC_NAME_CASE("RemoveSprite") {
 		stack->correctParams(1);
 		const char *spriteFile = stack->pop()->getString();
 		stack->pushBool(DID_SUCCEED(removeSprite(spriteFile)));
@@ -510,7 +512,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// Start
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Start") == 0) {
+	SC_NAME_CASE("Start") {
 		stack->correctParams(1);
 		_overheadTime = stack->pop()->getInt();
 		stack->pushBool(DID_SUCCEED(start()));
@@ -521,7 +523,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// Stop
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Stop") == 0) {
+	SC_NAME_CASE("Stop") {
 		stack->correctParams(0);
 
 		for (uint32 i = 0; i < _particles.size(); i++) {
@@ -538,7 +540,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// Pause
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Pause") == 0) {
+	SC_NAME_CASE("Pause") {
 		stack->correctParams(0);
 		_running = false;
 		stack->pushBool(true);
@@ -549,7 +551,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// Resume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Resume") == 0) {
+	SC_NAME_CASE("Resume") {
 		stack->correctParams(0);
 		_running = true;
 		stack->pushBool(true);
@@ -560,7 +562,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// AddGlobalForce
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddGlobalForce") == 0) {
+	SC_NAME_CASE("AddGlobalForce") {
 		stack->correctParams(3);
 		const char *forceName = stack->pop()->getString();
 		float angle = stack->pop()->getFloat();
@@ -574,7 +576,7 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// AddPointForce
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddPointForce") == 0) {
+	SC_NAME_CASE("AddPointForce") {
 		stack->correctParams(5);
 		const char *forceName = stack->pop()->getString();
 		int posX = stack->pop()->getInt();
@@ -590,54 +592,58 @@ bool PartEmitter::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveForce
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveForce") == 0) {
+	SC_NAME_CASE("RemoveForce") {
 		stack->correctParams(1);
 		const char *forceName = stack->pop()->getString();
 
 		stack->pushBool(DID_SUCCEED(removeForce(forceName)));
 
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////
 ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("particle-emitter");
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// X
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "X") {
+	SC_NAME_CASE("X") {
 		_scValue->setInt(_posX);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Y
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Y") {
+	SC_NAME_CASE("Y") {
 		_scValue->setInt(_posY);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Width
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Width") {
+	SC_NAME_CASE("Width") {
 		_scValue->setInt(_width);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Height
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Height") {
+	SC_NAME_CASE("Height") {
 		_scValue->setInt(_height);
 		return _scValue;
 	}
@@ -645,21 +651,21 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Scale1") {
+	SC_NAME_CASE("Scale1") {
 		_scValue->setFloat(_scale1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Scale2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Scale2") {
+	SC_NAME_CASE("Scale2") {
 		_scValue->setFloat(_scale2);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// ScaleZBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ScaleZBased") {
+	SC_NAME_CASE("ScaleZBased") {
 		_scValue->setBool(_scaleZBased);
 		return _scValue;
 	}
@@ -667,21 +673,21 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Velocity1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Velocity1") {
+	SC_NAME_CASE("Velocity1") {
 		_scValue->setFloat(_velocity1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Velocity2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Velocity2") {
+	SC_NAME_CASE("Velocity2") {
 		_scValue->setFloat(_velocity2);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// VelocityZBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "VelocityZBased") {
+	SC_NAME_CASE("VelocityZBased") {
 		_scValue->setBool(_velocityZBased);
 		return _scValue;
 	}
@@ -689,21 +695,21 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// LifeTime1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "LifeTime1") {
+	SC_NAME_CASE("LifeTime1") {
 		_scValue->setInt(_lifeTime1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// LifeTime2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "LifeTime2") {
+	SC_NAME_CASE("LifeTime2") {
 		_scValue->setInt(_lifeTime2);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// LifeTimeZBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "LifeTimeZBased") {
+	SC_NAME_CASE("LifeTimeZBased") {
 		_scValue->setBool(_lifeTimeZBased);
 		return _scValue;
 	}
@@ -711,14 +717,14 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Angle1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Angle1") {
+	SC_NAME_CASE("Angle1") {
 		_scValue->setInt(_angle1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Angle2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Angle2") {
+	SC_NAME_CASE("Angle2") {
 		_scValue->setInt(_angle2);
 		return _scValue;
 	}
@@ -726,14 +732,14 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AngVelocity1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AngVelocity1") {
+	SC_NAME_CASE("AngVelocity1") {
 		_scValue->setFloat(_angVelocity1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// AngVelocity2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AngVelocity2") {
+	SC_NAME_CASE("AngVelocity2") {
 		_scValue->setFloat(_angVelocity2);
 		return _scValue;
 	}
@@ -741,14 +747,14 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Rotation1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Rotation1") {
+	SC_NAME_CASE("Rotation1") {
 		_scValue->setFloat(_rotation1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Rotation2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Rotation2") {
+	SC_NAME_CASE("Rotation2") {
 		_scValue->setFloat(_rotation2);
 		return _scValue;
 	}
@@ -756,21 +762,21 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Alpha1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Alpha1") {
+	SC_NAME_CASE("Alpha1") {
 		_scValue->setInt(_alpha1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Alpha2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Alpha2") {
+	SC_NAME_CASE("Alpha2") {
 		_scValue->setInt(_alpha2);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaTimeBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AlphaTimeBased") {
+	SC_NAME_CASE("AlphaTimeBased") {
 		_scValue->setBool(_alphaTimeBased);
 		return _scValue;
 	}
@@ -778,14 +784,14 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxParticles
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MaxParticles") {
+	SC_NAME_CASE("MaxParticles") {
 		_scValue->setInt(_maxParticles);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// NumLiveParticles (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumLiveParticles") {
+	SC_NAME_CASE("NumLiveParticles") {
 		int numAlive = 0;
 		for (uint32 i = 0; i < _particles.size(); i++) {
 			if (_particles[i] && !_particles[i]->_isDead) {
@@ -799,21 +805,21 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// GenerationInterval
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "GenerationInterval") {
+	SC_NAME_CASE("GenerationInterval") {
 		_scValue->setInt(_genInterval);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// GenerationAmount
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "GenerationAmount") {
+	SC_NAME_CASE("GenerationAmount") {
 		_scValue->setInt(_genAmount);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// MaxBatches
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MaxBatches") {
+	SC_NAME_CASE("MaxBatches") {
 		_scValue->setInt(_maxBatches);
 		return _scValue;
 	}
@@ -821,14 +827,14 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// FadeInTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "FadeInTime") {
+	SC_NAME_CASE("FadeInTime") {
 		_scValue->setInt(_fadeInTime);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// FadeOutTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "FadeOutTime") {
+	SC_NAME_CASE("FadeOutTime") {
 		_scValue->setInt(_fadeOutTime);
 		return _scValue;
 	}
@@ -836,21 +842,21 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// GrowthRate1
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "GrowthRate1") {
+	SC_NAME_CASE("GrowthRate1") {
 		_scValue->setFloat(_growthRate1);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// GrowthRate2
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "GrowthRate2") {
+	SC_NAME_CASE("GrowthRate2") {
 		_scValue->setFloat(_growthRate2);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// ExponentialGrowth
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ExponentialGrowth") {
+	SC_NAME_CASE("ExponentialGrowth") {
 		_scValue->setBool(_exponentialGrowth);
 		return _scValue;
 	}
@@ -858,7 +864,7 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// UseRegion
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "UseRegion") {
+	SC_NAME_CASE("UseRegion") {
 		_scValue->setBool(_useRegion);
 		return _scValue;
 	}
@@ -866,46 +872,50 @@ ScValue *PartEmitter::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// EmitEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "EmitEvent") {
+	SC_NAME_CASE("EmitEvent") {
 		if (!_emitEvent) {
 			_scValue->setNULL();
 		} else {
 			_scValue->setString(_emitEvent);
 		}
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// X
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "X") == 0) {
+	SC_NAME_CASE("X") {
 		_posX = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Y
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Y") == 0) {
+	SC_NAME_CASE("Y") {
 		_posY = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Width
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Width") == 0) {
+	SC_NAME_CASE("Width") {
 		_width = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Height
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Height") == 0) {
+	SC_NAME_CASE("Height") {
 		_height = value->getInt();
 		return STATUS_OK;
 	}
@@ -913,21 +923,21 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Scale1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Scale1") == 0) {
+	SC_NAME_CASE("Scale1") {
 		_scale1 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Scale2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Scale2") == 0) {
+	SC_NAME_CASE("Scale2") {
 		_scale2 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// ScaleZBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScaleZBased") == 0) {
+	SC_NAME_CASE("ScaleZBased") {
 		_scaleZBased = value->getBool();
 		return STATUS_OK;
 	}
@@ -935,21 +945,21 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Velocity1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Velocity1") == 0) {
+	SC_NAME_CASE("Velocity1") {
 		_velocity1 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Velocity2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Velocity2") == 0) {
+	SC_NAME_CASE("Velocity2") {
 		_velocity2 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// VelocityZBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "VelocityZBased") == 0) {
+	SC_NAME_CASE("VelocityZBased") {
 		_velocityZBased = value->getBool();
 		return STATUS_OK;
 	}
@@ -957,21 +967,21 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// LifeTime1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LifeTime1") == 0) {
+	SC_NAME_CASE("LifeTime1") {
 		_lifeTime1 = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// LifeTime2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LifeTime2") == 0) {
+	SC_NAME_CASE("LifeTime2") {
 		_lifeTime2 = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// LifeTimeZBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LifeTimeZBased") == 0) {
+	SC_NAME_CASE("LifeTimeZBased") {
 		_lifeTimeZBased = value->getBool();
 		return STATUS_OK;
 	}
@@ -979,14 +989,14 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Angle1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Angle1") == 0) {
+	SC_NAME_CASE("Angle1") {
 		_angle1 = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Angle2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Angle2") == 0) {
+	SC_NAME_CASE("Angle2") {
 		_angle2 = value->getInt();
 		return STATUS_OK;
 	}
@@ -994,14 +1004,14 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AngVelocity1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AngVelocity1") == 0) {
+	SC_NAME_CASE("AngVelocity1") {
 		_angVelocity1 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// AngVelocity2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AngVelocity2") == 0) {
+	SC_NAME_CASE("AngVelocity2") {
 		_angVelocity2 = value->getFloat();
 		return STATUS_OK;
 	}
@@ -1009,14 +1019,14 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Rotation1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Rotation1") == 0) {
+	SC_NAME_CASE("Rotation1") {
 		_rotation1 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Rotation2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Rotation2") == 0) {
+	SC_NAME_CASE("Rotation2") {
 		_rotation2 = value->getFloat();
 		return STATUS_OK;
 	}
@@ -1024,7 +1034,7 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Alpha1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Alpha1") == 0) {
+	SC_NAME_CASE("Alpha1") {
 		_alpha1 = value->getInt();
 		if (_alpha1 < 0) {
 			_alpha1 = 0;
@@ -1037,7 +1047,7 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Alpha2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Alpha2") == 0) {
+	SC_NAME_CASE("Alpha2") {
 		_alpha2 = value->getInt();
 		if (_alpha2 < 0) {
 			_alpha2 = 0;
@@ -1050,7 +1060,7 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// AlphaTimeBased
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AlphaTimeBased") == 0) {
+	SC_NAME_CASE("AlphaTimeBased") {
 		_alphaTimeBased = value->getBool();
 		return STATUS_OK;
 	}
@@ -1058,7 +1068,7 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxParticles
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MaxParticles") == 0) {
+	SC_NAME_CASE("MaxParticles") {
 		_maxParticles = value->getInt();
 		return STATUS_OK;
 	}
@@ -1066,21 +1076,21 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// GenerationInterval
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GenerationInterval") == 0) {
+	SC_NAME_CASE("GenerationInterval") {
 		_genInterval = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// GenerationAmount
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GenerationAmount") == 0) {
+	SC_NAME_CASE("GenerationAmount") {
 		_genAmount = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// MaxBatches
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MaxBatches") == 0) {
+	SC_NAME_CASE("MaxBatches") {
 		_maxBatches = value->getInt();
 		return STATUS_OK;
 	}
@@ -1088,14 +1098,14 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// FadeInTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeInTime") == 0) {
+	SC_NAME_CASE("FadeInTime") {
 		_fadeInTime = value->getInt();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// FadeOutTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeOutTime") == 0) {
+	SC_NAME_CASE("FadeOutTime") {
 		_fadeOutTime = value->getInt();
 		return STATUS_OK;
 	}
@@ -1103,21 +1113,21 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// GrowthRate1
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GrowthRate1") == 0) {
+	SC_NAME_CASE("GrowthRate1") {
 		_growthRate1 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// GrowthRate2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GrowthRate2") == 0) {
+	SC_NAME_CASE("GrowthRate2") {
 		_growthRate2 = value->getFloat();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// ExponentialGrowth
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ExponentialGrowth") == 0) {
+	SC_NAME_CASE("ExponentialGrowth") {
 		_exponentialGrowth = value->getBool();
 		return STATUS_OK;
 	}
@@ -1125,7 +1135,7 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// UseRegion
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UseRegion") == 0) {
+	SC_NAME_CASE("UseRegion") {
 		_useRegion = value->getBool();
 		return STATUS_OK;
 	}
@@ -1133,16 +1143,19 @@ bool PartEmitter::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// EmitEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EmitEvent") == 0) {
+	SC_NAME_CASE("EmitEvent") {
 		delete[] _emitEvent;
 		_emitEvent = nullptr;
 		if (!value->isNULL()) {
 			BaseUtils::setString(&_emitEvent, value->getString());
 		}
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scSetProperty(name, value);
 	}
+	}
 }
 
 
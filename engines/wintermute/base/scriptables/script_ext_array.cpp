@@ -31,6 +31,7 @@
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/system/sys_instance.h"
 #include "engines/wintermute/base/scriptables/script_ext_array.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 
 namespace Wintermute {
 
@@ -98,10 +99,11 @@ const char *SXArray::scToString() {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXArray::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Push
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Push") == 0) {
+	SC_NAME_CASE("Push") {
 		int numParams = stack->pop()->getInt(0);
 		char paramName[20];
 
@@ -118,7 +120,7 @@ bool SXArray::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Pop
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Pop") == 0) {
+	SC_NAME_CASE("Pop") {
 		stack->correctParams(0);
 
 		if (_length > 0) {
@@ -141,7 +143,7 @@ bool SXArray::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	// Used to shuffle arrays and delete found items in various scripts
 	// Return value is never used
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Delete") == 0) {
+	SC_NAME_CASE("Delete") {
 		stack->correctParams(1);
 
 		int shiftPoint = stack->pop()->getInt(0);
@@ -161,9 +163,11 @@ bool SXArray::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	}
 #endif
 
-	else {
+	default:
+	unknownName: {
 		return STATUS_FAILED;
 	}
+	}
 }
 
 
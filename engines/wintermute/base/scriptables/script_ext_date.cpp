@@ -29,6 +29,7 @@
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_ext_date.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 
 namespace Wintermute {
 
@@ -74,10 +75,11 @@ const char *SXDate::scToString() {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetYear
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetYear") == 0) {
+	SC_NAME_CASE("GetYear") {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_year + 1900);
 		return STATUS_OK;
@@ -85,7 +87,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetMonth
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetMonth") == 0) {
+	SC_NAME_CASE("GetMonth") {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_mon + 1);
 		return STATUS_OK;
@@ -95,7 +97,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	// [FoxTail] GetDay
 	// date.GetDate() was renamed to date.GetDay() in FoxTail 1.2.896 engine
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetDay") == 0) {
+	SC_NAME_CASE("GetDay") {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_mday);
 		return STATUS_OK;
@@ -104,7 +106,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetDate
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetDate") == 0) {
+	SC_NAME_CASE("GetDate") {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_mday);
 		return STATUS_OK;
@@ -112,7 +114,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetHours
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHours") == 0) {
+	SC_NAME_CASE("GetHours") {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_hour);
 		return STATUS_OK;
@@ -120,7 +122,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetMinutes
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetMinutes") == 0) {
+	SC_NAME_CASE("GetMinutes") {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_min);
 		return STATUS_OK;
@@ -128,7 +130,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetSeconds
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSeconds") == 0) {
+	SC_NAME_CASE("GetSeconds") {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_sec);
 		return STATUS_OK;
@@ -136,7 +138,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetWeekday
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetWeekday") == 0) {
+	SC_NAME_CASE("GetWeekday") {
 		stack->correctParams(0);
 		stack->pushInt(_tm.tm_wday);
 		return STATUS_OK;
@@ -146,7 +148,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetYear
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetYear") == 0) {
+	SC_NAME_CASE("SetYear") {
 		stack->correctParams(1);
 		_tm.tm_year = stack->pop()->getInt() - 1900;
 		stack->pushNULL();
@@ -155,7 +157,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetMonth
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetMonth") == 0) {
+	SC_NAME_CASE("SetMonth") {
 		stack->correctParams(1);
 		_tm.tm_mon = stack->pop()->getInt() - 1;
 		stack->pushNULL();
@@ -164,7 +166,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetDate
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetDate") == 0) {
+	SC_NAME_CASE("SetDate") {
 		stack->correctParams(1);
 		_tm.tm_mday = stack->pop()->getInt();
 		stack->pushNULL();
@@ -173,7 +175,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetHours
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetHours") == 0) {
+	SC_NAME_CASE("SetHours") {
 		stack->correctParams(1);
 		_tm.tm_hour = stack->pop()->getInt();
 		stack->pushNULL();
@@ -182,7 +184,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetMinutes
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetMinutes") == 0) {
+	SC_NAME_CASE("SetMinutes") {
 		stack->correctParams(1);
 		_tm.tm_min = stack->pop()->getInt();
 		stack->pushNULL();
@@ -191,7 +193,7 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetSeconds
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSeconds") == 0) {
+	SC_NAME_CASE("SetSeconds") {
 		stack->correctParams(1);
 		_tm.tm_sec = stack->pop()->getInt();
 		stack->pushNULL();
@@ -202,14 +204,17 @@ bool SXDate::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetCurrentTime
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetCurrentTime") == 0) {
+	SC_NAME_CASE("SetCurrentTime") {
 		stack->correctParams(0);
 		g_system->getTimeAndDate(_tm);
 		stack->pushNULL();
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return STATUS_FAILED;
 	}
+	}
 }
 
 
@@ -29,6 +29,7 @@
 #include "engines/wintermute/base/scriptables/script_ext_directory.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/persistent.h"
 
@@ -59,10 +60,11 @@ SXDirectory::~SXDirectory() {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXDirectory::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Create
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Create") == 0) {
+	SC_NAME_CASE("Create") {
 		stack->correctParams(1);
 		const char *dirName = stack->pop()->getString();
 
@@ -82,7 +84,7 @@ bool SXDirectory::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// Delete
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Delete") == 0) {
+	SC_NAME_CASE("Delete") {
 		stack->correctParams(1);
 		stack->pop()->getString();
 
@@ -96,7 +98,8 @@ bool SXDirectory::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// GetFiles / GetDirectories
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFiles") == 0 || strcmp(name, "GetDirectories") == 0) {
+	SC_NAME_CASE("GetFiles")
+	SC_NAME_ALIAS("GetDirectories") {
 		stack->correctParams(2);
 		const char *dirName = stack->pop()->getString();
 		stack->pop()->getString();
@@ -120,7 +123,7 @@ bool SXDirectory::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 	//////////////////////////////////////////////////////////////////////////
 	// GetDrives
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetDrives") == 0) {
+	SC_NAME_CASE("GetDrives") {
 		stack->correctParams(0);
 
 		// No currently known games do this
@@ -129,9 +132,12 @@ bool SXDirectory::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 		stack->pushInt(0);
  		stack->pushNative(makeSXArray(_gameRef, stack), false);
  		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return STATUS_FAILED;
 	}
+	}
 }
 
 
@@ -139,10 +145,11 @@ bool SXDirectory::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSt
 ScValue *SXDirectory::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("directory");
 		return _scValue;
 	}
@@ -150,7 +157,7 @@ ScValue *SXDirectory::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PathSeparator
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PathSeparator") {
+	SC_NAME_CASE("PathSeparator") {
 		_scValue->setString("\\");
 		return _scValue;
 	}
@@ -158,7 +165,7 @@ ScValue *SXDirectory::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CurrentDirectory
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CurrentDirectory") {
+	SC_NAME_CASE("CurrentDirectory") {
 		_scValue->setString("."); // See also: BaseGame::scGetProperty("SaveDirectory")
 		return _scValue;
 	}
@@ -166,12 +173,15 @@ ScValue *SXDirectory::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TempDirectory
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TempDirectory") {
+	SC_NAME_CASE("TempDirectory") {
 		_scValue->setString("temp"); // See also: BaseGame::scGetProperty("SaveDirectory")
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return _scValue;
 	}
+	}
 }
 
 
@@ -36,6 +36,7 @@
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/platform_osystem.h"
 #include "engines/wintermute/base/scriptables/script_ext_file.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 
 // Note: This code is completely untested, as I have yet to find a game that uses SXFile.
 
@@ -105,10 +106,11 @@ const char *SXFile::scToString() {
 #define FILE_BUFFER_SIZE 32768
 //////////////////////////////////////////////////////////////////////////
 bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetFilename
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetFilename") == 0) {
+	SC_NAME_CASE("SetFilename") {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 		cleanup();
@@ -120,7 +122,8 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// OpenAsText / OpenAsBinary
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "OpenAsText") == 0 || strcmp(name, "OpenAsBinary") == 0) {
+	SC_NAME_CASE("OpenAsText")
+	SC_NAME_ALIAS("OpenAsBinary") {
 		stack->correctParams(1);
 		close();
 		_mode = stack->pop()->getInt(1);
@@ -171,7 +174,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Close
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Close") == 0) {
+	SC_NAME_CASE("Close") {
 		stack->correctParams(0);
 		close();
 		stack->pushNULL();
@@ -181,7 +184,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetPosition") == 0) {
+	SC_NAME_CASE("SetPosition") {
 		stack->correctParams(1);
 		if (_mode == 0) {
 			script->runtimeError("File.%s: File is not open", name);
@@ -196,7 +199,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Delete
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Delete") == 0) {
+	SC_NAME_CASE("Delete") {
 		stack->correctParams(0);
 		close();
 		warning("SXFile-Method: \"Delete\" not supported");
@@ -208,7 +211,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Copy
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Copy") == 0) {
+	SC_NAME_CASE("Copy") {
 		stack->correctParams(2);
 		/* const char *dest = */ stack->pop()->getString();
 		/* bool overwrite = */ stack->pop()->getBool(true);
@@ -225,7 +228,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadLine
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadLine") == 0) {
+	SC_NAME_CASE("ReadLine") {
 		stack->correctParams(0);
 		if (!_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open in text mode.", name);
@@ -280,7 +283,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadText
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadText") == 0) {
+	SC_NAME_CASE("ReadText") {
 		stack->correctParams(1);
 		int textLen = stack->pop()->getInt();
 
@@ -333,7 +336,8 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteLine / WriteText
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteLine") == 0 || strcmp(name, "WriteText") == 0) {
+	SC_NAME_CASE("WriteLine")
+	SC_NAME_ALIAS("WriteText") {
 		stack->correctParams(1);
 		const char *line = stack->pop()->getString();
 		if (!_textMode || !_writeFile) {
@@ -357,7 +361,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadBool
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadBool") == 0) {
+	SC_NAME_CASE("ReadBool") {
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open for reading in binary mode.", name);
@@ -377,7 +381,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadByte
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadByte") == 0) {
+	SC_NAME_CASE("ReadByte") {
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open for reading in binary mode.", name);
@@ -397,7 +401,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadShort
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadShort") == 0) {
+	SC_NAME_CASE("ReadShort") {
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open for reading in binary mode.", name);
@@ -416,7 +420,8 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadInt / ReadLong
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadInt") == 0 || strcmp(name, "ReadLong") == 0) {
+	SC_NAME_CASE("ReadInt")
+	SC_NAME_ALIAS("ReadLong") {
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open for reading in binary mode.", name);
@@ -436,7 +441,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadFloat
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadFloat") == 0) {
+	SC_NAME_CASE("ReadFloat") {
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open for reading in binary mode.", name);
@@ -457,7 +462,8 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadDouble
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadDouble") == 0) { // TODO: Solve reading a 8 byte double.
+	SC_NAME_CASE("ReadDouble") {
+ // TODO: Solve reading a 8 byte double.
 		error("SXFile::ReadDouble - Not endian safe yet");
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
@@ -478,7 +484,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ReadString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ReadString") == 0) {
+	SC_NAME_CASE("ReadString") {
 		stack->correctParams(0);
 		if (_textMode || !_readFile) {
 			script->runtimeError("File.%s: File must be open for reading in binary mode.", name);
@@ -507,7 +513,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteBool
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteBool") == 0) {
+	SC_NAME_CASE("WriteBool") {
 		stack->correctParams(1);
 		bool val = stack->pop()->getBool();
 
@@ -525,7 +531,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteByte
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteByte") == 0) {
+	SC_NAME_CASE("WriteByte") {
 		stack->correctParams(1);
 		byte val = stack->pop()->getInt();
 
@@ -543,7 +549,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteShort
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteShort") == 0) {
+	SC_NAME_CASE("WriteShort") {
 		stack->correctParams(1);
 		int16 val = stack->pop()->getInt();
 
@@ -561,7 +567,8 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteInt / WriteLong
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteInt") == 0 || strcmp(name, "WriteLong") == 0) {
+	SC_NAME_CASE("WriteInt")
+	SC_NAME_ALIAS("WriteLong") {
 		stack->correctParams(1);
 		int32 val = stack->pop()->getInt();
 
@@ -579,7 +586,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteFloat
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteFloat") == 0) {
+	SC_NAME_CASE("WriteFloat") {
 		stack->correctParams(1);
 		float val = stack->pop()->getFloat();
 
@@ -598,7 +605,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteDouble
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteDouble") == 0) {
+	SC_NAME_CASE("WriteDouble") {
 		error("SXFile::WriteDouble - Not endian safe yet");
 		stack->correctParams(1);
 		/* double val = */ stack->pop()->getFloat();
@@ -617,7 +624,7 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// WriteString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "WriteString") == 0) {
+	SC_NAME_CASE("WriteString") {
 		stack->correctParams(1);
 		const char *val = stack->pop()->getString();
 
@@ -634,9 +641,12 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 		stack->pushBool(true);
 
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptable::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -644,10 +654,11 @@ bool SXFile::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *SXFile::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("file");
 		return _scValue;
 	}
@@ -655,7 +666,7 @@ ScValue *SXFile::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Filename (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Filename") {
+	SC_NAME_CASE("Filename") {
 		_scValue->setString(_filename);
 		return _scValue;
 	}
@@ -663,7 +674,7 @@ ScValue *SXFile::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Position (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Position") {
+	SC_NAME_CASE("Position") {
 		_scValue->setInt(getPos());
 		return _scValue;
 	}
@@ -671,7 +682,7 @@ ScValue *SXFile::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Length (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Length") {
+	SC_NAME_CASE("Length") {
 		_scValue->setInt(getLength());
 		return _scValue;
 	}
@@ -679,7 +690,7 @@ ScValue *SXFile::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextMode (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TextMode") {
+	SC_NAME_CASE("TextMode") {
 		_scValue->setBool(_textMode);
 		return _scValue;
 	}
@@ -687,12 +698,15 @@ ScValue *SXFile::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// AccessMode (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AccessMode") {
+	SC_NAME_CASE("AccessMode") {
 		_scValue->setInt(_mode);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseScriptable::scGetProperty(name);
 	}
+	}
 }
 
 
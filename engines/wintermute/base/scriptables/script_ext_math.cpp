@@ -29,6 +29,7 @@
 #include "engines/wintermute/base/scriptables/script_ext_math.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/persistent.h"
 #include "common/math.h"
 
@@ -59,10 +60,11 @@ SXMath::~SXMath() {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Abs
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Abs") == 0) {
+	SC_NAME_CASE("Abs") {
 		stack->correctParams(1);
 		stack->pushFloat(fabs(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -71,7 +73,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Acos
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Acos") == 0) {
+	SC_NAME_CASE("Acos") {
 		stack->correctParams(1);
 		stack->pushFloat(acos(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -80,7 +82,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Asin
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Asin") == 0) {
+	SC_NAME_CASE("Asin") {
 		stack->correctParams(1);
 		stack->pushFloat(asin(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -89,7 +91,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Atan
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Atan") == 0) {
+	SC_NAME_CASE("Atan") {
 		stack->correctParams(1);
 		stack->pushFloat(atan(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -98,7 +100,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Atan2
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Atan2") == 0) {
+	SC_NAME_CASE("Atan2") {
 		stack->correctParams(2);
 		double y = stack->pop()->getFloat();
 		double x = stack->pop()->getFloat();
@@ -109,7 +111,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Ceil
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Ceil") == 0) {
+	SC_NAME_CASE("Ceil") {
 		stack->correctParams(1);
 		stack->pushFloat(ceil(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -118,7 +120,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Cos
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Cos") == 0) {
+	SC_NAME_CASE("Cos") {
 		stack->correctParams(1);
 		stack->pushFloat(cos(Common::deg2rad<double>(stack->pop()->getFloat())));
 		return STATUS_OK;
@@ -127,7 +129,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Cosh
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Cosh") == 0) {
+	SC_NAME_CASE("Cosh") {
 		stack->correctParams(1);
 		stack->pushFloat(cosh(Common::deg2rad<double>(stack->pop()->getFloat())));
 		return STATUS_OK;
@@ -136,7 +138,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Exp
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Exp") == 0) {
+	SC_NAME_CASE("Exp") {
 		stack->correctParams(1);
 		stack->pushFloat(exp(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -145,7 +147,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Floor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Floor") == 0) {
+	SC_NAME_CASE("Floor") {
 		stack->correctParams(1);
 		stack->pushFloat(floor(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -154,7 +156,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Log
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Log") == 0) {
+	SC_NAME_CASE("Log") {
 		stack->correctParams(1);
 		stack->pushFloat(log(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -163,7 +165,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Log10
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Log10") == 0) {
+	SC_NAME_CASE("Log10") {
 		stack->correctParams(1);
 		stack->pushFloat(log10(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -172,7 +174,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Pow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Pow") == 0) {
+	SC_NAME_CASE("Pow") {
 		stack->correctParams(2);
 		double x = stack->pop()->getFloat();
 		double y = stack->pop()->getFloat();
@@ -184,7 +186,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Sin
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Sin") == 0) {
+	SC_NAME_CASE("Sin") {
 		stack->correctParams(1);
 		stack->pushFloat(sin(Common::deg2rad<double>(stack->pop()->getFloat())));
 		return STATUS_OK;
@@ -193,7 +195,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Sinh
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Sinh") == 0) {
+	SC_NAME_CASE("Sinh") {
 		stack->correctParams(1);
 		stack->pushFloat(sinh(Common::deg2rad<double>(stack->pop()->getFloat())));
 		return STATUS_OK;
@@ -202,7 +204,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Tan
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Tan") == 0) {
+	SC_NAME_CASE("Tan") {
 		stack->correctParams(1);
 		stack->pushFloat(tan(Common::deg2rad<double>(stack->pop()->getFloat())));
 		return STATUS_OK;
@@ -211,7 +213,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Tanh
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Tanh") == 0) {
+	SC_NAME_CASE("Tanh") {
 		stack->correctParams(1);
 		stack->pushFloat(tanh(Common::deg2rad<double>(stack->pop()->getFloat())));
 		return STATUS_OK;
@@ -220,7 +222,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// Sqrt
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Sqrt") == 0) {
+	SC_NAME_CASE("Sqrt") {
 		stack->correctParams(1);
 		stack->pushFloat(sqrt(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -229,7 +231,7 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// DegToRad
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DegToRad") == 0) {
+	SC_NAME_CASE("DegToRad") {
 		stack->correctParams(1);
 		stack->pushFloat(Common::deg2rad<double>(stack->pop()->getFloat()));
 		return STATUS_OK;
@@ -238,13 +240,16 @@ bool SXMath::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// RadToDeg
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RadToDeg") == 0) {
+	SC_NAME_CASE("RadToDeg") {
 		stack->correctParams(1);
 		stack->pushFloat(Common::rad2deg<double>(stack->pop()->getFloat()));
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return STATUS_FAILED;
 	}
+	}
 }
 
 
@@ -32,6 +32,7 @@
 #include "engines/wintermute/utils/utils.h"
 #include "engines/wintermute/base/scriptables/script_ext_string.h"
 #include "engines/wintermute/base/scriptables/script_ext_array.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/utils/string_util.h"
 #include "common/str.h"
 #include "common/tokenizer.h"
@@ -108,10 +109,11 @@ void SXString::scSetString(const char *val) {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Substring
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Substring") == 0) {
+	SC_NAME_CASE("Substring") {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 		int end   = stack->pop()->getInt();
@@ -146,7 +148,7 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Substr
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Substr") == 0) {
+	SC_NAME_CASE("Substr") {
 		stack->correctParams(2);
 		int start = stack->pop()->getInt();
 
@@ -188,7 +190,7 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ToUpperCase
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ToUpperCase") == 0) {
+	SC_NAME_CASE("ToUpperCase") {
 		stack->correctParams(0);
 
 		WideString str;
@@ -212,7 +214,7 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ToLowerCase
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ToLowerCase") == 0) {
+	SC_NAME_CASE("ToLowerCase") {
 		stack->correctParams(0);
 
 		WideString str;
@@ -236,7 +238,7 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// IndexOf
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IndexOf") == 0) {
+	SC_NAME_CASE("IndexOf") {
 		stack->correctParams(2);
 
 		const char *strToFind = stack->pop()->getString();
@@ -268,7 +270,7 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// Returns integer value of char at given position
 	// Used at "Pole Chudes" only
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetCharCode") == 0) {
+	SC_NAME_CASE("GetCharCode") {
 		stack->correctParams(1);
 
 		int index = stack->pop()->getInt();
@@ -285,7 +287,7 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Split
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Split") == 0) {
+	SC_NAME_CASE("Split") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		char separators[MAX_PATH_LENGTH] = ",";
@@ -347,9 +349,12 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 
 		stack->pushNative(array, false);
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return STATUS_FAILED;
 	}
+	}
 }
 
 
@@ -357,17 +362,18 @@ bool SXString::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *SXString::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("string");
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Length (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Length") {
+	SC_NAME_CASE("Length") {
 		if (_gameRef->_textEncoding == TEXT_UTF8) {
 			WideString wstr = StringUtil::utf8ToWide(_string);
 			_scValue->setInt(wstr.size());
@@ -380,12 +386,15 @@ ScValue *SXString::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Capacity
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Capacity") {
+	SC_NAME_CASE("Capacity") {
 		_scValue->setInt(_capacity);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return _scValue;
 	}
+	}
 }
 
 
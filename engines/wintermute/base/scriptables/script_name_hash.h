@@ -0,0 +1,87 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef WINTERMUTE_SCRIPT_NAME_HASH_H
+#define WINTERMUTE_SCRIPT_NAME_HASH_H
+
+#include "common/scummsys.h"
+#include "common/str.h"
+
+namespace Wintermute {
+
+constexpr uint64 scNameHashStep(const char *name, uint64 hash) {
+	return *name ? scNameHashStep(name + 1, (hash ^ (byte)*name) * 1099511628211ULL) : hash;
+}
+
+/**
+ * 64 bit FNV-1a hash of a method or property name, which lets the scriptables
+ * dispatch the names with a switch, rather than comparing them one by one.
+ * The case values are computed by the compiler, which also rejects two names
+ * of a switch with the same hash. See SC_NAME_CASE for the case labels.
+ */
+constexpr uint64 scNameHash(const char *name) {
+	return scNameHashStep(name, 14695981039346656037ULL);
+}
+
+inline bool scNameIs(const char *name, const char *known) {
+	return strcmp(name, known) == 0;
+}
+
+inline bool scNameIs(const Common::String &name, const char *known) {
+	return name == known;
+}
+
+} // End of namespace Wintermute
+
+/**
+ * Case label of a switch over scNameHash(name):
+ *
+ *	switch (scNameHash(name)) {
+ *	SC_NAME_CASE("Width") {
+ *		...
+ *	}
+ *	SC_NAME_CASE("GetWidget")
+ *	SC_NAME_ALIAS("GetControl") {
+ *		...
+ *	}
+ *	default:
+ *	unknownName: {
+ *		...
+ *
+ * The name is compared once more after the hash matched, so that an unknown
+ * name with the hash of a known one goes to the unknownName label.
+ */
+#define SC_NAME_CASE(known) \
+	case Wintermute::scNameHash(known): \
+		if (!Wintermute::scNameIs(name, known)) \
+			goto unknownName;
+
+/**
+ * Additional case label for the block of the previous SC_NAME_CASE. Its name
+ * is only compared when the switch jumps to it, not when the previous label
+ * falls through.
+ */
+#define SC_NAME_ALIAS(known) \
+	if (false) \
+	SC_NAME_CASE(known)
+
+#endif
@@ -32,6 +32,7 @@
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/wintermute.h"
 #include "audio/audiostream.h"
+#include "audio/decodeahead.h"
 #include "audio/mixer.h"
 #ifdef USE_VORBIS
 #include "audio/decoders/vorbis.h"
@@ -107,6 +108,9 @@ bool BaseSoundBuffer::loadFromFile(const Common::String &filename, bool forceRel
 	if (strFilename.hasSuffix(".ogg")) {
 #ifdef USE_VORBIS
 		_stream = Audio::makeVorbisStream(_file, DisposeAfterUse::YES);
+		// Music and speech are streamed, decode them ahead of the mixer
+		if (_streamed)
+			_stream = Audio::makeDecodeAheadStream(_stream, DisposeAfterUse::YES);
 #else
 		error("BSoundBuffer::LoadFromFile - Ogg Vorbis not supported by this version of ScummVM (please report as this shouldn't trigger)");
 #endif
@@ -32,6 +32,7 @@
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/ext/wme_steam.h"
 
 namespace Wintermute {
@@ -76,12 +77,13 @@ const char *SXSteamAPI::scToString() {
 
 //////////////////////////////////////////////////////////////////////////
 bool SXSteamAPI::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// RequestStats()
 	// There are currently no known games that are using this
 	// So, all the initialization should be done at the constructor instead
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "RequestStats") == 0) {
+	SC_NAME_CASE("RequestStats") {
 		stack->correctParams(0);
 		stack->pushBool(AchMan.isReady());
 		return STATUS_OK;
@@ -89,7 +91,7 @@ bool SXSteamAPI::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetAchievement(string id)
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetAchievement") == 0) {
+	SC_NAME_CASE("SetAchievement") {
 		stack->correctParams(1);
 		const char *id = stack->pop()->getString();
 
@@ -106,7 +108,7 @@ bool SXSteamAPI::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// IsAchieved(string id)
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsAchieved") == 0) {
+	SC_NAME_CASE("IsAchieved") {
 		stack->correctParams(1);
 		const char *id = stack->pop()->getString();
 		stack->pushBool(AchMan.isAchieved(id));
@@ -115,7 +117,7 @@ bool SXSteamAPI::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// ClearAchievement(string id)
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ClearAchievement") == 0) {
+	SC_NAME_CASE("ClearAchievement") {
 		stack->correctParams(1);
 		const char *id = stack->pop()->getString();
 		stack->pushBool(AchMan.clearAchievement(id));
@@ -124,7 +126,7 @@ bool SXSteamAPI::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetAchievementId(int index)
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetAchievementId") == 0) {
+	SC_NAME_CASE("GetAchievementId") {
 		stack->correctParams(1);
 		uint32 index = (uint32) stack->pop()->getInt();
 
@@ -139,7 +141,7 @@ bool SXSteamAPI::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetStat(string id, int|float value)
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetStat") == 0) {
+	SC_NAME_CASE("SetStat") {
 		stack->correctParams(2);
 		const char *id = stack->pop()->getString();
 		ScValue *val = stack->pop();
@@ -155,7 +157,7 @@ bool SXSteamAPI::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetStatInt(string id)
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetStatInt") == 0) {
+	SC_NAME_CASE("GetStatInt") {
 		stack->correctParams(1);
 		const char *id = stack->pop()->getString();
 		stack->pushInt(AchMan.getStatInt(id));
@@ -164,7 +166,7 @@ bool SXSteamAPI::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetStatFloat(string id)
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetStatFloat") == 0) {
+	SC_NAME_CASE("GetStatFloat") {
 		stack->correctParams(1);
 		const char *id = stack->pop()->getString();
 		stack->pushFloat(AchMan.getStatFloat(id));
@@ -173,7 +175,7 @@ bool SXSteamAPI::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// ResetAllStats(bool includingAchievements)
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ResetAllStats") == 0) {
+	SC_NAME_CASE("ResetAllStats") {
 		stack->correctParams(1);
 		bool includingAchievements = stack->pop()->getBool();
 
@@ -186,9 +188,11 @@ bool SXSteamAPI::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 		return STATUS_OK;
 	}
 
-	else {
+	default:
+	unknownName: {
 		return STATUS_FAILED;
 	}
+	}
 }
 
 
@@ -196,45 +200,48 @@ bool SXSteamAPI::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 ScValue *SXSteamAPI::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type (RO)
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("steamapi");
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// SteamAvailable (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SteamAvailable") {
+	SC_NAME_CASE("SteamAvailable") {
 		_scValue->setBool(AchMan.isReady());
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// StatsAvailable (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "StatsAvailable") {
+	SC_NAME_CASE("StatsAvailable") {
 		_scValue->setBool(AchMan.isReady());
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// NumAchievements (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumAchievements") {
+	SC_NAME_CASE("NumAchievements") {
 		_scValue->setInt(_achievementsInfo.descriptions.size());
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// AppId (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "AppId") {
+	SC_NAME_CASE("AppId") {
 		_scValue->setInt(atoi(_achievementsInfo.appId.c_str()));
 		return _scValue;
 	}
 
-	else {
+	default:
+	unknownName: {
 		return _scValue;
 	}
+	}
 }
 
 
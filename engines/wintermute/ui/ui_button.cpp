@@ -41,6 +41,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 
 namespace Wintermute {
 
@@ -792,10 +793,11 @@ void UIButton::press() {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetDisabledFont
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetDisabledFont") == 0) {
+	SC_NAME_CASE("SetDisabledFont") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -815,7 +817,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetHoverFont
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetHoverFont") == 0) {
+	SC_NAME_CASE("SetHoverFont") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -835,7 +837,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetPressedFont
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetPressedFont") == 0) {
+	SC_NAME_CASE("SetPressedFont") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -855,7 +857,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetFocusedFont
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetFocusedFont") == 0) {
+	SC_NAME_CASE("SetFocusedFont") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -877,7 +879,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	// [FoxTail] HeightToFit
 	// Used to autofit widget's height to it's content
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HeightToFit") == 0) {
+	SC_NAME_CASE("HeightToFit") {
 		stack->correctParams(0);
 
 		correctSize();
@@ -890,7 +892,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetDisabledImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetDisabledImage") == 0) {
+	SC_NAME_CASE("SetDisabledImage") {
 		stack->correctParams(1);
 
 		delete _imageDisable;
@@ -910,7 +912,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetDisabledImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetDisabledImage") == 0) {
+	SC_NAME_CASE("GetDisabledImage") {
 		stack->correctParams(0);
 		if (!_imageDisable || !_imageDisable->getFilename()) {
 			stack->pushNULL();
@@ -924,7 +926,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetDisabledImageObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetDisabledImageObject") == 0) {
+	SC_NAME_CASE("GetDisabledImageObject") {
 		stack->correctParams(0);
 		if (!_imageDisable) {
 			stack->pushNULL();
@@ -939,7 +941,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetHoverImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetHoverImage") == 0) {
+	SC_NAME_CASE("SetHoverImage") {
 		stack->correctParams(1);
 
 		delete _imageHover;
@@ -959,7 +961,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetHoverImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHoverImage") == 0) {
+	SC_NAME_CASE("GetHoverImage") {
 		stack->correctParams(0);
 		if (!_imageHover || !_imageHover->getFilename()) {
 			stack->pushNULL();
@@ -973,7 +975,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetHoverImageObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetHoverImageObject") == 0) {
+	SC_NAME_CASE("GetHoverImageObject") {
 		stack->correctParams(0);
 		if (!_imageHover) {
 			stack->pushNULL();
@@ -987,7 +989,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetPressedImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetPressedImage") == 0) {
+	SC_NAME_CASE("SetPressedImage") {
 		stack->correctParams(1);
 
 		delete _imagePress;
@@ -1007,7 +1009,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetPressedImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetPressedImage") == 0) {
+	SC_NAME_CASE("GetPressedImage") {
 		stack->correctParams(0);
 		if (!_imagePress || !_imagePress->getFilename()) {
 			stack->pushNULL();
@@ -1021,7 +1023,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetPressedImageObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetPressedImageObject") == 0) {
+	SC_NAME_CASE("GetPressedImageObject") {
 		stack->correctParams(0);
 		if (!_imagePress) {
 			stack->pushNULL();
@@ -1035,7 +1037,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetFocusedImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetFocusedImage") == 0) {
+	SC_NAME_CASE("SetFocusedImage") {
 		stack->correctParams(1);
 
 		delete _imageFocus;
@@ -1055,7 +1057,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetFocusedImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFocusedImage") == 0) {
+	SC_NAME_CASE("GetFocusedImage") {
 		stack->correctParams(0);
 		if (!_imageFocus || !_imageFocus->getFilename()) {
 			stack->pushNULL();
@@ -1069,7 +1071,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetFocusedImageObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFocusedImageObject") == 0) {
+	SC_NAME_CASE("GetFocusedImageObject") {
 		stack->correctParams(0);
 		if (!_imageFocus) {
 			stack->pushNULL();
@@ -1083,7 +1085,7 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Press
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Press") == 0) {
+	SC_NAME_CASE("Press") {
 		stack->correctParams(0);
 
 		if (_visible && !_disable) {
@@ -1093,9 +1095,12 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		stack->pushNULL();
 
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return UIObject::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -1103,10 +1108,11 @@ bool UIButton::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *UIButton::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("button");
 		return _scValue;
 	}
@@ -1114,7 +1120,7 @@ ScValue *UIButton::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextAlign
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TextAlign") {
+	SC_NAME_CASE("TextAlign") {
 		_scValue->setInt(_align);
 		return _scValue;
 	}
@@ -1122,35 +1128,39 @@ ScValue *UIButton::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Focusable
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Focusable") {
+	SC_NAME_CASE("Focusable") {
 		_scValue->setBool(_canFocus);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Pressed
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Pressed") {
+	SC_NAME_CASE("Pressed") {
 		_scValue->setBool(_stayPressed);
 		return _scValue;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// PixelPerfect
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PixelPerfect") {
+	SC_NAME_CASE("PixelPerfect") {
 		_scValue->setBool(_pixelPerfect);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return UIObject::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool UIButton::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextAlign
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "TextAlign") == 0) {
+	SC_NAME_CASE("TextAlign") {
 		int i = value->getInt();
 		if (i < 0 || i >= NUM_TEXT_ALIGN) {
 			i = 0;
@@ -1162,26 +1172,29 @@ bool UIButton::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Focusable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Focusable") == 0) {
+	SC_NAME_CASE("Focusable") {
 		_canFocus = value->getBool();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// Pressed
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Pressed") == 0) {
+	SC_NAME_CASE("Pressed") {
 		_stayPressed = value->getBool();
 		return STATUS_OK;
 	}
 	//////////////////////////////////////////////////////////////////////////
 	// PixelPerfect
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PixelPerfect") == 0) {
+	SC_NAME_CASE("PixelPerfect") {
 		_pixelPerfect = value->getBool();
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return UIObject::scSetProperty(name, value);
 	}
+	}
 }
 
 
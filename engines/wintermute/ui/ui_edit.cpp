@@ -44,6 +44,7 @@
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/utils/utils.h"
 #include "common/util.h"
 #include "common/keyboard.h"
@@ -404,10 +405,11 @@ bool UIEdit::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("editor");
 		return _scValue;
 	}
@@ -415,7 +417,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SelStart
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SelStart") {
+	SC_NAME_CASE("SelStart") {
 		_scValue->setInt(_selStart);
 		return _scValue;
 	}
@@ -423,7 +425,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SelEnd
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SelEnd") {
+	SC_NAME_CASE("SelEnd") {
 		_scValue->setInt(_selEnd);
 		return _scValue;
 	}
@@ -431,7 +433,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorBlinkRate
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CursorBlinkRate") {
+	SC_NAME_CASE("CursorBlinkRate") {
 		_scValue->setInt(_cursorBlinkRate);
 		return _scValue;
 	}
@@ -439,7 +441,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorChar
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "CursorChar") {
+	SC_NAME_CASE("CursorChar") {
 		_scValue->setString(_cursorChar);
 		return _scValue;
 	}
@@ -447,7 +449,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// FrameWidth
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "FrameWidth") {
+	SC_NAME_CASE("FrameWidth") {
 		_scValue->setInt(_frameWidth);
 		return _scValue;
 	}
@@ -455,7 +457,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxLength
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "MaxLength") {
+	SC_NAME_CASE("MaxLength") {
 		_scValue->setInt(_maxLength);
 		return _scValue;
 	}
@@ -463,7 +465,7 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Text
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Text") {
+	SC_NAME_CASE("Text") {
 		if (_gameRef->_textEncoding == TEXT_UTF8) {
 			WideString wstr = StringUtil::ansiToWide(_text);
 			_scValue->setString(StringUtil::wideToUtf8(wstr).c_str());
@@ -471,18 +473,22 @@ ScValue *UIEdit::scGetProperty(const Common::String &name) {
 			_scValue->setString(_text);
 		}
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return UIObject::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool UIEdit::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SelStart
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SelStart") == 0) {
+	SC_NAME_CASE("SelStart") {
 		_selStart = value->getInt();
 		_selStart = MAX<int32>(_selStart, 0);
 		_selStart = (int)MIN((size_t)_selStart, strlen(_text));
@@ -492,7 +498,7 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SelEnd
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SelEnd") == 0) {
+	SC_NAME_CASE("SelEnd") {
 		_selEnd = value->getInt();
 		_selEnd = MAX<int32>(_selEnd, 0);
 		_selEnd = (int)MIN((size_t)_selEnd, strlen(_text));
@@ -502,7 +508,7 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorBlinkRate
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CursorBlinkRate") == 0) {
+	SC_NAME_CASE("CursorBlinkRate") {
 		_cursorBlinkRate = (uint32)value->getInt();
 		return STATUS_OK;
 	}
@@ -510,7 +516,7 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// CursorChar
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CursorChar") == 0) {
+	SC_NAME_CASE("CursorChar") {
 		setCursorChar(value->getString());
 		return STATUS_OK;
 	}
@@ -518,7 +524,7 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// FrameWidth
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FrameWidth") == 0) {
+	SC_NAME_CASE("FrameWidth") {
 		_frameWidth = value->getInt();
 		return STATUS_OK;
 	}
@@ -526,7 +532,7 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// MaxLength
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MaxLength") == 0) {
+	SC_NAME_CASE("MaxLength") {
 		_maxLength = value->getInt();
 		return STATUS_OK;
 	}
@@ -534,7 +540,7 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Text
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Text") == 0) {
+	SC_NAME_CASE("Text") {
 		if (_gameRef->_textEncoding == TEXT_UTF8) {
 			WideString wstr = StringUtil::utf8ToWide(value->getString());
 			setText(StringUtil::wideToAnsi(wstr).c_str());
@@ -542,9 +548,12 @@ bool UIEdit::scSetProperty(const char *name, ScValue *value) {
 			setText(value->getString());
 		}
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return UIObject::scSetProperty(name, value);
 	}
+	}
 }
 
 
@@ -35,6 +35,7 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/font/base_font_storage.h"
 
 namespace Wintermute {
@@ -157,10 +158,11 @@ void UIObject::correctSize() {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// SetFont
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SetFont") == 0) {
+	SC_NAME_CASE("SetFont") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -180,7 +182,7 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetImage") == 0) {
+	SC_NAME_CASE("SetImage") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -208,7 +210,7 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetImage") == 0) {
+	SC_NAME_CASE("GetImage") {
 		stack->correctParams(0);
 		if (!_image || !_image->getFilename()) {
 			stack->pushNULL();
@@ -222,7 +224,7 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetImageObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetImageObject") == 0) {
+	SC_NAME_CASE("GetImageObject") {
 		stack->correctParams(0);
 		if (!_image) {
 			stack->pushNULL();
@@ -236,7 +238,7 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Focus
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Focus") == 0) {
+	SC_NAME_CASE("Focus") {
 		stack->correctParams(0);
 		focus();
 		stack->pushNULL();
@@ -246,7 +248,8 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// MoveAfter / MoveBefore
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MoveAfter") == 0 || strcmp(name, "MoveBefore") == 0) {
+	SC_NAME_CASE("MoveAfter")
+	SC_NAME_ALIAS("MoveBefore") {
 		stack->correctParams(1);
 
 		if (_parent && _parent->_type == UI_WINDOW) {
@@ -312,7 +315,7 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// MoveToBottom
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MoveToBottom") == 0) {
+	SC_NAME_CASE("MoveToBottom") {
 		stack->correctParams(0);
 
 		if (_parent && _parent->_type == UI_WINDOW) {
@@ -335,7 +338,7 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// MoveToTop
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "MoveToTop") == 0) {
+	SC_NAME_CASE("MoveToTop") {
 		stack->correctParams(0);
 
 		if (_parent && _parent->_type == UI_WINDOW) {
@@ -353,9 +356,12 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		}
 
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scCallMethod(script, stack, thisStack, name);
 	}
+	}
 }
 
 
@@ -363,10 +369,11 @@ bool UIObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *UIObject::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("ui_object");
 		return _scValue;
 	}
@@ -374,7 +381,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Name") {
+	SC_NAME_CASE("Name") {
 		_scValue->setString(getName());
 		return _scValue;
 	}
@@ -382,7 +389,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Parent (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Parent") {
+	SC_NAME_CASE("Parent") {
 		_scValue->setNative(_parent, true);
 		return _scValue;
 	}
@@ -390,7 +397,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ParentNotify
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ParentNotify") {
+	SC_NAME_CASE("ParentNotify") {
 		_scValue->setBool(_parentNotify);
 		return _scValue;
 	}
@@ -398,7 +405,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Width
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Width") {
+	SC_NAME_CASE("Width") {
 		_scValue->setInt(_width);
 		return _scValue;
 	}
@@ -406,7 +413,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Height
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Height") {
+	SC_NAME_CASE("Height") {
 		_scValue->setInt(_height);
 		return _scValue;
 	}
@@ -414,7 +421,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Visible
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Visible") {
+	SC_NAME_CASE("Visible") {
 		_scValue->setBool(_visible);
 		return _scValue;
 	}
@@ -422,7 +429,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Disabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Disabled") {
+	SC_NAME_CASE("Disabled") {
 		_scValue->setBool(_disable);
 		return _scValue;
 	}
@@ -430,7 +437,7 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Text
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Text") {
+	SC_NAME_CASE("Text") {
 		_scValue->setString(_text);
 		return _scValue;
 	}
@@ -438,7 +445,8 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NextSibling (RO) / PrevSibling (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NextSibling" || name == "PrevSibling") {
+	SC_NAME_CASE("NextSibling")
+	SC_NAME_ALIAS("PrevSibling") {
 		_scValue->setNULL();
 		if (_parent && _parent->_type == UI_WINDOW) {
 			UIWindow *win = (UIWindow *)_parent;
@@ -458,18 +466,22 @@ ScValue *UIObject::scGetProperty(const Common::String &name) {
 			}
 		}
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool UIObject::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	SC_NAME_CASE("Name") {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -477,7 +489,7 @@ bool UIObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ParentNotify
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ParentNotify") == 0) {
+	SC_NAME_CASE("ParentNotify") {
 		_parentNotify = value->getBool();
 		return STATUS_OK;
 	}
@@ -485,7 +497,7 @@ bool UIObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Width
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Width") == 0) {
+	SC_NAME_CASE("Width") {
 		_width = value->getInt();
 		return STATUS_OK;
 	}
@@ -493,7 +505,7 @@ bool UIObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Height
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Height") == 0) {
+	SC_NAME_CASE("Height") {
 		_height = value->getInt();
 		return STATUS_OK;
 	}
@@ -501,7 +513,7 @@ bool UIObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Visible
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Visible") == 0) {
+	SC_NAME_CASE("Visible") {
 		_visible = value->getBool();
 		return STATUS_OK;
 	}
@@ -509,7 +521,7 @@ bool UIObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Disabled
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Disabled") == 0) {
+	SC_NAME_CASE("Disabled") {
 		_disable = value->getBool();
 		return STATUS_OK;
 	}
@@ -517,12 +529,15 @@ bool UIObject::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Text
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Text") == 0) {
+	SC_NAME_CASE("Text") {
 		setText(value->getString());
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return BaseObject::scSetProperty(name, value);
 	}
+	}
 }
 
 
@@ -37,6 +37,7 @@
 #include "engines/wintermute/base/base_string_table.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/base_sprite.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/platform_osystem.h"
@@ -437,10 +438,11 @@ bool UIText::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 ScValue *UIText::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("static");
 		return _scValue;
 	}
@@ -448,7 +450,7 @@ ScValue *UIText::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// TextAlign
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "TextAlign") {
+	SC_NAME_CASE("TextAlign") {
 		_scValue->setInt(_textAlign);
 		return _scValue;
 	}
@@ -456,12 +458,15 @@ ScValue *UIText::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// VerticalAlign
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "VerticalAlign") {
+	SC_NAME_CASE("VerticalAlign") {
 		_scValue->setInt(_verticalAlign);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return UIObject::scGetProperty(name);
 	}
+	}
 }
 
 
@@ -45,6 +45,7 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "engines/wintermute/base/scriptables/script.h"
 #include "engines/wintermute/base/scriptables/script_stack.h"
+#include "engines/wintermute/base/scriptables/script_name_hash.h"
 #include "engines/wintermute/base/base_sprite.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/platform_osystem.h"
@@ -766,10 +767,12 @@ bool UIWindow::showWidget(const char *name, bool visible) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// GetWidget / GetControl
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "GetWidget") == 0 || strcmp(name, "GetControl") == 0) {
+	SC_NAME_CASE("GetWidget")
+	SC_NAME_ALIAS("GetControl") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		if (val->getType() == VAL_INT) {
@@ -795,7 +798,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetInactiveFont
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetInactiveFont") == 0) {
+	SC_NAME_CASE("SetInactiveFont") {
 		stack->correctParams(1);
 
 		if (_fontInactive) {
@@ -810,7 +813,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetInactiveImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetInactiveImage") == 0) {
+	SC_NAME_CASE("SetInactiveImage") {
 		stack->correctParams(1);
 
 		delete _imageInactive;
@@ -830,7 +833,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetInactiveImage
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetInactiveImage") == 0) {
+	SC_NAME_CASE("GetInactiveImage") {
 		stack->correctParams(0);
 		if (!_imageInactive || !_imageInactive->getFilename()) {
 			stack->pushNULL();
@@ -844,7 +847,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetInactiveImageObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetInactiveImageObject") == 0) {
+	SC_NAME_CASE("GetInactiveImageObject") {
 		stack->correctParams(0);
 		if (!_imageInactive) {
 			stack->pushNULL();
@@ -859,7 +862,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Close
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Close") == 0) {
+	SC_NAME_CASE("Close") {
 		stack->correctParams(0);
 		stack->pushBool(DID_SUCCEED(close()));
 		return STATUS_OK;
@@ -868,7 +871,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GoExclusive
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GoExclusive") == 0) {
+	SC_NAME_CASE("GoExclusive") {
 		stack->correctParams(0);
 		goExclusive();
 		script->waitFor(this);
@@ -879,7 +882,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GoSystemExclusive
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GoSystemExclusive") == 0) {
+	SC_NAME_CASE("GoSystemExclusive") {
 		stack->correctParams(0);
 		goSystemExclusive();
 		script->waitFor(this);
@@ -890,7 +893,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Center
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Center") == 0) {
+	SC_NAME_CASE("Center") {
 		stack->correctParams(0);
 		_posX = (_gameRef->_renderer->getWidth() - _width) / 2;
 		_posY = (_gameRef->_renderer->getHeight() - _height) / 2;
@@ -901,7 +904,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LoadFromFile
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadFromFile") == 0) {
+	SC_NAME_CASE("LoadFromFile") {
 		stack->correctParams(1);
 
 		ScValue *val = stack->pop();
@@ -918,7 +921,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateButton
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateButton") == 0) {
+	SC_NAME_CASE("CreateButton") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -937,7 +940,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateStatic
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateStatic") == 0) {
+	SC_NAME_CASE("CreateStatic") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -956,7 +959,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateEditor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateEditor") == 0) {
+	SC_NAME_CASE("CreateEditor") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -975,7 +978,7 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateWindow") == 0) {
+	SC_NAME_CASE("CreateWindow") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -994,7 +997,11 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteControl / DeleteButton / DeleteStatic / DeleteEditor / DeleteWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteControl") == 0 || strcmp(name, "DeleteButton") == 0 || strcmp(name, "DeleteStatic") == 0 || strcmp(name, "DeleteEditor") == 0 || strcmp(name, "DeleteWindow") == 0) {
+	SC_NAME_CASE("DeleteControl")
+	SC_NAME_ALIAS("DeleteButton")
+	SC_NAME_ALIAS("DeleteStatic")
+	SC_NAME_ALIAS("DeleteEditor")
+	SC_NAME_ALIAS("DeleteWindow") {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		UIObject *obj = (UIObject *)val->getNative();
@@ -1010,12 +1017,16 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		}
 		stack->pushNULL();
 		return STATUS_OK;
-	} else if DID_SUCCEED(_gameRef->windowScriptMethodHook(this, script, stack, name)) {
-		return STATUS_OK;
 	}
+	default:
+	unknownName:
+		if DID_SUCCEED(_gameRef->windowScriptMethodHook(this, script, stack, name)) {
+			return STATUS_OK;
+		}
 
-	else {
-		return UIObject::scCallMethod(script, stack, thisStack, name);
+		else {
+			return UIObject::scCallMethod(script, stack, thisStack, name);
+		}
 	}
 }
 
@@ -1024,10 +1035,11 @@ bool UIWindow::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	_scValue->setNULL();
 
+	switch (scNameHash(name.c_str())) {
 	//////////////////////////////////////////////////////////////////////////
 	// Type
 	//////////////////////////////////////////////////////////////////////////
-	if (name == "Type") {
+	SC_NAME_CASE("Type") {
 		_scValue->setString("window");
 		return _scValue;
 	}
@@ -1035,7 +1047,8 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// NumWidgets / NumControls (RO)
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "NumWidgets" || name == "NumControls") {
+	SC_NAME_CASE("NumWidgets")
+	SC_NAME_ALIAS("NumControls") {
 		_scValue->setInt(_widgets.size());
 		return _scValue;
 	}
@@ -1043,7 +1056,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Exclusive
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Exclusive") {
+	SC_NAME_CASE("Exclusive") {
 		_scValue->setBool(_mode == WINDOW_EXCLUSIVE);
 		return _scValue;
 	}
@@ -1051,7 +1064,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// SystemExclusive
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "SystemExclusive") {
+	SC_NAME_CASE("SystemExclusive") {
 		_scValue->setBool(_mode == WINDOW_SYSTEM_EXCLUSIVE);
 		return _scValue;
 	}
@@ -1059,7 +1072,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Menu
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Menu") {
+	SC_NAME_CASE("Menu") {
 		_scValue->setBool(_isMenu);
 		return _scValue;
 	}
@@ -1067,7 +1080,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// InGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "InGame") {
+	SC_NAME_CASE("InGame") {
 		_scValue->setBool(_inGame);
 		return _scValue;
 	}
@@ -1075,7 +1088,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// PauseMusic
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "PauseMusic") {
+	SC_NAME_CASE("PauseMusic") {
 		_scValue->setBool(_pauseMusic);
 		return _scValue;
 	}
@@ -1083,7 +1096,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// ClipContents
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "ClipContents") {
+	SC_NAME_CASE("ClipContents") {
 		_scValue->setBool(_clipContents);
 		return _scValue;
 	}
@@ -1091,7 +1104,7 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// Transparent
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "Transparent") {
+	SC_NAME_CASE("Transparent") {
 		_scValue->setBool(_transparent);
 		return _scValue;
 	}
@@ -1099,21 +1112,25 @@ ScValue *UIWindow::scGetProperty(const Common::String &name) {
 	//////////////////////////////////////////////////////////////////////////
 	// FadeColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (name == "FadeColor") {
+	SC_NAME_CASE("FadeColor") {
 		_scValue->setInt((int)_fadeColor);
 		return _scValue;
-	} else {
+	}
+	default:
+	unknownName: {
 		return UIObject::scGetProperty(name);
 	}
+	}
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool UIWindow::scSetProperty(const char *name, ScValue *value) {
+	switch (scNameHash(name)) {
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "Name") == 0) {
+	SC_NAME_CASE("Name") {
 		setName(value->getString());
 		return STATUS_OK;
 	}
@@ -1121,7 +1138,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Menu
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Menu") == 0) {
+	SC_NAME_CASE("Menu") {
 		_isMenu = value->getBool();
 		return STATUS_OK;
 	}
@@ -1129,7 +1146,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// InGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "InGame") == 0) {
+	SC_NAME_CASE("InGame") {
 		_inGame = value->getBool();
 		return STATUS_OK;
 	}
@@ -1137,7 +1154,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// PauseMusic
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PauseMusic") == 0) {
+	SC_NAME_CASE("PauseMusic") {
 		_pauseMusic = value->getBool();
 		return STATUS_OK;
 	}
@@ -1145,7 +1162,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// ClipContents
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ClipContents") == 0) {
+	SC_NAME_CASE("ClipContents") {
 		_clipContents = value->getBool();
 		return STATUS_OK;
 	}
@@ -1153,7 +1170,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Transparent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Transparent") == 0) {
+	SC_NAME_CASE("Transparent") {
 		_transparent = value->getBool();
 		return STATUS_OK;
 	}
@@ -1161,7 +1178,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// FadeColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeColor") == 0) {
+	SC_NAME_CASE("FadeColor") {
 		_fadeColor = (uint32)value->getInt();
 		_fadeBackground = (_fadeColor != 0);
 		return STATUS_OK;
@@ -1170,7 +1187,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// Exclusive
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Exclusive") == 0) {
+	SC_NAME_CASE("Exclusive") {
 		if (value->getBool()) {
 			goExclusive();
 		} else {
@@ -1183,7 +1200,7 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	// SystemExclusive
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SystemExclusive") == 0) {
+	SC_NAME_CASE("SystemExclusive") {
 		if (value->getBool()) {
 			goSystemExclusive();
 		} else {
@@ -1191,9 +1208,12 @@ bool UIWindow::scSetProperty(const char *name, ScValue *value) {
 			_visible = true;
 		}
 		return STATUS_OK;
-	} else {
+	}
+	default:
+	unknownName: {
 		return UIObject::scSetProperty(name, value);
 	}
+	}
 }
 
 
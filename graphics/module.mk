@@ -62,6 +62,29 @@ MODULE_OBJS := \
 	tinygl/ztriangle.o \
 	tinygl/zblit.o \
 	tinygl/zdirtyrect.o \
+	tinygl/zspan.o
+
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	yuv_to_rgb_sse2.o \
+	tinygl/zspan_sse2.o
+
+$(MODULE)/yuv_to_rgb_sse2.o: CXXFLAGS += -msse2
+$(MODULE)/tinygl/zspan_sse2.o: CXXFLAGS += -msse2
+endif
+
+ifdef SCUMMVM_AVX2
+MODULE_OBJS += \
+	yuv_to_rgb_avx2.o
+
+$(MODULE)/yuv_to_rgb_avx2.o: CXXFLAGS += -mavx2
+endif
+
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	yuv_to_rgb_neon.o \
+	tinygl/zspan_neon.o
+endif
 
 ifdef USE_SCALERS
 MODULE_OBJS += \
@@ -690,3 +690,15 @@ void tglEnableDirtyRects(bool enable) {
 	TinyGL::GLContext *c = TinyGL::gl_get_context();
 	c->_enableDirtyRectangles = enable;
 }
+
+void tglEnableTiledRendering(bool enable) {
+	TinyGL::GLContext *c = TinyGL::gl_get_context();
+	c->_enableTiledRendering = enable;
+}
+
+void tglGetDirtyRectsStats(int *rectanglesIn, int *rectanglesOut, int *pixelsRasterized) {
+	TinyGL::GLContext *c = TinyGL::gl_get_context();
+	*rectanglesIn = c->_dirtyRectsStats.rectanglesIn;
+	*rectanglesOut = c->_dirtyRectsStats.rectanglesOut;
+	*pixelsRasterized = c->_dirtyRectsStats.pixelsRasterized;
+}
@@ -35,46 +35,63 @@
 
 namespace TinyGL {
 
-void glopArrayElement(GLContext *c, GLParam *param) {
+// pointers set while a buffer is bound are offsets into that buffer
+static inline const float *gl_array_data(const GLBuffer *buffer, const float *pointer) {
+	if (buffer)
+		return (const float *)(buffer->data + (size_t)pointer);
+	return pointer;
+}
+
+// set the current attributes from the enabled arrays, and return the vertex coords if there is one
+static bool gl_load_array_element(GLContext *c, int idx, GLParam *vertex) {
 	int i;
 	int states = c->client_states;
-	int idx = param[1].i;
 
 	if (states & COLOR_ARRAY) {
 		GLParam p[5];
 		int size = c->color_array_size;
+		const float *array = gl_array_data(c->color_array_buffer, c->color_array);
 		i = idx * (size + c->color_array_stride);
-		p[1].f = c->color_array[i];
-		p[2].f = c->color_array[i + 1];
-		p[3].f = c->color_array[i + 2];
-		p[4].f = size > 3 ? c->color_array[i + 3] : 1.0f;
+		p[1].f = array[i];
+		p[2].f = array[i + 1];
+		p[3].f = array[i + 2];
+		p[4].f = size > 3 ? array[i + 3] : 1.0f;
 		glopColor(c, p);
 	}
 	if (states & NORMAL_ARRAY) {
+		const float *array = gl_array_data(c->normal_array_buffer, c->normal_array);
 		i = idx * (3 + c->normal_array_stride);
-		c->current_normal.X = c->normal_array[i];
-		c->current_normal.Y = c->normal_array[i + 1];
-		c->current_normal.Z = c->normal_array[i + 2];
+		c->current_normal.X = array[i];
+		c->current_normal.Y = array[i + 1];
+		c->current_normal.Z = array[i + 2];
 		c->current_normal.W = 0.0f; // NOTE: this used to be Z but assigning Z again seemed like a bug...
 	}
 	if (states & TEXCOORD_ARRAY) {
 		int size = c->texcoord_array_size;
+		const float *array = gl_array_data(c->texcoord_array_buffer, c->texcoord_array);
 		i = idx * (size + c->texcoord_array_stride);
-		c->current_tex_coord.X = c->texcoord_array[i];
-		c->current_tex_coord.Y = c->texcoord_array[i + 1];
-		c->current_tex_coord.Z = size > 2 ? c->texcoord_array[i + 2] : 0.0f;
-		c->current_tex_coord.W = size > 3 ? c->texcoord_array[i + 3] : 1.0f;
+		c->current_tex_coord.X = array[i];
+		c->current_tex_coord.Y = array[i + 1];
+		c->current_tex_coord.Z = size > 2 ? array[i + 2] : 0.0f;
+		c->current_tex_coord.W = size > 3 ? array[i + 3] : 1.0f;
 	}
 	if (states & VERTEX_ARRAY) {
-		GLParam p[5];
 		int size = c->vertex_array_size;
+		const float *array = gl_array_data(c->vertex_array_buffer, c->vertex_array);
 		i = idx * (size + c->vertex_array_stride);
-		p[1].f = c->vertex_array[i];
-		p[2].f = c->vertex_array[i + 1];
-		p[3].f = size > 2 ? c->vertex_array[i + 2] : 0.0f;
-		p[4].f = size > 3 ? c->vertex_array[i + 3] : 1.0f;
-		glopVertex(c, p);
+		vertex[1].f = array[i];
+		vertex[2].f = array[i + 1];
+		vertex[3].f = size > 2 ? array[i + 2] : 0.0f;
+		vertex[4].f = size > 3 ? array[i + 3] : 1.0f;
+		return true;
 	}
+	return false;
+}
+
+void glopArrayElement(GLContext *c, GLParam *param) {
+	GLParam p[5];
+	if (gl_load_array_element(c, param[1].i, p))
+		glopVertex(c, p);
 }
 
 void glopDrawArrays(GLContext *c, GLParam *p) {
@@ -89,6 +106,70 @@ void glopDrawArrays(GLContext *c, GLParam *p) {
 	glopEnd(c, NULL);
 }
 
+static inline unsigned int gl_element_index(const void *indices, int type, int i) {
+	switch (type) {
+	case TGL_UNSIGNED_BYTE:
+		return ((const unsigned char *)indices)[i];
+	case TGL_UNSIGNED_SHORT:
+		return ((const unsigned short *)indices)[i];
+	default:
+		return ((const unsigned int *)indices)[i];
+	}
+}
+
+// Like glDrawArrays, but vertices referenced several times are only transformed and lit once.
+// The result is the same as with glArrayElement because, with color material enabled too,
+// a vertex is shaded with nothing but its own attributes and the state that is fixed
+// between glBegin and glEnd.
+void glopDrawElements(GLContext *c, GLParam *p) {
+	int count = p[2].i;
+	int type = p[3].i;
+	const void *indices = p[4].p;
+	GLParam begin[2];
+	GLParam vertex[5];
+
+	if (c->element_array_buffer)
+		indices = c->element_array_buffer->data + (size_t)indices;
+
+	begin[1].i = p[1].i;
+	glopBegin(c, begin);
+
+	if (count > 0 && (c->client_states & VERTEX_ARRAY)) {
+		unsigned int stamp = ++c->element_stamp;
+		if (stamp == 0) {
+			for (uint i = 0; i < c->element_vertex_stamps.size(); i++)
+				c->element_vertex_stamps[i] = 0;
+			stamp = c->element_stamp = 1;
+		}
+
+		unsigned int idx = 0;
+		for (int i = 0; i < count; i++) {
+			idx = gl_element_index(indices, type, i);
+			if (idx >= c->element_vertices.size()) {
+				c->element_vertices.resize(idx + 1);
+				c->element_vertex_stamps.resize(idx + 1);
+			}
+
+			GLVertex *v = &c->element_vertices[idx];
+			if (c->element_vertex_stamps[idx] != stamp) {
+				gl_load_array_element(c, idx, vertex);
+				v->coord.X = vertex[1].f;
+				v->coord.Y = vertex[2].f;
+				v->coord.Z = vertex[3].f;
+				v->coord.W = vertex[4].f;
+				gl_process_vertex(c, v);
+				c->element_vertex_stamps[idx] = stamp;
+			}
+			*gl_add_vertex(c) = *v;
+		}
+
+		// leave the current attributes as the last glArrayElement would have
+		gl_load_array_element(c, idx, vertex);
+	}
+
+	glopEnd(c, NULL);
+}
+
 void glopEnableClientState(GLContext *c, GLParam *p) {
 	c->client_states |= p[1].i;
 }
@@ -101,23 +182,69 @@ void glopVertexPointer(GLContext *c, GLParam *p) {
 	c->vertex_array_size = p[1].i;
 	c->vertex_array_stride = p[2].i;
 	c->vertex_array = (float *)p[3].p;
+	c->vertex_array_buffer = c->array_buffer;
 }
 
 void glopColorPointer(GLContext *c, GLParam *p) {
 	c->color_array_size = p[1].i;
 	c->color_array_stride = p[2].i;
 	c->color_array = (float *)p[3].p;
+	c->color_array_buffer = c->array_buffer;
 }
 
 void glopNormalPointer(GLContext *c, GLParam *p) {
 	c->normal_array_stride = p[1].i;
 	c->normal_array = (float *)p[2].p;
+	c->normal_array_buffer = c->array_buffer;
 }
 
 void glopTexCoordPointer(GLContext *c, GLParam *p) {
 	c->texcoord_array_size = p[1].i;
 	c->texcoord_array_stride = p[2].i;
 	c->texcoord_array = (float *)p[3].p;
+	c->texcoord_array_buffer = c->array_buffer;
+}
+
+static GLBuffer *gl_find_buffer(GLContext *c, unsigned int buffer) {
+	if (buffer == 0 || buffer > c->buffers.size())
+		return nullptr;
+	return c->buffers[buffer - 1];
+}
+
+static GLBuffer **gl_get_buffer_binding(GLContext *c, int target) {
+	switch (target) {
+	case TGL_ARRAY_BUFFER:
+		return &c->array_buffer;
+	case TGL_ELEMENT_ARRAY_BUFFER:
+		return &c->element_array_buffer;
+	default:
+		error("tinygl: unsupported buffer target %d", target);
+	}
+}
+
+static void gl_delete_buffer(GLContext *c, unsigned int buffer) {
+	GLBuffer *b = gl_find_buffer(c, buffer);
+	if (!b)
+		return;
+
+	GLBuffer **bindings[] = {
+		&c->array_buffer, &c->element_array_buffer,
+		&c->vertex_array_buffer, &c->normal_array_buffer, &c->color_array_buffer, &c->texcoord_array_buffer
+	};
+	for (int i = 0; i < ARRAYSIZE(bindings); i++) {
+		if (*bindings[i] == b)
+			*bindings[i] = nullptr;
+	}
+
+	gl_free(b->data);
+	gl_free(b);
+	c->buffers[buffer - 1] = nullptr;
+}
+
+void gl_dispose_buffers(GLContext *c) {
+	for (uint i = 0; i < c->buffers.size(); i++)
+		gl_delete_buffer(c, i + 1);
+	c->buffers.clear();
 }
 
 } // end of namespace TinyGL
@@ -224,3 +351,68 @@ void tglTexCoordPointer(TGLint size, TGLenum type, TGLsizei stride, const TGLvoi
 	p[3].p = const_cast<void *>(pointer);
 	gl_add_op(p);
 }
+
+void tglDrawElements(TGLenum mode, TGLsizei count, TGLenum type, const TGLvoid *indices) {
+	TinyGL::GLParam p[5];
+	assert(type == TGL_UNSIGNED_BYTE || type == TGL_UNSIGNED_SHORT || type == TGL_UNSIGNED_INT);
+	p[0].op = TinyGL::OP_DrawElements;
+	p[1].i = mode;
+	p[2].i = count;
+	p[3].i = type;
+	p[4].p = const_cast<void *>(indices);
+	gl_add_op(p);
+}
+
+void tglGenBuffers(TGLsizei n, TGLuint *buffers) {
+	TinyGL::GLContext *c = TinyGL::gl_get_context();
+
+	// a name is taken as soon as it is generated, so that the next call won't return it again
+	uint slot = 0;
+	for (int i = 0; i < n; i++) {
+		while (slot < c->buffers.size() && c->buffers[slot])
+			slot++;
+		TinyGL::GLBuffer *b = (TinyGL::GLBuffer *)TinyGL::gl_zalloc(sizeof(TinyGL::GLBuffer));
+		if (slot == c->buffers.size())
+			c->buffers.push_back(b);
+		else
+			c->buffers[slot] = b;
+		buffers[i] = slot + 1;
+	}
+}
+
+void tglDeleteBuffers(TGLsizei n, const TGLuint *buffers) {
+	TinyGL::GLContext *c = TinyGL::gl_get_context();
+
+	for (int i = 0; i < n; i++)
+		TinyGL::gl_delete_buffer(c, buffers[i]);
+}
+
+void tglBindBuffer(TGLenum target, TGLuint buffer) {
+	TinyGL::GLContext *c = TinyGL::gl_get_context();
+	TinyGL::GLBuffer *b = TinyGL::gl_find_buffer(c, buffer);
+
+	assert(buffer == 0 || b);
+	*TinyGL::gl_get_buffer_binding(c, target) = b;
+}
+
+void tglBufferData(TGLenum target, TGLsizeiptr size, const TGLvoid *data, TGLenum usage) {
+	TinyGL::GLContext *c = TinyGL::gl_get_context();
+	TinyGL::GLBuffer *b = *TinyGL::gl_get_buffer_binding(c, target);
+
+	assert(b);
+	if (b->size != size) {
+		TinyGL::gl_free(b->data);
+		b->data = (unsigned char *)TinyGL::gl_malloc(size);
+		b->size = size;
+	}
+	if (data)
+		memcpy(b->data, data, size);
+}
+
+void tglBufferSubData(TGLenum target, TGLintptr offset, TGLsizeiptr size, const TGLvoid *data) {
+	TinyGL::GLContext *c = TinyGL::gl_get_context();
+	TinyGL::GLBuffer *b = *TinyGL::gl_get_buffer_binding(c, target);
+
+	assert(b && offset >= 0 && offset + size <= b->size);
+	memcpy(b->data + offset, data, size);
+}
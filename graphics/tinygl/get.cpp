@@ -51,7 +51,7 @@ void tglGetIntegerv(int pname, int *params) {
 		*params = T_MAX_LIGHTS;
 		break;
 	case TGL_MAX_TEXTURE_SIZE:
-		*params = c->_textureSize;
+		*params = c->_maxTextureSize;
 		break;
 	case TGL_MAX_TEXTURE_STACK_DEPTH:
 		*params = MAX_TEXTURE_STACK_DEPTH;
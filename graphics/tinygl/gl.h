@@ -71,6 +71,11 @@ enum {
 	TGL_INDEX_ARRAY                 = 0x8077,
 	TGL_TEXTURE_COORD_ARRAY         = 0x8078,
 	TGL_EDGE_FLAG_ARRAY             = 0x8079,
+	TGL_ARRAY_BUFFER                = 0x8892,
+	TGL_ELEMENT_ARRAY_BUFFER        = 0x8893,
+	TGL_STREAM_DRAW                 = 0x88E0,
+	TGL_STATIC_DRAW                 = 0x88E4,
+	TGL_DYNAMIC_DRAW                = 0x88E8,
 	TGL_VERTEX_ARRAY_SIZE           = 0x807A,
 	TGL_VERTEX_ARRAY_TYPE           = 0x807B,
 	TGL_VERTEX_ARRAY_STRIDE         = 0x807C,
@@ -701,6 +706,8 @@ typedef unsigned int    TGLuint;    // 4-byte unsigned
 typedef float           TGLfloat;   // single precision float
 typedef double          TGLdouble;  // double precision float
 typedef int             TGLsizei;
+typedef int             TGLintptr;
+typedef int             TGLsizeiptr;
 
 // functions
 
@@ -841,11 +848,25 @@ void tglVertexPointer(TGLint size, TGLenum type, TGLsizei stride, const TGLvoid
 void tglColorPointer(TGLint size, TGLenum type, TGLsizei stride, const TGLvoid *pointer);
 void tglNormalPointer(TGLenum type, TGLsizei stride, const TGLvoid *pointer);
 void tglTexCoordPointer(TGLint size, TGLenum type, TGLsizei stride, const TGLvoid *pointer);
+void tglDrawElements(TGLenum mode, TGLsizei count, TGLenum type, const TGLvoid *indices);
+
+// opengl 1.5 buffer objects
+// The data is copied into memory owned by TinyGL. While a buffer is bound to TGL_ARRAY_BUFFER,
+// the pointer given to the array functions is an offset into it, and likewise for the indices
+// of tglDrawElements with TGL_ELEMENT_ARRAY_BUFFER. The usage hint is ignored.
+void tglGenBuffers(TGLsizei n, TGLuint *buffers);
+void tglDeleteBuffers(TGLsizei n, const TGLuint *buffers);
+void tglBindBuffer(TGLenum target, TGLuint buffer);
+void tglBufferData(TGLenum target, TGLsizeiptr size, const TGLvoid *data, TGLenum usage);
+void tglBufferSubData(TGLenum target, TGLintptr offset, TGLsizeiptr size, const TGLvoid *data);
 
 // opengl 1.2 polygon offset
 void tglPolygonOffset(TGLfloat factor, TGLfloat units);
 
 void tglEnableDirtyRects(bool enable);
+void tglEnableTiledRendering(bool enable);
+// Dirty rectangles found and left after merging, and pixels rasterized again, during the last tglPresentBuffer().
+void tglGetDirtyRectsStats(int *rectanglesIn, int *rectanglesOut, int *pixelsRasterized);
 
 void tglDebug(int mode);
 
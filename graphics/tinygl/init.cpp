@@ -29,6 +29,7 @@
 #include "graphics/tinygl/zgl.h"
 #include "graphics/tinygl/zblit.h"
 #include "graphics/tinygl/zdirtyrect.h"
+#include "graphics/tinygl/zspan.h"
 
 namespace TinyGL {
 
@@ -71,7 +72,9 @@ void glInit(void *zbuffer1, int textureSize) {
 	c->fb = zbuffer;
 
 	c->fb->_textureSize = c->_textureSize = textureSize;
-	c->fb->_textureSizeMask = (textureSize - 1) << ZB_POINT_ST_FRAC_BITS;
+	// Up to the size of a full mip chain, so that large textures such as the Myst 3 cube faces keep their detail
+	c->_maxTextureSize = MAX(textureSize, 1 << (MAX_TEXTURE_LEVELS - 1));
+	c->fb->_spanFuncs = selectSpanFuncs();
 	c->renderRect = Common::Rect(0, 0, zbuffer->xsize, zbuffer->ysize);
 
 	// allocate GLVertex array
@@ -209,6 +212,15 @@ void glInit(void *zbuffer1, int textureSize) {
 	// opengl 1.1 arrays
 	c->client_states = 0;
 
+	// buffer objects
+	c->array_buffer = nullptr;
+	c->element_array_buffer = nullptr;
+	c->vertex_array_buffer = nullptr;
+	c->normal_array_buffer = nullptr;
+	c->color_array_buffer = nullptr;
+	c->texcoord_array_buffer = nullptr;
+	c->element_stamp = 0;
+
 	// opengl 1.1 polygon offset
 	c->offset_states = 0;
 
@@ -234,8 +246,13 @@ void glInit(void *zbuffer1, int textureSize) {
 	c->_drawCallAllocator[0].initialize(kDrawCallMemory);
 	c->_drawCallAllocator[1].initialize(kDrawCallMemory);
 	c->_enableDirtyRectangles = true;
+	c->_enableTiledRendering = false;
+	c->_rasterizationThreads = nullptr;
+	c->_dirtyRectsStats.rectanglesIn = 0;
+	c->_dirtyRectsStats.rectanglesOut = 0;
+	c->_dirtyRectsStats.pixelsRasterized = 0;
 
-	Graphics::Internal::tglBlitResetScissorRect();
+	Graphics::Internal::tglBlitResetScissorRect(c);
 }
 
 void glClose() {
@@ -243,6 +260,8 @@ void glClose() {
 
 	tglDisposeDrawCallLists(c);
 	tglDisposeResources(c);
+	tglDisposeRasterizationWorkers(c);
+	gl_dispose_buffers(c);
 
 	specbuf_cleanup(c);
 	for (int i = 0; i < 3; i++)
@@ -98,6 +98,7 @@ ADD_OP(VertexPointer, 4, "%d %C %d %p")
 ADD_OP(ColorPointer, 4, "%d %C %d %p")
 ADD_OP(NormalPointer, 3, "%C %d %p")
 ADD_OP(TexCoordPointer, 4, "%d %C %d %p")
+ADD_OP(DrawElements, 4, "%C %d %C %p")
 
 // opengl 1.1 polygon offset
 ADD_OP(PolygonOffset, 2, "%f %f")
@@ -86,12 +86,63 @@ GLTexture *alloc_texture(GLContext *c, int h) {
 	*ht = t;
 
 	t->handle = h;
+	t->min_filter = TGL_NEAREST_MIPMAP_LINEAR;
 	t->disposed = false;
 	t->versionNumber = 0;
 
 	return t;
 }
 
+static bool is_mipmap_filter(int filter) {
+	return filter != TGL_NEAREST && filter != TGL_LINEAR;
+}
+
+// Smallest power of two holding the given size, without going over the maximum texture size
+static int gl_texture_size(GLContext *c, int size) {
+	int result = 2; // gl_resizeImage can't produce images one pixel wide
+	while (result < size && result < c->_maxTextureSize)
+		result <<= 1;
+	return result;
+}
+
+// Rebuild the mip chain from level 0 when the minification filter uses mipmaps, averaging 2x2 texels
+// into one on each level. Only level 0 is kept otherwise, or when it holds no image yet.
+static void gl_update_mipmaps(GLTexture *t, bool hasImage) {
+	for (int level = 1; level < MAX_TEXTURE_LEVELS; level++) {
+		GLImage *im = &t->images[level];
+		if (im->pixmap)
+			im->pixmap.free();
+	}
+
+	if (!hasImage || !is_mipmap_filter(t->min_filter) || !t->images[0].pixmap)
+		return;
+
+	for (int level = 1; level < MAX_TEXTURE_LEVELS; level++) {
+		const GLImage *src = &t->images[level - 1];
+		GLImage *dst = &t->images[level];
+		if (src->xsize == 1 && src->ysize == 1)
+			break;
+
+		dst->xsize = MAX(src->xsize / 2, 1);
+		dst->ysize = MAX(src->ysize / 2, 1);
+		byte *pixels = new byte[dst->xsize * dst->ysize * 4];
+		const byte *srcPixels = src->pixmap.getRawBuffer();
+		int dx = src->xsize > 1 ? 4 : 0;
+		int dy = src->ysize > 1 ? src->xsize * 4 : 0;
+		byte *out = pixels;
+		for (int y = 0; y < dst->ysize; y++) {
+			const byte *in = srcPixels + y * 2 * dy;
+			for (int x = 0; x < dst->xsize; x++) {
+				for (int i = 0; i < 4; i++)
+					out[i] = (in[i] + in[i + dx] + in[i + dy] + in[i + dx + dy] + 2) >> 2;
+				out += 4;
+				in += dx * 2;
+			}
+		}
+		dst->pixmap = Graphics::PixelBuffer(src->pixmap.getFormat(), pixels);
+	}
+}
+
 void glInitTextures(GLContext *c) {
 	// textures
 	c->texture_2d_enabled = 0;
@@ -144,27 +195,7 @@ void glopTexImage2D(GLContext *c, GLParam *p) {
 			error("tglTexImage2D: Pixel format not handled.");
 	}
 
-	Graphics::PixelFormat pf;
-	switch (format) {
-		case TGL_RGBA:
-		case TGL_RGB:
-#if defined(SCUMM_BIG_ENDIAN)
-			pf = Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0);
-#elif defined(SCUMM_LITTLE_ENDIAN)
-			pf = Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24);
-#endif
-			break;
-		case TGL_BGRA:
-		case TGL_BGR:
-#if defined(SCUMM_BIG_ENDIAN)
-			pf = Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 0, 8, 16);
-#elif defined(SCUMM_LITTLE_ENDIAN)
-			pf = Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24);
-#endif
-			break;
-		default:
-			break;
-	}
+	Graphics::PixelFormat pf = TEXTURE_PIXEL_FORMAT;
 	int bytes = pf.bytesPerPixel;
 
 	// Simply unpack RGB into RGBA with 255 for Alpha.
@@ -191,16 +222,32 @@ void glopTexImage2D(GLContext *c, GLParam *p) {
 		error("tglTexImage2D: combination of parameters not handled");
 	}
 
-	pixels1 = new byte[c->_textureSize * c->_textureSize * bytes];
+	// Swap the channels of BGRA pixels into the texture format
+	if (format == TGL_BGRA && pixels != NULL) {
+		Graphics::PixelBuffer temp(pf, width * height, DisposeAfterUse::NO);
+		Graphics::PixelBuffer pixPtr(sourceFormat, pixels);
+
+		for (int i = 0; i < width * height; ++i) {
+			uint8 a, r, g, b;
+			pixPtr.getARGBAt(i, a, r, g, b);
+			temp.setPixelAt(i, a, r, g, b);
+		}
+		pixels = temp.getRawBuffer();
+		do_free_after_rgb2rgba = true;
+	}
+
+	int textureWidth = gl_texture_size(c, width);
+	int textureHeight = gl_texture_size(c, height);
+	pixels1 = new byte[textureWidth * textureHeight * bytes];
 	if (pixels != NULL) {
-		if (width != c->_textureSize || height != c->_textureSize) {
+		if (width != textureWidth || height != textureHeight) {
 			// we use interpolation for better looking result
-			gl_resizeImage(pixels1, c->_textureSize, c->_textureSize, pixels, width, height);
-			width = c->_textureSize;
-			height = c->_textureSize;
+			gl_resizeImage(pixels1, textureWidth, textureHeight, pixels, width, height);
 		} else {
-			memcpy(pixels1, pixels, c->_textureSize * c->_textureSize * bytes);
+			memcpy(pixels1, pixels, textureWidth * textureHeight * bytes);
 		}
+		width = textureWidth;
+		height = textureHeight;
 #if defined(SCUMM_BIG_ENDIAN)
 		if (type == TGL_UNSIGNED_INT_8_8_8_8_REV) {
 			for (int y = 0; y < height; y++) {
@@ -212,6 +259,9 @@ void glopTexImage2D(GLContext *c, GLParam *p) {
 			}
 		}
 #endif
+	} else {
+		width = textureWidth;
+		height = textureHeight;
 	}
 
 	c->current_texture->versionNumber++;
@@ -222,6 +272,10 @@ void glopTexImage2D(GLContext *c, GLParam *p) {
 		im->pixmap.free();
 	im->pixmap = Graphics::PixelBuffer(pf, pixels1);
 
+	// The levels of a texture allocated without pixels would be averaged from uninitialized memory
+	if (level == 0)
+		gl_update_mipmaps(c->current_texture, pixels != NULL);
+
 	if (do_free_after_rgb2rgba) {
 		// pixels as been assigned to tmp.getRawBuffer() which was created with
 		// DisposeAfterUse::NO, therefore delete[] it
@@ -248,7 +302,7 @@ error:
 }
 
 // TODO: not all tests are done
-void glopTexParameter(GLContext *, GLParam *p) {
+void glopTexParameter(GLContext *c, GLParam *p) {
 	int target = p[1].i;
 	int pname = p[2].i;
 	int param = p[3].i;
@@ -264,6 +318,17 @@ error:
 		if (param != TGL_REPEAT)
 			goto error;
 		break;
+	case TGL_TEXTURE_MIN_FILTER: {
+		// Mipmap levels are always picked without filtering, whichever filter is asked
+		GLTexture *t = c->current_texture;
+		bool mipmapsChanged = is_mipmap_filter(param) != is_mipmap_filter(t->min_filter);
+		t->min_filter = param;
+		if (mipmapsChanged) {
+			t->versionNumber++;
+			gl_update_mipmaps(t, true);
+		}
+		break;
+	}
 	default:
 		;
 	}
@@ -188,8 +188,8 @@ static inline void gl_vertex_transform(GLContext *c, GLVertex *v) {
 	v->clip_code = gl_clipcode(v->pc.X, v->pc.Y, v->pc.Z, v->pc.W);
 }
 
-void glopVertex(GLContext *c, GLParam *p) {
-	GLVertex *v;
+// reserve the next vertex of the current primitive
+GLVertex *gl_add_vertex(GLContext *c) {
 	int n, cnt;
 
 	assert(c->in_begin != 0);
@@ -211,15 +211,13 @@ void glopVertex(GLContext *c, GLParam *p) {
 		gl_free(c->vertex);
 		c->vertex = newarray;
 	}
-	// new vertex entry
-	v = &c->vertex[n];
-	n++;
 
-	v->coord.X = p[1].f;
-	v->coord.Y = p[2].f;
-	v->coord.Z = p[3].f;
-	v->coord.W = p[4].f;
+	c->vertex_n = n + 1;
+	return &c->vertex[n];
+}
 
+// transform, shade and project a vertex whose coords are set, using the current state
+void gl_process_vertex(GLContext *c, GLVertex *v) {
 	gl_vertex_transform(c, v);
 
 	// color
@@ -246,8 +244,18 @@ void glopVertex(GLContext *c, GLParam *p) {
 	// edge flag
 
 	v->edge_flag = c->current_edge_flag;
+}
+
+void glopVertex(GLContext *c, GLParam *p) {
+	// new vertex entry
+	GLVertex *v = gl_add_vertex(c);
+
+	v->coord.X = p[1].f;
+	v->coord.Y = p[2].f;
+	v->coord.Z = p[3].f;
+	v->coord.W = p[4].f;
 
-	c->vertex_n = n;
+	gl_process_vertex(c, v);
 }
 
 void glopEnd(GLContext *c, GLParam *) {
@@ -44,6 +44,7 @@ public:
 	BlitImage() : _isDisposed(false), _version(0), _binaryTransparent(false), _refcount(1) { }
 
 	void loadData(const Graphics::Surface &surface, uint32 colorKey, bool applyColorKey) {
+		// Blitters read the pixels of the surface assuming this format, see getSourcePixel()
 		const Graphics::PixelFormat textureFormat(4, 8, 8, 8, 8, 0, 8, 16, 24);
 		int size = surface.w * surface.h;
 		_surface.create(surface.w, surface.h, textureFormat);
@@ -177,9 +178,7 @@ public:
 
 	// Blits an image to the z buffer.
 	// The function only supports clipped blitting without any type of transformation or tinting.
-	void tglBlitZBuffer(int dstX, int dstY) {
-		TinyGL::GLContext *c = TinyGL::gl_get_context();
-
+	void tglBlitZBuffer(TinyGL::GLContext *c, int dstX, int dstY) {
 		int clampWidth, clampHeight;
 		int width = _surface.w, height = _surface.h;
 		int srcWidth = 0, srcHeight = 0;
@@ -200,42 +199,60 @@ public:
 		}
 	}
 
-	template <bool kDisableColoring, bool kDisableBlending, bool kEnableAlphaBlending>
-	FORCEINLINE void tglBlitRLE(int dstX, int dstY, int srcX, int srcY, int srcWidth, int srcHeight, float aTint, float rTint, float gTint, float bTint);
+	template <bool kDisableColoring, bool kDisableBlending, bool kEnableAlphaBlending, int kFormat>
+	FORCEINLINE void tglBlitRLE(TinyGL::GLContext *c, int dstX, int dstY, int srcX, int srcY, int srcWidth, int srcHeight, float aTint, float rTint, float gTint, float bTint);
 
-	template <bool kDisableBlending, bool kDisableColoring, bool kFlipVertical, bool kFlipHorizontal>
-	FORCEINLINE void tglBlitSimple(int dstX, int dstY, int srcX, int srcY, int srcWidth, int srcHeight, float aTint, float rTint, float gTint, float bTint);
+	template <bool kDisableBlending, bool kDisableColoring, bool kFlipVertical, bool kFlipHorizontal, int kFormat>
+	FORCEINLINE void tglBlitSimple(TinyGL::GLContext *c, int dstX, int dstY, int srcX, int srcY, int srcWidth, int srcHeight, float aTint, float rTint, float gTint, float bTint);
 
-	template <bool kDisableBlending, bool kDisableColoring, bool kFlipVertical, bool kFlipHorizontal>
-	FORCEINLINE void tglBlitScale(int dstX, int dstY, int width, int height, int srcX, int srcY, int srcWidth, int srcHeight, float aTint, float rTint, float gTint, float bTint);
+	template <bool kDisableBlending, bool kDisableColoring, bool kFlipVertical, bool kFlipHorizontal, int kFormat>
+	FORCEINLINE void tglBlitScale(TinyGL::GLContext *c, int dstX, int dstY, int width, int height, int srcX, int srcY, int srcWidth, int srcHeight, float aTint, float rTint, float gTint, float bTint);
 
-	template <bool kDisableBlending, bool kDisableColoring, bool kFlipVertical, bool kFlipHorizontal>
-	FORCEINLINE void tglBlitRotoScale(int dstX, int dstY, int width, int height, int srcX, int srcY, int srcWidth, int srcHeight, int rotation,
+	template <bool kDisableBlending, bool kDisableColoring, bool kFlipVertical, bool kFlipHorizontal, int kFormat>
+	FORCEINLINE void tglBlitRotoScale(TinyGL::GLContext *c, int dstX, int dstY, int width, int height, int srcX, int srcY, int srcWidth, int srcHeight, int rotation,
 		int originX, int originY, float aTint, float rTint, float gTint, float bTint);
 
 	//Utility function that calls the correct blitting function.
 	template <bool kDisableBlending, bool kDisableColoring, bool kDisableTransform, bool kFlipVertical, bool kFlipHorizontal, bool kEnableAlphaBlending>
-	FORCEINLINE void tglBlitGeneric(const BlitTransform &transform) {
+	FORCEINLINE void tglBlitGeneric(TinyGL::GLContext *c, const BlitTransform &transform) {
+		switch (c->fb->_format) {
+		case TinyGL::kFormatRGBA8888:
+			tglBlitGeneric<kDisableBlending, kDisableColoring, kDisableTransform, kFlipVertical, kFlipHorizontal, kEnableAlphaBlending, TinyGL::kFormatRGBA8888>(c, transform);
+			break;
+		case TinyGL::kFormatXRGB8888:
+			tglBlitGeneric<kDisableBlending, kDisableColoring, kDisableTransform, kFlipVertical, kFlipHorizontal, kEnableAlphaBlending, TinyGL::kFormatXRGB8888>(c, transform);
+			break;
+		case TinyGL::kFormatRGB565:
+			tglBlitGeneric<kDisableBlending, kDisableColoring, kDisableTransform, kFlipVertical, kFlipHorizontal, kEnableAlphaBlending, TinyGL::kFormatRGB565>(c, transform);
+			break;
+		default:
+			tglBlitGeneric<kDisableBlending, kDisableColoring, kDisableTransform, kFlipVertical, kFlipHorizontal, kEnableAlphaBlending, TinyGL::kFormatGeneric>(c, transform);
+			break;
+		}
+	}
+
+	template <bool kDisableBlending, bool kDisableColoring, bool kDisableTransform, bool kFlipVertical, bool kFlipHorizontal, bool kEnableAlphaBlending, int kFormat>
+	FORCEINLINE void tglBlitGeneric(TinyGL::GLContext *c, const BlitTransform &transform) {
 		if (kDisableTransform) {
 			if ((kDisableBlending || kEnableAlphaBlending) && kFlipVertical == false && kFlipHorizontal == false) {
-				tglBlitRLE<kDisableColoring, kDisableBlending, kEnableAlphaBlending>(transform._destinationRectangle.left,
+				tglBlitRLE<kDisableColoring, kDisableBlending, kEnableAlphaBlending, kFormat>(c, transform._destinationRectangle.left,
 					transform._destinationRectangle.top, transform._sourceRectangle.left, transform._sourceRectangle.top, 
 					transform._sourceRectangle.width() , transform._sourceRectangle.height(), transform._aTint,
 					transform._rTint, transform._gTint, transform._bTint);
 			} else {
-				tglBlitSimple<kDisableBlending, kDisableColoring, kFlipVertical, kFlipHorizontal>(transform._destinationRectangle.left, 
+				tglBlitSimple<kDisableBlending, kDisableColoring, kFlipVertical, kFlipHorizontal, kFormat>(c, transform._destinationRectangle.left, 
 					transform._destinationRectangle.top, transform._sourceRectangle.left, transform._sourceRectangle.top, 
 					transform._sourceRectangle.width() , transform._sourceRectangle.height(),
 					transform._aTint, transform._rTint, transform._gTint, transform._bTint);
 			}
 		} else {
 			if (transform._rotation == 0) {
-				tglBlitScale<kDisableBlending, kDisableColoring, kFlipVertical, kFlipHorizontal>(transform._destinationRectangle.left,
+				tglBlitScale<kDisableBlending, kDisableColoring, kFlipVertical, kFlipHorizontal, kFormat>(c, transform._destinationRectangle.left,
 					transform._destinationRectangle.top, transform._destinationRectangle.width(), transform._destinationRectangle.height(),
 					transform._sourceRectangle.left, transform._sourceRectangle.top, transform._sourceRectangle.width(), transform._sourceRectangle.height(),
 					transform._aTint, transform._rTint, transform._gTint, transform._bTint);
 			} else {
-				tglBlitRotoScale<kDisableBlending, kDisableColoring, kFlipVertical, kFlipHorizontal>(transform._destinationRectangle.left,
+				tglBlitRotoScale<kDisableBlending, kDisableColoring, kFlipVertical, kFlipHorizontal, kFormat>(c, transform._destinationRectangle.left,
 					transform._destinationRectangle.top, transform._destinationRectangle.width(), transform._destinationRectangle.height(),
 					transform._sourceRectangle.left, transform._sourceRectangle.top, transform._sourceRectangle.width(),
 					transform._sourceRectangle.height(), transform._rotation, transform._originX, transform._originY, transform._aTint,
@@ -290,12 +307,37 @@ void tglDeleteBlitImage(BlitImage *blitImage) {
 	}
 }
 
+// Read a pixel of a blit image, which are all stored in the format set in loadData()
+FORCEINLINE static void getSourcePixel(const Graphics::PixelBuffer &buf, int pixel, byte &a, byte &r, byte &g, byte &b) {
+	uint32 color = FROM_LE_32(((const uint32 *)buf.getRawBuffer())[pixel]);
+	a = color >> 24;
+	r = color & 0xFF;
+	g = (color >> 8) & 0xFF;
+	b = (color >> 16) & 0xFF;
+}
+
+template <int kFormat>
+FORCEINLINE static void writePixel(TinyGL::FrameBuffer *fb, int pixel, byte a, byte r, byte g, byte b) {
+	if (fb->isAlphaTestEnabled()) {
+		if (fb->isBlendingEnabled()) {
+			fb->writePixel<true, true, false, kFormat>(pixel, a, r, g, b, 0);
+		} else {
+			fb->writePixel<true, false, false, kFormat>(pixel, a, r, g, b, 0);
+		}
+	} else {
+		if (fb->isBlendingEnabled()) {
+			fb->writePixel<false, true, false, kFormat>(pixel, a, r, g, b, 0);
+		} else {
+			fb->writePixel<false, false, false, kFormat>(pixel, a, r, g, b, 0);
+		}
+	}
+}
+
 // This function uses RLE encoding to skip transparent bitmap parts
 // This blit only supports tinting but it will fall back to simpleBlit
 // if flipping is required (or anything more complex than that, including rotationd and scaling).
-template <bool kDisableColoring, bool kDisableBlending, bool kEnableAlphaBlending>
-FORCEINLINE void BlitImage::tglBlitRLE(int dstX, int dstY, int srcX, int srcY, int srcWidth, int srcHeight, float aTint, float rTint, float gTint, float bTint) {
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
+template <bool kDisableColoring, bool kDisableBlending, bool kEnableAlphaBlending, int kFormat>
+FORCEINLINE void BlitImage::tglBlitRLE(TinyGL::GLContext *c, int dstX, int dstY, int srcX, int srcY, int srcWidth, int srcHeight, float aTint, float rTint, float gTint, float bTint) {
 
 	int clampWidth, clampHeight;
 	int width = srcWidth, height = srcHeight;
@@ -339,8 +381,8 @@ FORCEINLINE void BlitImage::tglBlitRLE(int dstX, int dstY, int srcX, int srcY, i
 					} else {
 						for(int x = xStart; x < xStart + length; x++) {
 							byte aDst, rDst, gDst, bDst;
-							srcBuf.getARGBAt((l._y - srcY) * _surface.w + x, aDst, rDst, gDst, bDst);
-							c->fb->writePixel((dstX + x) + (dstY + (l._y - srcY)) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
+							getSourcePixel(srcBuf, (l._y - srcY) * _surface.w + x, aDst, rDst, gDst, bDst);
+							writePixel<kFormat>(c->fb, (dstX + x) + (dstY + (l._y - srcY)) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
 						}
 					}
 
@@ -364,15 +406,15 @@ FORCEINLINE void BlitImage::tglBlitRLE(int dstX, int dstY, int srcX, int srcY, i
 					int xStart = MAX(l._x - srcX, 0);
 					for(int x = xStart; x < xStart + length; x++) {
 						byte aDst, rDst, gDst, bDst;
-						srcBuf.getARGBAt((l._y - srcY) * _surface.w + x, aDst, rDst, gDst, bDst);
+						getSourcePixel(srcBuf, (l._y - srcY) * _surface.w + x, aDst, rDst, gDst, bDst);
 						if (kDisableColoring) {
 							if (aDst != 0xFF) {
-								c->fb->writePixel((dstX + x) + (dstY + (l._y - srcY)) * c->fb->xsize, aDst, rDst, gDst, bDst);
+								writePixel<kFormat>(c->fb, (dstX + x) + (dstY + (l._y - srcY)) * c->fb->xsize, aDst, rDst, gDst, bDst);
 							} else {
-								dstBuf.setPixelAt(x + (l._y - srcY) * c->fb->xsize, aDst, rDst, gDst, bDst);
+								c->fb->setPixel<kFormat>((dstX + x) + (dstY + (l._y - srcY)) * c->fb->xsize, aDst, rDst, gDst, bDst);
 							}
 						} else {
-							c->fb->writePixel((dstX + x) + (dstY + (l._y - srcY)) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
+							writePixel<kFormat>(c->fb, (dstX + x) + (dstY + (l._y - srcY)) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
 						}
 					}
 				}
@@ -383,9 +425,8 @@ FORCEINLINE void BlitImage::tglBlitRLE(int dstX, int dstY, int srcX, int srcY, i
 }
 
 // This blit function is called when flipping is needed but transformation isn't.
-template <bool kDisableBlending, bool kDisableColoring, bool kFlipVertical, bool kFlipHorizontal>
-FORCEINLINE void BlitImage::tglBlitSimple(int dstX, int dstY, int srcX, int srcY, int srcWidth, int srcHeight, float aTint, float rTint, float gTint, float bTint) {
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
+template <bool kDisableBlending, bool kDisableColoring, bool kFlipVertical, bool kFlipHorizontal, int kFormat>
+FORCEINLINE void BlitImage::tglBlitSimple(TinyGL::GLContext *c, int dstX, int dstY, int srcX, int srcY, int srcWidth, int srcHeight, float aTint, float rTint, float gTint, float bTint) {
 
 	int clampWidth, clampHeight;
 	int width = srcWidth, height = srcHeight;
@@ -400,29 +441,27 @@ FORCEINLINE void BlitImage::tglBlitSimple(int dstX, int dstY, int srcX, int srcY
 		srcBuf.shiftBy((srcY * _surface.w));
 	}
 
-	Graphics::PixelBuffer dstBuf(c->fb->cmode, c->fb->getPixelBuffer());
-
 	for (int y = 0; y < clampHeight; y++) {
 		for (int x = 0; x < clampWidth; ++x) {
 			byte aDst, rDst, gDst, bDst;
 			if (kFlipHorizontal) {
-				srcBuf.getARGBAt(srcX + clampWidth - x, aDst, rDst, gDst, bDst);
+				getSourcePixel(srcBuf, srcX + clampWidth - x, aDst, rDst, gDst, bDst);
 			} else {
-				srcBuf.getARGBAt(srcX + x, aDst, rDst, gDst, bDst);
+				getSourcePixel(srcBuf, srcX + x, aDst, rDst, gDst, bDst);
 			}
 
 			// Those branches are needed to favor speed: avoiding writePixel always yield a huge performance boost when blitting images.
 			if (kDisableColoring) { 
 				if (kDisableBlending && aDst != 0) {
-					dstBuf.setPixelAt((dstX + x) + (dstY + y) * c->fb->xsize, aDst, rDst, gDst, bDst);
+					c->fb->setPixel<kFormat>((dstX + x) + (dstY + y) * c->fb->xsize, aDst, rDst, gDst, bDst);
 				} else {
-					c->fb->writePixel((dstX + x) + (dstY + y) * c->fb->xsize, aDst, rDst, gDst, bDst);
+					writePixel<kFormat>(c->fb, (dstX + x) + (dstY + y) * c->fb->xsize, aDst, rDst, gDst, bDst);
 				}
 			} else {
 				if (kDisableBlending && aDst * aTint != 0) {
-					dstBuf.setPixelAt((dstX + x) + (dstY + y) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
+					c->fb->setPixel<kFormat>((dstX + x) + (dstY + y) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
 				} else {
-					c->fb->writePixel((dstX + x) + (dstY + y) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
+					writePixel<kFormat>(c->fb, (dstX + x) + (dstY + y) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
 				}
 			}
 		}
@@ -436,10 +475,9 @@ FORCEINLINE void BlitImage::tglBlitSimple(int dstX, int dstY, int srcX, int srcY
 
 // This function is called when scale is needed: it uses a simple nearest
 // filter to scale the blit image before copying it to the screen.
-template <bool kDisableBlending, bool kDisableColoring, bool kFlipVertical, bool kFlipHorizontal>
-FORCEINLINE void BlitImage::tglBlitScale(int dstX, int dstY, int width, int height, int srcX, int srcY, int srcWidth, int srcHeight,
+template <bool kDisableBlending, bool kDisableColoring, bool kFlipVertical, bool kFlipHorizontal, int kFormat>
+FORCEINLINE void BlitImage::tglBlitScale(TinyGL::GLContext *c, int dstX, int dstY, int width, int height, int srcX, int srcY, int srcWidth, int srcHeight,
 					 float aTint, float rTint, float gTint, float bTint) {
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
 
 	int clampWidth, clampHeight;
 	if (clipBlitImage(c, srcX, srcY, srcWidth, srcHeight, width, height, dstX, dstY, clampWidth, clampHeight) == false)
@@ -448,8 +486,6 @@ FORCEINLINE void BlitImage::tglBlitScale(int dstX, int dstY, int width, int heig
 	Graphics::PixelBuffer srcBuf(_surface.format, (byte *)_surface.getPixels());
 	srcBuf.shiftBy(srcX + (srcY * _surface.w));
 
-	Graphics::PixelBuffer dstBuf(c->fb->cmode, c->fb->getPixelBuffer());
-
 	for (int y = 0; y < clampHeight; y++) {
 		for (int x = 0; x < clampWidth; ++x) {
 			byte aDst, rDst, gDst, bDst;
@@ -466,19 +502,19 @@ FORCEINLINE void BlitImage::tglBlitScale(int dstX, int dstY, int width, int heig
 				xSource = x;
 			}
 
-			srcBuf.getARGBAt(((ySource * srcHeight) / height) * _surface.w + ((xSource * srcWidth) / width), aDst, rDst, gDst, bDst);
+			getSourcePixel(srcBuf, ((ySource * srcHeight) / height) * _surface.w + ((xSource * srcWidth) / width), aDst, rDst, gDst, bDst);
 
 			if (kDisableColoring) {
 				if (kDisableBlending && aDst != 0) {
-					dstBuf.setPixelAt((dstX + x) + (dstY + y) * c->fb->xsize, aDst, rDst, gDst, bDst);
+					c->fb->setPixel<kFormat>((dstX + x) + (dstY + y) * c->fb->xsize, aDst, rDst, gDst, bDst);
 				} else {
-					c->fb->writePixel((dstX + x) + (dstY + y) * c->fb->xsize, aDst, rDst, gDst, bDst);
+					writePixel<kFormat>(c->fb, (dstX + x) + (dstY + y) * c->fb->xsize, aDst, rDst, gDst, bDst);
 				}
 			} else {
 				if (kDisableBlending && aDst * aTint != 0) {
-					dstBuf.setPixelAt((dstX + x) + (dstY + y) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
+					c->fb->setPixel<kFormat>((dstX + x) + (dstY + y) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
 				} else {
-					c->fb->writePixel((dstX + x) + (dstY + y) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
+					writePixel<kFormat>(c->fb, (dstX + x) + (dstY + y) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
 				}
 			}
 		}
@@ -525,10 +561,9 @@ systems.
 
 */
 
-template <bool kDisableBlending, bool kDisableColoring, bool kFlipVertical, bool kFlipHorizontal>
-FORCEINLINE void BlitImage::tglBlitRotoScale(int dstX, int dstY, int width, int height, int srcX, int srcY, int srcWidth, int srcHeight, int rotation,
+template <bool kDisableBlending, bool kDisableColoring, bool kFlipVertical, bool kFlipHorizontal, int kFormat>
+FORCEINLINE void BlitImage::tglBlitRotoScale(TinyGL::GLContext *c, int dstX, int dstY, int width, int height, int srcX, int srcY, int srcWidth, int srcHeight, int rotation,
 							 int originX, int originY, float aTint, float rTint, float gTint, float bTint) {
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
 	
 	int clampWidth, clampHeight;
 	if (clipBlitImage(c, srcX, srcY, srcWidth, srcHeight, width, height, dstX, dstY, clampWidth, clampHeight) == false)
@@ -537,8 +572,6 @@ FORCEINLINE void BlitImage::tglBlitRotoScale(int dstX, int dstY, int width, int
 	Graphics::PixelBuffer srcBuf(_surface.format, (byte *)_surface.getPixels());
 	srcBuf.shiftBy(srcX + (srcY * _surface.w));
 	
-	Graphics::PixelBuffer dstBuf(c->fb->cmode, c->fb->getPixelBuffer());
-	
 	// Transform destination rectangle accordingly.
 	Common::Rect destinationRectangle = rotateRectangle(dstX, dstY, width, height, rotation, originX, originY);
 	
@@ -589,18 +622,18 @@ FORCEINLINE void BlitImage::tglBlitRotoScale(int dstX, int dstY, int width, int
 			}
 			
 			if ((dx >= 0) && (dy >= 0) && (dx < srcWidth) && (dy < srcHeight)) {
-				srcBuf.getARGBAt(dy * _surface.w + dx, aDst, rDst, gDst, bDst);
+				getSourcePixel(srcBuf, dy * _surface.w + dx, aDst, rDst, gDst, bDst);
 				if (kDisableColoring) {
 					if (kDisableBlending && aDst != 0) {
-						dstBuf.setPixelAt((dstX + x) + (dstY + y) * c->fb->xsize, aDst, rDst, gDst, bDst);
+						c->fb->setPixel<kFormat>((dstX + x) + (dstY + y) * c->fb->xsize, aDst, rDst, gDst, bDst);
 					} else {
-						c->fb->writePixel((dstX + x) + (dstY + y) * c->fb->xsize, aDst, rDst, gDst, bDst);
+						writePixel<kFormat>(c->fb, (dstX + x) + (dstY + y) * c->fb->xsize, aDst, rDst, gDst, bDst);
 					}
 				} else {
 					if (kDisableBlending && aDst * aTint != 0) {
-						dstBuf.setPixelAt((dstX + x) + (dstY + y) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
+						c->fb->setPixel<kFormat>((dstX + x) + (dstY + y) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
 					} else {
-						c->fb->writePixel((dstX + x) + (dstY + y) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
+						writePixel<kFormat>(c->fb, (dstX + x) + (dstY + y) * c->fb->xsize, aDst * aTint, rDst * rTint, gDst * gTint, bDst * bTint);
 					}
 				}
 			}
@@ -637,78 +670,77 @@ void tglBlitZBuffer(BlitImage *blitImage, int x, int y) {
 namespace Internal {
 
 template <bool kEnableAlphaBlending, bool kDisableColor, bool kDisableTransform, bool kDisableBlend>
-void tglBlit(BlitImage *blitImage, const BlitTransform &transform) {
+void tglBlit(TinyGL::GLContext *c, BlitImage *blitImage, const BlitTransform &transform) {
 	if (transform._flipHorizontally) {
 		if (transform._flipVertically) {
-			blitImage->tglBlitGeneric<kDisableBlend, kDisableColor, kDisableTransform, true, true, kEnableAlphaBlending>(transform);
+			blitImage->tglBlitGeneric<kDisableBlend, kDisableColor, kDisableTransform, true, true, kEnableAlphaBlending>(c, transform);
 		} else {
-			blitImage->tglBlitGeneric<kDisableBlend, kDisableColor, kDisableTransform, false, true, kEnableAlphaBlending>(transform);
+			blitImage->tglBlitGeneric<kDisableBlend, kDisableColor, kDisableTransform, false, true, kEnableAlphaBlending>(c, transform);
 		}
 	} else if (transform._flipVertically) {
-		blitImage->tglBlitGeneric<kDisableBlend, kDisableColor, kDisableTransform, true, false, kEnableAlphaBlending>(transform);
+		blitImage->tglBlitGeneric<kDisableBlend, kDisableColor, kDisableTransform, true, false, kEnableAlphaBlending>(c, transform);
 	} else {
-		blitImage->tglBlitGeneric<kDisableBlend, kDisableColor, kDisableTransform, false, false, kEnableAlphaBlending>(transform);
+		blitImage->tglBlitGeneric<kDisableBlend, kDisableColor, kDisableTransform, false, false, kEnableAlphaBlending>(c, transform);
 	}
 }
 
 template <bool kEnableAlphaBlending, bool kDisableColor, bool kDisableTransform>
-void tglBlit(BlitImage *blitImage, const BlitTransform &transform, bool disableBlend) {
+void tglBlit(TinyGL::GLContext *c, BlitImage *blitImage, const BlitTransform &transform, bool disableBlend) {
 	if (disableBlend) {
-		tglBlit<kEnableAlphaBlending, kDisableColor, kDisableTransform, true>(blitImage, transform);
+		tglBlit<kEnableAlphaBlending, kDisableColor, kDisableTransform, true>(c, blitImage, transform);
 	} else {
-		tglBlit<kEnableAlphaBlending, kDisableColor, kDisableTransform, false>(blitImage, transform);
+		tglBlit<kEnableAlphaBlending, kDisableColor, kDisableTransform, false>(c, blitImage, transform);
 	}
 }
 
 template <bool kEnableAlphaBlending, bool kDisableColor>
-void tglBlit(BlitImage *blitImage, const BlitTransform &transform, bool disableTransform, bool disableBlend) {
+void tglBlit(TinyGL::GLContext *c, BlitImage *blitImage, const BlitTransform &transform, bool disableTransform, bool disableBlend) {
 	if (disableTransform) {
-		tglBlit<kEnableAlphaBlending, kDisableColor, true>(blitImage, transform, disableBlend);
+		tglBlit<kEnableAlphaBlending, kDisableColor, true>(c, blitImage, transform, disableBlend);
 	} else {
-		tglBlit<kEnableAlphaBlending, kDisableColor, false>(blitImage, transform, disableBlend);
+		tglBlit<kEnableAlphaBlending, kDisableColor, false>(c, blitImage, transform, disableBlend);
 	}
 }
 
 template <bool kEnableAlphaBlending>
-void tglBlit(BlitImage *blitImage, const BlitTransform &transform, bool disableColor, bool disableTransform, bool disableBlend) {
+void tglBlit(TinyGL::GLContext *c, BlitImage *blitImage, const BlitTransform &transform, bool disableColor, bool disableTransform, bool disableBlend) {
 	if (disableColor) {
-		tglBlit<kEnableAlphaBlending, true>(blitImage, transform, disableTransform, disableBlend);
+		tglBlit<kEnableAlphaBlending, true>(c, blitImage, transform, disableTransform, disableBlend);
 	} else {
-		tglBlit<kEnableAlphaBlending, false>(blitImage, transform, disableTransform, disableBlend);
+		tglBlit<kEnableAlphaBlending, false>(c, blitImage, transform, disableTransform, disableBlend);
 	}
 }
 
-void tglBlit(BlitImage *blitImage, const BlitTransform &transform) {
-	TinyGL::GLContext *c =TinyGL::gl_get_context();
+void tglBlit(TinyGL::GLContext *c, BlitImage *blitImage, const BlitTransform &transform) {
 	bool disableColor = transform._aTint == 1.0f && transform._bTint == 1.0f && transform._gTint == 1.0f && transform._rTint == 1.0f;
 	bool disableTransform = transform._destinationRectangle.width() == 0 && transform._destinationRectangle.height() == 0 && transform._rotation == 0;
 	bool disableBlend = c->fb->isBlendingEnabled() == false;
 	bool enableAlphaBlending = c->fb->isAlphaBlendingEnabled();
 
 	if (enableAlphaBlending) {
-		tglBlit<true>(blitImage, transform, disableColor, disableTransform, disableBlend);
+		tglBlit<true>(c, blitImage, transform, disableColor, disableTransform, disableBlend);
 	} else {
-		tglBlit<false>(blitImage, transform, disableColor, disableTransform, disableBlend);
+		tglBlit<false>(c, blitImage, transform, disableColor, disableTransform, disableBlend);
 	}
 }
 
-void tglBlitNoBlend(BlitImage *blitImage, const BlitTransform &transform) {
+void tglBlitNoBlend(TinyGL::GLContext *c, BlitImage *blitImage, const BlitTransform &transform) {
 	if (transform._flipHorizontally == false && transform._flipVertically == false) {
-		blitImage->tglBlitGeneric<true, false, false, false, false, false>(transform);
+		blitImage->tglBlitGeneric<true, false, false, false, false, false>(c, transform);
 	} else if(transform._flipHorizontally == false) {
-		blitImage->tglBlitGeneric<true, false, false, true, false, false>(transform);
+		blitImage->tglBlitGeneric<true, false, false, true, false, false>(c, transform);
 	} else {
-		blitImage->tglBlitGeneric<true, false, false, false, true, false>(transform);
+		blitImage->tglBlitGeneric<true, false, false, false, true, false>(c, transform);
 	}
 }
 
-void tglBlitFast(BlitImage *blitImage, int x, int y) {
+void tglBlitFast(TinyGL::GLContext *c, BlitImage *blitImage, int x, int y) {
 	BlitTransform transform(x, y);
-	blitImage->tglBlitGeneric<true, true, true, false, false, false>(transform);
+	blitImage->tglBlitGeneric<true, true, true, false, false, false>(c, transform);
 }
 
-void tglBlitZBuffer(BlitImage *blitImage, int x, int y) {
-	blitImage->tglBlitZBuffer(x, y);
+void tglBlitZBuffer(TinyGL::GLContext *c, BlitImage *blitImage, int x, int y) {
+	blitImage->tglBlitZBuffer(c, x, y);
 }
 
 void tglCleanupImages() {
@@ -724,12 +756,11 @@ void tglCleanupImages() {
 	}
 }
 
-void tglBlitSetScissorRect(const Common::Rect &rect) {
-	TinyGL::gl_get_context()->_scissorRect = rect;
+void tglBlitSetScissorRect(TinyGL::GLContext *c, const Common::Rect &rect) {
+	c->_scissorRect = rect;
 }
 
-void tglBlitResetScissorRect(void) {
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
+void tglBlitResetScissorRect(TinyGL::GLContext *c) {
 	c->_scissorRect = c->renderRect;
 }
 
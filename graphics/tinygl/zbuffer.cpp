@@ -80,10 +80,21 @@ void memset_l(void *adr, int val, int count) {
 		*p++ = val;
 }
 
+static FrameBufferFormat getFrameBufferFormat(const Graphics::PixelFormat &format) {
+	if (format == Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0))
+		return kFormatRGBA8888;
+	if (format == Graphics::PixelFormat(4, 8, 8, 8, 0, 16, 8, 0, 0))
+		return kFormatXRGB8888;
+	if (format == Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0))
+		return kFormatRGB565;
+	return kFormatGeneric;
+}
+
 FrameBuffer::FrameBuffer(int width, int height, const Graphics::PixelBuffer &frame_buffer) : _depthWrite(true), _enableScissor(false) {
 	this->xsize = width;
 	this->ysize = height;
 	this->cmode = frame_buffer.getFormat();
+	this->_format = getFrameBufferFormat(this->cmode);
 	this->pixelbytes = this->cmode.bytesPerPixel;
 	this->linesize = (xsize * this->pixelbytes + 3) & ~3;
 
@@ -93,10 +104,12 @@ FrameBuffer::FrameBuffer(int width, int height, const Graphics::PixelBuffer &fra
 	memset(this->_zbuf, 0, size);
 
 	this->frame_buffer_allocated = 0;
+	this->zbuffer_allocated = 1;
 	this->pbuf = frame_buffer;
 
 	this->current_texture = NULL;
 	this->shadow_mask_buf = NULL;
+	this->_spanFuncs = NULL;
 
 	this->buffer.pbuf = this->pbuf.getRawBuffer();
 	this->buffer.zbuf = this->_zbuf;
@@ -110,6 +123,7 @@ FrameBuffer::FrameBuffer(int width, int height, const Graphics::PixelFormat &for
 	this->xsize = width;
 	this->ysize = height;
 	this->cmode = format;
+	this->_format = getFrameBufferFormat(this->cmode);
 	this->pixelbytes = this->cmode.bytesPerPixel;
 	this->linesize = (xsize * this->pixelbytes + 3) & ~3;
 
@@ -121,9 +135,11 @@ FrameBuffer::FrameBuffer(int width, int height, const Graphics::PixelFormat &for
 	byte *pixelBuffer = (byte *)gl_malloc(this->ysize * this->linesize);
 	this->pbuf.set(this->cmode, pixelBuffer);
 	this->frame_buffer_allocated = 1;
+	this->zbuffer_allocated = 1;
 
 	this->current_texture = NULL;
 	this->shadow_mask_buf = NULL;
+	this->_spanFuncs = NULL;
 
 	this->buffer.pbuf = this->pbuf.getRawBuffer();
 	this->buffer.zbuf = this->_zbuf;
@@ -136,7 +152,18 @@ FrameBuffer::FrameBuffer(int width, int height, const Graphics::PixelFormat &for
 FrameBuffer::~FrameBuffer() {
 	if (frame_buffer_allocated)
 		pbuf.free();
-	gl_free(_zbuf);
+	if (zbuffer_allocated)
+		gl_free(_zbuf);
+}
+
+void FrameBuffer::syncView(const FrameBuffer &other) {
+	if (frame_buffer_allocated)
+		pbuf.free();
+	if (zbuffer_allocated)
+		gl_free(_zbuf);
+	*this = other;
+	this->frame_buffer_allocated = 0;
+	this->zbuffer_allocated = 0;
 }
 
 Buffer *FrameBuffer::genOffscreenBuffer() {
@@ -325,7 +352,7 @@ void FrameBuffer::clearOffscreenBuffer(Buffer *buf) {
 	buf->used = false;
 }
 
-void FrameBuffer::setTexture(const Graphics::PixelBuffer &texture) {
+void FrameBuffer::setTexture(const GLTexture *texture) {
 	current_texture = texture;
 }
 
@@ -73,6 +73,19 @@ static const int DRAW_SMOOTH = 2;
 static const int DRAW_SHADOW_MASK = 3;
 static const int DRAW_SHADOW = 4;
 
+// Frame buffer formats the rasterizer has code specialized for at compile time.
+// Any other format goes through the conversions of Graphics::PixelBuffer.
+enum FrameBufferFormat {
+	kFormatGeneric,
+	kFormatRGBA8888, // Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0)
+	kFormatXRGB8888, // Graphics::PixelFormat(4, 8, 8, 8, 0, 16, 8, 0, 0)
+	kFormatRGB565    // Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0)
+};
+
+struct GLTexture;
+struct SpanFuncs;
+struct SpanState;
+
 struct Buffer {
 	byte *pbuf;
 	unsigned int *zbuf;
@@ -108,6 +121,9 @@ struct FrameBuffer {
 	void delOffscreenBuffer(Buffer *buffer);
 	void clear(int clear_z, int z, int clear_color, int r, int g, int b);
 	void clearRegion(int x, int y, int w, int h,int clear_z, int z, int clear_color, int r, int g, int b);
+	// Turn into a view rendering into the buffers of another frame buffer with its rasterization state.
+	// The other frame buffer keeps the ownership of the buffers.
+	void syncView(const FrameBuffer &other);
 
 	byte *getPixelBuffer() {
 		return pbuf.getRawBuffer(0);
@@ -262,7 +278,63 @@ struct FrameBuffer {
 		writePixel<kEnableAlphaTest, kBlendingEnabled, false>(pixel, aSrc, rSrc, gSrc, bSrc, 0);
 	}
 
+	template <int kFormat>
+	FORCEINLINE void setPixel(int pixel, byte a, byte r, byte g, byte b) {
+		switch (kFormat) {
+		case kFormatRGBA8888:
+			((uint32 *)pbuf.getRawBuffer())[pixel] = TO_LE_32((r << 24) | (g << 16) | (b << 8) | a);
+			break;
+		case kFormatXRGB8888:
+			((uint32 *)pbuf.getRawBuffer())[pixel] = TO_LE_32((r << 16) | (g << 8) | b);
+			break;
+		case kFormatRGB565:
+			((uint16 *)pbuf.getRawBuffer())[pixel] = TO_LE_16(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+			break;
+		default:
+			pbuf.setPixelAt(pixel, a, r, g, b);
+			break;
+		}
+	}
+
+	template <int kFormat>
+	FORCEINLINE void getPixel(int pixel, byte &a, byte &r, byte &g, byte &b) {
+		switch (kFormat) {
+		case kFormatRGBA8888: {
+			uint32 color = FROM_LE_32(((uint32 *)pbuf.getRawBuffer())[pixel]);
+			a = color & 0xFF;
+			r = color >> 24;
+			g = (color >> 16) & 0xFF;
+			b = (color >> 8) & 0xFF;
+			}
+			break;
+		case kFormatXRGB8888: {
+			uint32 color = FROM_LE_32(((uint32 *)pbuf.getRawBuffer())[pixel]);
+			a = 0xFF;
+			r = (color >> 16) & 0xFF;
+			g = (color >> 8) & 0xFF;
+			b = color & 0xFF;
+			}
+			break;
+		case kFormatRGB565: {
+			uint16 color = FROM_LE_16(((uint16 *)pbuf.getRawBuffer())[pixel]);
+			a = 0xFF;
+			r = Graphics::ColorComponent<5>::expand(color >> 11);
+			g = Graphics::ColorComponent<6>::expand(color >> 5);
+			b = Graphics::ColorComponent<5>::expand(color);
+			}
+			break;
+		default:
+			pbuf.getARGBAt(pixel, a, r, g, b);
+			break;
+		}
+	}
+
 	template <bool kEnableAlphaTest, bool kBlendingEnabled, bool kDepthWrite>
+	FORCEINLINE void writePixel(int pixel, byte aSrc, byte rSrc, byte gSrc, byte bSrc, unsigned int z) {
+		writePixel<kEnableAlphaTest, kBlendingEnabled, kDepthWrite, kFormatGeneric>(pixel, aSrc, rSrc, gSrc, bSrc, z);
+	}
+
+	template <bool kEnableAlphaTest, bool kBlendingEnabled, bool kDepthWrite, int kFormat>
 	FORCEINLINE void writePixel(int pixel, byte aSrc, byte rSrc, byte gSrc, byte bSrc, unsigned int z) {
 		if (kEnableAlphaTest) {
 			if (!checkAlphaTest(aSrc))
@@ -273,10 +345,10 @@ struct FrameBuffer {
 		}
 		
 		if (kBlendingEnabled == false) {
-			this->pbuf.setPixelAt(pixel, aSrc, rSrc, gSrc, bSrc);
+			setPixel<kFormat>(pixel, aSrc, rSrc, gSrc, bSrc);
 		} else {
 			byte rDst, gDst, bDst, aDst;
-			this->pbuf.getARGBAt(pixel, aDst, rDst, gDst, bDst);
+			getPixel<kFormat>(pixel, aDst, rDst, gDst, bDst);
 			switch (_sourceBlendingFactor) {
 			case TGL_ZERO:
 				rSrc = gSrc = bSrc = 0;
@@ -370,7 +442,7 @@ struct FrameBuffer {
 			if (finalR > 255) { finalR = 255; }
 			if (finalG > 255) { finalG = 255; }
 			if (finalB > 255) { finalB = 255; }
-			this->pbuf.setPixelAt(pixel, 255, finalR, finalG, finalB);
+			setPixel<kFormat>(pixel, 255, finalR, finalG, finalB);
 		}
 	}
 
@@ -424,7 +496,10 @@ struct FrameBuffer {
 	void blitOffscreenBuffer(Buffer *buffer);
 	void selectOffscreenBuffer(Buffer *buffer);
 	void clearOffscreenBuffer(Buffer *buffer);
-	void setTexture(const Graphics::PixelBuffer &texture);
+	void setTexture(const GLTexture *texture);
+
+	template <bool kInterpRGB, bool kInterpZ, bool kInterpST, bool kInterpSTZ, int kDrawLogic, bool kDepthWrite, bool enableAlphaTest, bool kEnableScissor, bool enableBlending, int kFormat>
+	void fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint *p2);
 
 	template <bool kInterpRGB, bool kInterpZ, bool kInterpST, bool kInterpSTZ, int kDrawLogic, bool kDepthWrite, bool enableAlphaTest, bool kEnableScissor, bool enableBlending>
 	void fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint *p2);
@@ -470,6 +545,7 @@ struct FrameBuffer {
 	int xsize, ysize;
 	int linesize; // line size, in bytes
 	Graphics::PixelFormat cmode;
+	FrameBufferFormat _format;
 	int pixelbytes;
 
 	Buffer buffer;
@@ -479,12 +555,18 @@ struct FrameBuffer {
 	int shadow_color_g;
 	int shadow_color_b;
 	int frame_buffer_allocated;
+	int zbuffer_allocated;
 
 	unsigned char *dctable;
 	int *ctable;
-	Graphics::PixelBuffer current_texture;
+	const GLTexture *current_texture;
 	int _textureSize;
-	int _textureSizeMask;
+	// Mapping of s and t, scaled to _textureSize, to the texels of the level sampled by the current triangle
+	int _textureSShift, _textureTShift;
+	unsigned int _textureSMask, _textureTMask;
+	int _textureWidthShift;
+	// SIMD kernels drawing the spans of triangles, or NULL to always draw them pixel by pixel
+	const SpanFuncs *_spanFuncs;
 
 	FORCEINLINE bool isBlendingEnabled() const { return _blendingEnabled; }
 	FORCEINLINE void getBlendingFactors(int &sourceFactor, int &destinationFactor) const { sourceFactor = _sourceBlendingFactor; destinationFactor = _destinationBlendingFactor; }
@@ -498,6 +580,9 @@ struct FrameBuffer {
 
 private:
 
+	// Translate the rasterization state for the span kernels, returns false if they don't support it.
+	bool initSpanState(SpanState &state, bool depthWrite, bool alphaTest, bool blending) const;
+
 	template <bool kDepthWrite>
 	FORCEINLINE void putPixel(unsigned int pixelOffset, int color, int x, int y, unsigned int z);
 
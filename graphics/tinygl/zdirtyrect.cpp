@@ -30,13 +30,15 @@
 #include "graphics/tinygl/zgl.h"
 #include "graphics/tinygl/gl.h"
 #include "common/debug.h"
+#include "common/jobs.h"
 #include "common/math.h"
+#include "common/system.h"
 
 namespace TinyGL {
 
 void tglIssueDrawCall(Graphics::DrawCall *drawCall) {
 	TinyGL::GLContext *c = TinyGL::gl_get_context();
-	if (c->_enableDirtyRectangles && drawCall->getDirtyRegion().isEmpty())
+	if ((c->_enableDirtyRectangles || c->_enableTiledRendering) && drawCall->getDirtyRegion().isEmpty())
 		return;
 	c->_drawCallsQueue.push_back(drawCall);
 }
@@ -113,17 +115,260 @@ void tglDisposeDrawCallLists(TinyGL::GLContext *c) {
 	c->_drawCallsQueue.clear();
 }
 
-static inline void _appendDirtyRectangle(const Graphics::DrawCall &call, Common::List<DirtyRectangle> &rectangles, int r, int g, int b) {
+// Height of the horizontal bands the frame buffer is split into by tiled rendering.
+static const int kTileHeight = 32;
+static const uint kMaxRasterizationWorkers = 16;
+
+typedef Common::List<Graphics::DrawCall *>::const_iterator DrawCallIterator;
+
+struct TiledDrawCall {
+	const Graphics::DrawCall *drawCall;
+	Common::Rect clippingRectangle;
+
+	TiledDrawCall() : drawCall(nullptr) { }
+	TiledDrawCall(const Graphics::DrawCall *call, const Common::Rect &rect) : drawCall(call), clippingRectangle(rect) { }
+};
+
+typedef Common::Array<TiledDrawCall> TileBin;
+
+struct TiledRenderingJob {
+	GLContext *context;
+	const Common::Array<TileBin> *bins;
+	uint firstBin, binStride;
+};
+
+// Worker contexts only hold rasterization state: they render into a view of the main frame buffer.
+static GLContext *tglCreateRasterizationWorker(GLContext *c) {
+	GLContext *worker = new GLContext();
+	worker->fb = new FrameBuffer(c->fb->xsize, c->fb->ysize, c->fb->cmode);
+	worker->fb->syncView(*c->fb);
+	worker->vertex_max = POLYGON_MAX_VERTEX;
+	worker->vertex = (GLVertex *)gl_malloc(POLYGON_MAX_VERTEX * sizeof(GLVertex));
+	return worker;
+}
+
+void tglDisposeRasterizationWorkers(GLContext *c) {
+	// Stop the threads before freeing the contexts they run
+	delete c->_rasterizationThreads;
+	c->_rasterizationThreads = nullptr;
+
+	for (uint i = 0; i < c->_rasterizationWorkers.size(); i++) {
+		GLContext *worker = c->_rasterizationWorkers[i];
+		delete worker->fb;
+		gl_free(worker->vertex);
+		delete worker;
+	}
+	c->_rasterizationWorkers.clear();
+}
+
+// Copy the state draw calls don't capture themselves from the main context.
+static void tglSyncRasterizationWorker(GLContext *c, GLContext *worker) {
+	worker->fb->syncView(*c->fb);
+	worker->renderRect = c->renderRect;
+	worker->_scissorRect = c->renderRect;
+	worker->_textureSize = c->_textureSize;
+	worker->render_mode = c->render_mode;
+	worker->current_cull_face = c->current_cull_face;
+	worker->vertex_n = c->vertex_n;
+}
+
+static void tglRunTiledRenderingJob(void *param) {
+	const TiledRenderingJob *job = (const TiledRenderingJob *)param;
+	for (uint i = job->firstBin; i < job->bins->size(); i += job->binStride) {
+		const TileBin &bin = (*job->bins)[i];
+		for (uint j = 0; j < bin.size(); j++) {
+			bin[j].drawCall->execute(job->context, bin[j].clippingRectangle, true);
+		}
+	}
+}
+
+// Sort draw calls into horizontal bands and rasterize the bands concurrently, each with its own worker context.
+// Pixels are only ever touched by the worker owning their band, in draw call order, so the result is identical
+// to executing the calls one after the other. Regions must not overlap.
+static void tglExecuteDrawCallsTiled(GLContext *c, DrawCallIterator begin, DrawCallIterator end, const Common::Array<Common::Rect> &regions) {
+	int bandCount = (c->renderRect.bottom + kTileHeight - 1) / kTileHeight;
+	Common::Array<TileBin> bins;
+	bins.resize(bandCount);
+
+	for (DrawCallIterator it = begin; it != end; ++it) {
+		const Common::Rect drawCallRegion = (*it)->getDirtyRegion();
+		for (uint i = 0; i < regions.size(); i++) {
+			const Common::Rect &region = regions[i];
+			if (!region.intersects(drawCallRegion))
+				continue;
+			int firstBand = MAX(region.top, drawCallRegion.top) / kTileHeight;
+			int lastBand = (MIN(region.bottom, drawCallRegion.bottom) - 1) / kTileHeight;
+			for (int band = firstBand; band <= lastBand; band++) {
+				Common::Rect clippingRectangle(region.left, MAX<int>(region.top, band * kTileHeight), region.right, MIN<int>(region.bottom, (band + 1) * kTileHeight));
+				bins[band].push_back(TiledDrawCall(*it, clippingRectangle));
+			}
+		}
+	}
+
+	uint jobCount = MIN<uint>(c->_rasterizationWorkers.size(), bandCount);
+	TiledRenderingJob jobs[kMaxRasterizationWorkers];
+	void *params[kMaxRasterizationWorkers];
+	for (uint i = 0; i < jobCount; i++) {
+		jobs[i].context = c->_rasterizationWorkers[i];
+		jobs[i].bins = &bins;
+		jobs[i].firstBin = i;
+		jobs[i].binStride = jobCount;
+		params[i] = &jobs[i];
+	}
+	c->_rasterizationThreads->run(tglRunTiledRenderingJob, params, jobCount);
+}
+
+// Execute the draw calls of a frame, clipped to the given regions. Calls which can't be split across tiles are
+// executed on the main context, between two batches of tiled calls.
+static void tglExecuteDrawCalls(GLContext *c, const Common::Array<Common::Rect> &regions, bool clipToRegions) {
+	bool tiled = c->_enableTiledRendering && c->render_mode == TGL_RENDER;
+	if (tiled) {
+		if (c->_rasterizationWorkers.empty()) {
+			uint workerCount = g_system ? CLIP<uint>(g_system->getCPUCount(), 1, kMaxRasterizationWorkers) : 1;
+			for (uint i = 0; i < workerCount; i++) {
+				c->_rasterizationWorkers.push_back(tglCreateRasterizationWorker(c));
+			}
+			c->_rasterizationThreads = new Common::JobPool();
+		}
+		for (uint i = 0; i < c->_rasterizationWorkers.size(); i++) {
+			tglSyncRasterizationWorker(c, c->_rasterizationWorkers[i]);
+		}
+	}
+
+	DrawCallIterator batchBegin = c->_drawCallsQueue.begin();
+	for (DrawCallIterator it = c->_drawCallsQueue.begin(); it != c->_drawCallsQueue.end(); ++it) {
+		const Graphics::DrawCall *drawCall = *it;
+		if (tiled && drawCall->isClippable())
+			continue;
+		if (batchBegin != it) {
+			tglExecuteDrawCallsTiled(c, batchBegin, it, regions);
+		}
+		batchBegin = it;
+		++batchBegin;
+
+		if (!clipToRegions) {
+			drawCall->execute(c, true);
+			continue;
+		}
+		Common::Rect drawCallRegion = drawCall->getDirtyRegion();
+		for (uint i = 0; i < regions.size(); i++) {
+			if (regions[i].intersects(drawCallRegion)) {
+				drawCall->execute(c, regions[i], true);
+			}
+		}
+	}
+	if (batchBegin != c->_drawCallsQueue.end()) {
+		tglExecuteDrawCallsTiled(c, batchBegin, c->_drawCallsQueue.end(), regions);
+	}
+}
+
+static inline void _appendDirtyRectangle(const Graphics::DrawCall &call, Common::Array<DirtyRectangle> &rectangles, int r, int g, int b) {
 	Common::Rect dirty_region = call.getDirtyRegion();
 	if (rectangles.empty() || dirty_region != rectangles.back().rectangle)
 		rectangles.push_back(DirtyRectangle(dirty_region, r, g, b));
 }
 
-static void tglPresentBufferDirtyRects(TinyGL::GLContext *c) {
-	typedef Common::List<Graphics::DrawCall *>::const_iterator DrawCallIterator;
-	typedef Common::List<TinyGL::DirtyRectangle>::iterator RectangleIterator;
+// Size of the cells of the grid used to find overlapping dirty rectangles.
+static const int kDirtyRectGridCellSize = 64;
+
+static int _findDirtyRectangleGroup(Common::Array<int> &groups, int index) {
+	while (groups[index] != index) {
+		groups[index] = groups[groups[index]];
+		index = groups[index];
+	}
+	return index;
+}
+
+// Merge overlapping rectangles until none of them overlap anymore. Each pass registers the rectangles
+// in the cells of a coarse grid they cover, so only rectangles sharing a cell are compared, and
+// groups overlapping rectangles into their bounding box. Bounding boxes can overlap rectangles their
+// members didn't, so passes are repeated until nothing gets merged.
+static void _mergeDirtyRectangles(Common::Array<DirtyRectangle> &rectangles, const Common::Rect &bounds) {
+	const int columns = MAX(1, (bounds.right + kDirtyRectGridCellSize - 1) / kDirtyRectGridCellSize);
+	const int rows = MAX(1, (bounds.bottom + kDirtyRectGridCellSize - 1) / kDirtyRectGridCellSize);
+
+	Common::Array<int> groups;
+	Common::Array<int> cellStart;
+	Common::Array<int> cellEntries;
+	Common::Array<DirtyRectangle> merged;
+
+	while (rectangles.size() > 1) {
+		const int count = rectangles.size();
+		Common::Array<Common::Rect> cells(count);
+		for (int i = 0; i < count; i++) {
+			const Common::Rect &rect = rectangles[i].rectangle;
+			cells[i] = Common::Rect(
+				CLIP(rect.left / kDirtyRectGridCellSize, 0, columns - 1),
+				CLIP(rect.top / kDirtyRectGridCellSize, 0, rows - 1),
+				CLIP((rect.right - 1) / kDirtyRectGridCellSize, 0, columns - 1) + 1,
+				CLIP((rect.bottom - 1) / kDirtyRectGridCellSize, 0, rows - 1) + 1
+			);
+		}
+
+		// Bucket rectangle indices by cell.
+		cellStart.resize(columns * rows + 1);
+		for (uint i = 0; i < cellStart.size(); i++)
+			cellStart[i] = 0;
+		for (int i = 0; i < count; i++) {
+			for (int y = cells[i].top; y < cells[i].bottom; y++)
+				for (int x = cells[i].left; x < cells[i].right; x++)
+					cellStart[y * columns + x + 1]++;
+		}
+		for (uint i = 1; i < cellStart.size(); i++)
+			cellStart[i] += cellStart[i - 1];
+		cellEntries.resize(cellStart.back());
+		for (int i = 0; i < count; i++) {
+			for (int y = cells[i].top; y < cells[i].bottom; y++)
+				for (int x = cells[i].left; x < cells[i].right; x++)
+					cellEntries[cellStart[y * columns + x]++] = i;
+		}
+		// Filling the buckets moved each start to the next cell start.
+		for (int i = cellStart.size() - 1; i > 0; i--)
+			cellStart[i] = cellStart[i - 1];
+		cellStart[0] = 0;
+
+		groups.resize(count);
+		for (int i = 0; i < count; i++)
+			groups[i] = i;
+
+		bool mergedAny = false;
+		for (int cell = 0; cell < columns * rows; cell++) {
+			for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++) {
+				for (int j = i + 1; j < cellStart[cell + 1]; j++) {
+					int a = cellEntries[i], b = cellEntries[j];
+					if (!rectangles[a].rectangle.intersects(rectangles[b].rectangle))
+						continue;
+					int groupA = _findDirtyRectangleGroup(groups, a);
+					int groupB = _findDirtyRectangleGroup(groups, b);
+					if (groupA != groupB) {
+						// Keep the first rectangle as group leader, to preserve ordering.
+						groups[MAX(groupA, groupB)] = MIN(groupA, groupB);
+						mergedAny = true;
+					}
+				}
+			}
+		}
+
+		if (!mergedAny)
+			break;
+
+		merged.clear();
+		Common::Array<int> mergedIndex(count);
+		for (int i = 0; i < count; i++) {
+			int group = _findDirtyRectangleGroup(groups, i);
+			if (group == i) {
+				mergedIndex[i] = merged.size();
+				merged.push_back(rectangles[i]);
+			} else {
+				merged[mergedIndex[group]].rectangle.extend(rectangles[i].rectangle);
+			}
+		}
+		rectangles = merged;
+	}
+}
 
-	Common::List<DirtyRectangle> rectangles;
+static void tglPresentBufferDirtyRects(TinyGL::GLContext *c) {
+	Common::Array<DirtyRectangle> rectangles;
 
 	DrawCallIterator itFrame = c->_drawCallsQueue.begin();
 	DrawCallIterator endFrame = c->_drawCallsQueue.end();
@@ -150,60 +395,35 @@ static void tglPresentBufferDirtyRects(TinyGL::GLContext *c) {
 		_appendDirtyRectangle(**itFrame, rectangles, 255, 0, 0);
 	}
 
+	c->_dirtyRectsStats.rectanglesIn = rectangles.size();
+
 	// This loop increases outer rectangle coordinates to favor merging of adjacent rectangles.
-	for (RectangleIterator it = rectangles.begin(); it != rectangles.end(); ++it) {
-		(*it).rectangle.right++;
-		(*it).rectangle.bottom++;
+	for (uint i = 0; i < rectangles.size(); i++) {
+		rectangles[i].rectangle.right++;
+		rectangles[i].rectangle.bottom++;
 	}
 
 	// Merge coalesce dirty rects.
-	bool restartMerge;
-	do {
-		restartMerge = false;
-		for (RectangleIterator it1 = rectangles.begin(); it1 != rectangles.end(); ++it1) {
-			for (RectangleIterator it2 = rectangles.begin(); it2 != rectangles.end();) {
-				if (it1 != it2) {
-					if ((*it1).rectangle.intersects((*it2).rectangle)) {
-						(*it1).rectangle.extend((*it2).rectangle);
-						it2 = rectangles.erase(it2);
-						restartMerge = true;
-					} else {
-						++it2;
-					}
-				} else {
-					++it2;
-				}
-			}
+	_mergeDirtyRectangles(rectangles, c->renderRect);
+
+	c->_dirtyRectsStats.rectanglesOut = 0;
+	c->_dirtyRectsStats.pixelsRasterized = 0;
+	for (uint i = 0; i < rectangles.size(); i++) {
+		rectangles[i].rectangle.clip(c->renderRect);
+		if (!rectangles[i].rectangle.isEmpty()) {
+			c->_dirtyRectsStats.rectanglesOut++;
+			c->_dirtyRectsStats.pixelsRasterized += rectangles[i].rectangle.width() * rectangles[i].rectangle.height();
 		}
-	} while(restartMerge);
-
-	for (RectangleIterator it1 = rectangles.begin(); it1 != rectangles.end(); ++it1) {
-		RectangleIterator it2 = it1;
-		it2++;
-		while (it2 != rectangles.end()) {
-			if ((*it1).rectangle.contains((*it2).rectangle)) {
-				it2 = rectangles.erase(it2);
-			} else {
-				++it2;
-			}
-		}
-	}
-
-	for (RectangleIterator it1 = rectangles.begin(); it1 != rectangles.end(); ++it1) {
-		(*it1).rectangle.clip(c->renderRect);
 	}
 
 	if (!rectangles.empty()) {
 		// Execute draw calls.
-		for (DrawCallIterator it = c->_drawCallsQueue.begin(); it != c->_drawCallsQueue.end(); ++it) {
-			Common::Rect drawCallRegion = (*it)->getDirtyRegion();
-			for (RectangleIterator itRect = rectangles.begin(); itRect != rectangles.end(); ++itRect) {
-				Common::Rect dirtyRegion = (*itRect).rectangle;
-				if (dirtyRegion.intersects(drawCallRegion)) {
-					(*it)->execute(dirtyRegion, true);
-				}
-			}
+		Common::Array<Common::Rect> regions;
+		regions.reserve(rectangles.size());
+		for (uint i = 0; i < rectangles.size(); i++) {
+			regions.push_back(rectangles[i].rectangle);
 		}
+		tglExecuteDrawCalls(c, regions, true);
 #if TGL_DIRTY_RECT_SHOW
 		// Draw debug rectangles.
 		// Note: white rectangles are rectangle that contained other rectangles
@@ -215,8 +435,8 @@ static void tglPresentBufferDirtyRects(TinyGL::GLContext *c) {
 		c->fb->enableBlending(false);
 		c->fb->enableAlphaTest(false);
 
-		for (RectangleIterator it = rectangles.begin(); it != rectangles.end(); ++it) {
-			tglDrawRectangle((*it).rectangle, (*it).r, (*it).g, (*it).b);
+		for (uint i = 0; i < rectangles.size(); i++) {
+			tglDrawRectangle(rectangles[i].rectangle, rectangles[i].r, rectangles[i].g, rectangles[i].b);
 		}
 
 		c->fb->enableBlending(blendingEnabled);
@@ -240,10 +460,21 @@ static void tglPresentBufferDirtyRects(TinyGL::GLContext *c) {
 }
 
 static void tglPresentBufferSimple(TinyGL::GLContext *c) {
-	typedef Common::List<Graphics::DrawCall *>::const_iterator DrawCallIterator;
+	c->_dirtyRectsStats.rectanglesIn = 0;
+	c->_dirtyRectsStats.rectanglesOut = 1;
+	c->_dirtyRectsStats.pixelsRasterized = c->renderRect.width() * c->renderRect.height();
+
+	if (c->_enableTiledRendering) {
+		Common::Array<Common::Rect> regions;
+		regions.push_back(c->renderRect);
+		tglExecuteDrawCalls(c, regions, false);
+	} else {
+		for (DrawCallIterator it = c->_drawCallsQueue.begin(); it != c->_drawCallsQueue.end(); ++it) {
+			(*it)->execute(c, true);
+		}
+	}
 
 	for (DrawCallIterator it = c->_drawCallsQueue.begin(); it != c->_drawCallsQueue.end(); ++it) {
-		(*it)->execute(true);
 		delete *it;
 	}
 
@@ -294,8 +525,8 @@ RasterizationDrawCall::RasterizationDrawCall() : DrawCall(DrawCall_Rasterization
 	_drawTriangleFront = c->draw_triangle_front;
 	_drawTriangleBack = c->draw_triangle_back;
 	memcpy(_vertex, c->vertex, sizeof(TinyGL::GLVertex) * _vertexCount);
-	_state = captureState();
-	if (c->_enableDirtyRectangles) {
+	_state = captureState(c);
+	if (c->_enableDirtyRectangles || c->_enableTiledRendering) {
 		computeDirtyRegion();
 	}
 }
@@ -333,19 +564,29 @@ void RasterizationDrawCall::computeDirtyRegion() {
 	}
 }
 
-void RasterizationDrawCall::execute(bool restoreState) const {
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
-
+void RasterizationDrawCall::execute(TinyGL::GLContext *c, bool restoreState) const {
 	RasterizationDrawCall::RasterizationState backupState;
 	if (restoreState) {
-		backupState = captureState();
+		backupState = captureState(c);
 	}
-	applyState(_state);
+	applyState(c, _state);
+
+	// Rasterization modifies vertices (edge flags, quad strips), so work on a copy in the context vertex array
+	// to keep the recorded vertices intact for the next execution of this draw call.
+	if (_vertexCount > c->vertex_max) {
+		TinyGL::gl_free(c->vertex);
+		while (_vertexCount > c->vertex_max)
+			c->vertex_max <<= 1;
+		c->vertex = (TinyGL::GLVertex *)TinyGL::gl_malloc(sizeof(TinyGL::GLVertex) * c->vertex_max);
+		if (!c->vertex) {
+			error("unable to allocate GLVertex array.");
+		}
+	}
+	memcpy(c->vertex, _vertex, sizeof(TinyGL::GLVertex) * _vertexCount);
 
 	TinyGL::GLVertex *prevVertex = c->vertex;
 	int prevVertexCount = c->vertex_cnt;
 
-	c->vertex = _vertex;
 	c->vertex_cnt = _vertexCount;
 	c->draw_triangle_front = (TinyGL::gl_draw_triangle_func)_drawTriangleFront;
 	c->draw_triangle_back = (TinyGL::gl_draw_triangle_func)_drawTriangleBack;
@@ -429,13 +670,12 @@ void RasterizationDrawCall::execute(bool restoreState) const {
 	c->vertex_cnt = prevVertexCount;
 
 	if (restoreState) {
-		applyState(backupState);
+		applyState(c, backupState);
 	}
 }
 
-RasterizationDrawCall::RasterizationState RasterizationDrawCall::captureState() const {
+RasterizationDrawCall::RasterizationState RasterizationDrawCall::captureState(TinyGL::GLContext *c) const {
 	RasterizationState state;
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
 	state.alphaTest = c->fb->isAlphaTestEnabled();
 	c->fb->getBlendingFactors(state.sfactor, state.dfactor);
 	state.enableBlending = c->fb->isBlendingEnabled();
@@ -467,8 +707,7 @@ RasterizationDrawCall::RasterizationState RasterizationDrawCall::captureState()
 	return state;
 }
 
-void RasterizationDrawCall::applyState(const RasterizationDrawCall::RasterizationState &state) const {
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
+void RasterizationDrawCall::applyState(TinyGL::GLContext *c, const RasterizationDrawCall::RasterizationState &state) const {
 	c->fb->setBlendingFactors(state.sfactor, state.dfactor);
 	c->fb->enableBlending(state.enableBlending);
 	c->fb->enableAlphaTest(state.alphaTest);
@@ -495,13 +734,17 @@ void RasterizationDrawCall::applyState(const RasterizationDrawCall::Rasterizatio
 	memcpy(c->viewport.trans._v, state.viewportTranslation, sizeof(c->viewport.trans._v));
 }
 
-void RasterizationDrawCall::execute(const Common::Rect &clippingRectangle, bool restoreState) const {
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
+void RasterizationDrawCall::execute(TinyGL::GLContext *c, const Common::Rect &clippingRectangle, bool restoreState) const {
 	c->fb->setScissorRectangle(clippingRectangle);
-	execute(restoreState);
+	execute(c, restoreState);
 	c->fb->resetScissorRectangle();
 }
 
+bool RasterizationDrawCall::isClippable() const {
+	// Shadow masks are written without scissor test.
+	return (_state.shadowMode & 1) == 0;
+}
+
 bool RasterizationDrawCall::operator==(const RasterizationDrawCall &other) const {
 	if (_vertexCount == other._vertexCount && 
 		_drawTriangleFront == other._drawTriangleFront && 
@@ -519,9 +762,10 @@ bool RasterizationDrawCall::operator==(const RasterizationDrawCall &other) const
 
 BlittingDrawCall::BlittingDrawCall(Graphics::BlitImage *image, const BlitTransform &transform, BlittingMode blittingMode) : DrawCall(DrawCall_Blitting), _transform(transform), _mode(blittingMode), _image(image) {
 	tglIncBlitImageRef(image);
-	_blitState = captureState();
+	TinyGL::GLContext *c = TinyGL::gl_get_context();
+	_blitState = captureState(c);
 	_imageVersion = tglGetBlitImageVersion(image);
-	if (TinyGL::gl_get_context()->_enableDirtyRectangles) {
+	if (c->_enableDirtyRectangles || c->_enableTiledRendering) {
 		computeDirtyRegion();
 	}
 }
@@ -530,43 +774,56 @@ BlittingDrawCall::~BlittingDrawCall() {
 	tglDeleteBlitImage(_image);
 }
 
-void BlittingDrawCall::execute(bool restoreState) const {
+void BlittingDrawCall::execute(TinyGL::GLContext *c, bool restoreState) const {
 	BlittingState backupState;
 	if (restoreState) {
-		backupState = captureState();
+		backupState = captureState(c);
 	}
-	applyState(_blitState);
+	applyState(c, _blitState);
 
 	switch (_mode) {
 	case Graphics::BlittingDrawCall::BlitMode_Regular:
-		Graphics::Internal::tglBlit(_image, _transform);
+		Graphics::Internal::tglBlit(c, _image, _transform);
 		break;
 	case Graphics::BlittingDrawCall::BlitMode_NoBlend:
-		Graphics::Internal::tglBlitNoBlend(_image, _transform);
+		Graphics::Internal::tglBlitNoBlend(c, _image, _transform);
 		break;
 	case Graphics::BlittingDrawCall::BlitMode_Fast:
-		Graphics::Internal::tglBlitFast(_image, _transform._destinationRectangle.left, _transform._destinationRectangle.top);
+		Graphics::Internal::tglBlitFast(c, _image, _transform._destinationRectangle.left, _transform._destinationRectangle.top);
 		break;
 	case Graphics::BlittingDrawCall::BlitMode_ZBuffer:
-		Graphics::Internal::tglBlitZBuffer(_image, _transform._destinationRectangle.left, _transform._destinationRectangle.top);
+		Graphics::Internal::tglBlitZBuffer(c, _image, _transform._destinationRectangle.left, _transform._destinationRectangle.top);
 		break;
 	default:
 		break;
 	}
 	if (restoreState) {
-		applyState(backupState);
+		applyState(c, backupState);
 	}
 }
 
-void BlittingDrawCall::execute(const Common::Rect &clippingRectangle, bool restoreState) const {
-	Graphics::Internal::tglBlitSetScissorRect(clippingRectangle);
-	execute(restoreState);
-	Graphics::Internal::tglBlitResetScissorRect();
+void BlittingDrawCall::execute(TinyGL::GLContext *c, const Common::Rect &clippingRectangle, bool restoreState) const {
+	Graphics::Internal::tglBlitSetScissorRect(c, clippingRectangle);
+	execute(c, restoreState);
+	Graphics::Internal::tglBlitResetScissorRect(c);
 }
 
-BlittingDrawCall::BlittingState BlittingDrawCall::captureState() const {
+bool BlittingDrawCall::isClippable() const {
+	// Scaled, rotated and flipped blits derive their source coordinates from the clipped destination.
+	switch (_mode) {
+	case Graphics::BlittingDrawCall::BlitMode_Regular:
+		return _transform._destinationRectangle.width() == 0 && _transform._destinationRectangle.height() == 0 &&
+			_transform._rotation == 0 && !_transform._flipHorizontally && !_transform._flipVertically;
+	case Graphics::BlittingDrawCall::BlitMode_Fast:
+	case Graphics::BlittingDrawCall::BlitMode_ZBuffer:
+		return true;
+	default:
+		return false;
+	}
+}
+
+BlittingDrawCall::BlittingState BlittingDrawCall::captureState(TinyGL::GLContext *c) const {
 	BlittingState state;
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
 	state.alphaTest = c->fb->isAlphaTestEnabled();
 	c->fb->getBlendingFactors(state.sfactor, state.dfactor);
 	state.enableBlending = c->fb->isBlendingEnabled();
@@ -576,8 +833,7 @@ BlittingDrawCall::BlittingState BlittingDrawCall::captureState() const {
 	return state;
 }
 
-void BlittingDrawCall::applyState(const BlittingState &state) const {
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
+void BlittingDrawCall::applyState(TinyGL::GLContext *c, const BlittingState &state) const {
 	c->fb->setBlendingFactors(state.sfactor, state.dfactor);
 	c->fb->enableBlending(state.enableBlending);
 	c->fb->enableAlphaTest(state.alphaTest);
@@ -626,18 +882,16 @@ bool BlittingDrawCall::operator==(const BlittingDrawCall &other) const {
 ClearBufferDrawCall::ClearBufferDrawCall(bool clearZBuffer, int zValue, bool clearColorBuffer, int rValue, int gValue, int bValue) 
 	: _clearZBuffer(clearZBuffer), _clearColorBuffer(clearColorBuffer), _zValue(zValue), _rValue(rValue), _gValue(gValue), _bValue(bValue), DrawCall(DrawCall_Clear) {
 	TinyGL::GLContext *c = TinyGL::gl_get_context();
-	if (c->_enableDirtyRectangles) {
+	if (c->_enableDirtyRectangles || c->_enableTiledRendering) {
 		_dirtyRegion = c->renderRect;
 	}
 }
 
-void ClearBufferDrawCall::execute(bool restoreState) const {
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
+void ClearBufferDrawCall::execute(TinyGL::GLContext *c, bool restoreState) const {
 	c->fb->clear(_clearZBuffer, _zValue, _clearColorBuffer, _rValue, _gValue, _bValue);
 }
 
-void ClearBufferDrawCall::execute(const Common::Rect &clippingRectangle, bool restoreState) const {
-	TinyGL::GLContext *c = TinyGL::gl_get_context();
+void ClearBufferDrawCall::execute(TinyGL::GLContext *c, const Common::Rect &clippingRectangle, bool restoreState) const {
 	Common::Rect clearRect = clippingRectangle.findIntersectingRect(getDirtyRegion());
 	c->fb->clearRegion(clearRect.left, clearRect.top, clearRect.width(), clearRect.height(), _clearZBuffer, _zValue, _clearColorBuffer, _rValue, _gValue, _bValue);
 }
@@ -60,8 +60,10 @@ public:
 	bool operator!=(const DrawCall &other) const {
 		return !(*this == other);
 	}
-	virtual void execute(bool restoreState) const = 0;
-	virtual void execute(const Common::Rect &clippingRectangle, bool restoreState) const = 0;
+	virtual void execute(TinyGL::GLContext *c, bool restoreState) const = 0;
+	virtual void execute(TinyGL::GLContext *c, const Common::Rect &clippingRectangle, bool restoreState) const = 0;
+	// Returns true if executing the call once per clipping rectangle gives the same pixels as executing it unclipped.
+	virtual bool isClippable() const { return true; }
 	DrawCallType getType() const { return _type; }
 	virtual const Common::Rect getDirtyRegion() const { return _dirtyRegion; }
 protected:
@@ -75,8 +77,8 @@ public:
 	ClearBufferDrawCall(bool clearZBuffer, int zValue, bool clearColorBuffer, int rValue, int gValue, int bValue);
 	virtual ~ClearBufferDrawCall() { }
 	bool operator==(const ClearBufferDrawCall &other) const;
-	virtual void execute(bool restoreState) const;
-	virtual void execute(const Common::Rect &clippingRectangle, bool restoreState) const;
+	virtual void execute(TinyGL::GLContext *c, bool restoreState) const;
+	virtual void execute(TinyGL::GLContext *c, const Common::Rect &clippingRectangle, bool restoreState) const;
 
 	void *operator new(size_t size) {
 		return ::Internal::allocateFrame(size);
@@ -94,8 +96,9 @@ public:
 	RasterizationDrawCall();
 	virtual ~RasterizationDrawCall() { }
 	bool operator==(const RasterizationDrawCall &other) const;
-	virtual void execute(bool restoreState) const;
-	virtual void execute(const Common::Rect &clippingRectangle, bool restoreState) const;
+	virtual void execute(TinyGL::GLContext *c, bool restoreState) const;
+	virtual void execute(TinyGL::GLContext *c, const Common::Rect &clippingRectangle, bool restoreState) const;
+	virtual bool isClippable() const;
 
 	void *operator new(size_t size) {
 		return ::Internal::allocateFrame(size);
@@ -139,8 +142,8 @@ private:
 
 	RasterizationState _state;
 
-	RasterizationState captureState() const;
-	void applyState(const RasterizationState &state) const;
+	RasterizationState captureState(TinyGL::GLContext *c) const;
+	void applyState(TinyGL::GLContext *c, const RasterizationState &state) const;
 };
 
 // Encapsulate a blit call: it might execute either a color buffer or z buffer blit.
@@ -156,8 +159,9 @@ public:
 	BlittingDrawCall(BlitImage *image, const BlitTransform &transform, BlittingMode blittingMode);
 	virtual ~BlittingDrawCall();
 	bool operator==(const BlittingDrawCall &other) const;
-	virtual void execute(bool restoreState) const;
-	virtual void execute(const Common::Rect &clippingRectangle, bool restoreState) const;
+	virtual void execute(TinyGL::GLContext *c, bool restoreState) const;
+	virtual void execute(TinyGL::GLContext *c, const Common::Rect &clippingRectangle, bool restoreState) const;
+	virtual bool isClippable() const;
 
 	BlittingMode getBlittingMode() const { return _mode; }
 	
@@ -191,8 +195,8 @@ private:
 		}
 	};
 
-	BlittingState captureState() const;
-	void applyState(const BlittingState &state) const;
+	BlittingState captureState(TinyGL::GLContext *c) const;
+	void applyState(TinyGL::GLContext *c, const BlittingState &state) const;
 
 	BlittingState _blitState;
 };
@@ -41,6 +41,10 @@
 #include "graphics/tinygl/zblit.h"
 #include "graphics/tinygl/zdirtyrect.h"
 
+namespace Common {
+class JobPool;
+}
+
 namespace TinyGL {
 
 enum {
@@ -173,6 +177,12 @@ struct GLVertex {
 	}
 };
 
+// vertex buffer objects
+struct GLBuffer {
+	unsigned char *data;
+	int size;
+};
+
 struct GLImage {
 	Graphics::PixelBuffer pixmap;
 	int xsize, ysize;
@@ -182,8 +192,25 @@ struct GLImage {
 
 #define TEXTURE_HASH_TABLE_SIZE 256
 
+// Textures are all stored in this format, whatever the format of the uploaded pixels,
+// so that the rasterizer can fetch texels with constant shifts.
+#if defined(SCUMM_BIG_ENDIAN)
+#define TEXTURE_R_SHIFT 24
+#define TEXTURE_G_SHIFT 16
+#define TEXTURE_B_SHIFT 8
+#define TEXTURE_A_SHIFT 0
+#else
+#define TEXTURE_R_SHIFT 0
+#define TEXTURE_G_SHIFT 8
+#define TEXTURE_B_SHIFT 16
+#define TEXTURE_A_SHIFT 24
+#endif
+#define TEXTURE_PIXEL_FORMAT Graphics::PixelFormat(4, 8, 8, 8, 8, TEXTURE_R_SHIFT, TEXTURE_G_SHIFT, TEXTURE_B_SHIFT, TEXTURE_A_SHIFT)
+
 struct GLTexture {
+	// Levels are stored at their own power of two size, level 0 being at most _maxTextureSize
 	GLImage images[MAX_TEXTURE_LEVELS];
+	int min_filter;
 	unsigned int handle;
 	int versionNumber;
 	struct GLTexture *next, *prev;
@@ -259,8 +286,10 @@ struct GLContext {
 	FrameBuffer *fb;
 	Common::Rect renderRect;
 
-	// Internal texture size
+	// Internal texture size, to which the texture coordinates are scaled
 	int _textureSize;
+	// Largest level 0 of a texture, which may exceed _textureSize
+	int _maxTextureSize;
 
 	// lights
 	GLLight lights[T_MAX_LIGHTS];
@@ -357,6 +386,20 @@ struct GLContext {
 	int texcoord_array_stride;
 	int client_states;
 
+	// opengl 1.5 buffer objects, named by their index + 1
+	Common::Array<GLBuffer *> buffers;
+	GLBuffer *array_buffer;
+	GLBuffer *element_array_buffer;
+	GLBuffer *vertex_array_buffer;
+	GLBuffer *normal_array_buffer;
+	GLBuffer *color_array_buffer;
+	GLBuffer *texcoord_array_buffer;
+
+	// Vertices already processed by the current glDrawElements, tagged with its stamp
+	Common::Array<GLVertex> element_vertices;
+	Common::Array<unsigned int> element_vertex_stamps;
+	unsigned int element_stamp;
+
 	// opengl 1.1 polygon offset
 	float offset_factor;
 	float offset_units;
@@ -382,6 +425,18 @@ struct GLContext {
 	Common::Rect _scissorRect;
 
 	bool _enableDirtyRectangles;
+	bool _enableTiledRendering;
+
+	// Statistics of the last presented frame
+	struct DirtyRectsStats {
+		int rectanglesIn;
+		int rectanglesOut;
+		int pixelsRasterized;
+	} _dirtyRectsStats;
+
+	// Private contexts used to rasterize tiles concurrently, and the threads running them
+	Common::Array<GLContext *> _rasterizationWorkers;
+	Common::JobPool *_rasterizationThreads;
 
 	// blit test
 	Common::List<Graphics::BlitImage *> _blitImages;
@@ -397,6 +452,13 @@ extern GLContext *gl_ctx;
 
 void gl_add_op(GLParam *p);
 
+// vertex.c
+GLVertex *gl_add_vertex(GLContext *c);
+void gl_process_vertex(GLContext *c, GLVertex *v);
+
+// arrays.c
+void gl_dispose_buffers(GLContext *c);
+
 // clip.c
 void gl_transform_to_viewport(GLContext *c, GLVertex *v);
 void gl_draw_triangle(GLContext *c, GLVertex *p0, GLVertex *p1, GLVertex *p2);
@@ -433,6 +495,7 @@ void tglIssueDrawCall(Graphics::DrawCall *drawCall);
 // zdirtyrect.cpp
 void tglDisposeResources(GLContext *c);
 void tglDisposeDrawCallLists(TinyGL::GLContext *c);
+void tglDisposeRasterizationWorkers(GLContext *c);
 
 GLContext *gl_get_context();
 
@@ -0,0 +1,55 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/system.h"
+#include "graphics/tinygl/zspan.h"
+
+namespace TinyGL {
+
+const SpanFuncs *selectSpanFuncs() {
+	// The kernels read the pixels as little endian values
+#ifndef SCUMM_BIG_ENDIAN
+	// SSE2 and NEON are part of the base instruction sets of x86-64 and AArch64,
+	// the CPU only needs to be asked about them in 32 bit builds.
+#ifdef SCUMMVM_NEON
+#if defined(__aarch64__) || defined(_M_ARM64)
+	return getSpanFuncsNEON();
+#else
+	if (g_system && g_system->hasFeature(OSystem::kFeatureCpuNEON))
+		return getSpanFuncsNEON();
+#endif
+#endif
+
+#ifdef SCUMMVM_SSE2
+#if defined(__x86_64__) || defined(_M_X64)
+	return getSpanFuncsSSE2();
+#else
+	if (g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+		return getSpanFuncsSSE2();
+#endif
+#endif
+#endif
+
+	return NULL;
+}
+
+} // end of namespace TinyGL
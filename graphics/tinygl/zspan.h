@@ -0,0 +1,101 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GRAPHICS_TINYGL_ZSPAN_H_
+#define GRAPHICS_TINYGL_ZSPAN_H_
+
+#include "common/scummsys.h"
+
+namespace TinyGL {
+
+// Span kernels draw the pixels of a scanline several at a time with SIMD instructions.
+// They only handle 32 bit frame buffers and the states the games use the most, the
+// rasterizer falls back to its per pixel code for everything else. Their results
+// are identical to the ones of FrameBuffer::writePixel().
+
+enum SpanBlending {
+	kSpanBlendNone,
+	kSpanBlendAlpha,    // TGL_SRC_ALPHA, TGL_ONE_MINUS_SRC_ALPHA
+	kSpanBlendAdditive  // TGL_SRC_ALPHA, TGL_ONE
+};
+
+enum SpanDepthTest {
+	kSpanDepthAlways,   // Also used when the depth test is disabled
+	kSpanDepthLess,
+	kSpanDepthLessEqual
+};
+
+// Rasterization state, which is the same for all the spans of a triangle.
+struct SpanState {
+	SpanDepthTest depthTest;
+	bool depthWrite;
+	SpanBlending blending;
+	// Pixels pass the alpha test when their alpha is within [alphaMin, alphaMax],
+	// or outside of it if alphaInvert is set.
+	bool alphaTest;
+	int alphaMin, alphaMax;
+	bool alphaInvert;
+	// Position of the components in the pixels, once read as little endian.
+	// Frame buffers without alpha get 0 written in place of it, see alphaMask.
+	int rShift, gShift, bShift, aShift;
+	uint32 alphaMask;
+	// Position of the components in the texels.
+	int texelRShift, texelGShift, texelBShift, texelAShift;
+};
+
+// Pixels of a scanline, and the values interpolated along it. The colors are fixed point
+// numbers with 8 fractional bits, as used by the rasterizer.
+struct Span {
+	uint32 *pixels;
+	unsigned int *zbuf;
+	const byte *mask;      // Shadow mask, pixels with a 0 mask are skipped. Can be NULL.
+	const uint32 *texels;  // Texel of each pixel, in the format of the textures, for textured spans.
+	int count;
+	unsigned int z, r, g, b, a;
+	int dzdx, drdx, dgdx, dbdx, dadx;
+};
+
+struct SpanFuncs {
+	// Pixels of the span get its interpolated color.
+	void (*drawSmooth)(const SpanState &state, const Span &span);
+	// Pixels of the span get their texel modulated by the interpolated color.
+	void (*drawTextured)(const SpanState &state, const Span &span);
+};
+
+#ifdef SCUMMVM_SSE2
+const SpanFuncs *getSpanFuncsSSE2();
+#endif
+
+#ifdef SCUMMVM_NEON
+const SpanFuncs *getSpanFuncsNEON();
+#endif
+
+/**
+ * Select the best span kernels supported by the CPU.
+ *
+ * @return the kernels, or NULL if only the per pixel code can be used.
+ */
+const SpanFuncs *selectSpanFuncs();
+
+} // end of namespace TinyGL
+
+#endif
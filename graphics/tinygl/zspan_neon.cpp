@@ -0,0 +1,210 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "graphics/tinygl/zspan.h"
+
+#ifdef SCUMMVM_NEON
+
+#include <arm_neon.h>
+
+namespace TinyGL {
+
+// Values interpolated along the span, for the 4 pixels of a block
+struct SpanVectors {
+	uint32x4_t z, r, g, b, a;
+};
+
+static inline uint32x4_t interpolate(unsigned int value, int delta) {
+	unsigned int step = delta;
+	const uint32 values[4] = { value, value + step, value + 2 * step, value + 3 * step };
+	return vld1q_u32(values);
+}
+
+static inline uint32x4_t extract(uint32x4_t value, int shift) {
+	return vandq_u32(vshlq_u32(value, vdupq_n_s32(-shift)), vdupq_n_u32(0xFF));
+}
+
+static inline uint32x4_t insert(uint32x4_t value, int shift) {
+	return vshlq_u32(value, vdupq_n_s32(shift));
+}
+
+// (a * b) >> 8, truncated to 8 bits. The lanes of a hold 8 bit values.
+static inline uint32x4_t multiply(uint32x4_t a, uint32x4_t b) {
+	return vandq_u32(vshrq_n_u32(vmulq_u32(a, b), 8), vdupq_n_u32(0xFF));
+}
+
+template <bool kTextured, SpanBlending kBlending, bool kDepthWrite>
+static inline void drawBlock(const SpanState &state, uint32 *pixels, unsigned int *zbuf, const byte *mask, const uint32 *texels, const SpanVectors &v) {
+	const uint32x4_t byteMax = vdupq_n_u32(0xFF);
+
+	uint32x4_t zDst = vld1q_u32(zbuf);
+	uint32x4_t pass;
+	switch (state.depthTest) {
+	case kSpanDepthLess:
+		pass = vcltq_u32(zDst, v.z);
+		break;
+	case kSpanDepthLessEqual:
+		pass = vcleq_u32(zDst, v.z);
+		break;
+	default:
+		pass = vdupq_n_u32(0xFFFFFFFF);
+		break;
+	}
+	if (mask) {
+		const uint32 values[4] = { mask[0], mask[1], mask[2], mask[3] };
+		pass = vandq_u32(pass, vtstq_u32(vld1q_u32(values), vld1q_u32(values)));
+	}
+
+	uint32x4_t r = vandq_u32(vshrq_n_u32(v.r, 8), byteMax);
+	uint32x4_t g = vandq_u32(vshrq_n_u32(v.g, 8), byteMax);
+	uint32x4_t b = vandq_u32(vshrq_n_u32(v.b, 8), byteMax);
+	uint32x4_t a = vandq_u32(vshrq_n_u32(v.a, 8), byteMax);
+	if (kTextured) {
+		uint32x4_t texel = vld1q_u32(texels);
+		r = multiply(extract(texel, state.texelRShift), vshrq_n_u32(v.r, 8));
+		g = multiply(extract(texel, state.texelGShift), vshrq_n_u32(v.g, 8));
+		b = multiply(extract(texel, state.texelBShift), vshrq_n_u32(v.b, 8));
+		a = multiply(extract(texel, state.texelAShift), vshrq_n_u32(v.a, 8));
+	}
+
+	if (state.alphaTest) {
+		int32x4_t alpha = vreinterpretq_s32_u32(a);
+		uint32x4_t outside = vorrq_u32(vcltq_s32(alpha, vdupq_n_s32(state.alphaMin)), vcgtq_s32(alpha, vdupq_n_s32(state.alphaMax)));
+		pass = state.alphaInvert ? vandq_u32(outside, pass) : vbicq_u32(pass, outside);
+	}
+
+	uint32x4_t dst = vld1q_u32(pixels);
+	if (kBlending != kSpanBlendNone) {
+		uint32x4_t dstR = extract(dst, state.rShift);
+		uint32x4_t dstG = extract(dst, state.gShift);
+		uint32x4_t dstB = extract(dst, state.bShift);
+		if (kBlending == kSpanBlendAlpha) {
+			uint32x4_t invA = vsubq_u32(byteMax, a);
+			dstR = multiply(dstR, invA);
+			dstG = multiply(dstG, invA);
+			dstB = multiply(dstB, invA);
+		}
+		r = vminq_u32(vaddq_u32(multiply(r, a), dstR), byteMax);
+		g = vminq_u32(vaddq_u32(multiply(g, a), dstG), byteMax);
+		b = vminq_u32(vaddq_u32(multiply(b, a), dstB), byteMax);
+		a = byteMax;
+	}
+
+	uint32x4_t color = insert(r, state.rShift);
+	color = vorrq_u32(color, insert(g, state.gShift));
+	color = vorrq_u32(color, insert(b, state.bShift));
+	color = vorrq_u32(color, vandq_u32(insert(a, state.aShift), vdupq_n_u32(state.alphaMask)));
+	vst1q_u32(pixels, vbslq_u32(pass, color, dst));
+
+	if (kDepthWrite) {
+		vst1q_u32(zbuf, vbslq_u32(pass, v.z, zDst));
+	}
+}
+
+template <bool kTextured, SpanBlending kBlending, bool kDepthWrite>
+static void drawSpan(const SpanState &state, const Span &span) {
+	SpanVectors v;
+	v.z = interpolate(span.z, span.dzdx);
+	v.r = interpolate(span.r, span.drdx);
+	v.g = interpolate(span.g, span.dgdx);
+	v.b = interpolate(span.b, span.dbdx);
+	v.a = interpolate(span.a, span.dadx);
+	const uint32x4_t dz = vdupq_n_u32((unsigned int)span.dzdx * 4);
+	const uint32x4_t dr = vdupq_n_u32((unsigned int)span.drdx * 4);
+	const uint32x4_t dg = vdupq_n_u32((unsigned int)span.dgdx * 4);
+	const uint32x4_t db = vdupq_n_u32((unsigned int)span.dbdx * 4);
+	const uint32x4_t da = vdupq_n_u32((unsigned int)span.dadx * 4);
+
+	int i = 0;
+	for (; i + 4 <= span.count; i += 4) {
+		drawBlock<kTextured, kBlending, kDepthWrite>(state, span.pixels + i, span.zbuf + i, span.mask ? span.mask + i : NULL,
+		                                             kTextured ? span.texels + i : NULL, v);
+		v.z = vaddq_u32(v.z, dz);
+		v.r = vaddq_u32(v.r, dr);
+		v.g = vaddq_u32(v.g, dg);
+		v.b = vaddq_u32(v.b, db);
+		v.a = vaddq_u32(v.a, da);
+	}
+
+	// Draw the last pixels in a copy of them, so that the block doesn't access anything past the span
+	int left = span.count - i;
+	if (left > 0) {
+		uint32 pixels[4] = { 0, 0, 0, 0 };
+		unsigned int zbuf[4] = { 0, 0, 0, 0 };
+		byte mask[4] = { 0, 0, 0, 0 };
+		uint32 texels[4] = { 0, 0, 0, 0 };
+		for (int j = 0; j < left; j++) {
+			pixels[j] = span.pixels[i + j];
+			zbuf[j] = span.zbuf[i + j];
+			if (span.mask)
+				mask[j] = span.mask[i + j];
+			if (kTextured)
+				texels[j] = span.texels[i + j];
+		}
+		drawBlock<kTextured, kBlending, kDepthWrite>(state, pixels, zbuf, span.mask ? mask : NULL, texels, v);
+		for (int j = 0; j < left; j++) {
+			span.pixels[i + j] = pixels[j];
+			if (kDepthWrite)
+				span.zbuf[i + j] = zbuf[j];
+		}
+	}
+}
+
+template <bool kTextured, SpanBlending kBlending>
+static void drawSpan(const SpanState &state, const Span &span) {
+	if (state.depthWrite)
+		drawSpan<kTextured, kBlending, true>(state, span);
+	else
+		drawSpan<kTextured, kBlending, false>(state, span);
+}
+
+template <bool kTextured>
+static void drawSpan(const SpanState &state, const Span &span) {
+	switch (state.blending) {
+	case kSpanBlendAlpha:
+		drawSpan<kTextured, kSpanBlendAlpha>(state, span);
+		break;
+	case kSpanBlendAdditive:
+		drawSpan<kTextured, kSpanBlendAdditive>(state, span);
+		break;
+	default:
+		drawSpan<kTextured, kSpanBlendNone>(state, span);
+		break;
+	}
+}
+
+static void drawSmooth(const SpanState &state, const Span &span) {
+	drawSpan<false>(state, span);
+}
+
+static void drawTextured(const SpanState &state, const Span &span) {
+	drawSpan<true>(state, span);
+}
+
+const SpanFuncs *getSpanFuncsNEON() {
+	static const SpanFuncs funcs = { drawSmooth, drawTextured };
+	return &funcs;
+}
+
+} // end of namespace TinyGL
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,216 @@
+/* ResidualVM - A 3D game interpreter
+ *
+ * ResidualVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the AUTHORS
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// This file is compiled with SSE2 enabled, it must only be called after checking the CPU supports it.
+
+#include "graphics/tinygl/zspan.h"
+
+#ifdef SCUMMVM_SSE2
+
+#include <emmintrin.h>
+
+namespace TinyGL {
+
+// Values interpolated along the span, for the 4 pixels of a block
+struct SpanVectors {
+	__m128i z, r, g, b, a;
+};
+
+static inline __m128i interpolate(unsigned int value, int delta) {
+	unsigned int step = delta;
+	return _mm_setr_epi32(value, value + step, value + 2 * step, value + 3 * step);
+}
+
+static inline __m128i extract(__m128i value, int shift) {
+	return _mm_and_si128(_mm_srl_epi32(value, _mm_cvtsi32_si128(shift)), _mm_set1_epi32(0xFF));
+}
+
+// Unsigned version of _mm_cmpgt_epi32()
+static inline __m128i compareGreater(__m128i a, __m128i b) {
+	const __m128i bias = _mm_set1_epi32((int)0x80000000);
+	return _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+}
+
+// (a * b) >> 8, truncated to 8 bits. The lanes of a hold 8 bit values, only the low 16 bits of b matter.
+static inline __m128i multiply(__m128i a, __m128i b) {
+	return _mm_and_si128(_mm_srli_epi32(_mm_mullo_epi16(a, _mm_and_si128(b, _mm_set1_epi32(0xFFFF))), 8), _mm_set1_epi32(0xFF));
+}
+
+template <bool kTextured, SpanBlending kBlending, bool kDepthWrite>
+static inline void drawBlock(const SpanState &state, uint32 *pixels, unsigned int *zbuf, const byte *mask, const uint32 *texels, const SpanVectors &v) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i allSet = _mm_cmpeq_epi32(zero, zero);
+	const __m128i byteMax = _mm_set1_epi32(0xFF);
+
+	__m128i zDst = _mm_loadu_si128((const __m128i *)zbuf);
+	__m128i pass;
+	switch (state.depthTest) {
+	case kSpanDepthLess:
+		pass = compareGreater(v.z, zDst);
+		break;
+	case kSpanDepthLessEqual:
+		pass = _mm_andnot_si128(compareGreater(zDst, v.z), allSet);
+		break;
+	default:
+		pass = allSet;
+		break;
+	}
+	if (mask) {
+		__m128i m = _mm_cvtsi32_si128(mask[0] | (mask[1] << 8) | (mask[2] << 16) | (mask[3] << 24));
+		m = _mm_unpacklo_epi16(_mm_unpacklo_epi8(m, zero), zero);
+		pass = _mm_andnot_si128(_mm_cmpeq_epi32(m, zero), pass);
+	}
+
+	__m128i r = _mm_and_si128(_mm_srli_epi32(v.r, 8), byteMax);
+	__m128i g = _mm_and_si128(_mm_srli_epi32(v.g, 8), byteMax);
+	__m128i b = _mm_and_si128(_mm_srli_epi32(v.b, 8), byteMax);
+	__m128i a = _mm_and_si128(_mm_srli_epi32(v.a, 8), byteMax);
+	if (kTextured) {
+		__m128i texel = _mm_loadu_si128((const __m128i *)texels);
+		r = multiply(extract(texel, state.texelRShift), _mm_srli_epi32(v.r, 8));
+		g = multiply(extract(texel, state.texelGShift), _mm_srli_epi32(v.g, 8));
+		b = multiply(extract(texel, state.texelBShift), _mm_srli_epi32(v.b, 8));
+		a = multiply(extract(texel, state.texelAShift), _mm_srli_epi32(v.a, 8));
+	}
+
+	if (state.alphaTest) {
+		__m128i outside = _mm_or_si128(_mm_cmpgt_epi32(_mm_set1_epi32(state.alphaMin), a), _mm_cmpgt_epi32(a, _mm_set1_epi32(state.alphaMax)));
+		pass = state.alphaInvert ? _mm_and_si128(outside, pass) : _mm_andnot_si128(outside, pass);
+	}
+
+	__m128i dst = _mm_loadu_si128((const __m128i *)pixels);
+	if (kBlending != kSpanBlendNone) {
+		// The components stay below 512, the saturation can use 16 bit operations
+		__m128i dstR = extract(dst, state.rShift);
+		__m128i dstG = extract(dst, state.gShift);
+		__m128i dstB = extract(dst, state.bShift);
+		if (kBlending == kSpanBlendAlpha) {
+			__m128i invA = _mm_sub_epi32(byteMax, a);
+			dstR = multiply(dstR, invA);
+			dstG = multiply(dstG, invA);
+			dstB = multiply(dstB, invA);
+		}
+		r = _mm_min_epi16(_mm_add_epi32(multiply(r, a), dstR), byteMax);
+		g = _mm_min_epi16(_mm_add_epi32(multiply(g, a), dstG), byteMax);
+		b = _mm_min_epi16(_mm_add_epi32(multiply(b, a), dstB), byteMax);
+		a = byteMax;
+	}
+
+	__m128i color = _mm_sll_epi32(r, _mm_cvtsi32_si128(state.rShift));
+	color = _mm_or_si128(color, _mm_sll_epi32(g, _mm_cvtsi32_si128(state.gShift)));
+	color = _mm_or_si128(color, _mm_sll_epi32(b, _mm_cvtsi32_si128(state.bShift)));
+	color = _mm_or_si128(color, _mm_and_si128(_mm_sll_epi32(a, _mm_cvtsi32_si128(state.aShift)), _mm_set1_epi32(state.alphaMask)));
+	_mm_storeu_si128((__m128i *)pixels, _mm_or_si128(_mm_and_si128(pass, color), _mm_andnot_si128(pass, dst)));
+
+	if (kDepthWrite) {
+		_mm_storeu_si128((__m128i *)zbuf, _mm_or_si128(_mm_and_si128(pass, v.z), _mm_andnot_si128(pass, zDst)));
+	}
+}
+
+template <bool kTextured, SpanBlending kBlending, bool kDepthWrite>
+static void drawSpan(const SpanState &state, const Span &span) {
+	SpanVectors v;
+	v.z = interpolate(span.z, span.dzdx);
+	v.r = interpolate(span.r, span.drdx);
+	v.g = interpolate(span.g, span.dgdx);
+	v.b = interpolate(span.b, span.dbdx);
+	v.a = interpolate(span.a, span.dadx);
+	const __m128i dz = _mm_set1_epi32((unsigned int)span.dzdx * 4);
+	const __m128i dr = _mm_set1_epi32((unsigned int)span.drdx * 4);
+	const __m128i dg = _mm_set1_epi32((unsigned int)span.dgdx * 4);
+	const __m128i db = _mm_set1_epi32((unsigned int)span.dbdx * 4);
+	const __m128i da = _mm_set1_epi32((unsigned int)span.dadx * 4);
+
+	int i = 0;
+	for (; i + 4 <= span.count; i += 4) {
+		drawBlock<kTextured, kBlending, kDepthWrite>(state, span.pixels + i, span.zbuf + i, span.mask ? span.mask + i : NULL,
+		                                             kTextured ? span.texels + i : NULL, v);
+		v.z = _mm_add_epi32(v.z, dz);
+		v.r = _mm_add_epi32(v.r, dr);
+		v.g = _mm_add_epi32(v.g, dg);
+		v.b = _mm_add_epi32(v.b, db);
+		v.a = _mm_add_epi32(v.a, da);
+	}
+
+	// Draw the last pixels in a copy of them, so that the block doesn't access anything past the span
+	int left = span.count - i;
+	if (left > 0) {
+		uint32 pixels[4] = { 0, 0, 0, 0 };
+		unsigned int zbuf[4] = { 0, 0, 0, 0 };
+		byte mask[4] = { 0, 0, 0, 0 };
+		uint32 texels[4] = { 0, 0, 0, 0 };
+		for (int j = 0; j < left; j++) {
+			pixels[j] = span.pixels[i + j];
+			zbuf[j] = span.zbuf[i + j];
+			if (span.mask)
+				mask[j] = span.mask[i + j];
+			if (kTextured)
+				texels[j] = span.texels[i + j];
+		}
+		drawBlock<kTextured, kBlending, kDepthWrite>(state, pixels, zbuf, span.mask ? mask : NULL, texels, v);
+		for (int j = 0; j < left; j++) {
+			span.pixels[i + j] = pixels[j];
+			if (kDepthWrite)
+				span.zbuf[i + j] = zbuf[j];
+		}
+	}
+}
+
+template <bool kTextured, SpanBlending kBlending>
+static void drawSpan(const SpanState &state, const Span &span) {
+	if (state.depthWrite)
+		drawSpan<kTextured, kBlending, true>(state, span);
+	else
+		drawSpan<kTextured, kBlending, false>(state, span);
+}
+
+template <bool kTextured>
+static void drawSpan(const SpanState &state, const Span &span) {
+	switch (state.blending) {
+	case kSpanBlendAlpha:
+		drawSpan<kTextured, kSpanBlendAlpha>(state, span);
+		break;
+	case kSpanBlendAdditive:
+		drawSpan<kTextured, kSpanBlendAdditive>(state, span);
+		break;
+	default:
+		drawSpan<kTextured, kSpanBlendNone>(state, span);
+		break;
+	}
+}
+
+static void drawSmooth(const SpanState &state, const Span &span) {
+	drawSpan<false>(state, span);
+}
+
+static void drawTextured(const SpanState &state, const Span &span) {
+	drawSpan<true>(state, span);
+}
+
+const SpanFuncs *getSpanFuncsSSE2() {
+	static const SpanFuncs funcs = { drawSmooth, drawTextured };
+	return &funcs;
+}
+
+} // end of namespace TinyGL
+
+#endif // SCUMMVM_SSE2
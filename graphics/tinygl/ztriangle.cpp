@@ -27,28 +27,30 @@
  */
 
 #include "common/endian.h"
+#include "common/math.h"
 #include "graphics/tinygl/zbuffer.h"
 #include "graphics/tinygl/zgl.h"
+#include "graphics/tinygl/zspan.h"
 
 namespace TinyGL {
 
 static const int NB_INTERP = 8;
 
-template <bool kDepthWrite, bool kEnableAlphaTest, bool kEnableScissor, bool kEnableBlending>
+template <bool kDepthWrite, bool kEnableAlphaTest, bool kEnableScissor, bool kEnableBlending, int kFormat>
 FORCEINLINE static void putPixelFlat(FrameBuffer *buffer, int buf, unsigned int *pz, int _a,
                                      int x, int y, unsigned int &z, unsigned int &r, unsigned int &g, unsigned int &b, unsigned int &a, int &dzdx) {
 	if ((!kEnableScissor || !buffer->scissorPixel(x + _a, y)) && buffer->compareDepth(z, pz[_a])) {
-		buffer->writePixel<kEnableAlphaTest, kEnableBlending, kDepthWrite>(buf + _a, a >> (ZB_POINT_ALPHA_BITS - 8), r >> (ZB_POINT_RED_BITS - 8), g >> (ZB_POINT_GREEN_BITS - 8), b >> (ZB_POINT_BLUE_BITS - 8), z);
+		buffer->writePixel<kEnableAlphaTest, kEnableBlending, kDepthWrite, kFormat>(buf + _a, a >> (ZB_POINT_ALPHA_BITS - 8), r >> (ZB_POINT_RED_BITS - 8), g >> (ZB_POINT_GREEN_BITS - 8), b >> (ZB_POINT_BLUE_BITS - 8), z);
 	}
 	z += dzdx;
 }
 
-template <bool kDepthWrite, bool kEnableAlphaTest, bool kEnableScissor, bool kEnableBlending>
+template <bool kDepthWrite, bool kEnableAlphaTest, bool kEnableScissor, bool kEnableBlending, int kFormat>
 FORCEINLINE static void putPixelSmooth(FrameBuffer *buffer, int buf, unsigned int *pz, int _a,
                                        int x, int y, unsigned int &z, unsigned int &r, unsigned int &g, unsigned int &b, unsigned int &a,
                                        int &dzdx, int &drdx, int &dgdx, int &dbdx, unsigned int dadx) {
 	if ((!kEnableScissor || !buffer->scissorPixel(x + _a, y)) && buffer->compareDepth(z, pz[_a])) {
-		buffer->writePixel<kEnableAlphaTest, kEnableBlending, kDepthWrite>(buf + _a, a >> (ZB_POINT_ALPHA_BITS - 8), r >> (ZB_POINT_RED_BITS - 8), g >> (ZB_POINT_GREEN_BITS - 8), b >> (ZB_POINT_BLUE_BITS - 8), z);
+		buffer->writePixel<kEnableAlphaTest, kEnableBlending, kDepthWrite, kFormat>(buf + _a, a >> (ZB_POINT_ALPHA_BITS - 8), r >> (ZB_POINT_RED_BITS - 8), g >> (ZB_POINT_GREEN_BITS - 8), b >> (ZB_POINT_BLUE_BITS - 8), z);
 	}
 	z += dzdx;
 	a += dadx;
@@ -67,30 +69,29 @@ FORCEINLINE static void putPixelDepth(FrameBuffer *buffer, int buf, unsigned int
 	z += dzdx;
 }
 
-template <bool kDepthWrite, bool kAlphaTestEnabled, bool kEnableScissor, bool kBlendingEnabled>
+template <bool kDepthWrite, bool kAlphaTestEnabled, bool kEnableScissor, bool kBlendingEnabled, int kFormat>
 FORCEINLINE static void putPixelShadow(FrameBuffer *buffer, int buf, unsigned int *pz, int _a, int x, int y, unsigned int &z, unsigned int &r, unsigned int &g, unsigned int &b, int &dzdx, unsigned char *pm) {
 	if ((!kEnableScissor || !buffer->scissorPixel(x + _a, y)) && buffer->compareDepth(z, pz[_a]) && pm[_a]) {
-		buffer->writePixel<kAlphaTestEnabled, kBlendingEnabled, kDepthWrite>(buf + _a, 255, r >> (ZB_POINT_RED_BITS - 8), g >> (ZB_POINT_GREEN_BITS - 8), b >> (ZB_POINT_BLUE_BITS - 8), z);
+		buffer->writePixel<kAlphaTestEnabled, kBlendingEnabled, kDepthWrite, kFormat>(buf + _a, 255, r >> (ZB_POINT_RED_BITS - 8), g >> (ZB_POINT_GREEN_BITS - 8), b >> (ZB_POINT_BLUE_BITS - 8), z);
 	}
 	z += dzdx;
 }
 
-template <bool kDepthWrite, bool kLightsMode, bool kSmoothMode, bool kEnableAlphaTest, bool kEnableScissor, bool kEnableBlending>
+template <bool kDepthWrite, bool kLightsMode, bool kSmoothMode, bool kEnableAlphaTest, bool kEnableScissor, bool kEnableBlending, int kFormat>
 FORCEINLINE static void putPixelTextureMappingPerspective(FrameBuffer *buffer, int buf,
-                        Graphics::PixelFormat &textureFormat, Graphics::PixelBuffer &texture, unsigned int *pz, int _a,
+                        const uint32 *texture, unsigned int *pz, int _a,
                         int x, int y, unsigned int &z, unsigned int &t, unsigned int &s, unsigned int &r, unsigned int &g, unsigned int &b, unsigned int &a,
                         int &dzdx, int &dsdx, int &dtdx, int &drdx, int &dgdx, int &dbdx, unsigned int dadx) {
 	if ((!kEnableScissor || !buffer->scissorPixel(x + _a, y)) && buffer->compareDepth(z, pz[_a])) {
-		unsigned sss = (s & buffer->_textureSizeMask) >> ZB_POINT_ST_FRAC_BITS;
-		unsigned ttt = (t & buffer->_textureSizeMask) >> ZB_POINT_ST_FRAC_BITS;
-		int pixel = ttt * buffer->_textureSize + sss;
+		unsigned sss = (s >> buffer->_textureSShift) & buffer->_textureSMask;
+		unsigned ttt = (t >> buffer->_textureTShift) & buffer->_textureTMask;
+		int pixel = (ttt << buffer->_textureWidthShift) + sss;
 		uint8 c_a, c_r, c_g, c_b;
-		uint32 *textureBuffer = (uint32 *)texture.getRawBuffer(pixel);
-		uint32 col = *textureBuffer;
-		c_a = (col >> textureFormat.aShift) & 0xFF;
-		c_r = (col >> textureFormat.rShift) & 0xFF;
-		c_g = (col >> textureFormat.gShift) & 0xFF;
-		c_b = (col >> textureFormat.bShift) & 0xFF;
+		uint32 col = texture[pixel];
+		c_a = (col >> TEXTURE_A_SHIFT) & 0xFF;
+		c_r = (col >> TEXTURE_R_SHIFT) & 0xFF;
+		c_g = (col >> TEXTURE_G_SHIFT) & 0xFF;
+		c_b = (col >> TEXTURE_B_SHIFT) & 0xFF;
 		if (kLightsMode) {
 			unsigned int l_a = (a >> (ZB_POINT_ALPHA_BITS - 8));
 			unsigned int l_r = (r >> (ZB_POINT_RED_BITS - 8));
@@ -101,7 +102,7 @@ FORCEINLINE static void putPixelTextureMappingPerspective(FrameBuffer *buffer, i
 			c_g = (c_g * l_g) >> (ZB_POINT_GREEN_BITS - 8);
 			c_b = (c_b * l_b) >> (ZB_POINT_BLUE_BITS - 8);
 		}
-		buffer->writePixel<kEnableAlphaTest, kEnableBlending, kDepthWrite>(buf + _a, c_a, c_r, c_g, c_b, z);
+		buffer->writePixel<kEnableAlphaTest, kEnableBlending, kDepthWrite, kFormat>(buf + _a, c_a, c_r, c_g, c_b, z);
 	}
 	z += dzdx;
 	s += dsdx;
@@ -114,10 +115,230 @@ FORCEINLINE static void putPixelTextureMappingPerspective(FrameBuffer *buffer, i
 	}
 }
 
-template <bool kInterpRGB, bool kInterpZ, bool kInterpST, bool kInterpSTZ, int kDrawLogic, bool kDepthWrite, bool kAlphaTestEnabled, bool kEnableScissor, bool kBlendingEnabled>
+// Clip a span starting at x to the scissor rectangle. Returns the number of pixels to skip at its start.
+template <bool kEnableScissor>
+FORCEINLINE static int clipSpan(const FrameBuffer *buffer, int x, int &count) {
+	if (!kEnableScissor)
+		return 0;
+	int skip = MAX<int>(buffer->_clipRectangle.left - x, 0);
+	count = MIN<int>(count, buffer->_clipRectangle.right - x) - skip;
+	return skip;
+}
+
+template <bool kEnableScissor>
+FORCEINLINE static void drawSpanSmooth(const FrameBuffer *buffer, const SpanFuncs *spanFuncs, const SpanState &state, uint32 *pixels, unsigned int *pz,
+                                       const unsigned char *pm, int x, int count, unsigned int z, unsigned int r, unsigned int g, unsigned int b, unsigned int a,
+                                       int dzdx, int drdx, int dgdx, int dbdx, int dadx) {
+	unsigned int skip = clipSpan<kEnableScissor>(buffer, x, count);
+	if (count <= 0)
+		return;
+	Span span;
+	span.pixels = pixels + skip;
+	span.zbuf = pz + skip;
+	span.mask = pm ? pm + skip : NULL;
+	span.texels = NULL;
+	span.count = count;
+	span.z = z + skip * dzdx;
+	span.r = r + skip * drdx;
+	span.g = g + skip * dgdx;
+	span.b = b + skip * dbdx;
+	span.a = a + skip * dadx;
+	span.dzdx = dzdx;
+	span.drdx = drdx;
+	span.dgdx = dgdx;
+	span.dbdx = dbdx;
+	span.dadx = dadx;
+	spanFuncs->drawSmooth(state, span);
+}
+
+// Textured counterpart of putPixelTextureMappingPerspective() for count pixels, at most NB_INTERP.
+template <bool kSmoothMode, bool kEnableScissor>
+FORCEINLINE static void drawSpanTextureMappingPerspective(const FrameBuffer *buffer, const SpanFuncs *spanFuncs, const SpanState &state, uint32 *pixels,
+                        const uint32 *texture, unsigned int *pz, int x, int count,
+                        unsigned int &z, unsigned int &t, unsigned int &s, unsigned int &r, unsigned int &g, unsigned int &b, unsigned int &a,
+                        int dzdx, int dsdx, int dtdx, int drdx, int dgdx, int dbdx, unsigned int dadx) {
+	int drawn = count;
+	unsigned int skip = clipSpan<kEnableScissor>(buffer, x, drawn);
+	if (drawn > 0) {
+		uint32 texels[NB_INTERP];
+		unsigned int ss = s + skip * dsdx;
+		unsigned int tt = t + skip * dtdx;
+		for (int i = 0; i < drawn; i++) {
+			unsigned sss = (ss >> buffer->_textureSShift) & buffer->_textureSMask;
+			unsigned ttt = (tt >> buffer->_textureTShift) & buffer->_textureTMask;
+			texels[i] = texture[(ttt << buffer->_textureWidthShift) + sss];
+			ss += dsdx;
+			tt += dtdx;
+		}
+
+		Span span;
+		span.pixels = pixels + skip;
+		span.zbuf = pz + skip;
+		span.mask = NULL;
+		span.texels = texels;
+		span.count = drawn;
+		span.z = z + skip * dzdx;
+		span.dzdx = dzdx;
+		if (kSmoothMode) {
+			span.r = r + skip * drdx;
+			span.g = g + skip * dgdx;
+			span.b = b + skip * dbdx;
+			span.a = a + skip * dadx;
+			span.drdx = drdx;
+			span.dgdx = dgdx;
+			span.dbdx = dbdx;
+			span.dadx = dadx;
+		} else {
+			span.r = r;
+			span.g = g;
+			span.b = b;
+			span.a = a;
+			span.drdx = span.dgdx = span.dbdx = span.dadx = 0;
+		}
+		spanFuncs->drawTextured(state, span);
+	}
+
+	unsigned int steps = count;
+	z += steps * dzdx;
+	s += steps * dsdx;
+	t += steps * dtdx;
+	if (kSmoothMode) {
+		a += steps * dadx;
+		r += steps * drdx;
+		g += steps * dgdx;
+		b += steps * dbdx;
+	}
+}
+
+bool FrameBuffer::initSpanState(SpanState &state, bool depthWrite, bool alphaTest, bool blending) const {
+	if (!_spanFuncs)
+		return false;
+
+	switch (_format) {
+	case kFormatRGBA8888:
+		state.rShift = 24;
+		state.gShift = 16;
+		state.bShift = 8;
+		state.aShift = 0;
+		state.alphaMask = 0xFF;
+		break;
+	case kFormatXRGB8888:
+		state.rShift = 16;
+		state.gShift = 8;
+		state.bShift = 0;
+		state.aShift = 24;
+		state.alphaMask = 0;
+		break;
+	default:
+		return false;
+	}
+	state.texelRShift = TEXTURE_R_SHIFT;
+	state.texelGShift = TEXTURE_G_SHIFT;
+	state.texelBShift = TEXTURE_B_SHIFT;
+	state.texelAShift = TEXTURE_A_SHIFT;
+
+	if (!_depthTestEnabled) {
+		state.depthTest = kSpanDepthAlways;
+	} else {
+		switch (_depthFunc) {
+		case TGL_LESS:
+			state.depthTest = kSpanDepthLess;
+			break;
+		case TGL_LEQUAL:
+			state.depthTest = kSpanDepthLessEqual;
+			break;
+		case TGL_ALWAYS:
+			state.depthTest = kSpanDepthAlways;
+			break;
+		default:
+			return false;
+		}
+	}
+	state.depthWrite = depthWrite;
+
+	if (!blending) {
+		state.blending = kSpanBlendNone;
+	} else if (_sourceBlendingFactor == TGL_SRC_ALPHA && _destinationBlendingFactor == TGL_ONE_MINUS_SRC_ALPHA) {
+		state.blending = kSpanBlendAlpha;
+	} else if (_sourceBlendingFactor == TGL_SRC_ALPHA && _destinationBlendingFactor == TGL_ONE) {
+		state.blending = kSpanBlendAdditive;
+	} else {
+		return false;
+	}
+
+	// Alpha values are between 0 and 255, see checkAlphaTest()
+	state.alphaTest = alphaTest;
+	state.alphaMin = 0;
+	state.alphaMax = 255;
+	state.alphaInvert = false;
+	if (alphaTest) {
+		switch (_alphaTestFunc) {
+		case TGL_NEVER:
+			state.alphaMin = 256;
+			break;
+		case TGL_LESS:
+			state.alphaMax = _alphaTestRefVal - 1;
+			break;
+		case TGL_EQUAL:
+			state.alphaMin = state.alphaMax = _alphaTestRefVal;
+			break;
+		case TGL_LEQUAL:
+			state.alphaMax = _alphaTestRefVal;
+			break;
+		case TGL_GREATER:
+			state.alphaMin = _alphaTestRefVal + 1;
+			break;
+		case TGL_NOTEQUAL:
+			state.alphaMin = state.alphaMax = _alphaTestRefVal;
+			state.alphaInvert = true;
+			break;
+		case TGL_GEQUAL:
+			state.alphaMin = _alphaTestRefVal;
+			break;
+		default:
+			break;
+		}
+	}
+	return true;
+}
+
+// Pick the level of the current texture whose texels are the closest in size to the pixels covered
+// by the triangle, whose doubled area is given, and set up the mapping of s and t into it.
+static const GLImage *selectTextureLevel(FrameBuffer *buffer, const ZBufferPoint *p0, const ZBufferPoint *p1, const ZBufferPoint *p2, float area) {
+	const GLTexture *texture = buffer->current_texture;
+	int level = 0;
+
+	if (texture->min_filter != TGL_NEAREST && texture->min_filter != TGL_LINEAR) {
+		float ds1 = (float)(p1->s - p0->s);
+		float dt1 = (float)(p1->t - p0->t);
+		float ds2 = (float)(p2->s - p0->s);
+		float dt2 = (float)(p2->t - p0->t);
+		float texelArea = fabs(ds1 * dt2 - ds2 * dt1) / (float)(1 << (2 * ZB_POINT_ST_FRAC_BITS));
+		float baseScale = (float)(texture->images[0].xsize * texture->images[0].ysize) / (buffer->_textureSize * buffer->_textureSize);
+		// Level 0 texels per pixel, which is divided by 4 on each level
+		float texelsPerPixel = texelArea * baseScale / fabs(area);
+		float threshold = 2.0f;
+		while (level + 1 < MAX_TEXTURE_LEVELS && texture->images[level + 1].pixmap && texelsPerPixel > threshold) {
+			level++;
+			threshold *= 4.0f;
+		}
+	}
+
+	const GLImage *image = &texture->images[level];
+	int sizeShift = Common::intLog2(buffer->_textureSize);
+	int widthShift = Common::intLog2(image->xsize);
+	int heightShift = Common::intLog2(image->ysize);
+	buffer->_textureSShift = ZB_POINT_ST_FRAC_BITS + sizeShift - widthShift;
+	buffer->_textureTShift = ZB_POINT_ST_FRAC_BITS + sizeShift - heightShift;
+	buffer->_textureSMask = image->xsize - 1;
+	buffer->_textureTMask = image->ysize - 1;
+	buffer->_textureWidthShift = widthShift;
+	return image;
+}
+
+template <bool kInterpRGB, bool kInterpZ, bool kInterpST, bool kInterpSTZ, int kDrawLogic, bool kDepthWrite, bool kAlphaTestEnabled, bool kEnableScissor, bool kBlendingEnabled, int kFormat>
 void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint *p2) {
-	Graphics::PixelBuffer texture;
-	Graphics::PixelFormat textureFormat;
+	const uint32 *texture = NULL;
 	float fdzdx = 0, fndzdx = 0, ndszdx = 0, ndtzdx = 0;
 
 	ZBufferPoint *tp, *pr1 = 0, *pr2 = 0, *l1 = 0, *l2 = 0;
@@ -171,6 +392,7 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 	fz0 = fdx1 * fdy2 - fdx2 * fdy1;
 	if (fz0 == 0)
 		return;
+	float area = fz0;
 	fz0 = (float)(1.0 / fz0);
 
 	fdx1 *= fz0;
@@ -269,15 +491,25 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 	}
 
 	if ((kInterpST || kInterpSTZ) && (kDrawLogic == DRAW_FLAT || kDrawLogic == DRAW_SMOOTH)) {
-		texture = current_texture;
-		textureFormat = texture.getFormat();
-		assert(textureFormat.bytesPerPixel == 4);
+		texture = (const uint32 *)selectTextureLevel(this, p0, p1, p2, area)->pixmap.getRawBuffer();
 		fdzdx = (float)dzdx;
 		fndzdx = NB_INTERP * fdzdx;
 		ndszdx = NB_INTERP * dszdx;
 		ndtzdx = NB_INTERP * dtzdx;
 	}
 
+	// Let the span kernels draw the scanlines, if they support the state
+	const bool spanDrawLogic = (kDrawLogic == DRAW_SMOOTH && !(kInterpST || kInterpSTZ)) || kDrawLogic == DRAW_SHADOW ||
+	                            ((kInterpST || kInterpSTZ) && kInterpRGB && (kDrawLogic == DRAW_FLAT || kDrawLogic == DRAW_SMOOTH));
+	const SpanFuncs *spanFuncs = NULL;
+	SpanState spanState;
+	uint32 *pixels = NULL;
+	if ((kFormat == kFormatRGBA8888 || kFormat == kFormatXRGB8888) && spanDrawLogic &&
+	    initSpanState(spanState, kDepthWrite, kAlphaTestEnabled, kBlendingEnabled)) {
+		spanFuncs = _spanFuncs;
+		pixels = (uint32 *)pbuf.getRawBuffer();
+	}
+
 	if (fz0 > 0) {
 		l1 = p0;
 		l2 = p2;
@@ -371,7 +603,8 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 		// we draw all the scan line of the part
 		while (nb_lines > 0) {
 			int x = x1;
-			{
+			// Scanlines outside of the scissor rectangle can be skipped entirely: every pixel would be rejected anyway.
+			if (!kEnableScissor || kDrawLogic == DRAW_SHADOW_MASK || (y >= _clipRectangle.top && y < _clipRectangle.bottom)) {
 				if (kDrawLogic == DRAW_DEPTH_ONLY ||
 						(kDrawLogic == DRAW_FLAT && !(kInterpST || kInterpSTZ))) {
 					int pp;
@@ -400,10 +633,10 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 							buf += 4;
 						}
 						if (kDrawLogic == DRAW_FLAT) {
-							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, pp, pz, 0, x, y, z, r, g, b, a, dzdx);
-							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, pp, pz, 1, x, y, z, r, g, b, a, dzdx);
-							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, pp, pz, 2, x, y, z, r, g, g, a, dzdx);
-							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, pp, pz, 3, x, y, z, r, g, b, a, dzdx);
+							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, pp, pz, 0, x, y, z, r, g, b, a, dzdx);
+							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, pp, pz, 1, x, y, z, r, g, b, a, dzdx);
+							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, pp, pz, 2, x, y, z, r, g, g, a, dzdx);
+							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, pp, pz, 3, x, y, z, r, g, b, a, dzdx);
 						}
 						if (kInterpZ) {
 							pz += 4;
@@ -418,7 +651,7 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 							buf ++;
 						}
 						if (kDrawLogic == DRAW_FLAT) {
-							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, pp, pz, 0, x, y, z, r, g, b, a, dzdx);
+							putPixelFlat<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, pp, pz, 0, x, y, z, r, g, b, a, dzdx);
 						}
 						if (kInterpZ) {
 							pz += 1;
@@ -464,24 +697,29 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 					pm = pm1 + x1;
 					pz = pz1 + x1;
 					z = z1;
-					while (n >= 3) {
-						putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 0, x, y, z, r, g, b, dzdx, pm);
-						putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 1, x, y, z, r, g, b, dzdx, pm);
-						putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 2, x, y, z, r, g, b, dzdx, pm);
-						putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 3, x, y, z, r, g, b, dzdx, pm);
-						pz += 4;
-						pm += 4;
-						buf += 4;
-						n -= 4;
-						x += 4;
-					}
-					while (n >= 0) {
-						putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 0, x, y, z, r, g, b, dzdx, pm);
-						pz += 1;
-						pm += 1;
-						buf += 1;
-						n -= 1;
-						x += 1;
+					if (spanFuncs) {
+						drawSpanSmooth<kEnableScissor>(this, spanFuncs, spanState, pixels + buf, pz, pm, x, n + 1, z, r, g, b, 0xFF << (ZB_POINT_ALPHA_BITS - 8),
+						                               dzdx, 0, 0, 0, 0);
+					} else {
+						while (n >= 3) {
+							putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, buf, pz, 0, x, y, z, r, g, b, dzdx, pm);
+							putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, buf, pz, 1, x, y, z, r, g, b, dzdx, pm);
+							putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, buf, pz, 2, x, y, z, r, g, b, dzdx, pm);
+							putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, buf, pz, 3, x, y, z, r, g, b, dzdx, pm);
+							pz += 4;
+							pm += 4;
+							buf += 4;
+							n -= 4;
+							x += 4;
+						}
+						while (n >= 0) {
+							putPixelShadow<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, buf, pz, 0, x, y, z, r, g, b, dzdx, pm);
+							pz += 1;
+							pm += 1;
+							buf += 1;
+							n -= 1;
+							x += 1;
+						}
 					}
 				} else if (kDrawLogic == DRAW_SMOOTH && !(kInterpST || kInterpSTZ)) {
 					unsigned int *pz;
@@ -495,22 +733,26 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 					g = g1;
 					b = b1;
 					a = a1;
-					while (n >= 3) {
-						putPixelSmooth<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 0, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
-						putPixelSmooth<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 1, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
-						putPixelSmooth<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 2, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
-						putPixelSmooth<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 3, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
-						pz += 4;
-						buf += 4;
-						n -= 4;
-						x += 4;
-					}
-					while (n >= 0) {
-						putPixelSmooth<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, pz, 0, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
-						buf += 1;
-						pz += 1;
-						n -= 1;
-						x += 1;
+					if (spanFuncs) {
+						drawSpanSmooth<kEnableScissor>(this, spanFuncs, spanState, pixels + buf, pz, NULL, x, n + 1, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
+					} else {
+						while (n >= 3) {
+							putPixelSmooth<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, buf, pz, 0, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
+							putPixelSmooth<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, buf, pz, 1, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
+							putPixelSmooth<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, buf, pz, 2, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
+							putPixelSmooth<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, buf, pz, 3, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
+							pz += 4;
+							buf += 4;
+							n -= 4;
+							x += 4;
+						}
+						while (n >= 0) {
+							putPixelSmooth<kDepthWrite, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, buf, pz, 0, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx);
+							buf += 1;
+							pz += 1;
+							n -= 1;
+							x += 1;
+						}
 					}
 				} else if (kInterpST || kInterpSTZ) {
 					unsigned int *pz;
@@ -545,9 +787,14 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 							fz += fndzdx;
 							zinv = (float)(1.0 / fz);
 						}
-						for (int _a = 0; _a < NB_INTERP; _a++) {
-							putPixelTextureMappingPerspective<kDepthWrite, kInterpRGB, kDrawLogic == DRAW_SMOOTH, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, textureFormat, texture,
-							                           pz, _a, x, y, z, t, s, r, g, b, a, dzdx, dsdx, dtdx, drdx, dgdx, dbdx, dadx);
+						if (spanFuncs) {
+							drawSpanTextureMappingPerspective<kDrawLogic == DRAW_SMOOTH, kEnableScissor>(this, spanFuncs, spanState, pixels + buf, texture,
+							                           pz, x, NB_INTERP, z, t, s, r, g, b, a, dzdx, dsdx, dtdx, drdx, dgdx, dbdx, dadx);
+						} else {
+							for (int _a = 0; _a < NB_INTERP; _a++) {
+								putPixelTextureMappingPerspective<kDepthWrite, kInterpRGB, kDrawLogic == DRAW_SMOOTH, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, buf, texture,
+								                           pz, _a, x, y, z, t, s, r, g, b, a, dzdx, dsdx, dtdx, drdx, dgdx, dbdx, dadx);
+							}
 						}
 						pz += NB_INTERP;
 						buf += NB_INTERP;
@@ -567,13 +814,18 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 						dtdx = (int)((dtzdx - tt * fdzdx) * zinv);
 					}
 
-					while (n >= 0) {
-						putPixelTextureMappingPerspective<kDepthWrite, kInterpRGB, kDrawLogic == DRAW_SMOOTH, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled>(this, buf, textureFormat, texture,
-						                           pz, 0, x, y, z, t, s, r, g, b, a, dzdx, dsdx, dtdx, drdx, dgdx, dbdx, dadx);
-						pz += 1;
-						buf += 1;
-						n -= 1;
-						x += 1;
+					if (spanFuncs) {
+						drawSpanTextureMappingPerspective<kDrawLogic == DRAW_SMOOTH, kEnableScissor>(this, spanFuncs, spanState, pixels + buf, texture,
+						                           pz, x, n + 1, z, t, s, r, g, b, a, dzdx, dsdx, dtdx, drdx, dgdx, dbdx, dadx);
+					} else {
+						while (n >= 0) {
+							putPixelTextureMappingPerspective<kDepthWrite, kInterpRGB, kDrawLogic == DRAW_SMOOTH, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kFormat>(this, buf, texture,
+							                           pz, 0, x, y, z, t, s, r, g, b, a, dzdx, dsdx, dtdx, drdx, dgdx, dbdx, dadx);
+							pz += 1;
+							buf += 1;
+							n -= 1;
+							x += 1;
+						}
 					}
 				}
 			}
@@ -630,6 +882,25 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 	}
 }
 
+template <bool kInterpRGB, bool kInterpZ, bool kInterpST, bool kInterpSTZ, int kDrawMode, bool kDepthWrite, bool kEnableAlphaTest, bool kEnableScissor, bool kBlendingEnabled>
+void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint *p2) {
+	// Depth only triangles don't touch the pixels, no need to specialize them
+	switch (kDrawMode == DRAW_DEPTH_ONLY ? kFormatGeneric : _format) {
+	case kFormatRGBA8888:
+		fillTriangle<kInterpRGB, kInterpZ, kInterpST, kInterpSTZ, kDrawMode, kDepthWrite, kEnableAlphaTest, kEnableScissor, kBlendingEnabled, kFormatRGBA8888>(p0, p1, p2);
+		break;
+	case kFormatXRGB8888:
+		fillTriangle<kInterpRGB, kInterpZ, kInterpST, kInterpSTZ, kDrawMode, kDepthWrite, kEnableAlphaTest, kEnableScissor, kBlendingEnabled, kFormatXRGB8888>(p0, p1, p2);
+		break;
+	case kFormatRGB565:
+		fillTriangle<kInterpRGB, kInterpZ, kInterpST, kInterpSTZ, kDrawMode, kDepthWrite, kEnableAlphaTest, kEnableScissor, kBlendingEnabled, kFormatRGB565>(p0, p1, p2);
+		break;
+	default:
+		fillTriangle<kInterpRGB, kInterpZ, kInterpST, kInterpSTZ, kDrawMode, kDepthWrite, kEnableAlphaTest, kEnableScissor, kBlendingEnabled, kFormatGeneric>(p0, p1, p2);
+		break;
+	}
+}
+
 template <bool kInterpRGB, bool kInterpZ, bool kInterpST, bool kInterpSTZ, int kDrawMode, bool kDepthWrite, bool kEnableAlphaTest, bool kEnableScissor>
 void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint *p2) {
 	if (_blendingEnabled) {
@@ -83,8 +83,10 @@
 // BASIS, AND BROWN UNIVERSITY HAS NO OBLIGATION TO PROVIDE MAINTENANCE,
 // SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 
+#include "common/system.h"
 #include "graphics/surface.h"
 #include "graphics/yuv_to_rgb.h"
+#include "graphics/yuv_to_rgb_simd.h"
 
 namespace Common {
 DECLARE_SINGLETON(Graphics::YUVToRGBManager);
@@ -166,9 +168,80 @@ YUVToRGBLookup::YUVToRGBLookup(Graphics::PixelFormat format, YUVToRGBManager::Lu
 	}
 }
 
+static const YUVRowFuncs *getRowFuncs(YUVToRGBManager::Backend backend) {
+	// The kernels write the pixels as little endian values
+#ifndef SCUMM_BIG_ENDIAN
+	// SSE2 and NEON are part of the base instruction sets of x86-64 and AArch64,
+	// the CPU only needs to be asked about them in 32 bit builds.
+	switch (backend) {
+#ifdef SCUMMVM_SSE2
+	case YUVToRGBManager::kBackendSSE2:
+#if defined(__x86_64__) || defined(_M_X64)
+		return getYUVRowFuncsSSE2();
+#else
+		if (g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+			return getYUVRowFuncsSSE2();
+		break;
+#endif
+#endif
+
+#ifdef SCUMMVM_AVX2
+	case YUVToRGBManager::kBackendAVX2:
+		if (g_system && g_system->hasFeature(OSystem::kFeatureCpuAVX2))
+			return getYUVRowFuncsAVX2();
+		break;
+#endif
+
+#ifdef SCUMMVM_NEON
+	case YUVToRGBManager::kBackendNEON:
+#if defined(__aarch64__) || defined(_M_ARM64)
+		return getYUVRowFuncsNEON();
+#else
+		if (g_system && g_system->hasFeature(OSystem::kFeatureCpuNEON))
+			return getYUVRowFuncsNEON();
+		break;
+#endif
+#endif
+
+	default:
+		break;
+	}
+#endif
+
+	return 0;
+}
+
+static bool fitsPixelHalf(int loss, int shift) {
+	return loss >= 8 || shift >= 16 || shift + 8 - loss <= 16;
+}
+
+static bool getRowState(const Graphics::PixelFormat &format, YUVToRGBManager::LuminanceScale scale, YUVRowState &state) {
+	// The row kernels work on 16 bit values, each component of 32 bit formats has to be within a half of the pixels
+	if (format.bytesPerPixel == 4 && !(fitsPixelHalf(format.rLoss, format.rShift) && fitsPixelHalf(format.gLoss, format.gShift) &&
+	                                   fitsPixelHalf(format.bLoss, format.bShift) && fitsPixelHalf(format.aLoss, format.aShift)))
+		return false;
+
+	state.itu = (scale == YUVToRGBManager::kScaleITU);
+	state.bytesPerPixel = format.bytesPerPixel;
+	state.rLoss = format.rLoss;
+	state.gLoss = format.gLoss;
+	state.bLoss = format.bLoss;
+	state.aLoss = format.aLoss;
+	state.rShift = format.rShift;
+	state.gShift = format.gShift;
+	state.bShift = format.bShift;
+	state.aShift = format.aShift;
+	return true;
+}
+
 YUVToRGBManager::YUVToRGBManager() {
 	_lookup = 0;
 	_alphaMode = false;
+	_backend = kBackendLookup;
+	_rowFuncs = 0;
+
+	if (!setBackend(kBackendAVX2) && !setBackend(kBackendSSE2))
+		setBackend(kBackendNEON);
 
 	int16 *Cr_r_tab = &_colorTab[0 * 256];
 	int16 *Cr_g_tab = &_colorTab[1 * 256];
@@ -193,6 +266,16 @@ YUVToRGBManager::~YUVToRGBManager() {
 	delete _lookup;
 }
 
+bool YUVToRGBManager::setBackend(Backend backend) {
+	const YUVRowFuncs *rowFuncs = getRowFuncs(backend);
+	if (backend != kBackendLookup && !rowFuncs)
+		return false;
+
+	_backend = backend;
+	_rowFuncs = rowFuncs;
+	return true;
+}
+
 const YUVToRGBLookup *YUVToRGBManager::getLookup(Graphics::PixelFormat format, YUVToRGBManager::LuminanceScale scale, bool alphaMode) {
 	if (_lookup && _lookup->getFormat() == format && _lookup->getScale() == scale && _alphaMode == alphaMode)
 		return _lookup;
@@ -244,6 +327,13 @@ void YUVToRGBManager::convert444(Graphics::Surface *dst, YUVToRGBManager::Lumina
 	assert(dst->format.bytesPerPixel == 2 || dst->format.bytesPerPixel == 4);
 	assert(ySrc && uSrc && vSrc);
 
+	YUVRowState state;
+	if (_rowFuncs && getRowState(dst->format, scale, state)) {
+		for (int h = 0; h < yHeight; h++)
+			_rowFuncs->convertRow(state, (byte *)dst->getBasePtr(0, h), ySrc + h * yPitch, uSrc + h * uvPitch, vSrc + h * uvPitch, yWidth);
+		return;
+	}
+
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
 
 	// Use a templated function to avoid an if check on every pixel
@@ -300,6 +390,13 @@ void YUVToRGBManager::convert420(Graphics::Surface *dst, YUVToRGBManager::Lumina
 	assert((yWidth & 1) == 0);
 	assert((yHeight & 1) == 0);
 
+	YUVRowState state;
+	if (_rowFuncs && getRowState(dst->format, scale, state)) {
+		for (int h = 0; h < yHeight; h += 2)
+			_rowFuncs->convertRowPair(state, (byte *)dst->getBasePtr(0, h), dst->pitch, ySrc + h * yPitch, 0, yPitch, uSrc + (h >> 1) * uvPitch, vSrc + (h >> 1) * uvPitch, yWidth);
+		return;
+	}
+
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
 
 	// Use a templated function to avoid an if check on every pixel
@@ -364,6 +461,13 @@ void YUVToRGBManager::convert420Alpha(Graphics::Surface *dst, YUVToRGBManager::L
 	assert((yWidth & 1) == 0);
 	assert((yHeight & 1) == 0);
 
+	YUVRowState state;
+	if (_rowFuncs && getRowState(dst->format, scale, state)) {
+		for (int h = 0; h < yHeight; h += 2)
+			_rowFuncs->convertRowPair(state, (byte *)dst->getBasePtr(0, h), dst->pitch, ySrc + h * yPitch, aSrc + h * yPitch, yPitch, uSrc + (h >> 1) * uvPitch, vSrc + (h >> 1) * uvPitch, yWidth);
+		return;
+	}
+
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale, true);
 
 	// Use a templated function to avoid an if check on every pixel
@@ -437,6 +541,37 @@ void convertYUV410ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 	}
 }
 
+static void convertYUV410ToRGBRows(const YUVRowFuncs *rowFuncs, const YUVRowState &state, Graphics::Surface *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+	// Interpolate the chroma of each row like convertYUV410ToRGB() does, the row kernels
+	// then get a chroma sample per pixel
+	byte *uRow = new byte[yWidth * 2];
+	byte *vRow = uRow + yWidth;
+	int quarterWidth = yWidth >> 2;
+
+	for (int y = 0; y < yHeight; y++) {
+		int yDiff = y & 3;
+		int index = (y >> 2) * uvPitch;
+
+		for (int x = 0; x < quarterWidth; x++, index++) {
+			byte u, v;
+
+			READ_QUAD(uSrc, u);
+			READ_QUAD(vSrc, v);
+
+			for (int xDiff = 0; xDiff < 4; xDiff++) {
+				DO_INTERPOLATION(u);
+				DO_INTERPOLATION(v);
+				uRow[x * 4 + xDiff] = u;
+				vRow[x * 4 + xDiff] = v;
+			}
+		}
+
+		rowFuncs->convertRow(state, (byte *)dst->getBasePtr(0, y), ySrc + y * yPitch, uRow, vRow, yWidth);
+	}
+
+	delete[] uRow;
+}
+
 #undef READ_QUAD
 #undef DO_INTERPOLATION
 #undef DO_YUV410_PIXEL
@@ -449,6 +584,12 @@ void YUVToRGBManager::convert410(Graphics::Surface *dst, YUVToRGBManager::Lumina
 	assert((yWidth & 3) == 0);
 	assert((yHeight & 3) == 0);
 
+	YUVRowState state;
+	if (_rowFuncs && getRowState(dst->format, scale, state)) {
+		convertYUV410ToRGBRows(_rowFuncs, state, dst, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
+		return;
+	}
+
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
 
 	// Use a templated function to avoid an if check on every pixel
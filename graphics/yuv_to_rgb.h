@@ -42,6 +42,7 @@
 namespace Graphics {
 
 class YUVToRGBLookup;
+struct YUVRowFuncs;
 
 class YUVToRGBManager : public Common::Singleton<YUVToRGBManager> {
 public:
@@ -51,6 +52,26 @@ public:
 		kScaleITU   /** Luminance values range from [16, 235], the range from ITU-R BT.601 */
 	};
 
+	/** The implementation of the conversions */
+	enum Backend {
+		kBackendLookup, /** Lookup tables, the reference the other backends are checked against */
+		kBackendSSE2,
+		kBackendAVX2,
+		kBackendNEON
+	};
+
+	/**
+	 * Select the implementation of the conversions. The best one supported
+	 * by the CPU is used by default.
+	 *
+	 * @param backend the implementation to use
+	 * @return false if it is not supported, in which case the current one is kept
+	 */
+	bool setBackend(Backend backend);
+
+	/** Get the implementation of the conversions in use */
+	Backend getBackend() const { return _backend; }
+
 	/**
 	 * Convert a YUV444 image to an RGB surface
 	 *
@@ -128,6 +149,9 @@ private:
 	YUVToRGBLookup *_lookup;
 	int16 _colorTab[4 * 256]; // 2048 bytes
 	bool _alphaMode;
+
+	Backend _backend;
+	const YUVRowFuncs *_rowFuncs; // NULL when using the lookup tables
 };
 
 } // End of namespace Graphics
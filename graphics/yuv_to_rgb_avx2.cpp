@@ -0,0 +1,282 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// This file is compiled with AVX2 enabled, it must only be called after checking the CPU supports it.
+
+#include "graphics/yuv_to_rgb_simd.h"
+
+#ifdef SCUMMVM_AVX2
+
+#include <immintrin.h>
+
+namespace Graphics {
+
+enum {
+	kBlockSize = 32
+};
+
+// Where the kernels put the components in the pixels
+struct PixelLayout {
+	// 32 bit formats with 8 bit components are written a byte at a time, from the
+	// component at each position. The alpha byte is cleared when the format has none.
+	bool bytes;
+	int rPos, gPos, bPos, aPos;
+	bool hasAlpha;
+
+	// Other formats have their components shifted in 16 bit values, in the half of the
+	// pixels holding them for 32 bit formats.
+	__m128i rLoss, gLoss, bLoss, aLoss;
+	__m128i rShift, gShift, bShift, aShift;
+
+	PixelLayout(const YUVRowState &state) {
+		bytes = state.bytesPerPixel == 4 && state.rLoss == 0 && state.gLoss == 0 && state.bLoss == 0 &&
+		        (state.aLoss == 0 || state.aLoss == 8) && ((state.rShift | state.gShift | state.bShift | state.aShift) & 7) == 0;
+		rPos = state.rShift / 8;
+		gPos = state.gShift / 8;
+		bPos = state.bShift / 8;
+		hasAlpha = state.aLoss == 0;
+		aPos = hasAlpha ? state.aShift / 8 : 6 - rPos - gPos - bPos;
+
+		rLoss = _mm_cvtsi32_si128(state.rLoss);
+		gLoss = _mm_cvtsi32_si128(state.gLoss);
+		bLoss = _mm_cvtsi32_si128(state.bLoss);
+		aLoss = _mm_cvtsi32_si128(state.aLoss);
+		rShift = _mm_cvtsi32_si128(state.rShift & 15);
+		gShift = _mm_cvtsi32_si128(state.gShift & 15);
+		bShift = _mm_cvtsi32_si128(state.bShift & 15);
+		aShift = _mm_cvtsi32_si128(state.aShift & 15);
+	}
+};
+
+// What the chroma adds to the luminance for each component
+struct ChromaTerms {
+	__m256i r, g, b;
+};
+
+static inline __m256i multiply(__m256i c, __m256i sign, int shift, int mul) {
+	return _mm256_sub_epi16(_mm256_mulhi_epi16(_mm256_sll_epi16(c, _mm_cvtsi32_si128(shift)), _mm256_set1_epi16(mul)), sign);
+}
+
+// Computes the terms for the 16 samples of the 16 bit lanes of u and v
+static inline ChromaTerms getChromaTerms(__m256i u, __m256i v) {
+	__m256i cr = _mm256_sub_epi16(v, _mm256_set1_epi16(128));
+	__m256i cb = _mm256_sub_epi16(u, _mm256_set1_epi16(128));
+	__m256i crSign = _mm256_srai_epi16(cr, 15);
+	__m256i cbSign = _mm256_srai_epi16(cb, 15);
+
+	ChromaTerms terms;
+	terms.r = multiply(cr, crSign, kYUVCrRShift, kYUVCrRMul);
+	terms.g = _mm256_sub_epi16(_mm256_setzero_si256(), _mm256_add_epi16(multiply(cr, crSign, kYUVCrGShift, kYUVCrGMul), multiply(cb, cbSign, kYUVCbGShift, kYUVCbGMul)));
+	terms.b = multiply(cb, cbSign, kYUVCbBShift, kYUVCbBMul);
+	return terms;
+}
+
+// The luminance values of the ITU scale have already been offset by -16. The
+// full scale values are left to be clamped when packed to bytes, if they are.
+static inline __m256i scaleLuminance(const YUVRowState &state, __m256i value, bool packed) {
+	if (state.itu) {
+		value = _mm256_min_epi16(_mm256_max_epi16(value, _mm256_setzero_si256()), _mm256_set1_epi16(219));
+		return _mm256_mulhi_epu16(_mm256_slli_epi16(value, 1), _mm256_set1_epi16((short)kYUVITUMul));
+	}
+
+	if (packed)
+		return value;
+
+	return _mm256_min_epi16(_mm256_max_epi16(value, _mm256_setzero_si256()), _mm256_set1_epi16(255));
+}
+
+static inline __m256i place(__m256i value, __m128i loss, __m128i shift) {
+	return _mm256_sll_epi16(_mm256_srl_epi16(value, loss), shift);
+}
+
+// Writes 16 pixels with their components shifted in place. The unpacking works within
+// each 128 bit lane, the first 8 pixels go to dst and the last 8 ones to secondDst.
+template <int kBytesPerPixel>
+static inline void writeShiftedPixels(const YUVRowState &state, const PixelLayout &layout, byte *dst, byte *secondDst, __m256i y, const ChromaTerms &terms, __m256i a) {
+	__m256i r = place(scaleLuminance(state, _mm256_add_epi16(y, terms.r), false), layout.rLoss, layout.rShift);
+	__m256i g = place(scaleLuminance(state, _mm256_add_epi16(y, terms.g), false), layout.gLoss, layout.gShift);
+	__m256i b = place(scaleLuminance(state, _mm256_add_epi16(y, terms.b), false), layout.bLoss, layout.bShift);
+	a = place(a, layout.aLoss, layout.aShift);
+
+	if (kBytesPerPixel == 2) {
+		__m256i pixels = _mm256_or_si256(_mm256_or_si256(r, g), _mm256_or_si256(b, a));
+		_mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(pixels));
+		_mm_storeu_si128((__m128i *)secondDst, _mm256_extracti128_si256(pixels, 1));
+	} else {
+		__m256i low = _mm256_setzero_si256();
+		__m256i high = _mm256_setzero_si256();
+		if (state.rShift < 16)
+			low = _mm256_or_si256(low, r);
+		else
+			high = _mm256_or_si256(high, r);
+		if (state.gShift < 16)
+			low = _mm256_or_si256(low, g);
+		else
+			high = _mm256_or_si256(high, g);
+		if (state.bShift < 16)
+			low = _mm256_or_si256(low, b);
+		else
+			high = _mm256_or_si256(high, b);
+		if (state.aShift < 16)
+			low = _mm256_or_si256(low, a);
+		else
+			high = _mm256_or_si256(high, a);
+
+		__m256i first = _mm256_unpacklo_epi16(low, high);
+		__m256i second = _mm256_unpackhi_epi16(low, high);
+		_mm256_storeu_si256((__m256i *)dst, _mm256_permute2x128_si256(first, second, 0x20));
+		_mm256_storeu_si256((__m256i *)secondDst, _mm256_permute2x128_si256(first, second, 0x31));
+	}
+}
+
+// Writes 32 pixels, from their luminance and alpha bytes. As the unpacking works within
+// each 128 bit lane, the low terms are the ones of pixels 0-7 and 16-23, and the high
+// terms the ones of pixels 8-15 and 24-31.
+template <int kBytesPerPixel>
+static inline void writePixels(const YUVRowState &state, const PixelLayout &layout, byte *dst, __m256i y, __m256i a, const ChromaTerms &low, const ChromaTerms &high) {
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i yOffset = _mm256_set1_epi16(state.itu ? 16 : 0);
+	__m256i yLow = _mm256_sub_epi16(_mm256_unpacklo_epi8(y, zero), yOffset);
+	__m256i yHigh = _mm256_sub_epi16(_mm256_unpackhi_epi8(y, zero), yOffset);
+
+	if (kBytesPerPixel == 4 && layout.bytes) {
+		// Packing puts the components back in the order of the pixels
+		__m256i components[4];
+		components[layout.rPos] = _mm256_packus_epi16(scaleLuminance(state, _mm256_add_epi16(yLow, low.r), true), scaleLuminance(state, _mm256_add_epi16(yHigh, high.r), true));
+		components[layout.gPos] = _mm256_packus_epi16(scaleLuminance(state, _mm256_add_epi16(yLow, low.g), true), scaleLuminance(state, _mm256_add_epi16(yHigh, high.g), true));
+		components[layout.bPos] = _mm256_packus_epi16(scaleLuminance(state, _mm256_add_epi16(yLow, low.b), true), scaleLuminance(state, _mm256_add_epi16(yHigh, high.b), true));
+		components[layout.aPos] = layout.hasAlpha ? a : zero;
+
+		__m256i low01 = _mm256_unpacklo_epi8(components[0], components[1]);
+		__m256i high01 = _mm256_unpackhi_epi8(components[0], components[1]);
+		__m256i low23 = _mm256_unpacklo_epi8(components[2], components[3]);
+		__m256i high23 = _mm256_unpackhi_epi8(components[2], components[3]);
+		__m256i pixels0 = _mm256_unpacklo_epi16(low01, low23);
+		__m256i pixels4 = _mm256_unpackhi_epi16(low01, low23);
+		__m256i pixels8 = _mm256_unpacklo_epi16(high01, high23);
+		__m256i pixels12 = _mm256_unpackhi_epi16(high01, high23);
+		_mm256_storeu_si256((__m256i *)dst, _mm256_permute2x128_si256(pixels0, pixels4, 0x20));
+		_mm256_storeu_si256((__m256i *)(dst + 32), _mm256_permute2x128_si256(pixels8, pixels12, 0x20));
+		_mm256_storeu_si256((__m256i *)(dst + 64), _mm256_permute2x128_si256(pixels0, pixels4, 0x31));
+		_mm256_storeu_si256((__m256i *)(dst + 96), _mm256_permute2x128_si256(pixels8, pixels12, 0x31));
+	} else {
+		writeShiftedPixels<kBytesPerPixel>(state, layout, dst, dst + 16 * kBytesPerPixel, yLow, low, _mm256_unpacklo_epi8(a, zero));
+		writeShiftedPixels<kBytesPerPixel>(state, layout, dst + 8 * kBytesPerPixel, dst + 24 * kBytesPerPixel, yHigh, high, _mm256_unpackhi_epi8(a, zero));
+	}
+}
+
+template <int kBytesPerPixel>
+static void convertRow(const YUVRowState &state, byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, int width) {
+	const PixelLayout layout(state);
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i alpha = _mm256_set1_epi8((char)255);
+
+	int x = 0;
+	for (; x + kBlockSize <= width; x += kBlockSize) {
+		__m256i y = _mm256_loadu_si256((const __m256i *)(ySrc + x));
+		__m256i u = _mm256_loadu_si256((const __m256i *)(uSrc + x));
+		__m256i v = _mm256_loadu_si256((const __m256i *)(vSrc + x));
+		ChromaTerms low = getChromaTerms(_mm256_unpacklo_epi8(u, zero), _mm256_unpacklo_epi8(v, zero));
+		ChromaTerms high = getChromaTerms(_mm256_unpackhi_epi8(u, zero), _mm256_unpackhi_epi8(v, zero));
+		writePixels<kBytesPerPixel>(state, layout, dst + x * kBytesPerPixel, y, alpha, low, high);
+	}
+
+	// Convert the last pixels from a copy of them, so that the blocks don't access anything past the row
+	int left = width - x;
+	if (left > 0) {
+		byte y[kBlockSize] = { 0 }, u[kBlockSize] = { 0 }, v[kBlockSize] = { 0 };
+		byte pixels[kBlockSize * kBytesPerPixel];
+		memcpy(y, ySrc + x, left);
+		memcpy(u, uSrc + x, left);
+		memcpy(v, vSrc + x, left);
+		convertRow<kBytesPerPixel>(state, pixels, y, u, v, kBlockSize);
+		memcpy(dst + x * kBytesPerPixel, pixels, left * kBytesPerPixel);
+	}
+}
+
+template <int kBytesPerPixel>
+static void convertRowPair(const YUVRowState &state, byte *dst, int dstPitch, const byte *ySrc, const byte *aSrc, int yPitch, const byte *uSrc, const byte *vSrc, int width) {
+	const PixelLayout layout(state);
+	const __m256i alpha = _mm256_set1_epi8((char)255);
+
+	// The chroma of 16 samples is computed once for the 32 pixels of both rows. Duplicating
+	// the samples within each lane gives the terms in the order writePixels() takes them.
+	int x = 0;
+	for (; x + kBlockSize <= width; x += kBlockSize) {
+		__m256i u = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(uSrc + x / 2)));
+		__m256i v = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(vSrc + x / 2)));
+		ChromaTerms terms = getChromaTerms(u, v);
+		ChromaTerms low, high;
+		low.r = _mm256_unpacklo_epi16(terms.r, terms.r);
+		low.g = _mm256_unpacklo_epi16(terms.g, terms.g);
+		low.b = _mm256_unpacklo_epi16(terms.b, terms.b);
+		high.r = _mm256_unpackhi_epi16(terms.r, terms.r);
+		high.g = _mm256_unpackhi_epi16(terms.g, terms.g);
+		high.b = _mm256_unpackhi_epi16(terms.b, terms.b);
+
+		for (int row = 0; row < 2; row++) {
+			__m256i y = _mm256_loadu_si256((const __m256i *)(ySrc + row * yPitch + x));
+			__m256i a = aSrc ? _mm256_loadu_si256((const __m256i *)(aSrc + row * yPitch + x)) : alpha;
+			writePixels<kBytesPerPixel>(state, layout, dst + row * dstPitch + x * kBytesPerPixel, y, a, low, high);
+		}
+	}
+
+	// Convert the last pixels from a copy of them, so that the blocks don't access anything past the rows
+	int left = width - x;
+	if (left > 0) {
+		byte y[2 * kBlockSize] = { 0 }, a[2 * kBlockSize] = { 0 }, u[kBlockSize / 2] = { 0 }, v[kBlockSize / 2] = { 0 };
+		byte pixels[2 * kBlockSize * kBytesPerPixel];
+		for (int row = 0; row < 2; row++) {
+			memcpy(y + row * kBlockSize, ySrc + row * yPitch + x, left);
+			if (aSrc)
+				memcpy(a + row * kBlockSize, aSrc + row * yPitch + x, left);
+		}
+		memcpy(u, uSrc + x / 2, (left + 1) / 2);
+		memcpy(v, vSrc + x / 2, (left + 1) / 2);
+		convertRowPair<kBytesPerPixel>(state, pixels, kBlockSize * kBytesPerPixel, y, aSrc ? a : 0, kBlockSize, u, v, kBlockSize);
+		for (int row = 0; row < 2; row++)
+			memcpy(dst + row * dstPitch + x * kBytesPerPixel, pixels + row * kBlockSize * kBytesPerPixel, left * kBytesPerPixel);
+	}
+}
+
+static void convertRow(const YUVRowState &state, byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, int width) {
+	if (state.bytesPerPixel == 2)
+		convertRow<2>(state, dst, ySrc, uSrc, vSrc, width);
+	else
+		convertRow<4>(state, dst, ySrc, uSrc, vSrc, width);
+}
+
+static void convertRowPair(const YUVRowState &state, byte *dst, int dstPitch, const byte *ySrc, const byte *aSrc, int yPitch, const byte *uSrc, const byte *vSrc, int width) {
+	if (state.bytesPerPixel == 2)
+		convertRowPair<2>(state, dst, dstPitch, ySrc, aSrc, yPitch, uSrc, vSrc, width);
+	else
+		convertRowPair<4>(state, dst, dstPitch, ySrc, aSrc, yPitch, uSrc, vSrc, width);
+}
+
+const YUVRowFuncs *getYUVRowFuncsAVX2() {
+	static const YUVRowFuncs funcs = { convertRow, convertRowPair };
+	return &funcs;
+}
+
+} // End of namespace Graphics
+
+#endif // SCUMMVM_AVX2
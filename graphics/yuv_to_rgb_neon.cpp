@@ -0,0 +1,252 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "graphics/yuv_to_rgb_simd.h"
+
+#ifdef SCUMMVM_NEON
+
+#include <arm_neon.h>
+
+namespace Graphics {
+
+enum {
+	kBlockSize = 16
+};
+
+// Where the kernels put the components in the pixels
+struct PixelLayout {
+	// 32 bit formats with 8 bit components are written a byte at a time, from the
+	// component at each position. The alpha byte is cleared when the format has none.
+	bool bytes;
+	int rPos, gPos, bPos, aPos;
+	bool hasAlpha;
+
+	// Other formats have their components shifted in 16 bit values, in the half of the
+	// pixels holding them for 32 bit formats. The losses are negated for vshlq_u16().
+	int16x8_t rLoss, gLoss, bLoss, aLoss;
+	int16x8_t rShift, gShift, bShift, aShift;
+
+	PixelLayout(const YUVRowState &state) {
+		bytes = state.bytesPerPixel == 4 && state.rLoss == 0 && state.gLoss == 0 && state.bLoss == 0 &&
+		        (state.aLoss == 0 || state.aLoss == 8) && ((state.rShift | state.gShift | state.bShift | state.aShift) & 7) == 0;
+		rPos = state.rShift / 8;
+		gPos = state.gShift / 8;
+		bPos = state.bShift / 8;
+		hasAlpha = state.aLoss == 0;
+		aPos = hasAlpha ? state.aShift / 8 : 6 - rPos - gPos - bPos;
+
+		rLoss = vdupq_n_s16(-state.rLoss);
+		gLoss = vdupq_n_s16(-state.gLoss);
+		bLoss = vdupq_n_s16(-state.bLoss);
+		aLoss = vdupq_n_s16(-state.aLoss);
+		rShift = vdupq_n_s16(state.rShift & 15);
+		gShift = vdupq_n_s16(state.gShift & 15);
+		bShift = vdupq_n_s16(state.bShift & 15);
+		aShift = vdupq_n_s16(state.aShift & 15);
+	}
+};
+
+// What the chroma adds to the luminance for each component
+struct ChromaTerms {
+	int16x8_t r, g, b;
+};
+
+static inline int16x8_t multiply(int16x8_t c, int16x8_t sign, int shift, int mul) {
+	c = vshlq_s16(c, vdupq_n_s16(shift));
+	int16x4_t low = vshrn_n_s32(vmull_n_s16(vget_low_s16(c), mul), 16);
+	int16x4_t high = vshrn_n_s32(vmull_n_s16(vget_high_s16(c), mul), 16);
+	return vsubq_s16(vcombine_s16(low, high), sign);
+}
+
+// Computes the terms for the 8 samples of u and v
+static inline ChromaTerms getChromaTerms(uint8x8_t u, uint8x8_t v) {
+	int16x8_t cr = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(v)), vdupq_n_s16(128));
+	int16x8_t cb = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(u)), vdupq_n_s16(128));
+	int16x8_t crSign = vshrq_n_s16(cr, 15);
+	int16x8_t cbSign = vshrq_n_s16(cb, 15);
+
+	ChromaTerms terms;
+	terms.r = multiply(cr, crSign, kYUVCrRShift, kYUVCrRMul);
+	terms.g = vnegq_s16(vaddq_s16(multiply(cr, crSign, kYUVCrGShift, kYUVCrGMul), multiply(cb, cbSign, kYUVCbGShift, kYUVCbGMul)));
+	terms.b = multiply(cb, cbSign, kYUVCbBShift, kYUVCbBMul);
+	return terms;
+}
+
+// The luminance values of the ITU scale have already been offset by -16.
+// The results are clamped when packed to bytes.
+static inline int16x8_t scaleLuminance(const YUVRowState &state, int16x8_t value) {
+	if (state.itu) {
+		uint16x8_t clamped = vreinterpretq_u16_s16(vminq_s16(vmaxq_s16(value, vdupq_n_s16(0)), vdupq_n_s16(219)));
+		clamped = vshlq_n_u16(clamped, 1);
+		uint16x4_t low = vshrn_n_u32(vmull_n_u16(vget_low_u16(clamped), kYUVITUMul), 16);
+		uint16x4_t high = vshrn_n_u32(vmull_n_u16(vget_high_u16(clamped), kYUVITUMul), 16);
+		return vreinterpretq_s16_u16(vcombine_u16(low, high));
+	}
+
+	return value;
+}
+
+static inline uint16x8_t place(uint8x8_t value, int16x8_t loss, int16x8_t shift) {
+	return vshlq_u16(vshlq_u16(vmovl_u8(value), loss), shift);
+}
+
+// Writes 8 pixels with their components shifted in place
+template <int kBytesPerPixel>
+static inline void writeShiftedPixels(const YUVRowState &state, const PixelLayout &layout, byte *dst, uint8x8_t r8, uint8x8_t g8, uint8x8_t b8, uint8x8_t a8) {
+	uint16x8_t r = place(r8, layout.rLoss, layout.rShift);
+	uint16x8_t g = place(g8, layout.gLoss, layout.gShift);
+	uint16x8_t b = place(b8, layout.bLoss, layout.bShift);
+	uint16x8_t a = place(a8, layout.aLoss, layout.aShift);
+
+	if (kBytesPerPixel == 2) {
+		vst1q_u16((uint16 *)dst, vorrq_u16(vorrq_u16(r, g), vorrq_u16(b, a)));
+	} else {
+		uint16x8x2_t pixels;
+		pixels.val[0] = vdupq_n_u16(0);
+		pixels.val[1] = vdupq_n_u16(0);
+		pixels.val[state.rShift < 16 ? 0 : 1] = vorrq_u16(pixels.val[state.rShift < 16 ? 0 : 1], r);
+		pixels.val[state.gShift < 16 ? 0 : 1] = vorrq_u16(pixels.val[state.gShift < 16 ? 0 : 1], g);
+		pixels.val[state.bShift < 16 ? 0 : 1] = vorrq_u16(pixels.val[state.bShift < 16 ? 0 : 1], b);
+		pixels.val[state.aShift < 16 ? 0 : 1] = vorrq_u16(pixels.val[state.aShift < 16 ? 0 : 1], a);
+		vst2q_u16((uint16 *)dst, pixels);
+	}
+}
+
+// Writes 16 pixels, from their luminance and alpha bytes and the chroma terms of each half of them
+template <int kBytesPerPixel>
+static inline void writePixels(const YUVRowState &state, const PixelLayout &layout, byte *dst, uint8x16_t y, uint8x16_t a, const ChromaTerms &low, const ChromaTerms &high) {
+	const int16x8_t yOffset = vdupq_n_s16(state.itu ? 16 : 0);
+	int16x8_t yLow = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(y))), yOffset);
+	int16x8_t yHigh = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(y))), yOffset);
+
+	// Packing the components to bytes clamps them
+	uint8x16_t r = vcombine_u8(vqmovun_s16(scaleLuminance(state, vaddq_s16(yLow, low.r))), vqmovun_s16(scaleLuminance(state, vaddq_s16(yHigh, high.r))));
+	uint8x16_t g = vcombine_u8(vqmovun_s16(scaleLuminance(state, vaddq_s16(yLow, low.g))), vqmovun_s16(scaleLuminance(state, vaddq_s16(yHigh, high.g))));
+	uint8x16_t b = vcombine_u8(vqmovun_s16(scaleLuminance(state, vaddq_s16(yLow, low.b))), vqmovun_s16(scaleLuminance(state, vaddq_s16(yHigh, high.b))));
+
+	if (kBytesPerPixel == 4 && layout.bytes) {
+		uint8x16x4_t pixels;
+		pixels.val[layout.rPos] = r;
+		pixels.val[layout.gPos] = g;
+		pixels.val[layout.bPos] = b;
+		pixels.val[layout.aPos] = layout.hasAlpha ? a : vdupq_n_u8(0);
+		vst4q_u8(dst, pixels);
+	} else {
+		writeShiftedPixels<kBytesPerPixel>(state, layout, dst, vget_low_u8(r), vget_low_u8(g), vget_low_u8(b), vget_low_u8(a));
+		writeShiftedPixels<kBytesPerPixel>(state, layout, dst + 8 * kBytesPerPixel, vget_high_u8(r), vget_high_u8(g), vget_high_u8(b), vget_high_u8(a));
+	}
+}
+
+template <int kBytesPerPixel>
+static void convertRow(const YUVRowState &state, byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, int width) {
+	const PixelLayout layout(state);
+	const uint8x16_t alpha = vdupq_n_u8(255);
+
+	int x = 0;
+	for (; x + kBlockSize <= width; x += kBlockSize) {
+		uint8x16_t u = vld1q_u8(uSrc + x);
+		uint8x16_t v = vld1q_u8(vSrc + x);
+		ChromaTerms low = getChromaTerms(vget_low_u8(u), vget_low_u8(v));
+		ChromaTerms high = getChromaTerms(vget_high_u8(u), vget_high_u8(v));
+		writePixels<kBytesPerPixel>(state, layout, dst + x * kBytesPerPixel, vld1q_u8(ySrc + x), alpha, low, high);
+	}
+
+	// Convert the last pixels from a copy of them, so that the blocks don't access anything past the row
+	int left = width - x;
+	if (left > 0) {
+		byte y[kBlockSize] = { 0 }, u[kBlockSize] = { 0 }, v[kBlockSize] = { 0 };
+		byte pixels[kBlockSize * kBytesPerPixel];
+		memcpy(y, ySrc + x, left);
+		memcpy(u, uSrc + x, left);
+		memcpy(v, vSrc + x, left);
+		convertRow<kBytesPerPixel>(state, pixels, y, u, v, kBlockSize);
+		memcpy(dst + x * kBytesPerPixel, pixels, left * kBytesPerPixel);
+	}
+}
+
+template <int kBytesPerPixel>
+static void convertRowPair(const YUVRowState &state, byte *dst, int dstPitch, const byte *ySrc, const byte *aSrc, int yPitch, const byte *uSrc, const byte *vSrc, int width) {
+	const PixelLayout layout(state);
+	const uint8x16_t alpha = vdupq_n_u8(255);
+
+	// The chroma of 8 samples is computed once for the 16 pixels of both rows
+	int x = 0;
+	for (; x + kBlockSize <= width; x += kBlockSize) {
+		ChromaTerms terms = getChromaTerms(vld1_u8(uSrc + x / 2), vld1_u8(vSrc + x / 2));
+		int16x8x2_t r = vzipq_s16(terms.r, terms.r);
+		int16x8x2_t g = vzipq_s16(terms.g, terms.g);
+		int16x8x2_t b = vzipq_s16(terms.b, terms.b);
+		ChromaTerms low, high;
+		low.r = r.val[0];
+		low.g = g.val[0];
+		low.b = b.val[0];
+		high.r = r.val[1];
+		high.g = g.val[1];
+		high.b = b.val[1];
+
+		for (int row = 0; row < 2; row++) {
+			uint8x16_t y = vld1q_u8(ySrc + row * yPitch + x);
+			uint8x16_t a = aSrc ? vld1q_u8(aSrc + row * yPitch + x) : alpha;
+			writePixels<kBytesPerPixel>(state, layout, dst + row * dstPitch + x * kBytesPerPixel, y, a, low, high);
+		}
+	}
+
+	// Convert the last pixels from a copy of them, so that the blocks don't access anything past the rows
+	int left = width - x;
+	if (left > 0) {
+		byte y[2 * kBlockSize] = { 0 }, a[2 * kBlockSize] = { 0 }, u[kBlockSize / 2] = { 0 }, v[kBlockSize / 2] = { 0 };
+		byte pixels[2 * kBlockSize * kBytesPerPixel];
+		for (int row = 0; row < 2; row++) {
+			memcpy(y + row * kBlockSize, ySrc + row * yPitch + x, left);
+			if (aSrc)
+				memcpy(a + row * kBlockSize, aSrc + row * yPitch + x, left);
+		}
+		memcpy(u, uSrc + x / 2, (left + 1) / 2);
+		memcpy(v, vSrc + x / 2, (left + 1) / 2);
+		convertRowPair<kBytesPerPixel>(state, pixels, kBlockSize * kBytesPerPixel, y, aSrc ? a : 0, kBlockSize, u, v, kBlockSize);
+		for (int row = 0; row < 2; row++)
+			memcpy(dst + row * dstPitch + x * kBytesPerPixel, pixels + row * kBlockSize * kBytesPerPixel, left * kBytesPerPixel);
+	}
+}
+
+static void convertRow(const YUVRowState &state, byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, int width) {
+	if (state.bytesPerPixel == 2)
+		convertRow<2>(state, dst, ySrc, uSrc, vSrc, width);
+	else
+		convertRow<4>(state, dst, ySrc, uSrc, vSrc, width);
+}
+
+static void convertRowPair(const YUVRowState &state, byte *dst, int dstPitch, const byte *ySrc, const byte *aSrc, int yPitch, const byte *uSrc, const byte *vSrc, int width) {
+	if (state.bytesPerPixel == 2)
+		convertRowPair<2>(state, dst, dstPitch, ySrc, aSrc, yPitch, uSrc, vSrc, width);
+	else
+		convertRowPair<4>(state, dst, dstPitch, ySrc, aSrc, yPitch, uSrc, vSrc, width);
+}
+
+const YUVRowFuncs *getYUVRowFuncsNEON() {
+	static const YUVRowFuncs funcs = { convertRow, convertRowPair };
+	return &funcs;
+}
+
+} // End of namespace Graphics
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,76 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GRAPHICS_YUV_TO_RGB_SIMD_H
+#define GRAPHICS_YUV_TO_RGB_SIMD_H
+
+#include "common/scummsys.h"
+
+namespace Graphics {
+
+// Row kernels convert rows of pixels several at a time with SIMD instructions.
+// Their results are identical to the ones of the lookup tables of YUVToRGBManager.
+
+// Fixed point versions of the factors of the chroma tables of YUVToRGBManager.
+// For c in [-128, 127], ((c << shift) * mul) >> 16 is the product rounded down,
+// adding one to it when c is negative truncates it like the tables do.
+enum {
+	kYUVCrRMul = 22957, kYUVCrRShift = 2, // 0.419 / 0.299
+	kYUVCrGMul = 23381, kYUVCrGShift = 1, // 0.299 / 0.419
+	kYUVCbGMul = 22569, kYUVCbGShift = 0, // 0.114 / 0.331
+	kYUVCbBMul = 29055, kYUVCbBShift = 2, // 0.587 / 0.331
+	// (x * 2 * kYUVITUMul) >> 16 equals x * 255 / 219, for x in [0, 219]
+	kYUVITUMul = 38155
+};
+
+struct YUVRowState {
+	bool itu;          // Luminance values range from [16, 235] instead of [0, 255]
+	int bytesPerPixel; // 2 or 4
+	// Layout of the pixels. In 32 bit formats, each component has to be within
+	// either the low or the high 16 bits of the pixels.
+	int rLoss, gLoss, bLoss, aLoss;
+	int rShift, gShift, bShift, aShift;
+};
+
+struct YUVRowFuncs {
+	// Converts width pixels, with a chroma sample for each of them.
+	void (*convertRow)(const YUVRowState &state, byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, int width);
+	// Converts two rows of width pixels, with a chroma sample for each two by two pixels.
+	// aSrc can be NULL for opaque pixels, its pitch is the one of ySrc.
+	void (*convertRowPair)(const YUVRowState &state, byte *dst, int dstPitch, const byte *ySrc, const byte *aSrc, int yPitch, const byte *uSrc, const byte *vSrc, int width);
+};
+
+#ifdef SCUMMVM_SSE2
+const YUVRowFuncs *getYUVRowFuncsSSE2();
+#endif
+
+#ifdef SCUMMVM_AVX2
+const YUVRowFuncs *getYUVRowFuncsAVX2();
+#endif
+
+#ifdef SCUMMVM_NEON
+const YUVRowFuncs *getYUVRowFuncsNEON();
+#endif
+
+} // End of namespace Graphics
+
+#endif
@@ -0,0 +1,269 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// This file is compiled with SSE2 enabled, it must only be called after checking the CPU supports it.
+
+#include "graphics/yuv_to_rgb_simd.h"
+
+#ifdef SCUMMVM_SSE2
+
+#include <emmintrin.h>
+
+namespace Graphics {
+
+enum {
+	kBlockSize = 16
+};
+
+// Where the kernels put the components in the pixels
+struct PixelLayout {
+	// 32 bit formats with 8 bit components are written a byte at a time, from the
+	// component at each position. The alpha byte is cleared when the format has none.
+	bool bytes;
+	int rPos, gPos, bPos, aPos;
+	bool hasAlpha;
+
+	// Other formats have their components shifted in 16 bit values, in the half of the
+	// pixels holding them for 32 bit formats.
+	__m128i rLoss, gLoss, bLoss, aLoss;
+	__m128i rShift, gShift, bShift, aShift;
+
+	PixelLayout(const YUVRowState &state) {
+		bytes = state.bytesPerPixel == 4 && state.rLoss == 0 && state.gLoss == 0 && state.bLoss == 0 &&
+		        (state.aLoss == 0 || state.aLoss == 8) && ((state.rShift | state.gShift | state.bShift | state.aShift) & 7) == 0;
+		rPos = state.rShift / 8;
+		gPos = state.gShift / 8;
+		bPos = state.bShift / 8;
+		hasAlpha = state.aLoss == 0;
+		aPos = hasAlpha ? state.aShift / 8 : 6 - rPos - gPos - bPos;
+
+		rLoss = _mm_cvtsi32_si128(state.rLoss);
+		gLoss = _mm_cvtsi32_si128(state.gLoss);
+		bLoss = _mm_cvtsi32_si128(state.bLoss);
+		aLoss = _mm_cvtsi32_si128(state.aLoss);
+		rShift = _mm_cvtsi32_si128(state.rShift & 15);
+		gShift = _mm_cvtsi32_si128(state.gShift & 15);
+		bShift = _mm_cvtsi32_si128(state.bShift & 15);
+		aShift = _mm_cvtsi32_si128(state.aShift & 15);
+	}
+};
+
+// What the chroma adds to the luminance for each component
+struct ChromaTerms {
+	__m128i r, g, b;
+};
+
+static inline __m128i multiply(__m128i c, __m128i sign, int shift, int mul) {
+	return _mm_sub_epi16(_mm_mulhi_epi16(_mm_sll_epi16(c, _mm_cvtsi32_si128(shift)), _mm_set1_epi16(mul)), sign);
+}
+
+// Computes the terms for the 8 samples of the 16 bit lanes of u and v
+static inline ChromaTerms getChromaTerms(__m128i u, __m128i v) {
+	__m128i cr = _mm_sub_epi16(v, _mm_set1_epi16(128));
+	__m128i cb = _mm_sub_epi16(u, _mm_set1_epi16(128));
+	__m128i crSign = _mm_srai_epi16(cr, 15);
+	__m128i cbSign = _mm_srai_epi16(cb, 15);
+
+	ChromaTerms terms;
+	terms.r = multiply(cr, crSign, kYUVCrRShift, kYUVCrRMul);
+	terms.g = _mm_sub_epi16(_mm_setzero_si128(), _mm_add_epi16(multiply(cr, crSign, kYUVCrGShift, kYUVCrGMul), multiply(cb, cbSign, kYUVCbGShift, kYUVCbGMul)));
+	terms.b = multiply(cb, cbSign, kYUVCbBShift, kYUVCbBMul);
+	return terms;
+}
+
+// The luminance values of the ITU scale have already been offset by -16. The
+// full scale values are left to be clamped when packed to bytes, if they are.
+static inline __m128i scaleLuminance(const YUVRowState &state, __m128i value, bool packed) {
+	if (state.itu) {
+		value = _mm_min_epi16(_mm_max_epi16(value, _mm_setzero_si128()), _mm_set1_epi16(219));
+		return _mm_mulhi_epu16(_mm_slli_epi16(value, 1), _mm_set1_epi16((short)kYUVITUMul));
+	}
+
+	if (packed)
+		return value;
+
+	return _mm_min_epi16(_mm_max_epi16(value, _mm_setzero_si128()), _mm_set1_epi16(255));
+}
+
+static inline __m128i place(__m128i value, __m128i loss, __m128i shift) {
+	return _mm_sll_epi16(_mm_srl_epi16(value, loss), shift);
+}
+
+// Writes 8 pixels with their components shifted in place
+template <int kBytesPerPixel>
+static inline void writeShiftedPixels(const YUVRowState &state, const PixelLayout &layout, byte *dst, __m128i y, const ChromaTerms &terms, __m128i a) {
+	__m128i r = place(scaleLuminance(state, _mm_add_epi16(y, terms.r), false), layout.rLoss, layout.rShift);
+	__m128i g = place(scaleLuminance(state, _mm_add_epi16(y, terms.g), false), layout.gLoss, layout.gShift);
+	__m128i b = place(scaleLuminance(state, _mm_add_epi16(y, terms.b), false), layout.bLoss, layout.bShift);
+	a = place(a, layout.aLoss, layout.aShift);
+
+	if (kBytesPerPixel == 2) {
+		_mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a)));
+	} else {
+		__m128i low = _mm_setzero_si128();
+		__m128i high = _mm_setzero_si128();
+		if (state.rShift < 16)
+			low = _mm_or_si128(low, r);
+		else
+			high = _mm_or_si128(high, r);
+		if (state.gShift < 16)
+			low = _mm_or_si128(low, g);
+		else
+			high = _mm_or_si128(high, g);
+		if (state.bShift < 16)
+			low = _mm_or_si128(low, b);
+		else
+			high = _mm_or_si128(high, b);
+		if (state.aShift < 16)
+			low = _mm_or_si128(low, a);
+		else
+			high = _mm_or_si128(high, a);
+		_mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi16(low, high));
+		_mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi16(low, high));
+	}
+}
+
+// Writes 16 pixels, from their luminance and alpha bytes and the chroma terms of each half of them
+template <int kBytesPerPixel>
+static inline void writePixels(const YUVRowState &state, const PixelLayout &layout, byte *dst, __m128i y, __m128i a, const ChromaTerms &low, const ChromaTerms &high) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i yOffset = _mm_set1_epi16(state.itu ? 16 : 0);
+	__m128i yLow = _mm_sub_epi16(_mm_unpacklo_epi8(y, zero), yOffset);
+	__m128i yHigh = _mm_sub_epi16(_mm_unpackhi_epi8(y, zero), yOffset);
+
+	if (kBytesPerPixel == 4 && layout.bytes) {
+		__m128i components[4];
+		components[layout.rPos] = _mm_packus_epi16(scaleLuminance(state, _mm_add_epi16(yLow, low.r), true), scaleLuminance(state, _mm_add_epi16(yHigh, high.r), true));
+		components[layout.gPos] = _mm_packus_epi16(scaleLuminance(state, _mm_add_epi16(yLow, low.g), true), scaleLuminance(state, _mm_add_epi16(yHigh, high.g), true));
+		components[layout.bPos] = _mm_packus_epi16(scaleLuminance(state, _mm_add_epi16(yLow, low.b), true), scaleLuminance(state, _mm_add_epi16(yHigh, high.b), true));
+		components[layout.aPos] = layout.hasAlpha ? a : zero;
+
+		__m128i low01 = _mm_unpacklo_epi8(components[0], components[1]);
+		__m128i high01 = _mm_unpackhi_epi8(components[0], components[1]);
+		__m128i low23 = _mm_unpacklo_epi8(components[2], components[3]);
+		__m128i high23 = _mm_unpackhi_epi8(components[2], components[3]);
+		_mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi16(low01, low23));
+		_mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi16(low01, low23));
+		_mm_storeu_si128((__m128i *)(dst + 32), _mm_unpacklo_epi16(high01, high23));
+		_mm_storeu_si128((__m128i *)(dst + 48), _mm_unpackhi_epi16(high01, high23));
+	} else {
+		writeShiftedPixels<kBytesPerPixel>(state, layout, dst, yLow, low, _mm_unpacklo_epi8(a, zero));
+		writeShiftedPixels<kBytesPerPixel>(state, layout, dst + 8 * kBytesPerPixel, yHigh, high, _mm_unpackhi_epi8(a, zero));
+	}
+}
+
+template <int kBytesPerPixel>
+static void convertRow(const YUVRowState &state, byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, int width) {
+	const PixelLayout layout(state);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alpha = _mm_set1_epi8((char)255);
+
+	int x = 0;
+	for (; x + kBlockSize <= width; x += kBlockSize) {
+		__m128i y = _mm_loadu_si128((const __m128i *)(ySrc + x));
+		__m128i u = _mm_loadu_si128((const __m128i *)(uSrc + x));
+		__m128i v = _mm_loadu_si128((const __m128i *)(vSrc + x));
+		ChromaTerms low = getChromaTerms(_mm_unpacklo_epi8(u, zero), _mm_unpacklo_epi8(v, zero));
+		ChromaTerms high = getChromaTerms(_mm_unpackhi_epi8(u, zero), _mm_unpackhi_epi8(v, zero));
+		writePixels<kBytesPerPixel>(state, layout, dst + x * kBytesPerPixel, y, alpha, low, high);
+	}
+
+	// Convert the last pixels from a copy of them, so that the blocks don't access anything past the row
+	int left = width - x;
+	if (left > 0) {
+		byte y[kBlockSize] = { 0 }, u[kBlockSize] = { 0 }, v[kBlockSize] = { 0 };
+		byte pixels[kBlockSize * kBytesPerPixel];
+		memcpy(y, ySrc + x, left);
+		memcpy(u, uSrc + x, left);
+		memcpy(v, vSrc + x, left);
+		convertRow<kBytesPerPixel>(state, pixels, y, u, v, kBlockSize);
+		memcpy(dst + x * kBytesPerPixel, pixels, left * kBytesPerPixel);
+	}
+}
+
+template <int kBytesPerPixel>
+static void convertRowPair(const YUVRowState &state, byte *dst, int dstPitch, const byte *ySrc, const byte *aSrc, int yPitch, const byte *uSrc, const byte *vSrc, int width) {
+	const PixelLayout layout(state);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alpha = _mm_set1_epi8((char)255);
+
+	// The chroma of 8 samples is computed once for the 16 pixels of both rows
+	int x = 0;
+	for (; x + kBlockSize <= width; x += kBlockSize) {
+		__m128i u = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(uSrc + x / 2)), zero);
+		__m128i v = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(vSrc + x / 2)), zero);
+		ChromaTerms terms = getChromaTerms(u, v);
+		ChromaTerms low, high;
+		low.r = _mm_unpacklo_epi16(terms.r, terms.r);
+		low.g = _mm_unpacklo_epi16(terms.g, terms.g);
+		low.b = _mm_unpacklo_epi16(terms.b, terms.b);
+		high.r = _mm_unpackhi_epi16(terms.r, terms.r);
+		high.g = _mm_unpackhi_epi16(terms.g, terms.g);
+		high.b = _mm_unpackhi_epi16(terms.b, terms.b);
+
+		for (int row = 0; row < 2; row++) {
+			__m128i y = _mm_loadu_si128((const __m128i *)(ySrc + row * yPitch + x));
+			__m128i a = aSrc ? _mm_loadu_si128((const __m128i *)(aSrc + row * yPitch + x)) : alpha;
+			writePixels<kBytesPerPixel>(state, layout, dst + row * dstPitch + x * kBytesPerPixel, y, a, low, high);
+		}
+	}
+
+	// Convert the last pixels from a copy of them, so that the blocks don't access anything past the rows
+	int left = width - x;
+	if (left > 0) {
+		byte y[2 * kBlockSize] = { 0 }, a[2 * kBlockSize] = { 0 }, u[kBlockSize / 2] = { 0 }, v[kBlockSize / 2] = { 0 };
+		byte pixels[2 * kBlockSize * kBytesPerPixel];
+		for (int row = 0; row < 2; row++) {
+			memcpy(y + row * kBlockSize, ySrc + row * yPitch + x, left);
+			if (aSrc)
+				memcpy(a + row * kBlockSize, aSrc + row * yPitch + x, left);
+		}
+		memcpy(u, uSrc + x / 2, (left + 1) / 2);
+		memcpy(v, vSrc + x / 2, (left + 1) / 2);
+		convertRowPair<kBytesPerPixel>(state, pixels, kBlockSize * kBytesPerPixel, y, aSrc ? a : 0, kBlockSize, u, v, kBlockSize);
+		for (int row = 0; row < 2; row++)
+			memcpy(dst + row * dstPitch + x * kBytesPerPixel, pixels + row * kBlockSize * kBytesPerPixel, left * kBytesPerPixel);
+	}
+}
+
+static void convertRow(const YUVRowState &state, byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, int width) {
+	if (state.bytesPerPixel == 2)
+		convertRow<2>(state, dst, ySrc, uSrc, vSrc, width);
+	else
+		convertRow<4>(state, dst, ySrc, uSrc, vSrc, width);
+}
+
+static void convertRowPair(const YUVRowState &state, byte *dst, int dstPitch, const byte *ySrc, const byte *aSrc, int yPitch, const byte *uSrc, const byte *vSrc, int width) {
+	if (state.bytesPerPixel == 2)
+		convertRowPair<2>(state, dst, dstPitch, ySrc, aSrc, yPitch, uSrc, vSrc, width);
+	else
+		convertRowPair<4>(state, dst, dstPitch, ySrc, aSrc, yPitch, uSrc, vSrc, width);
+}
+
+const YUVRowFuncs *getYUVRowFuncsSSE2() {
+	static const YUVRowFuncs funcs = { convertRow, convertRowPair };
+	return &funcs;
+}
+
+} // End of namespace Graphics
+
+#endif // SCUMMVM_SSE2
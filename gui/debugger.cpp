@@ -26,6 +26,7 @@
 #include "common/debug.h"
 #include "common/debug-channels.h"
 #include "common/system.h"
+#include "common/timer.h"
 
 #ifndef DISABLE_MD5
 #include "common/md5.h"
@@ -77,6 +78,8 @@ Debugger::Debugger() {
 	registerCmd("debugflag_list",		WRAP_METHOD(Debugger, cmdDebugFlagsList));
 	registerCmd("debugflag_enable",	WRAP_METHOD(Debugger, cmdDebugFlagEnable));
 	registerCmd("debugflag_disable",	WRAP_METHOD(Debugger, cmdDebugFlagDisable));
+
+	registerCmd("timers",			WRAP_METHOD(Debugger, cmdTimers));
 }
 
 Debugger::~Debugger() {
@@ -780,6 +783,53 @@ bool Debugger::cmdDebugFlagDisable(int argc, const char **argv) {
 	return true;
 }
 
+static void printTimerHistogram(Debugger *debugger, const char *name, const uint32 *histogram) {
+	Common::String line = Common::String::format("  %s:", name);
+	for (uint i = 0; i < Common::TimerManager::TimerStats::kHistogramBuckets; i++) {
+		if (!histogram[i])
+			continue;
+		if (i == Common::TimerManager::TimerStats::kHistogramBuckets - 1)
+			line += Common::String::format(" >=%uus %u", 1u << (i - 1), histogram[i]);
+		else
+			line += Common::String::format(" <%uus %u", 1u << i, histogram[i]);
+	}
+	debugger->debugPrintf("%s\n", line.c_str());
+}
+
+bool Debugger::cmdTimers(int argc, const char **argv) {
+	Common::TimerManager *timerManager = g_system->getTimerManager();
+
+	if (argc >= 2 && !scumm_stricmp(argv[1], "reset")) {
+		timerManager->resetTimerStats();
+		debugPrintf("Reset the timer statistics\n");
+		return true;
+	} else if (argc >= 2) {
+		debugPrintf("timers [reset]\n");
+		return true;
+	}
+
+	Common::Array<Common::TimerManager::TimerStats> stats;
+	timerManager->getTimerStats(stats);
+	if (stats.empty()) {
+		debugPrintf("No timer statistics\n");
+		return true;
+	}
+
+	for (uint i = 0; i < stats.size(); i++) {
+		const Common::TimerManager::TimerStats &timer = stats[i];
+		if (!timer.calls) {
+			debugPrintf("%s: no calls\n", timer.id.c_str());
+			continue;
+		}
+		debugPrintf("%s: %u calls, lateness avg %uus max %uus, duration avg %uus max %uus\n", timer.id.c_str(), timer.calls,
+		            (uint32)(timer.totalLateness / timer.calls), timer.maxLateness,
+		            (uint32)(timer.totalDuration / timer.calls), timer.maxDuration);
+		printTimerHistogram(this, "lateness", timer.latenessHistogram);
+		printTimerHistogram(this, "duration", timer.durationHistogram);
+	}
+	return true;
+}
+
 // Console handler
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
 bool Debugger::debuggerInputCallback(GUI::ConsoleDialog *console, const char *input, void *refCon) {
@@ -0,0 +1,76 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/decodeahead.h"
+
+class DecodeAheadTestSuite : public CxxTest::TestSuite
+{
+private:
+	void write(Audio::DecodeAheadRing &ring, int16 first, uint32 count) {
+		while (count > 0) {
+			uint32 written = count;
+			int16 *buffer = ring.getWriteBuffer(written);
+			TS_ASSERT(written > 0);
+			for (uint32 i = 0; i < written; i++)
+				buffer[i] = first++;
+			ring.commitWrite(written);
+			count -= written;
+		}
+	}
+
+public:
+	void test_read_write() {
+		Audio::DecodeAheadRing ring(16);
+		int16 samples[16];
+
+		TS_ASSERT(ring.isEmpty());
+		TS_ASSERT_EQUALS(ring.getFreeSpace(), 16U);
+
+		// Wrap around the end of the ring a few times
+		int16 next = 0;
+		for (int i = 0; i < 5; i++) {
+			write(ring, next, 12);
+			TS_ASSERT_EQUALS(ring.getFreeSpace(), 4U);
+			TS_ASSERT_EQUALS(ring.read(samples, 16), 12);
+			for (int j = 0; j < 12; j++)
+				TS_ASSERT_EQUALS(samples[j], next + j);
+			next += 12;
+		}
+		TS_ASSERT(ring.isEmpty());
+	}
+
+	void test_drop() {
+		Audio::DecodeAheadRing ring(16);
+		int16 samples[16];
+
+		write(ring, 0, 10);
+		TS_ASSERT_EQUALS(ring.read(samples, 4), 4);
+
+		// Nothing is written until the reader has dropped the samples
+		ring.drop();
+		TS_ASSERT(ring.isEmpty());
+		TS_ASSERT_EQUALS(ring.getFreeSpace(), 0U);
+
+		TS_ASSERT_EQUALS(ring.read(samples, 16), 0);
+		TS_ASSERT(ring.isEmpty());
+		TS_ASSERT_EQUALS(ring.getFreeSpace(), 16U);
+
+		write(ring, 100, 6);
+		TS_ASSERT_EQUALS(ring.read(samples, 16), 6);
+		for (int i = 0; i < 6; i++)
+			TS_ASSERT_EQUALS(samples[i], 100 + i);
+	}
+
+	void test_drop_twice() {
+		Audio::DecodeAheadRing ring(16);
+		int16 samples[16];
+
+		write(ring, 0, 8);
+		ring.drop();
+		ring.drop();
+		TS_ASSERT_EQUALS(ring.read(samples, 16), 0);
+
+		write(ring, 50, 3);
+		TS_ASSERT_EQUALS(ring.read(samples, 16), 3);
+		TS_ASSERT_EQUALS(samples[0], 50);
+	}
+};
@@ -0,0 +1,133 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/audiostream.h"
+#include "audio/mixbus.h"
+#include "audio/mixer.h"
+#include "audio/rate.h"
+#include "audio/decoders/raw.h"
+
+#include "common/memstream.h"
+
+#include "helper.h"
+
+class MixBusTestSuite : public CxxTest::TestSuite
+{
+private:
+	// Mono stream holding the same sample value repeatedly
+	static Audio::AudioStream *createConstantStream(int16 value, int samples) {
+		int16 *data = (int16 *)malloc(samples * sizeof(int16));
+		for (int i = 0; i < samples; ++i)
+			data[i] = value;
+		Common::SeekableReadStream *stream = new Common::MemoryReadStream((const byte *)data, samples * sizeof(int16), DisposeAfterUse::YES);
+		return Audio::makeRawStream(stream, 22050, Audio::FLAG_16BITS | Audio::FLAG_LITTLE_ENDIAN);
+	}
+
+	// At full volume, mixing a single stream through the bus gives the same samples as the int16 output
+	void compareOutputs(int inRate, int outRate, bool stereo, bool reverseStereo) {
+		const int frames = 4000;
+		Audio::RateConverter *converter16 = Audio::makeRateConverter(inRate, outRate, stereo, reverseStereo);
+		Audio::RateConverter *converter32 = Audio::makeRateConverter(inRate, outRate, stereo, reverseStereo);
+		Audio::SeekableAudioStream *stream16 = createSineStream<int16>(inRate, 1, 0, true, stereo);
+		Audio::SeekableAudioStream *stream32 = createSineStream<int16>(inRate, 1, 0, true, stereo);
+
+		int16 *output16 = new int16[frames * 2];
+		int16 *output32 = new int16[frames * 2];
+		int32 *bus = new int32[frames * 2];
+		memset(output16, 0, frames * 2 * sizeof(int16));
+		memset(bus, 0, frames * 2 * sizeof(int32));
+
+		const int max = Audio::Mixer::kMaxMixerVolume;
+		TS_ASSERT_EQUALS(converter16->flow(*stream16, output16, frames, max, max), frames);
+		TS_ASSERT_EQUALS(converter32->flow(*stream32, bus, frames, max, max), frames);
+		Audio::selectMixBusFuncs()->resolve(output32, bus, frames * 2);
+		TS_ASSERT_EQUALS(memcmp(output16, output32, frames * 2 * sizeof(int16)), 0);
+
+		delete[] output16;
+		delete[] output32;
+		delete[] bus;
+		delete stream16;
+		delete stream32;
+		delete converter16;
+		delete converter32;
+	}
+
+public:
+	void test_copy_matches_int16_output() {
+		compareOutputs(22050, 22050, true, false);
+		compareOutputs(22050, 22050, false, false);
+	}
+
+	void test_simple_matches_int16_output() {
+		compareOutputs(44100, 22050, true, true);
+		compareOutputs(44100, 22050, false, false);
+	}
+
+	void test_linear_matches_int16_output() {
+		compareOutputs(11025, 44100, true, false);
+		compareOutputs(22050, 48000, false, false);
+	}
+
+	void test_clamps_once() {
+		// Two loud channels clip when added, a third one brings their sum back in range
+		const int16 values[] = { 20000, 20000, -20000 };
+		const int frames = 100;
+		int32 bus[frames * 2];
+		int16 output[frames * 2];
+		memset(bus, 0, sizeof(bus));
+
+		for (int i = 0; i < ARRAYSIZE(values); ++i) {
+			Audio::AudioStream *stream = createConstantStream(values[i], frames);
+			Audio::RateConverter *converter = Audio::makeRateConverter(22050, 22050, false);
+			TS_ASSERT_EQUALS(converter->flow(*stream, bus, frames, Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume), frames);
+			delete converter;
+			delete stream;
+		}
+		Audio::selectMixBusFuncs()->resolve(output, bus, frames * 2);
+
+		for (int i = 0; i < frames * 2; ++i)
+			TS_ASSERT_EQUALS(output[i], 20000);
+	}
+
+	void test_kernels() {
+		// Odd counts, so that the kernels go through the samples they don't process several at a time
+		const int frames = 37;
+		int16 samples[frames * 2];
+		int32 bus[frames * 2], expected[frames * 2];
+		for (int i = 0; i < frames * 2; ++i)
+			samples[i] = (i * 7919) % 65536 - 32768;
+
+		const Audio::MixBusFuncs *funcs = Audio::selectMixBusFuncs();
+
+		memset(bus, 0, sizeof(bus));
+		funcs->mixMono(bus, samples, frames, 200, 56);
+		for (int i = 0; i < frames; ++i) {
+			expected[i * 2] = samples[i] * 200;
+			expected[i * 2 + 1] = samples[i] * 56;
+		}
+		TS_ASSERT_EQUALS(memcmp(bus, expected, sizeof(bus)), 0);
+
+		memset(bus, 0, sizeof(bus));
+		funcs->mixStereo(bus, samples, frames, 256, 3, false);
+		for (int i = 0; i < frames; ++i) {
+			expected[i * 2] = samples[i * 2] * 256;
+			expected[i * 2 + 1] = samples[i * 2 + 1] * 3;
+		}
+		TS_ASSERT_EQUALS(memcmp(bus, expected, sizeof(bus)), 0);
+
+		memset(bus, 0, sizeof(bus));
+		funcs->mixStereo(bus, samples, frames, 256, 3, true);
+		for (int i = 0; i < frames; ++i) {
+			expected[i * 2] = samples[i * 2 + 1] * 3;
+			expected[i * 2 + 1] = samples[i * 2] * 256;
+		}
+		TS_ASSERT_EQUALS(memcmp(bus, expected, sizeof(bus)), 0);
+
+		// Rounding and clamping
+		const int32 values[] = { 127, 128, -128, -129, 40000 * 256, -40000 * 256, 1000 * 256 + 200, -1000 * 256 - 200, 0 };
+		const int16 results[] = { 0, 1, 0, -1, 32767, -32768, 1001, -1001, 0 };
+		int16 output[ARRAYSIZE(values)];
+		funcs->resolve(output, values, ARRAYSIZE(values));
+		for (int i = 0; i < ARRAYSIZE(values); ++i)
+			TS_ASSERT_EQUALS(output[i], results[i]);
+	}
+};
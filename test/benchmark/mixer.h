@@ -0,0 +1,93 @@
+// Timings are measured with clock(), since there is no OSystem to ask.
+#define FORBIDDEN_SYMBOL_EXCEPTION_clock
+
+#include <cxxtest/TestSuite.h>
+
+#include <time.h>
+
+#include "audio/audiostream.h"
+#include "audio/mixbus.h"
+#include "audio/mixer.h"
+#include "audio/rate.h"
+#include "audio/decoders/raw.h"
+#include "common/memstream.h"
+#include "common/str.h"
+
+/**
+ * Mixes 32 looping channels with various rates, with the rate converters
+ * adding each channel to the int16 output and clamping it, and with them
+ * adding the channels to the mixing bus, which is clamped once at the end.
+ */
+class MixerBenchmarkSuite : public CxxTest::TestSuite {
+public:
+	void test_32_channels() {
+		double busTime = mix(true);
+		double int16Time = mix(false);
+
+		double frames = (double)kFrames * kCallbacks;
+		Common::String result = Common::String::format("Mixing bus: %.2f ns/frame, int16 output: %.2f ns/frame",
+		                                               busTime * 1e9 / frames, int16Time * 1e9 / frames);
+		TS_TRACE(result.c_str());
+	}
+
+private:
+	enum {
+		kChannels = 32,
+		kOutputRate = 44100,
+		kFrames = 2048,
+		kCallbacks = 500
+	};
+
+	static Audio::AudioStream *createStream(int rate, bool stereo) {
+		const int samples = rate * (stereo ? 2 : 1);
+		int16 *data = (int16 *)malloc(samples * sizeof(int16));
+		for (int i = 0; i < samples; i++)
+			data[i] = (int16)(((uint32)i * 1103515245 + 12345) >> 16);
+
+		Common::SeekableReadStream *memory = new Common::MemoryReadStream((const byte *)data, samples * sizeof(int16), DisposeAfterUse::YES);
+		Audio::SeekableAudioStream *raw = Audio::makeRawStream(memory, rate, Audio::FLAG_16BITS | (stereo ? Audio::FLAG_STEREO : 0));
+		return Audio::makeLoopingAudioStream(raw, 0);
+	}
+
+	// Returns the time spent mixing
+	double mix(bool bus) {
+		// Copies and interpolations, in mono and stereo
+		static const int rates[] = { 44100, 88200, 22050, 11025, 48000, 32000 };
+
+		Audio::AudioStream *streams[kChannels];
+		Audio::RateConverter *converters[kChannels];
+		for (int i = 0; i < kChannels; i++) {
+			int rate = rates[i % ARRAYSIZE(rates)];
+			bool stereo = (i / ARRAYSIZE(rates)) & 1;
+			streams[i] = createStream(rate, stereo);
+			converters[i] = Audio::makeRateConverter(rate, kOutputRate, stereo, i == 7);
+		}
+
+		const Audio::MixBusFuncs *funcs = Audio::selectMixBusFuncs();
+		int16 *output = new int16[kFrames * 2];
+		int32 *mixBus = new int32[kFrames * 2];
+
+		clock_t start = clock();
+		for (int callback = 0; callback < kCallbacks; callback++) {
+			if (bus) {
+				memset(mixBus, 0, kFrames * 2 * sizeof(int32));
+				for (int i = 0; i < kChannels; i++)
+					converters[i]->flow(*streams[i], mixBus, kFrames, 100 + i, 200 - i);
+				funcs->resolve(output, mixBus, kFrames * 2);
+			} else {
+				memset(output, 0, kFrames * 2 * sizeof(int16));
+				for (int i = 0; i < kChannels; i++)
+					converters[i]->flow(*streams[i], output, kFrames, 100 + i, 200 - i);
+			}
+		}
+		double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+		for (int i = 0; i < kChannels; i++) {
+			delete converters[i];
+			delete streams[i];
+		}
+		delete[] output;
+		delete[] mixBus;
+		return elapsed;
+	}
+};
@@ -0,0 +1,159 @@
+// Timings are measured with clock(), since there is no OSystem to ask.
+#define FORBIDDEN_SYMBOL_EXCEPTION_clock
+
+#include <cxxtest/TestSuite.h>
+
+#include <time.h>
+
+#include "common/str.h"
+#include "graphics/pixelbuffer.h"
+#include "graphics/tinygl/zgl.h"
+#include "graphics/tinygl/zspan.h"
+
+/**
+ * Renders the same scene with the frame buffer formats the rasterizer has
+ * specialized code for, and with generic formats of the same depth, which
+ * only differ by the order of their channels. Also compares the SIMD span
+ * kernels with the per pixel code, when the CPU has them.
+ */
+class TinyGLBenchmarkSuite : public CxxTest::TestSuite {
+public:
+	void test_rgba8888() {
+		compareFormats(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24), "RGBA8888");
+	}
+
+	void test_xrgb8888() {
+		compareFormats(Graphics::PixelFormat(4, 8, 8, 8, 0, 16, 8, 0, 0), Graphics::PixelFormat(4, 8, 8, 8, 0, 0, 8, 16, 0), "XRGB8888");
+	}
+
+	void test_rgb565() {
+		compareFormats(Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0), Graphics::PixelFormat(2, 5, 6, 5, 0, 0, 5, 11, 0), "RGB565");
+	}
+
+	void test_span_kernels() {
+		if (!TinyGL::selectSpanFuncs()) {
+			TS_TRACE("No span kernels for this CPU");
+			return;
+		}
+		Graphics::PixelFormat format(4, 8, 8, 8, 8, 24, 16, 8, 0);
+		uint32 *simdPixels = new uint32[kWidth * kHeight];
+		uint32 *scalarPixels = new uint32[kWidth * kHeight];
+		double simdTime = render(format, simdPixels, true);
+		double scalarTime = render(format, scalarPixels, false);
+
+		double pixels = (double)kWidth * kHeight * kFrames;
+		Common::String result = Common::String::format("Span kernels: %.2f ns/pixel, per pixel code: %.2f ns/pixel",
+		                                               simdTime * 1e9 / pixels, scalarTime * 1e9 / pixels);
+		TS_TRACE(result.c_str());
+
+		TS_ASSERT_SAME_DATA(simdPixels, scalarPixels, kWidth * kHeight * sizeof(uint32));
+		delete[] simdPixels;
+		delete[] scalarPixels;
+	}
+
+private:
+	enum {
+		kWidth = 640,
+		kHeight = 480,
+		kTextureSize = 64,
+		kFrames = 50
+	};
+
+	void compareFormats(const Graphics::PixelFormat &specialized, const Graphics::PixelFormat &generic, const char *name) {
+		uint32 *specializedPixels = new uint32[kWidth * kHeight];
+		uint32 *genericPixels = new uint32[kWidth * kHeight];
+		double specializedTime = render(specialized, specializedPixels);
+		double genericTime = render(generic, genericPixels);
+
+		double pixels = (double)kWidth * kHeight * kFrames;
+		Common::String result = Common::String::format("%s: %.2f ns/pixel, generic path: %.2f ns/pixel", name,
+		                                               specializedTime * 1e9 / pixels, genericTime * 1e9 / pixels);
+		TS_TRACE(result.c_str());
+
+		TS_ASSERT_SAME_DATA(specializedPixels, genericPixels, kWidth * kHeight * sizeof(uint32));
+		delete[] specializedPixels;
+		delete[] genericPixels;
+	}
+
+	// Returns the time spent rendering, and the ARGB pixels of the last frame
+	double render(const Graphics::PixelFormat &format, uint32 *pixels, bool spanKernels = true) {
+		TinyGL::FrameBuffer *frameBuffer = new TinyGL::FrameBuffer(kWidth, kHeight, format);
+		TinyGL::glInit(frameBuffer, 256);
+		if (!spanKernels)
+			frameBuffer->_spanFuncs = NULL;
+
+		byte *texels = new byte[kTextureSize * kTextureSize * 4];
+		for (int i = 0; i < kTextureSize * kTextureSize; i++) {
+			texels[i * 4 + 0] = i * 3;
+			texels[i * 4 + 1] = i * 5;
+			texels[i * 4 + 2] = i * 7;
+			texels[i * 4 + 3] = 128 + (i & 127);
+		}
+		TGLuint texture;
+		tglGenTextures(1, &texture);
+		tglBindTexture(TGL_TEXTURE_2D, texture);
+		tglTexImage2D(TGL_TEXTURE_2D, 0, 3, kTextureSize, kTextureSize, 0, TGL_RGBA, TGL_UNSIGNED_BYTE, texels);
+		delete[] texels;
+
+		clock_t start = clock();
+		for (int frame = 0; frame < kFrames; frame++) {
+			drawFrame();
+		}
+		double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+		Graphics::PixelBuffer buffer(format, frameBuffer->getPixelBuffer());
+		for (int i = 0; i < kWidth * kHeight; i++) {
+			byte a, r, g, b;
+			buffer.getARGBAt(i, a, r, g, b);
+			pixels[i] = (a << 24) | (r << 16) | (g << 8) | b;
+		}
+
+		tglDeleteTextures(1, &texture);
+		TinyGL::glClose();
+		delete frameBuffer;
+		return elapsed;
+	}
+
+	// Full screen layers of smooth shaded, blended and textured quads
+	void drawFrame() {
+		tglClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+		tglClear(TGL_COLOR_BUFFER_BIT | TGL_DEPTH_BUFFER_BIT);
+		tglMatrixMode(TGL_PROJECTION);
+		tglLoadIdentity();
+		tglMatrixMode(TGL_MODELVIEW);
+		tglLoadIdentity();
+		tglEnable(TGL_DEPTH_TEST);
+		tglDepthFunc(TGL_LEQUAL);
+		tglShadeModel(TGL_SMOOTH);
+		tglBlendFunc(TGL_SRC_ALPHA, TGL_ONE_MINUS_SRC_ALPHA);
+
+		for (int layer = 0; layer < 4; layer++) {
+			if (layer & 1)
+				tglEnable(TGL_BLEND);
+			else
+				tglDisable(TGL_BLEND);
+			if (layer & 2)
+				tglEnable(TGL_TEXTURE_2D);
+			else
+				tglDisable(TGL_TEXTURE_2D);
+
+			float z = 0.5f - layer * 0.25f;
+			tglBegin(TGL_QUADS);
+			tglColor4f(1.0f, 0.2f, 0.2f, 0.5f);
+			tglTexCoord2f(0.0f, 0.0f);
+			tglVertex3f(-1.0f, -1.0f, z);
+			tglColor4f(0.2f, 1.0f, 0.2f, 0.7f);
+			tglTexCoord2f(4.0f, 0.0f);
+			tglVertex3f(1.0f, -1.0f, z);
+			tglColor4f(0.2f, 0.2f, 1.0f, 0.9f);
+			tglTexCoord2f(4.0f, 4.0f);
+			tglVertex3f(1.0f, 1.0f, z);
+			tglColor4f(1.0f, 1.0f, 1.0f, 0.3f);
+			tglTexCoord2f(0.0f, 4.0f);
+			tglVertex3f(-1.0f, 1.0f, z);
+			tglEnd();
+		}
+
+		TinyGL::tglPresentBuffer();
+	}
+};
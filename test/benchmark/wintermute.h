@@ -0,0 +1,194 @@
+// Timings are measured with clock(), since the OSystem below has no real clock.
+#define FORBIDDEN_SYMBOL_EXCEPTION_clock
+
+#include <cxxtest/TestSuite.h>
+
+#include <time.h>
+
+#include "common/archive.h"
+#include "common/fs.h"
+#include "common/str.h"
+#include "common/system.h"
+#include "common/util.h"
+#include "graphics/pixelformat.h"
+#include "engines/wintermute/ad/ad_actor.h"
+#include "engines/wintermute/ad/ad_game.h"
+#include "engines/wintermute/ad/ad_scene.h"
+#include "engines/wintermute/base/base_engine.h"
+#include "engines/wintermute/base/scriptables/script_stack.h"
+
+#if defined(POSIX)
+#include "backends/fs/posix/posix-fs-factory.h"
+#endif
+
+/**
+ * Just enough of an OSystem for the Wintermute engine to create its game
+ * objects: a clock, and the files of the engine data directory.
+ */
+class WintermuteBenchmarkSystem : public OSystem {
+public:
+	WintermuteBenchmarkSystem() {
+#if defined(POSIX)
+		_fsFactory = new POSIXFilesystemFactory();
+#endif
+	}
+
+	Graphics::PixelFormat getScreenFormat() const override { return Graphics::PixelFormat::createFormatCLUT8(); }
+	Common::List<Graphics::PixelFormat> getSupportedFormats() const override { return Common::List<Graphics::PixelFormat>(); }
+	void initSize(uint width, uint height, const Graphics::PixelFormat *format) override {}
+	int16 getHeight() override { return 0; }
+	int16 getWidth() override { return 0; }
+	PaletteManager *getPaletteManager() override { return nullptr; }
+	void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) override {}
+	Graphics::Surface *lockScreen() override { return nullptr; }
+	void unlockScreen() override {}
+	void fillScreen(uint32 col) override {}
+	void updateScreen() override {}
+	void setShakePos(int shakeXOffset, int shakeYOffset) override {}
+	void showOverlay() override {}
+	void hideOverlay() override {}
+	bool isOverlayVisible() const override { return false; }
+	Graphics::PixelFormat getOverlayFormat() const override { return Graphics::PixelFormat::createFormatCLUT8(); }
+	void clearOverlay() override {}
+	void grabOverlay(void *buf, int pitch) override {}
+	void copyRectToOverlay(const void *buf, int pitch, int x, int y, int w, int h) override {}
+	int16 getOverlayHeight() override { return 0; }
+	int16 getOverlayWidth() override { return 0; }
+	bool showMouse(bool visible) override { return false; }
+	void warpMouse(int x, int y) override {}
+	void setMouseCursor(const void *buf, uint w, uint h, int hotspotX, int hotspotY, uint32 keycolor, bool dontScale, const Graphics::PixelFormat *format) override {}
+	uint32 getMillis(bool skipRecord) override { return (uint32)(clock() * 1000.0 / CLOCKS_PER_SEC); }
+	void delayMillis(uint msecs) override {}
+	void getTimeAndDate(TimeDate &t) const override { memset(&t, 0, sizeof(t)); }
+	MutexRef createMutex() override { return nullptr; }
+	void lockMutex(MutexRef mutex) override {}
+	void unlockMutex(MutexRef mutex) override {}
+	void deleteMutex(MutexRef mutex) override {}
+	Audio::Mixer *getMixer() override { return nullptr; }
+	void quit() override {}
+	void displayMessageOnOSD(const Common::U32String &msg) override {}
+	void displayActivityIconOnOSD(const Graphics::Surface *icon) override {}
+	void logMessage(LogMessageType::Type type, const char *message) override {}
+
+	// The game writes the configuration when it is destroyed
+	Common::WriteStream *createConfigWriteStream() override { return nullptr; }
+};
+
+/**
+ * Looks up the members of the Game, of its scene and of an actor, as the
+ * scripts do every frame, through the scGetProperty and scCallMethod of
+ * the real scriptables. The names include members of the parent classes,
+ * which the lookups pass on, and a name no class knows.
+ */
+class WintermuteBenchmarkSuite : public CxxTest::TestSuite {
+public:
+	void setUp() {
+		g_system = &_system;
+		SearchMan.addDirectory("engine-data", Common::FSNode(BENCHMARK_ENGINE_DATA));
+		Wintermute::BaseEngine::createInstance("benchmark", "benchmark", Common::EN_ANY, Wintermute::LATEST_VERSION, 0);
+
+		_game = new Wintermute::AdGame("benchmark");
+		_stack = new Wintermute::ScStack(_game);
+	}
+
+	void tearDown() {
+		delete _stack;
+		delete _game;
+
+		Wintermute::BaseEngine::destroy();
+		SearchMan.remove("engine-data");
+		g_system = nullptr;
+	}
+
+	void test_game_properties() {
+		static const char *const names[] = {
+			// AdGame
+			"Type", "Scene", "SelectedItem", "NumItems", "SmartItemCursor", "InventoryVisible",
+			"ResponsesVisible", "PrevScene", "InventoryObject", "TotalNumItems", "TalkSkipButton", "ChangingScene",
+			// BaseGame
+			"Name", "CurrentTime", "MouseX", "MouseY", "MainObject", "ActiveObject", "Interactive", "DebugMode",
+			"Subtitles", "SubtitlesSpeed", "VideoSubtitles", "FPS", "TextEncoding", "TextRTL", "SoundBufferSize",
+			"SuspendedRendering", "SuppressScriptErrors", "Frozen", "AutorunDisabled", "AutoSaveOnExit",
+			"AutoSaveSlot", "CursorHidden",
+			// BaseObject
+			"Caption", "X", "Y", "Movable", "Scale", "AlphaColor",
+			"Unknown"
+		};
+
+		int found = 0;
+		clock_t start = clock();
+		for (int round = 0; round < kRounds; round++) {
+			for (uint i = 0; i < ARRAYSIZE(names); i++) {
+				if (_game->scGetProperty(names[i]))
+					found++;
+			}
+		}
+		report("Game properties", start, ARRAYSIZE(names));
+
+		// All but the unknown name
+		TS_ASSERT_EQUALS(found, (int)(ARRAYSIZE(names) - 1) * kRounds);
+	}
+
+	void test_scene_methods() {
+		static const char *const names[] = {
+			// AdScene
+			"GetLayer", "GetWaypointGroup", "GetNode", "GetFreeNode", "GetRegionAt", "IsBlockedAt",
+			"IsWalkableAt", "GetScaleAt", "GetRotationAt", "IsScrolling", "GetFadeColor",
+			// BaseObject and BaseScriptHolder
+			"GetCursor", "HasCursor", "IsSoundPlaying", "GetSoundVolume", "CanHandleEvent", "IsScriptRunning",
+			"Unknown"
+		};
+		callMethods("Scene methods", _game->_scene, names, ARRAYSIZE(names));
+	}
+
+	void test_actor_methods() {
+		static const char *const names[] = {
+			// AdActor
+			"IsWalking", "HasAnim",
+			// AdTalkHolder and AdObject
+			"GetSprite", "GetSpriteObject", "IsTalking", "GetFont", "GetAttachment",
+			// BaseObject and BaseScriptHolder
+			"GetCursor", "HasCursor", "IsSoundPlaying", "GetSoundPosition", "GetSoundVolume",
+			"GetShadowImage", "CanHandleEvent", "CanHandleMethod", "IsScriptRunning",
+			"Unknown"
+		};
+
+		Wintermute::AdActor *actor = new Wintermute::AdActor(_game);
+		callMethods("Actor methods", actor, names, ARRAYSIZE(names));
+		delete actor;
+	}
+
+private:
+	enum {
+		kRounds = 20000
+	};
+
+	WintermuteBenchmarkSystem _system;
+	Wintermute::AdGame *_game;
+	Wintermute::ScStack *_stack;
+
+	// Calls the methods without parameters, as the scripts do
+	void callMethods(const char *what, Wintermute::BaseScriptable *object, const char *const *names, int count) {
+		int found = 0;
+		clock_t start = clock();
+		for (int round = 0; round < kRounds; round++) {
+			for (int i = 0; i < count; i++) {
+				_stack->pushInt(0);
+				if (DID_SUCCEED(object->scCallMethod(nullptr, _stack, nullptr, names[i])))
+					found++;
+				// The return value, or the parameter count the unknown methods leave
+				_stack->pop();
+			}
+		}
+		report(what, start, count);
+
+		TS_ASSERT_EQUALS(found, (count - 1) * kRounds);
+		TS_ASSERT_EQUALS(_stack->_sP, -1);
+	}
+
+	void report(const char *what, clock_t start, int count) {
+		double time = (double)(clock() - start) / CLOCKS_PER_SEC;
+		Common::String result = Common::String::format("%s: %.2f ns/lookup", what, time * 1e9 / ((double)count * kRounds));
+		TS_TRACE(result.c_str());
+	}
+};
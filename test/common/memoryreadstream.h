@@ -104,4 +104,51 @@ class MemoryReadStreamTestSuite : public CxxTest::TestSuite {
 		ms.seek(0, SEEK_SET);
 		TS_ASSERT(!ms.eos());
 	}
+
+	struct CountedOwner : public Common::SharedMemoryReadStream::Owner {
+		CountedOwner(int *deleted) : _deleted(deleted) {}
+		~CountedOwner() { (*_deleted)++; }
+		int *_deleted;
+	};
+
+	void test_shared_ranges() {
+		byte contents[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+		int deleted = 0;
+		Common::SharedMemoryReadStream *ms = new Common::SharedMemoryReadStream(new CountedOwner(&deleted), contents, sizeof(contents));
+
+		Common::SharedMemoryReadStream *range = ms->createRangeStream(2, 6);
+		Common::SharedMemoryReadStream *subRange = range->createRangeStream(1, 3);
+		delete ms;
+
+		TS_ASSERT_EQUALS(range->size(), 4);
+		TS_ASSERT_EQUALS(range->getData(), contents + 2);
+		TS_ASSERT_EQUALS(range->readUint32BE(), 0x03040506UL);
+		range->readByte();
+		TS_ASSERT(range->eos());
+		delete range;
+
+		TS_ASSERT_EQUALS(deleted, 0);
+		TS_ASSERT_EQUALS(subRange->size(), 2);
+		TS_ASSERT_EQUALS(subRange->readUint16BE(), 0x0405UL);
+		delete subRange;
+		TS_ASSERT_EQUALS(deleted, 1);
+	}
+
+	void test_shared_range_out_of_bounds() {
+		byte contents[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+		int deleted = 0;
+		Common::SharedMemoryReadStream *ms = new Common::SharedMemoryReadStream(new CountedOwner(&deleted), contents, sizeof(contents));
+
+		Common::SharedMemoryReadStream *range = ms->createRangeStream(6, 12);
+		TS_ASSERT_EQUALS(range->size(), 2);
+		TS_ASSERT_EQUALS(range->getData(), contents + 6);
+
+		Common::SharedMemoryReadStream *empty = ms->createRangeStream(10, 12);
+		TS_ASSERT_EQUALS(empty->size(), 0);
+
+		delete ms;
+		delete range;
+		delete empty;
+		TS_ASSERT_EQUALS(deleted, 1);
+	}
 };
@@ -0,0 +1,106 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/archive.h"
+#include "common/memstream.h"
+
+// An archive whose members contain their own name and the name of the archive
+class NamedMembersArchive : public Common::Archive {
+public:
+	NamedMembersArchive(const char *archiveName, const char *const *members) : _archiveName(archiveName), _probes(0) {
+		for (; *members; members++)
+			_members.push_back(*members);
+	}
+
+	bool hasFile(const Common::String &name) const override {
+		_probes++;
+		for (Common::List<Common::String>::const_iterator it = _members.begin(); it != _members.end(); ++it) {
+			if (it->equalsIgnoreCase(name))
+				return true;
+		}
+		return false;
+	}
+
+	int listMembers(Common::ArchiveMemberList &list) const override {
+		for (Common::List<Common::String>::const_iterator it = _members.begin(); it != _members.end(); ++it)
+			list.push_back(Common::ArchiveMemberPtr(new Common::GenericArchiveMember(*it, this)));
+		return _members.size();
+	}
+
+	const Common::ArchiveMemberPtr getMember(const Common::String &name) const override {
+		if (!hasFile(name))
+			return Common::ArchiveMemberPtr();
+		return Common::ArchiveMemberPtr(new Common::GenericArchiveMember(name, this));
+	}
+
+	Common::SeekableReadStream *createReadStreamForMember(const Common::String &name) const override {
+		if (!hasFile(name))
+			return nullptr;
+		return new Common::MemoryReadStream((const byte *)_archiveName, strlen(_archiveName));
+	}
+
+	const char *_archiveName;
+	Common::List<Common::String> _members;
+	mutable int _probes;
+};
+
+class SearchSetTestSuite : public CxxTest::TestSuite {
+public:
+	void test_priorities() {
+		const char *const lowMembers[] = { "a.txt", "b.txt", nullptr };
+		const char *const highMembers[] = { "B.TXT", "c.txt", nullptr };
+		const char *const plainMembers[] = { "a.txt", "d.txt", nullptr };
+
+		Common::SearchSet set;
+		set.add("low", new NamedMembersArchive("low", lowMembers), 1, true, true);
+		set.add("high", new NamedMembersArchive("high", highMembers), 3, true, true);
+		set.add("plain", new NamedMembersArchive("plain", plainMembers), 2);
+
+		TS_ASSERT_EQUALS(readMember(set, "a.txt"), "plain");
+		TS_ASSERT_EQUALS(readMember(set, "b.txt"), "high");
+		TS_ASSERT_EQUALS(readMember(set, "C.txt"), "high");
+		TS_ASSERT_EQUALS(readMember(set, "d.txt"), "plain");
+		TS_ASSERT(set.hasFile("A.TXT"));
+		TS_ASSERT(!set.hasFile("e.txt"));
+		TS_ASSERT(set.getMember("b.txt"));
+		TS_ASSERT(!set.getMember("e.txt"));
+
+		set.setPriority("low", 4);
+		TS_ASSERT_EQUALS(readMember(set, "a.txt"), "low");
+		TS_ASSERT_EQUALS(readMember(set, "b.txt"), "low");
+
+		set.remove("low");
+		TS_ASSERT_EQUALS(readMember(set, "a.txt"), "plain");
+		TS_ASSERT_EQUALS(readMember(set, "b.txt"), "high");
+
+		set.add("new", new NamedMembersArchive("new", lowMembers), 5, true, true);
+		TS_ASSERT_EQUALS(readMember(set, "b.txt"), "new");
+	}
+
+	void test_indexed_archives_not_probed() {
+		const char *const members[] = { "a.txt", nullptr };
+		NamedMembersArchive *indexed = new NamedMembersArchive("indexed", members);
+		NamedMembersArchive *plain = new NamedMembersArchive("plain", members);
+
+		Common::SearchSet set;
+		set.add("indexed", indexed, 1, true, true);
+		set.add("plain", plain, 0);
+
+		TS_ASSERT(set.hasFile("a.txt"));
+		TS_ASSERT(!set.hasFile("b.txt"));
+		TS_ASSERT_EQUALS(readMember(set, "a.txt"), "indexed");
+		TS_ASSERT_EQUALS(indexed->_probes, 1);
+		TS_ASSERT_EQUALS(plain->_probes, 1);
+	}
+
+private:
+	static Common::String readMember(const Common::SearchSet &set, const char *name) {
+		Common::SeekableReadStream *stream = set.createReadStreamForMember(name);
+		if (!stream)
+			return Common::String();
+
+		char contents[16];
+		uint32 size = stream->read(contents, sizeof(contents));
+		delete stream;
+		return Common::String(contents, size);
+	}
+};
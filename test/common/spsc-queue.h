@@ -0,0 +1,70 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/spsc-queue.h"
+
+class SPSCQueueTestSuite : public CxxTest::TestSuite {
+public:
+	void test_push_pop() {
+		Common::SPSCQueue<int, 4> queue;
+		int item;
+		TS_ASSERT(queue.empty());
+		TS_ASSERT(!queue.pop(item));
+		TS_ASSERT(queue.front() == nullptr);
+
+		TS_ASSERT(queue.push(1));
+		TS_ASSERT(queue.push(2));
+		TS_ASSERT(!queue.empty());
+		TS_ASSERT_EQUALS(*queue.front(), 1);
+
+		TS_ASSERT(queue.pop(item));
+		TS_ASSERT_EQUALS(item, 1);
+		TS_ASSERT_EQUALS(*queue.front(), 2);
+		queue.pop();
+		TS_ASSERT(queue.empty());
+	}
+
+	void test_full() {
+		Common::SPSCQueue<int, 4> queue;
+		for (int i = 0; i < 4; i++)
+			TS_ASSERT(queue.push(i));
+		TS_ASSERT(!queue.push(4));
+
+		int item;
+		TS_ASSERT(queue.pop(item));
+		TS_ASSERT_EQUALS(item, 0);
+		TS_ASSERT(queue.push(4));
+		TS_ASSERT(!queue.push(5));
+
+		for (int i = 1; i <= 4; i++) {
+			TS_ASSERT(queue.pop(item));
+			TS_ASSERT_EQUALS(item, i);
+		}
+		TS_ASSERT(queue.empty());
+	}
+
+	void test_wrap_around() {
+		Common::SPSCQueue<int, 4> queue;
+		int item;
+		for (int i = 0; i < 100; i++) {
+			TS_ASSERT(queue.push(i));
+			TS_ASSERT(queue.push(-i));
+			TS_ASSERT(queue.pop(item));
+			TS_ASSERT_EQUALS(item, i);
+			TS_ASSERT(queue.pop(item));
+			TS_ASSERT_EQUALS(item, -i);
+		}
+		TS_ASSERT(queue.empty());
+	}
+
+	void test_has_popped() {
+		Common::SPSCQueue<int, 4> queue;
+		TS_ASSERT(queue.push(1));
+		uint32 writePos = queue.getWritePos();
+		TS_ASSERT(!queue.hasPopped(writePos));
+
+		TS_ASSERT(queue.push(2));
+		queue.pop();
+		TS_ASSERT(queue.hasPopped(writePos));
+		TS_ASSERT(!queue.hasPopped(queue.getWritePos()));
+	}
+};
@@ -0,0 +1,115 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/surface.h"
+#include "graphics/yuv_to_rgb.h"
+
+/**
+ * Checks that the SIMD backends the CPU supports give the same pixels as the
+ * lookup tables.
+ */
+class YUVToRGBTestSuite : public CxxTest::TestSuite {
+public:
+	void test_convert444() {
+		compareBackends(kConvert444);
+	}
+
+	void test_convert420() {
+		compareBackends(kConvert420);
+	}
+
+	void test_convert420Alpha() {
+		compareBackends(kConvert420Alpha);
+	}
+
+	void test_convert410() {
+		compareBackends(kConvert410);
+	}
+
+private:
+	enum Conversion {
+		kConvert444,
+		kConvert420,
+		kConvert420Alpha,
+		kConvert410
+	};
+
+	enum {
+		// Not a multiple of the number of pixels the backends convert at once
+		kWidth = 76,
+		kHeight = 12,
+		kPitch = 80,
+		kPlaneSize = kPitch * kHeight
+	};
+
+	void compareBackends(Conversion conversion) {
+		const Graphics::PixelFormat formats[] = {
+			Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0),
+			Graphics::PixelFormat(2, 5, 5, 5, 1, 10, 5, 0, 15),
+			Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0),
+			Graphics::PixelFormat(4, 8, 8, 8, 0, 16, 8, 0, 0)
+		};
+		const Graphics::YUVToRGBManager::LuminanceScale scales[] = {
+			Graphics::YUVToRGBManager::kScaleFull,
+			Graphics::YUVToRGBManager::kScaleITU
+		};
+		const Graphics::YUVToRGBManager::Backend backends[] = {
+			Graphics::YUVToRGBManager::kBackendSSE2,
+			Graphics::YUVToRGBManager::kBackendAVX2,
+			Graphics::YUVToRGBManager::kBackendNEON
+		};
+
+		// Pseudo random planes, covering the whole range of the components
+		byte planes[4][kPlaneSize];
+		uint32 seed = 12345;
+		for (int i = 0; i < 4; i++) {
+			for (int j = 0; j < kPlaneSize; j++) {
+				seed = seed * 1103515245 + 12345;
+				planes[i][j] = seed >> 16;
+			}
+		}
+
+		Graphics::YUVToRGBManager::Backend previous = YUVToRGBMan.getBackend();
+
+		for (int f = 0; f < ARRAYSIZE(formats); f++) {
+			for (int s = 0; s < ARRAYSIZE(scales); s++) {
+				Graphics::Surface reference;
+				reference.create(kWidth, kHeight, formats[f]);
+				TS_ASSERT(YUVToRGBMan.setBackend(Graphics::YUVToRGBManager::kBackendLookup));
+				convert(conversion, &reference, scales[s], planes);
+
+				for (int b = 0; b < ARRAYSIZE(backends); b++) {
+					if (!YUVToRGBMan.setBackend(backends[b]))
+						continue;
+
+					Graphics::Surface surface;
+					surface.create(kWidth, kHeight, formats[f]);
+					convert(conversion, &surface, scales[s], planes);
+					TS_ASSERT_SAME_DATA(surface.getPixels(), reference.getPixels(), kHeight * reference.pitch);
+					surface.free();
+				}
+
+				reference.free();
+			}
+		}
+
+		YUVToRGBMan.setBackend(previous);
+	}
+
+	void convert(Conversion conversion, Graphics::Surface *dst, Graphics::YUVToRGBManager::LuminanceScale scale, byte planes[4][kPlaneSize]) {
+		switch (conversion) {
+		case kConvert444:
+			YUVToRGBMan.convert444(dst, scale, planes[0], planes[1], planes[2], kWidth, kHeight, kPitch, kPitch);
+			break;
+		case kConvert420:
+			YUVToRGBMan.convert420(dst, scale, planes[0], planes[1], planes[2], kWidth, kHeight, kPitch, kPitch / 2);
+			break;
+		case kConvert420Alpha:
+			YUVToRGBMan.convert420Alpha(dst, scale, planes[0], planes[1], planes[2], planes[3], kWidth, kHeight, kPitch, kPitch / 2);
+			break;
+		case kConvert410:
+			// The chroma planes have an extra row and column
+			YUVToRGBMan.convert410(dst, scale, planes[0], planes[1], planes[2], kWidth, kHeight, kPitch, kPitch / 4);
+			break;
+		}
+	}
+};
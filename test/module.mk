@@ -5,8 +5,8 @@
 #
 ######################################################################
 
-TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/audio/*.h $(srcdir)/test/math/*.h
-TEST_LIBS    := audio/libaudio.a math/libmath.a common/libcommon.a
+TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/audio/*.h $(srcdir)/test/math/*.h $(srcdir)/test/graphics/*.h
+TEST_LIBS    := audio/libaudio.a math/libmath.a graphics/libgraphics.a common/libcommon.a
 
 ifeq ($(ENABLE_WINTERMUTE), STATIC_PLUGIN)
 	TESTS += $(srcdir)/test/engines/wintermute/*.h
@@ -51,8 +51,40 @@ test/runner.cpp: $(TESTS)
 	@mkdir -p test
 	$(srcdir)/test/cxxtest/cxxtestgen.py $(TEST_FLAGS) -o $@ $+
 
+######################################################################
+# Benchmarks, based on CxxTest as well, reporting their timings as traces.
+# They are kept out of the tests since they take a while to run.
+# Use the 'benchmark' target to run them.
+######################################################################
+
+BENCHMARKS      := $(srcdir)/test/benchmark/mixer.h $(srcdir)/test/benchmark/tinygl.h
+BENCHMARK_LIBS  := audio/libaudio.a graphics/libgraphics.a common/libcommon.a
+BENCHMARK_CFLAGS :=
+BENCHMARK_OBJS  :=
+BENCHMARK_DEPS  :=
+
+# The Wintermute benchmark creates the game objects, which need the whole
+# engine, linked like the executable, and wintermute.zip from the sources.
+ifeq ($(ENABLE_WINTERMUTE), STATIC_PLUGIN)
+ifdef POSIX
+	BENCHMARKS += $(srcdir)/test/benchmark/wintermute.h
+	BENCHMARK_CFLAGS += -DBENCHMARK_ENGINE_DATA=\"$(srcdir)/dists/engine-data\"
+	# Expanded when linking, after all the modules added their objects
+	BENCHMARK_OBJS = $(DETECT_OBJS) $(OBJS)
+	BENCHMARK_DEPS += $(EXECUTABLE)
+endif
+endif
+
+benchmark: test/benchmark_runner
+	./test/benchmark_runner
+test/benchmark_runner: test/benchmark_runner.cpp $(BENCHMARK_LIBS) | $(BENCHMARK_DEPS)
+	$(QUIET_CXX)$(CXX) $(TEST_CXXFLAGS) $(CPPFLAGS) $(TEST_CFLAGS) $(BENCHMARK_CFLAGS) -o $@ $+ $(BENCHMARK_OBJS) $(TEST_LDFLAGS)
+test/benchmark_runner.cpp: $(BENCHMARKS)
+	@mkdir -p test
+	$(srcdir)/test/cxxtest/cxxtestgen.py $(TEST_FLAGS) -o $@ $+
+
 clean: clean-test
 clean-test:
-	-$(RM) test/runner.cpp test/runner
+	-$(RM) test/runner.cpp test/runner test/benchmark_runner.cpp test/benchmark_runner
 
-.PHONY: test clean-test
+.PHONY: test benchmark clean-test
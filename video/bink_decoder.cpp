@@ -36,6 +36,8 @@
 #include "common/str.h"
 #include "common/bitstream.h"
 #include "common/huffman.h"
+#include "common/jobs.h"
+#include "common/memstream.h"
 #include "common/rdft.h"
 #include "common/dct.h"
 #include "common/system.h"
@@ -200,16 +202,20 @@ void BinkDecoder::readNextPacket() {
 		}
 	}
 
-	uint32 videoPacketStart = _bink->pos();
-	uint32 videoPacketEnd   = _bink->pos() + frameSize;
+	// The packet is read at once, so that its planes can be decoded concurrently
+	byte *videoPacket = new byte[frameSize];
+	if (_bink->read(videoPacket, frameSize) != frameSize)
+		error("Could not read the video packet");
 
-	frame.bits = new Common::BitStream32LELSB(new Common::SeekableSubReadStream(_bink,
-			videoPacketStart, videoPacketEnd), DisposeAfterUse::YES);
+	frame.data = videoPacket;
+	frame.bits = new Common::BitStream32LELSB(new Common::MemoryReadStream(videoPacket, frameSize), DisposeAfterUse::YES);
 
 	videoTrack->decodePacket(frame);
 
 	delete frame.bits;
 	frame.bits = 0;
+	frame.data = 0;
+	delete[] videoPacket;
 }
 
 VideoDecoder::AudioTrack *BinkDecoder::getAudioTrack(int index) {
@@ -222,7 +228,7 @@ VideoDecoder::AudioTrack *BinkDecoder::getAudioTrack(int index) {
 	return (AudioTrack *)track;
 }
 
-BinkDecoder::VideoFrame::VideoFrame() : bits(0) {
+BinkDecoder::VideoFrame::VideoFrame() : bits(0), data(0) {
 }
 
 BinkDecoder::VideoFrame::~VideoFrame() {
@@ -245,27 +251,34 @@ BinkDecoder::AudioInfo::~AudioInfo() {
 BinkDecoder::BinkVideoTrack::BinkVideoTrack(uint32 width, uint32 height, const Graphics::PixelFormat &format, uint32 frameCount, const Common::Rational &frameRate, bool swapPlanes, bool hasAlpha, uint32 id) :
 		_frameCount(frameCount), _frameRate(frameRate), _swapPlanes(swapPlanes), _hasAlpha(hasAlpha), _id(id) {
 	_curFrame = -1;
+	_chromaOffset = kChromaOffsetUnknown;
 
 	for (int i = 0; i < 16; i++)
 		_huffman[i] = 0;
 
-	for (int i = 0; i < kSourceMAX; i++) {
-		_bundles[i].countLength = 0;
+	for (int s = 0; s < ARRAYSIZE(_planeStates); s++) {
+		PlaneState &state = _planeStates[s];
 
-		_bundles[i].huffman.index = 0;
-		for (int j = 0; j < 16; j++)
-			_bundles[i].huffman.symbols[j] = j;
+		for (int i = 0; i < kSourceMAX; i++) {
+			state.bundles[i].countLength = 0;
 
-		_bundles[i].data     = 0;
-		_bundles[i].dataEnd  = 0;
-		_bundles[i].curDec   = 0;
-		_bundles[i].curPtr   = 0;
-	}
+			state.bundles[i].huffman.index = 0;
+			for (int j = 0; j < 16; j++)
+				state.bundles[i].huffman.symbols[j] = j;
 
-	for (int i = 0; i < 16; i++) {
-		_colHighHuffman[i].index = 0;
-		for (int j = 0; j < 16; j++)
-			_colHighHuffman[i].symbols[j] = j;
+			state.bundles[i].data     = 0;
+			state.bundles[i].dataEnd  = 0;
+			state.bundles[i].curDec   = 0;
+			state.bundles[i].curPtr   = 0;
+		}
+
+		for (int i = 0; i < 16; i++) {
+			state.colHighHuffman[i].index = 0;
+			for (int j = 0; j < 16; j++)
+				state.colHighHuffman[i].symbols[j] = j;
+		}
+
+		state.colLastVal = 0;
 	}
 
 	// Make the surface even-sized:
@@ -477,19 +490,40 @@ void BinkDecoder::BinkVideoTrack::decodePacket(VideoFrame &frame) {
 		if (_id == kBIKiID)
 			frame.bits->skip(32);
 
-		decodePlane(frame, 3, false);
+		decodePlane(frame, _planeStates[0], 3, false);
 	}
 
+	// Since 'i', the luma plane is preceded by the offset of the chroma planes,
+	// which allows decoding them at the same time. Its origin isn't documented,
+	// so it is found by checking the possible ones against the planes decoded
+	// one after another.
+	uint32 fieldPos = frame.bits->pos();
+	uint32 chromaOffset = 0;
 	if (_id == kBIKiID)
-		frame.bits->skip(32);
+		chromaOffset = frame.bits->getBits(32);
 
-	for (int i = 0; i < 3; i++) {
-		int planeIdx = ((i == 0) || !_swapPlanes) ? i : (i ^ 3);
+	uint32 chromaStart = getChromaStart(_chromaOffset, fieldPos, chromaOffset, frame.bits->size());
+	if (chromaStart != 0 && g_system->getCPUCount() > 1) {
+		decodePlanesConcurrently(frame, chromaStart);
+	} else {
+		for (int i = 0; i < 3; i++) {
+			int planeIdx = ((i == 0) || !_swapPlanes) ? i : (i ^ 3);
 
-		decodePlane(frame, planeIdx, i != 0);
+			decodePlane(frame, _planeStates[0], planeIdx, i != 0);
 
-		if (frame.bits->pos() >= frame.bits->size())
-			break;
+			if (_chromaOffset == kChromaOffsetUnknown && _id == kBIKiID && i == 0) {
+				_chromaOffset = kChromaOffsetInvalid;
+				for (int offset = kChromaOffsetPacket; offset < kChromaOffsetInvalid; offset++) {
+					if (getChromaStart((ChromaOffset)offset, fieldPos, chromaOffset, frame.bits->size()) == frame.bits->pos()) {
+						_chromaOffset = (ChromaOffset)offset;
+						break;
+					}
+				}
+			}
+
+			if (frame.bits->pos() >= frame.bits->size())
+				break;
+		}
 	}
 
 	// Convert the YUV data we have to our format
@@ -512,7 +546,74 @@ void BinkDecoder::BinkVideoTrack::decodePacket(VideoFrame &frame) {
 	_curFrame++;
 }
 
-void BinkDecoder::BinkVideoTrack::decodePlane(VideoFrame &video, int planeIdx, bool isChroma) {
+uint32 BinkDecoder::BinkVideoTrack::getChromaStart(ChromaOffset chromaOffset, uint32 fieldPos, uint32 offset, uint32 size) const {
+	uint32 start;
+	switch (chromaOffset) {
+	case kChromaOffsetPacket:
+		start = offset * 8;
+		break;
+	case kChromaOffsetField:
+		start = fieldPos + offset * 8;
+		break;
+	case kChromaOffsetLuma:
+		start = fieldPos + 32 + offset * 8;
+		break;
+	default:
+		return 0;
+	}
+
+	// The planes start at 32-bit boundaries, after the luma plane
+	if (offset == 0 || (start & 0x1F) || start <= fieldPos + 32 || start >= size)
+		return 0;
+
+	return start;
+}
+
+void BinkDecoder::BinkVideoTrack::decodePlanesConcurrently(VideoFrame &frame, uint32 chromaStart) {
+	VideoFrame chroma;
+	chroma.data = frame.data;
+	chroma.bits = new Common::BitStream32LELSB(new Common::MemoryReadStream(frame.data + chromaStart / 8,
+			(frame.bits->size() - chromaStart) / 8), DisposeAfterUse::YES);
+
+	PlaneJob jobs[2];
+	jobs[0].track = this;
+	jobs[0].video = &frame;
+	jobs[0].state = &_planeStates[0];
+	jobs[0].planeIdx[0] = 0;
+	jobs[0].planeIdx[1] = -1;
+	jobs[0].isChroma = false;
+	jobs[1].track = this;
+	jobs[1].video = &chroma;
+	jobs[1].state = &_planeStates[1];
+	jobs[1].planeIdx[0] = _swapPlanes ? 2 : 1;
+	jobs[1].planeIdx[1] = _swapPlanes ? 1 : 2;
+	jobs[1].isChroma = true;
+
+	void *params[2] = { &jobs[0], &jobs[1] };
+	Common::runJobs(decodePlaneJob, params, 2);
+
+	if (frame.bits->pos() != chromaStart) {
+		// The chroma planes didn't start where expected, decode them again after the luma plane
+		warning("Bink chroma planes at an unexpected position, decoding the planes one after another");
+		_chromaOffset = kChromaOffsetInvalid;
+
+		for (int i = 1; i < 3 && frame.bits->pos() < frame.bits->size(); i++)
+			decodePlane(frame, _planeStates[0], jobs[1].planeIdx[i - 1], true);
+	}
+}
+
+void BinkDecoder::BinkVideoTrack::decodePlaneJob(void *param) {
+	PlaneJob *job = (PlaneJob *)param;
+
+	for (int i = 0; i < 2 && job->planeIdx[i] >= 0; i++) {
+		if (job->video->bits->pos() >= job->video->bits->size())
+			break;
+
+		job->track->decodePlane(*job->video, *job->state, job->planeIdx[i], job->isChroma);
+	}
+}
+
+void BinkDecoder::BinkVideoTrack::decodePlane(VideoFrame &video, PlaneState &state, int planeIdx, bool isChroma) {
 	uint32 blockWidth  = isChroma ? _uvBlockWidth  : _yBlockWidth;
 	uint32 blockHeight = isChroma ? _uvBlockHeight : _yBlockHeight;
 	uint32 width       = blockWidth  * 8;
@@ -521,6 +622,7 @@ void BinkDecoder::BinkVideoTrack::decodePlane(VideoFrame &video, int planeIdx, b
 	DecodeContext ctx;
 
 	ctx.video     = &video;
+	ctx.state     = &state;
 	ctx.planeIdx  = planeIdx;
 	ctx.destStart = _curPlanes[planeIdx];
 	ctx.destEnd   = _curPlanes[planeIdx] + width * height;
@@ -538,27 +640,27 @@ void BinkDecoder::BinkVideoTrack::decodePlane(VideoFrame &video, int planeIdx, b
 	}
 
 	for (int i = 0; i < kSourceMAX; i++) {
-		_bundles[i].countLength = _bundles[i].countLengths[isChroma ? 1 : 0];
+		state.bundles[i].countLength = state.bundles[i].countLengths[isChroma ? 1 : 0];
 
-		readBundle(video, (Source) i);
+		readBundle(video, state, (Source) i);
 	}
 
 	for (ctx.blockY = 0; ctx.blockY < blockHeight; ctx.blockY++) {
-		readBlockTypes  (video, _bundles[kSourceBlockTypes]);
-		readBlockTypes  (video, _bundles[kSourceSubBlockTypes]);
-		readColors      (video, _bundles[kSourceColors]);
-		readPatterns    (video, _bundles[kSourcePattern]);
-		readMotionValues(video, _bundles[kSourceXOff]);
-		readMotionValues(video, _bundles[kSourceYOff]);
-		readDCS         (video, _bundles[kSourceIntraDC], kDCStartBits, false);
-		readDCS         (video, _bundles[kSourceInterDC], kDCStartBits, true);
-		readRuns        (video, _bundles[kSourceRun]);
+		readBlockTypes  (video, state.bundles[kSourceBlockTypes]);
+		readBlockTypes  (video, state.bundles[kSourceSubBlockTypes]);
+		readColors      (video, state);
+		readPatterns    (video, state.bundles[kSourcePattern]);
+		readMotionValues(video, state.bundles[kSourceXOff]);
+		readMotionValues(video, state.bundles[kSourceYOff]);
+		readDCS         (video, state.bundles[kSourceIntraDC], kDCStartBits, false);
+		readDCS         (video, state.bundles[kSourceInterDC], kDCStartBits, true);
+		readRuns        (video, state.bundles[kSourceRun]);
 
 		ctx.dest = ctx.destStart + 8 * ctx.blockY * ctx.pitch;
 		ctx.prev = ctx.prevStart + 8 * ctx.blockY * ctx.pitch;
 
 		for (ctx.blockX = 0; ctx.blockX < blockWidth; ctx.blockX++, ctx.dest += 8, ctx.prev += 8) {
-			BlockType blockType = (BlockType) getBundleValue(kSourceBlockTypes);
+			BlockType blockType = (BlockType) getBundleValue(ctx, kSourceBlockTypes);
 
 			// 16x16 block type on odd line means part of the already decoded block, so skip it
 			if ((ctx.blockY & 1) && (blockType == kBlockScaled)) {
@@ -612,19 +714,19 @@ void BinkDecoder::BinkVideoTrack::decodePlane(VideoFrame &video, int planeIdx, b
 
 }
 
-void BinkDecoder::BinkVideoTrack::readBundle(VideoFrame &video, Source source) {
+void BinkDecoder::BinkVideoTrack::readBundle(VideoFrame &video, PlaneState &state, Source source) {
 	if (source == kSourceColors) {
 		for (int i = 0; i < 16; i++)
-			readHuffman(video, _colHighHuffman[i]);
+			readHuffman(video, state.colHighHuffman[i]);
 
-		_colLastVal = 0;
+		state.colLastVal = 0;
 	}
 
 	if ((source != kSourceIntraDC) && (source != kSourceInterDC))
-		readHuffman(video, _bundles[source].huffman);
+		readHuffman(video, state.bundles[source].huffman);
 
-	_bundles[source].curDec = _bundles[source].data;
-	_bundles[source].curPtr = _bundles[source].data;
+	state.bundles[source].curDec = state.bundles[source].data;
+	state.bundles[source].curPtr = state.bundles[source].data;
 }
 
 void BinkDecoder::BinkVideoTrack::readHuffman(VideoFrame &video, Huffman &huffman) {
@@ -706,33 +808,40 @@ void BinkDecoder::BinkVideoTrack::initBundles() {
 	uint32 bh     = (_surface.h + 7) >> 3;
 	uint32 blocks = bw * bh;
 
-	for (int i = 0; i < kSourceMAX; i++) {
-		_bundles[i].data    = new byte[blocks * 64];
-		_bundles[i].dataEnd = _bundles[i].data + blocks * 64;
+	for (int s = 0; s < ARRAYSIZE(_planeStates); s++) {
+		for (int i = 0; i < kSourceMAX; i++) {
+			_planeStates[s].bundles[i].data    = new byte[blocks * 64];
+			_planeStates[s].bundles[i].dataEnd = _planeStates[s].bundles[i].data + blocks * 64;
+		}
 	}
 
 	uint32 cbw[2] = { (uint32)((_surface.w + 7) >> 3), (uint32)((_surface.w  + 15) >> 4) };
 	uint32 cw [2] = { (uint32)( _surface.w          ), (uint32)( _surface.w        >> 1) };
 
 	// Calculate the lengths of an element count in bits
-	for (int i = 0; i < 2; i++) {
-		int width = MAX<uint32>(cw[i], 8);
-
-		_bundles[kSourceBlockTypes   ].countLengths[i] = Common::intLog2((width       >> 3) + 511) + 1;
-		_bundles[kSourceSubBlockTypes].countLengths[i] = Common::intLog2(((width + 7) >> 4) + 511) + 1;
-		_bundles[kSourceColors       ].countLengths[i] = Common::intLog2((cbw[i])     * 64  + 511) + 1;
-		_bundles[kSourceIntraDC      ].countLengths[i] = Common::intLog2((width       >> 3) + 511) + 1;
-		_bundles[kSourceInterDC      ].countLengths[i] = Common::intLog2((width       >> 3) + 511) + 1;
-		_bundles[kSourceXOff         ].countLengths[i] = Common::intLog2((width       >> 3) + 511) + 1;
-		_bundles[kSourceYOff         ].countLengths[i] = Common::intLog2((width       >> 3) + 511) + 1;
-		_bundles[kSourcePattern      ].countLengths[i] = Common::intLog2((cbw[i]      << 3) + 511) + 1;
-		_bundles[kSourceRun          ].countLengths[i] = Common::intLog2((cbw[i])     * 48  + 511) + 1;
+	for (int s = 0; s < ARRAYSIZE(_planeStates); s++) {
+		Bundle *bundles = _planeStates[s].bundles;
+
+		for (int i = 0; i < 2; i++) {
+			int width = MAX<uint32>(cw[i], 8);
+
+			bundles[kSourceBlockTypes   ].countLengths[i] = Common::intLog2((width       >> 3) + 511) + 1;
+			bundles[kSourceSubBlockTypes].countLengths[i] = Common::intLog2(((width + 7) >> 4) + 511) + 1;
+			bundles[kSourceColors       ].countLengths[i] = Common::intLog2((cbw[i])     * 64  + 511) + 1;
+			bundles[kSourceIntraDC      ].countLengths[i] = Common::intLog2((width       >> 3) + 511) + 1;
+			bundles[kSourceInterDC      ].countLengths[i] = Common::intLog2((width       >> 3) + 511) + 1;
+			bundles[kSourceXOff         ].countLengths[i] = Common::intLog2((width       >> 3) + 511) + 1;
+			bundles[kSourceYOff         ].countLengths[i] = Common::intLog2((width       >> 3) + 511) + 1;
+			bundles[kSourcePattern      ].countLengths[i] = Common::intLog2((cbw[i]      << 3) + 511) + 1;
+			bundles[kSourceRun          ].countLengths[i] = Common::intLog2((cbw[i])     * 48  + 511) + 1;
+		}
 	}
 }
 
 void BinkDecoder::BinkVideoTrack::deinitBundles() {
-	for (int i = 0; i < kSourceMAX; i++)
-		delete[] _bundles[i].data;
+	for (int s = 0; s < ARRAYSIZE(_planeStates); s++)
+		for (int i = 0; i < kSourceMAX; i++)
+			delete[] _planeStates[s].bundles[i].data;
 }
 
 void BinkDecoder::BinkVideoTrack::initHuffman() {
@@ -744,16 +853,18 @@ byte BinkDecoder::BinkVideoTrack::getHuffmanSymbol(VideoFrame &video, Huffman &h
 	return huffman.symbols[_huffman[huffman.index]->getSymbol(*video.bits)];
 }
 
-int32 BinkDecoder::BinkVideoTrack::getBundleValue(Source source) {
+int32 BinkDecoder::BinkVideoTrack::getBundleValue(DecodeContext &ctx, Source source) {
+	Bundle &bundle = ctx.state->bundles[source];
+
 	if ((source < kSourceXOff) || (source == kSourceRun))
-		return *_bundles[source].curPtr++;
+		return *bundle.curPtr++;
 
 	if ((source == kSourceXOff) || (source == kSourceYOff))
-		return (int8) *_bundles[source].curPtr++;
+		return (int8) *bundle.curPtr++;
 
-	int16 ret = *((int16 *) _bundles[source].curPtr);
+	int16 ret = *((int16 *) bundle.curPtr);
 
-	_bundles[source].curPtr += 2;
+	bundle.curPtr += 2;
 
 	return ret;
 }
@@ -790,7 +901,7 @@ void BinkDecoder::BinkVideoTrack::blockScaledRun(DecodeContext &ctx) {
 
 	int i = 0;
 	do {
-		int run = getBundleValue(kSourceRun) + 1;
+		int run = getBundleValue(ctx, kSourceRun) + 1;
 
 		i += run;
 		if (i > 64)
@@ -798,7 +909,7 @@ void BinkDecoder::BinkVideoTrack::blockScaledRun(DecodeContext &ctx) {
 
 		if (ctx.video->bits->getBit()) {
 
-			byte v = getBundleValue(kSourceColors);
+			byte v = getBundleValue(ctx, kSourceColors);
 			for (int j = 0; j < run; j++, scan++)
 				ctx.dest[ctx.coordScaledMap1[*scan]] =
 				ctx.dest[ctx.coordScaledMap2[*scan]] =
@@ -810,7 +921,7 @@ void BinkDecoder::BinkVideoTrack::blockScaledRun(DecodeContext &ctx) {
 				ctx.dest[ctx.coordScaledMap1[*scan]] =
 				ctx.dest[ctx.coordScaledMap2[*scan]] =
 				ctx.dest[ctx.coordScaledMap3[*scan]] =
-				ctx.dest[ctx.coordScaledMap4[*scan]] = getBundleValue(kSourceColors);
+				ctx.dest[ctx.coordScaledMap4[*scan]] = getBundleValue(ctx, kSourceColors);
 
 	} while (i < 63);
 
@@ -818,14 +929,14 @@ void BinkDecoder::BinkVideoTrack::blockScaledRun(DecodeContext &ctx) {
 		ctx.dest[ctx.coordScaledMap1[*scan]] =
 		ctx.dest[ctx.coordScaledMap2[*scan]] =
 		ctx.dest[ctx.coordScaledMap3[*scan]] =
-		ctx.dest[ctx.coordScaledMap4[*scan]] = getBundleValue(kSourceColors);
+		ctx.dest[ctx.coordScaledMap4[*scan]] = getBundleValue(ctx, kSourceColors);
 }
 
 void BinkDecoder::BinkVideoTrack::blockScaledIntra(DecodeContext &ctx) {
 	int32 block[64];
 	memset(block, 0, 64 * sizeof(int32));
 
-	block[0] = getBundleValue(kSourceIntraDC);
+	block[0] = getBundleValue(ctx, kSourceIntraDC);
 
 	readDCTCoeffs(*ctx.video, block, true);
 
@@ -843,7 +954,7 @@ void BinkDecoder::BinkVideoTrack::blockScaledIntra(DecodeContext &ctx) {
 }
 
 void BinkDecoder::BinkVideoTrack::blockScaledFill(DecodeContext &ctx) {
-	byte v = getBundleValue(kSourceColors);
+	byte v = getBundleValue(ctx, kSourceColors);
 
 	byte *dest = ctx.dest;
 	for (int i = 0; i < 16; i++, dest += ctx.pitch)
@@ -854,12 +965,12 @@ void BinkDecoder::BinkVideoTrack::blockScaledPattern(DecodeContext &ctx) {
 	byte col[2];
 
 	for (int i = 0; i < 2; i++)
-		col[i] = getBundleValue(kSourceColors);
+		col[i] = getBundleValue(ctx, kSourceColors);
 
 	byte *dest1 = ctx.dest;
 	byte *dest2 = ctx.dest + ctx.pitch;
 	for (int j = 0; j < 8; j++, dest1 += (ctx.pitch << 1) - 16, dest2 += (ctx.pitch << 1) - 16) {
-		byte v = getBundleValue(kSourcePattern);
+		byte v = getBundleValue(ctx, kSourcePattern);
 
 		for (int i = 0; i < 8; i++, dest1 += 2, dest2 += 2, v >>= 1)
 			dest1[0] = dest1[1] = dest2[0] = dest2[1] = col[v & 1];
@@ -872,17 +983,17 @@ void BinkDecoder::BinkVideoTrack::blockScaledRaw(DecodeContext &ctx) {
 	byte *dest1 = ctx.dest;
 	byte *dest2 = ctx.dest + ctx.pitch;
 	for (int j = 0; j < 8; j++, dest1 += (ctx.pitch << 1) - 16, dest2 += (ctx.pitch << 1) - 16) {
-		memcpy(row, _bundles[kSourceColors].curPtr, 8);
+		memcpy(row, ctx.state->bundles[kSourceColors].curPtr, 8);
 
 		for (int i = 0; i < 8; i++, dest1 += 2, dest2 += 2)
 			dest1[0] = dest1[1] = dest2[0] = dest2[1] = row[i];
 
-		_bundles[kSourceColors].curPtr += 8;
+		ctx.state->bundles[kSourceColors].curPtr += 8;
 	}
 }
 
 void BinkDecoder::BinkVideoTrack::blockScaled(DecodeContext &ctx) {
-	BlockType blockType = (BlockType) getBundleValue(kSourceSubBlockTypes);
+	BlockType blockType = (BlockType) getBundleValue(ctx, kSourceSubBlockTypes);
 
 	switch (blockType) {
 	case kBlockRun:
@@ -910,8 +1021,8 @@ void BinkDecoder::BinkVideoTrack::blockScaled(DecodeContext &ctx) {
 }
 
 void BinkDecoder::BinkVideoTrack::blockMotion(DecodeContext &ctx) {
-	int8 xOff = getBundleValue(kSourceXOff);
-	int8 yOff = getBundleValue(kSourceYOff);
+	int8 xOff = getBundleValue(ctx, kSourceXOff);
+	int8 yOff = getBundleValue(ctx, kSourceYOff);
 
 	byte *dest = ctx.dest;
 	byte *prev = ctx.prev + yOff * ((int32) ctx.pitch) + xOff;
@@ -927,7 +1038,7 @@ void BinkDecoder::BinkVideoTrack::blockRun(DecodeContext &ctx) {
 
 	int i = 0;
 	do {
-		int run = getBundleValue(kSourceRun) + 1;
+		int run = getBundleValue(ctx, kSourceRun) + 1;
 
 		i += run;
 		if (i > 64)
@@ -935,18 +1046,18 @@ void BinkDecoder::BinkVideoTrack::blockRun(DecodeContext &ctx) {
 
 		if (ctx.video->bits->getBit()) {
 
-			byte v = getBundleValue(kSourceColors);
+			byte v = getBundleValue(ctx, kSourceColors);
 			for (int j = 0; j < run; j++)
 				ctx.dest[ctx.coordMap[*scan++]] = v;
 
 		} else
 			for (int j = 0; j < run; j++)
-				ctx.dest[ctx.coordMap[*scan++]] = getBundleValue(kSourceColors);
+				ctx.dest[ctx.coordMap[*scan++]] = getBundleValue(ctx, kSourceColors);
 
 	} while (i < 63);
 
 	if (i == 63)
-		ctx.dest[ctx.coordMap[*scan++]] = getBundleValue(kSourceColors);
+		ctx.dest[ctx.coordMap[*scan++]] = getBundleValue(ctx, kSourceColors);
 }
 
 void BinkDecoder::BinkVideoTrack::blockResidue(DecodeContext &ctx) {
@@ -970,7 +1081,7 @@ void BinkDecoder::BinkVideoTrack::blockIntra(DecodeContext &ctx) {
 	int32 block[64];
 	memset(block, 0, 64 * sizeof(int32));
 
-	block[0] = getBundleValue(kSourceIntraDC);
+	block[0] = getBundleValue(ctx, kSourceIntraDC);
 
 	readDCTCoeffs(*ctx.video, block, true);
 
@@ -978,7 +1089,7 @@ void BinkDecoder::BinkVideoTrack::blockIntra(DecodeContext &ctx) {
 }
 
 void BinkDecoder::BinkVideoTrack::blockFill(DecodeContext &ctx) {
-	byte v = getBundleValue(kSourceColors);
+	byte v = getBundleValue(ctx, kSourceColors);
 
 	byte *dest = ctx.dest;
 	for (int i = 0; i < 8; i++, dest += ctx.pitch)
@@ -991,7 +1102,7 @@ void BinkDecoder::BinkVideoTrack::blockInter(DecodeContext &ctx) {
 	int32 block[64];
 	memset(block, 0, 64 * sizeof(int32));
 
-	block[0] = getBundleValue(kSourceInterDC);
+	block[0] = getBundleValue(ctx, kSourceInterDC);
 
 	readDCTCoeffs(*ctx.video, block, false);
 
@@ -1002,11 +1113,11 @@ void BinkDecoder::BinkVideoTrack::blockPattern(DecodeContext &ctx) {
 	byte col[2];
 
 	for (int i = 0; i < 2; i++)
-		col[i] = getBundleValue(kSourceColors);
+		col[i] = getBundleValue(ctx, kSourceColors);
 
 	byte *dest = ctx.dest;
 	for (int i = 0; i < 8; i++, dest += ctx.pitch - 8) {
-		byte v = getBundleValue(kSourcePattern);
+		byte v = getBundleValue(ctx, kSourcePattern);
 
 		for (int j = 0; j < 8; j++, v >>= 1)
 			*dest++ = col[v & 1];
@@ -1015,11 +1126,11 @@ void BinkDecoder::BinkVideoTrack::blockPattern(DecodeContext &ctx) {
 
 void BinkDecoder::BinkVideoTrack::blockRaw(DecodeContext &ctx) {
 	byte *dest = ctx.dest;
-	byte *data = _bundles[kSourceColors].curPtr;
+	byte *data = ctx.state->bundles[kSourceColors].curPtr;
 	for (int i = 0; i < 8; i++, dest += ctx.pitch, data += 8)
 		memcpy(dest, data, 8);
 
-	_bundles[kSourceColors].curPtr += 64;
+	ctx.state->bundles[kSourceColors].curPtr += 64;
 }
 
 void BinkDecoder::BinkVideoTrack::readRuns(VideoFrame &video, Bundle &bundle) {
@@ -1134,7 +1245,9 @@ void BinkDecoder::BinkVideoTrack::readPatterns(VideoFrame &video, Bundle &bundle
 }
 
 
-void BinkDecoder::BinkVideoTrack::readColors(VideoFrame &video, Bundle &bundle) {
+void BinkDecoder::BinkVideoTrack::readColors(VideoFrame &video, PlaneState &state) {
+	Bundle &bundle = state.bundles[kSourceColors];
+
 	uint32 n = readBundleCount(video, bundle);
 	if (n == 0)
 		return;
@@ -1144,11 +1257,11 @@ void BinkDecoder::BinkVideoTrack::readColors(VideoFrame &video, Bundle &bundle)
 		error("Too many color values");
 
 	if (video.bits->getBit()) {
-		_colLastVal = getHuffmanSymbol(video, _colHighHuffman[_colLastVal]);
+		state.colLastVal = getHuffmanSymbol(video, state.colHighHuffman[state.colLastVal]);
 
 		byte v;
 		v = getHuffmanSymbol(video, bundle.huffman);
-		v = (_colLastVal << 4) | v;
+		v = (state.colLastVal << 4) | v;
 
 		if (_id != kBIKiID) {
 			int sign = ((int8) v) >> 7;
@@ -1163,11 +1276,11 @@ void BinkDecoder::BinkVideoTrack::readColors(VideoFrame &video, Bundle &bundle)
 	}
 
 	while (bundle.curDec < decEnd) {
-		_colLastVal = getHuffmanSymbol(video, _colHighHuffman[_colLastVal]);
+		state.colLastVal = getHuffmanSymbol(video, state.colHighHuffman[state.colLastVal]);
 
 		byte v;
 		v = getHuffmanSymbol(video, bundle.huffman);
-		v = (_colLastVal << 4) | v;
+		v = (state.colLastVal << 4) | v;
 
 		if (_id != kBIKiID) {
 			int sign = ((int8) v) >> 7;
@@ -139,6 +139,7 @@ private:
 		uint32 size;
 
 		Common::BitStream32LELSB *bits;
+		const byte *data; ///< The data of the video packet, while it is being decoded.
 
 		VideoFrame();
 		~VideoFrame();
@@ -166,9 +167,12 @@ private:
 		Common::Rational getFrameRate() const override { return _frameRate; }
 
 	private:
+		struct PlaneState;
+
 		/** A decoder state. */
 		struct DecodeContext {
 			VideoFrame *video;
+			PlaneState *state;
 
 			uint32 planeIdx;
 
@@ -239,6 +243,34 @@ private:
 			byte *curPtr; ///< Pointer to the data that wasn't yet read.
 		};
 
+		/** The state of the bitstream of a plane. Planes decoded concurrently each have their own. */
+		struct PlaneState {
+			Bundle bundles[kSourceMAX]; ///< Bundles for decoding all data types.
+
+			/** Huffman codebooks to use for decoding high nibbles in color data types. */
+			Huffman colHighHuffman[16];
+			/** Value of the last decoded high nibble in color data types. */
+			int colLastVal;
+		};
+
+		/** Where the chroma planes start, according to the field preceding the luma plane. */
+		enum ChromaOffset {
+			kChromaOffsetUnknown, ///< Not found yet, the planes are decoded one after another.
+			kChromaOffsetPacket,  ///< Bytes from the start of the video packet.
+			kChromaOffsetField,   ///< Bytes from the start of the field.
+			kChromaOffsetLuma,    ///< Bytes from the start of the luma plane.
+			kChromaOffsetInvalid  ///< The field didn't match, don't look at it any more.
+		};
+
+		/** Consecutive planes to decode on a worker thread. */
+		struct PlaneJob {
+			BinkVideoTrack *track;
+			VideoFrame *video;
+			PlaneState *state;
+			int planeIdx[2];
+			bool isChroma;
+		};
+
 		int _curFrame;
 		int _frameCount;
 
@@ -253,15 +285,12 @@ private:
 
 		Common::Rational _frameRate;
 
-		Bundle _bundles[kSourceMAX]; ///< Bundles for decoding all data types.
+		/** States for decoding the luma and the chroma planes at the same time. */
+		PlaneState _planeStates[2];
+		ChromaOffset _chromaOffset;
 
 		Common::Huffman<Common::BitStream32LELSB> *_huffman[16]; ///< The 16 Huffman codebooks used in Bink decoding.
 
-		/** Huffman codebooks to use for decoding high nibbles in color data types. */
-		Huffman _colHighHuffman[16];
-		/** Value of the last decoded high nibble in color data types. */
-		int _colLastVal;
-
 		uint32 _yBlockWidth;   ///< Width of the Y plane in blocks
 		uint32 _yBlockHeight;  ///< Height of the Y plane in blocks
 		uint32 _uvBlockWidth;  ///< Width of the U and V planes in blocks
@@ -279,10 +308,15 @@ private:
 		void initHuffman();
 
 		/** Decode a plane. */
-		void decodePlane(VideoFrame &video, int planeIdx, bool isChroma);
+		void decodePlane(VideoFrame &video, PlaneState &state, int planeIdx, bool isChroma);
+		/** Decode the luma and the chroma planes concurrently, with the chroma planes starting at the given bit. */
+		void decodePlanesConcurrently(VideoFrame &frame, uint32 chromaStart);
+		static void decodePlaneJob(void *param);
+		/** Get the bit the chroma planes start at according to the field at the given bit, or 0 if it isn't valid. */
+		uint32 getChromaStart(ChromaOffset chromaOffset, uint32 fieldPos, uint32 offset, uint32 size) const;
 
 		/** Read/Initialize a bundle for decoding a plane. */
-		void readBundle(VideoFrame &video, Source source);
+		void readBundle(VideoFrame &video, PlaneState &state, Source source);
 
 		/** Read the symbols for a Huffman code. */
 		void readHuffman(VideoFrame &video, Huffman &huffman);
@@ -293,7 +327,7 @@ private:
 		byte getHuffmanSymbol(VideoFrame &video, Huffman &huffman);
 
 		/** Get a direct value out of a bundle. */
-		int32 getBundleValue(Source source);
+		int32 getBundleValue(DecodeContext &ctx, Source source);
 		/** Read a count value out of a bundle. */
 		uint32 readBundleCount(VideoFrame &video, Bundle &bundle);
 
@@ -320,7 +354,7 @@ private:
 		void readMotionValues(VideoFrame &video, Bundle &bundle);
 		void readBlockTypes  (VideoFrame &video, Bundle &bundle);
 		void readPatterns    (VideoFrame &video, Bundle &bundle);
-		void readColors      (VideoFrame &video, Bundle &bundle);
+		void readColors      (VideoFrame &video, PlaneState &state);
 		void readDCS         (VideoFrame &video, Bundle &bundle, int startBits, bool hasSign);
 		void readDCTCoeffs   (VideoFrame &video, int32 *block, bool isIntra);
 		void readResidue     (VideoFrame &video, int16 *block, int masksCount);